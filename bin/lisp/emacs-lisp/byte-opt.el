@@ -1822,8 +1822,8 @@ See Info node `(elisp) Integer Basics'."
          previous-single-char-property-change previous-single-property-change
          text-properties-at text-property-any text-property-not-all
          ;; thread.c
-         all-threads condition-mutex condition-name mutex-name thread-live-p
-         thread-name
+         all-threads channel-length channel-name condition-mutex
+         condition-name mutex-name thread-live-p thread-name
          ;; timefns.c
          current-cpu-time
          current-time-string current-time-zone decode-time encode-time
@@ -1866,7 +1866,7 @@ See Info node `(elisp) Integer Basics'."
          ;; data.c
          arrayp atom bare-symbol-p bool-vector-p bufferp byte-code-function-p
          interpreted-function-p closurep
-         byteorder car-safe cdr-safe char-or-string-p char-table-p
+         byteorder car-safe cdr-safe channelp char-or-string-p char-table-p
          condition-variable-p consp eq floatp indirect-function
          integer-or-marker-p integerp keywordp listp markerp
          module-function-p multibyte-string-p mutexp native-comp-function-p
@@ -1953,9 +1953,10 @@ See Info node `(elisp) Integer Basics'."
          % * + - / /= 1+ 1- < <= = > >= aref arrayp ash atom bare-symbol
          bool-vector-count-consecutive bool-vector-count-population
          bool-vector-p bool-vector-subsetp
-         bufferp car car-safe cdr cdr-safe char-or-string-p char-table-p
-         condition-variable-p consp eq floatp integer-or-marker-p integerp
-         keywordp listp logand logcount logior lognot logxor markerp max min
+         bufferp car car-safe cdr cdr-safe channelp char-or-string-p
+         char-table-p condition-variable-p consp eq floatp
+         integer-or-marker-p integerp keywordp listp logand logcount logior
+         lognot logxor markerp max min
          mod multibyte-string-p mutexp natnump nlistp null number-or-marker-p
          numberp recordp remove-pos-from-symbol sequencep stringp symbol-name
          symbolp threadp type-of vector-or-char-table-p vectorp
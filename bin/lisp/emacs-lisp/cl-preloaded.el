@@ -373,6 +373,7 @@ regardless if `funcall' would accept to call them."
 (cl--define-built-in-type font-spec atom)
 (cl--define-built-in-type condvar atom)
 (cl--define-built-in-type mutex atom)
+(cl--define-built-in-type channel atom)
 (cl--define-built-in-type thread atom)
 (cl--define-built-in-type terminal atom)
 (cl--define-built-in-type hash-table atom)
@@ -1704,6 +1704,7 @@ static void allocate_string_data(struct Lisp_String* s, EMACS_INT nchars,
 #endif
     s->u.s.size = nchars;
     s->u.s.size_byte = nbytes;
+    s->u.s.hash = 0;
     s->u.s.data[nbytes] = '\0';
 #ifdef GC_CHECK_STRING_OVERRUN
     memcpy((char*)data + needed, string_overrun_cookie,
@@ -2906,6 +2907,9 @@ static void cleanup_vector(struct Lisp_Vector* vector) {
     case PVEC_CONDVAR:
         finalize_one_condvar(PSEUDOVEC_STRUCT(vector, Lisp_CondVar));
         break;
+    case PVEC_CHANNEL:
+        finalize_one_channel(PSEUDOVEC_STRUCT(vector, Lisp_Channel));
+        break;
     case PVEC_MARKER:
         /* sweep_buffer should already have unchained this from its buffer.  */
         eassert(!PSEUDOVEC_STRUCT(vector, Lisp_Marker)->buffer);
@@ -2965,13 +2969,9 @@ static void cleanup_vector(struct Lisp_Vector* vector) {
             if (h->table_size > 0) {
                 eassert(h->index_bits > 0);
                 xfree(h->index);
-                xfree(h->key_and_value);
-                xfree(h->next);
-                xfree(h->hash);
-                ptrdiff_t bytes = (h->table_size *
-                                       (2 * sizeof *h->key_and_value +
-                                        sizeof *h->hash + sizeof *h->next) +
-                                   hash_table_index_size(h) * sizeof *h->index);
+                xfree(h->entries);
+                ptrdiff_t bytes = (h->table_size * sizeof *h->entries +
+                                   hash_index_bytes(h->index_bits));
                 hash_table_allocated_bytes -= bytes;
             }
         }
@@ -2980,7 +2980,7 @@ static void cleanup_vector(struct Lisp_Vector* vector) {
         {
             struct Lisp_Obarray* o = PSEUDOVEC_STRUCT(vector, Lisp_Obarray);
             xfree(o->buckets);
-            ptrdiff_t bytes = obarray_size(o) * sizeof *o->buckets;
+            ptrdiff_t bytes = obarray_bytes(o);
             hash_table_allocated_bytes -= bytes;
         }
         break;
@@ -3324,6 +3324,8 @@ usage: (make-closure PROTOTYPE &rest CLOSURE-VARS) */)
 (ptrdiff_t nargs, Lisp_Object* args) {
     Lisp_Object protofun = args[0];
     CHECK_TYPE(CLOSUREP(protofun), Qbyte_code_function_p, protofun);
+    if (closure_body_pending_p(protofun))
+        fetch_closure_body(protofun);
 
     /* Create a copy of the constant vector, filling it with the closure
        variables in the beginning.  (The overwritten part should just
@@ -3403,7 +3405,7 @@ void init_symbol(Lisp_Object val, Lisp_Object name) {
     p->u.s.redirect = SYMBOL_PLAINVAL;
     SET_SYMBOL_VAL(p, Qunbound);
     set_symbol_function(val, Qnil);
-    set_symbol_next(val, NULL);
+    p->u.s.hash = 0;
     p->u.s.gcmarkbit = false;
     p->u.s.interned = SYMBOL_UNINTERNED;
     p->u.s.trapped_write = SYMBOL_UNTRAPPED_WRITE;
@@ -4292,8 +4294,7 @@ static struct Lisp_Symbol* live_symbol_holding(struct mem_node* m, void* p) {
             || off == offsetof(struct Lisp_Symbol, u.s.name) ||
             off == offsetof(struct Lisp_Symbol, u.s.val) ||
             off == offsetof(struct Lisp_Symbol, u.s.function) ||
-            off == offsetof(struct Lisp_Symbol, u.s.plist) ||
-            off == offsetof(struct Lisp_Symbol, u.s.next)) {
+            off == offsetof(struct Lisp_Symbol, u.s.plist)) {
             struct Lisp_Symbol* s = p = cp -= off;
 #if GC_ASAN_POISON_OBJECTS
             if (__asan_region_is_poisoned(s, sizeof(*s)))
@@ -5362,7 +5363,9 @@ void garbage_collect(void) {
     FOR_EACH_LIVE_BUFFER(tail, buffer) {
         struct buffer* nextb = XBUFFER(buffer);
         if (!EQ(BVAR(nextb, undo_list), Qt))
-            bset_undo_list(nextb, compact_undo_list(BVAR(nextb, undo_list)));
+            bset_undo_list_tail(nextb,
+                                compact_undo_list(BVAR(nextb, undo_list)));
+        compact_undo_log(nextb);
         /* Now that we have stripped the elements that need not be
      in the undo_list any more, we can finally mark the list.  */
         mark_object(BVAR(nextb, undo_list));
@@ -5656,6 +5659,9 @@ static void mark_buffer(struct buffer* buffer) {
        but just to be on the safe side, we mark it here.  */
     if (!BUFFER_LIVE_P(buffer))
         mark_object(BVAR(buffer, undo_list));
+    mark_undo_log(buffer);
+    mark_syntax_checkpoints(buffer);
+    mark_column_index(buffer);
 
     if (!itree_empty_p(buffer->overlays))
         mark_overlays(buffer->overlays->root);
@@ -5722,14 +5728,16 @@ static void mark_window(struct Lisp_Vector* ptr) {
         mark_glyph_matrix(w->current_matrix);
         mark_glyph_matrix(w->desired_matrix);
     }
+    mark_layout_cache(w);
 }
 
 /* Entry of the mark stack.  */
 struct mark_entry {
-    ptrdiff_t n; /* number of values, or 0 if a single value */
+    ptrdiff_t n; /* number of values, or 0 if a single value, or minus
+                    the number of keys and values of hash table entries */
     union {
         Lisp_Object value; /* when n = 0 */
-        Lisp_Object* values; /* when n > 0 */
+        Lisp_Object* values; /* when n != 0 */
     } u;
 };
 
@@ -5754,6 +5762,23 @@ static inline Lisp_Object mark_stack_pop(void) {
         --mark_stk.sp;
         return e->u.value;
     }
+    if (e->n < 0) /* keys and values of hash table entries */
+    {
+        /* VALUES points to a key while N is even and to its value while
+           N is odd; step from key to value, then to the next key.  */
+        static_assert(offsetof(struct hash_table_entry, key) == 0);
+        static_assert(offsetof(struct hash_table_entry, value) ==
+                      sizeof(Lisp_Object));
+        Lisp_Object* p = e->u.values;
+        e->n++;
+        if (e->n == 0)
+            --mark_stk.sp;
+        else if (e->n & 1)
+            e->u.values = p + 1;
+        else
+            e->u.values = &((struct hash_table_entry*)(p - 1))[1].key;
+        return *p;
+    }
     /* Array of values: pop them left to right, which seems to be slightly
        faster than right to left.  */
     e->n--;
@@ -5789,6 +5814,19 @@ static inline void mark_stack_push_values(Lisp_Object* values, ptrdiff_t n) {
         (struct mark_entry){.n = n, .u.values = values};
 }
 
+/* Push the keys and values of the N entries at ENTRIES onto the mark
+   stack.  */
+static inline void
+mark_stack_push_hash_entries(struct hash_table_entry* entries, ptrdiff_t n) {
+    eassume(n >= 0);
+    if (n == 0)
+        return;
+    if (mark_stk.sp >= mark_stk.size)
+        grow_mark_stack();
+    mark_stk.stack[mark_stk.sp++] =
+        (struct mark_entry){.n = -2 * n, .u.values = &entries->key};
+}
+
 /* When GC_CHECK_MARKED_OBJECTS is set, perform some sanity checks on
    the objects marked here.  Abort if we encounter an object we know is
    bogus.  This increases GC time by ~80%.  */
@@ -5919,8 +5957,8 @@ static void process_mark_stack(ptrdiff_t base_sp) {
                             /* The values pushed here may include
                                HASH_UNUSED_ENTRY_KEY, which this function must
                                cope with.  */
-                            mark_stack_push_values(h->key_and_value,
-                                                   2 * h->table_size);
+                            mark_stack_push_hash_entries(h->entries,
+                                                         h->table_size);
                         else {
                             /* For weak tables, don't mark the
                          contents --- that's what makes it weak.  */
@@ -5993,7 +6031,6 @@ static void process_mark_stack(ptrdiff_t base_sp) {
         case Lisp_Symbol:
             {
                 struct Lisp_Symbol* ptr = XBARE_SYMBOL(obj);
-            nextsym:
                 if (symbol_marked_p(ptr))
                     break;
                 check_allocated_and_live_symbol(po, ptr);
@@ -6039,12 +6076,6 @@ static void process_mark_stack(ptrdiff_t base_sp) {
                 }
                 set_string_marked(XSTRING(ptr->u.s.name));
                 mark_interval_tree(string_intervals(ptr->u.s.name));
-                /* Inner loop to mark next symbol in this bucket, if any.  */
-                ptr = ptr->u.s.next;
-                if (GC_CHECK_MARKED_OBJECTS)
-                    po = ptr;
-                if (ptr)
-                    goto nextsym;
             }
             break;
 
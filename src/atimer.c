@@ -51,10 +51,21 @@ static struct atimer* free_atimers;
 
 static struct atimer* stopped_atimers;
 
-/* List of active atimers, sorted by expiration time.  The timer that
-   will become ripe next is always at the front of this list.  */
+/* Active atimers, kept as a binary min-heap on expiration time, so
+   that starting and cancelling a timer costs O(log N) and the timer
+   that will become ripe next is always atimer_heap[0].  */
 
-static struct atimer* atimers;
+static struct atimer** atimer_heap;
+
+/* Number of timers in atimer_heap, and number of slots allocated.  */
+
+static ptrdiff_t atimer_heap_used, atimer_heap_size;
+
+/* Number of atimers that are either active or stopped.  atimer_heap
+   always has room for all of them, so that run_all_atimers never has
+   to allocate.  */
+
+static ptrdiff_t live_atimers;
 
 #ifdef HAVE_ITIMERSPEC
 /* The alarm timer and whether it was properly initialized, if
@@ -90,7 +101,8 @@ static void unblock_atimers(sigset_t const* oldset) {
 
 static void set_alarm(void);
 static void schedule_atimer(struct atimer*);
-static struct atimer* append_atimer_lists(struct atimer*, struct atimer*);
+static void unschedule_atimer(struct atimer*);
+static void free_atimer(struct atimer*);
 
 /* Start a new atimer of type TYPE.  TIMESTAMP specifies when the timer is
    ripe.  FN is the function to call when the timer fires.
@@ -130,8 +142,17 @@ struct atimer* start_atimer(enum atimer_type type, struct timespec timestamp,
     else
         t = xmalloc(sizeof *t);
 
+    /* Make sure the heap has room for this timer before blocking
+       SIGALRM, since allocating might signal an error.  */
+    if (atimer_heap_size <= live_atimers)
+        atimer_heap = xpalloc(atimer_heap, &atimer_heap_size,
+                              live_atimers + 1 - atimer_heap_size, -1,
+                              sizeof *atimer_heap);
+    live_atimers++;
+
     /* Fill the atimer structure.  */
     memset(t, 0, sizeof *t);
+    t->heap_index = -1;
     t->type = type;
     t->fn = fn;
     t->client_data = client_data;
@@ -154,7 +175,7 @@ struct atimer* start_atimer(enum atimer_type type, struct timespec timestamp,
         break;
     }
 
-    /* Insert the timer in the list of active atimers.  */
+    /* Insert the timer in the heap of active atimers.  */
     schedule_atimer(t);
     unblock_atimers(&oldset);
 
@@ -168,31 +189,31 @@ struct atimer* start_atimer(enum atimer_type type, struct timespec timestamp,
 /* Cancel and free atimer TIMER.  */
 
 void cancel_atimer(struct atimer* timer) {
-    int i;
     sigset_t oldset;
 
     block_atimers(&oldset);
 
-    for (i = 0; i < 2; ++i) {
+    /* If TIMER is active, take it off the heap.  We don't bother to
+       arrange for setting a different alarm time, since a too early
+       one doesn't hurt.  */
+    if (0 <= timer->heap_index) {
+        unschedule_atimer(timer);
+        free_atimer(timer);
+    }
+    else {
         struct atimer *t, *prev;
-        struct atimer** list = i ? &stopped_atimers : &atimers;
 
-        /* See if TIMER is active or stopped.  */
-        for (t = *list, prev = NULL; t && t != timer; prev = t, t = t->next)
+        /* See if TIMER is stopped.  */
+        for (t = stopped_atimers, prev = NULL; t && t != timer;
+             prev = t, t = t->next)
             ;
 
-        /* If it is, take it off its list, and put in on the free-list.
-       We don't bother to arrange for setting a different alarm time,
-       since a too early one doesn't hurt.  */
         if (t) {
             if (prev)
                 prev->next = t->next;
             else
-                *list = t->next;
-
-            t->next = free_atimers;
-            free_atimers = t;
-            break;
+                stopped_atimers = t->next;
+            free_atimer(t);
         }
     }
 
@@ -200,53 +221,30 @@ void cancel_atimer(struct atimer* timer) {
 }
 
 
-/* Append two lists of atimers LIST_1 and LIST_2 and return the
-   result list.  */
-
-static struct atimer* append_atimer_lists(struct atimer* list_1,
-                                          struct atimer* list_2) {
-    if (list_1 == NULL)
-        return list_2;
-    else if (list_2 == NULL)
-        return list_1;
-    else {
-        struct atimer* p;
-
-        for (p = list_1; p->next; p = p->next)
-            ;
-        p->next = list_2;
-        return list_1;
-    }
-}
-
-
 /* Stop all timers except timer T.  T null means stop all timers.  */
 
 void stop_other_atimers(struct atimer* t) {
     sigset_t oldset;
     block_atimers(&oldset);
 
-    if (t) {
-        struct atimer *p, *prev;
+    /* If T is not active, handle this like T == 0.  */
+    if (t && t->heap_index < 0)
+        t = NULL;
 
-        /* See if T is active.  */
-        for (p = atimers, prev = NULL; p && p != t; prev = p, p = p->next)
-            ;
-
-        if (p == t) {
-            if (prev)
-                prev->next = t->next;
-            else
-                atimers = t->next;
-            t->next = NULL;
+    for (ptrdiff_t i = 0; i < atimer_heap_used; i++) {
+        struct atimer* p = atimer_heap[i];
+        if (p != t) {
+            p->heap_index = -1;
+            p->next = stopped_atimers;
+            stopped_atimers = p;
         }
-        else
-            /* T is not active.  Let's handle this like T == 0.  */
-            t = NULL;
     }
 
-    stopped_atimers = append_atimer_lists(atimers, stopped_atimers);
-    atimers = t;
+    atimer_heap_used = 0;
+    if (t) {
+        t->heap_index = -1;
+        schedule_atimer(t);
+    }
     unblock_atimers(&oldset);
 }
 
@@ -256,19 +254,16 @@ void stop_other_atimers(struct atimer* t) {
 
 void run_all_atimers(void) {
     if (stopped_atimers) {
-        struct atimer* t = atimers;
         struct atimer* next;
         sigset_t oldset;
 
         block_atimers(&oldset);
-        atimers = stopped_atimers;
-        stopped_atimers = NULL;
 
-        while (t) {
+        for (struct atimer* t = stopped_atimers; t; t = next) {
             next = t->next;
             schedule_atimer(t);
-            t = next;
         }
+        stopped_atimers = NULL;
 
         unblock_atimers(&oldset);
     }
@@ -278,12 +273,14 @@ void run_all_atimers(void) {
 /* Arrange for a SIGALRM to arrive when the next timer is ripe.  */
 
 static void set_alarm(void) {
-    if (atimers) {
+    if (atimer_heap_used) {
+        struct atimer* next = atimer_heap[0];
+
 #ifdef HAVE_ITIMERSPEC
         if (0 <= timerfd || alarm_timer_ok) {
             bool exit = false;
             struct itimerspec ispec;
-            ispec.it_value = atimers->expiration;
+            ispec.it_value = next->expiration;
             ispec.it_interval.tv_sec = ispec.it_interval.tv_nsec = 0;
             if (alarm_timer_ok &&
                 timer_settime(alarm_timer, TIMER_ABSTIME, &ispec, 0) == 0)
@@ -314,12 +311,12 @@ static void set_alarm(void) {
 
         /* Determine interval till the next timer is ripe.  */
         struct timespec now = current_timespec();
-        if (timespec_cmp(atimers->expiration, now) <= 0) {
+        if (timespec_cmp(next->expiration, now) <= 0) {
             /* Timer is (over)due -- just trigger the signal right way.  */
             raise(SIGALRM);
         }
         else {
-            struct timespec interval = timespec_sub(atimers->expiration, now);
+            struct timespec interval = timespec_sub(next->expiration, now);
 
 #ifdef HAVE_SETITIMER
             struct itimerval it = {.it_value = make_timeval(interval)};
@@ -332,42 +329,99 @@ static void set_alarm(void) {
 }
 
 
-/* Insert timer T into the list of active atimers `atimers', keeping
-   the list sorted by expiration time.  T must not be in this list
-   already.  */
+/* Store timer T in slot I of atimer_heap.  */
+
+static void atimer_heap_set(ptrdiff_t i, struct atimer* t) {
+    atimer_heap[i] = t;
+    t->heap_index = i;
+}
+
+/* Move timer T, which belongs in slot I of atimer_heap, towards the
+   root of the heap until its parent is not ripe after it, and store
+   it there.  */
+
+static void atimer_sift_up(ptrdiff_t i, struct atimer* t) {
+    while (0 < i) {
+        ptrdiff_t parent = (i - 1) >> 1;
+        if (timespec_cmp(atimer_heap[parent]->expiration, t->expiration) <= 0)
+            break;
+        atimer_heap_set(i, atimer_heap[parent]);
+        i = parent;
+    }
+    atimer_heap_set(i, t);
+}
+
+/* Likewise, but move T towards the leaves of the heap.  */
+
+static void atimer_sift_down(ptrdiff_t i, struct atimer* t) {
+    for (;;) {
+        ptrdiff_t child = 2 * i + 1;
+        if (atimer_heap_used <= child)
+            break;
+        if (child + 1 < atimer_heap_used &&
+            timespec_cmp(atimer_heap[child + 1]->expiration,
+                         atimer_heap[child]->expiration) < 0)
+            child++;
+        if (timespec_cmp(t->expiration, atimer_heap[child]->expiration) <= 0)
+            break;
+        atimer_heap_set(i, atimer_heap[child]);
+        i = child;
+    }
+    atimer_heap_set(i, t);
+}
+
+/* Insert timer T into the heap of active atimers.  T must not be in
+   the heap already.  */
 
 static void schedule_atimer(struct atimer* t) {
-    struct atimer *a = atimers, *prev = NULL;
+    eassert(t->heap_index < 0 && atimer_heap_used < atimer_heap_size);
+    atimer_sift_up(atimer_heap_used++, t);
+}
 
-    /* Look for the first atimer that is ripe after T.  */
-    while (a && timespec_cmp(a->expiration, t->expiration) < 0)
-        prev = a, a = a->next;
+/* Remove timer T from the heap of active atimers.  */
 
-    /* Insert T in front of the atimer found, if any.  */
-    if (prev)
-        prev->next = t;
-    else
-        atimers = t;
+static void unschedule_atimer(struct atimer* t) {
+    ptrdiff_t i = t->heap_index;
+    struct atimer* last = atimer_heap[--atimer_heap_used];
 
-    t->next = a;
+    eassert(atimer_heap[i] == t);
+    t->heap_index = -1;
+
+    /* Fill the hole with the last timer, and restore the heap order
+       in whichever direction it was broken.  */
+    if (last != t) {
+        if (0 < i && timespec_cmp(last->expiration,
+                                  atimer_heap[(i - 1) >> 1]->expiration) < 0)
+            atimer_sift_up(i, last);
+        else
+            atimer_sift_down(i, last);
+    }
+}
+
+/* Put timer T, which must be neither active nor stopped, on the
+   free-list.  */
+
+static void free_atimer(struct atimer* t) {
+    t->next = free_atimers;
+    free_atimers = t;
+    live_atimers--;
 }
 
 static void run_timers(void) {
     struct timespec now = current_timespec();
 
-    while (atimers && timespec_cmp(atimers->expiration, now) <= 0) {
-        struct atimer* t = atimers;
-        atimers = atimers->next;
+    while (atimer_heap_used &&
+           timespec_cmp(atimer_heap[0]->expiration, now) <= 0) {
+        struct atimer* t = atimer_heap[0];
+        unschedule_atimer(t);
         t->fn(t);
 
         if (t->type == ATIMER_CONTINUOUS) {
             t->expiration = timespec_add(now, t->interval);
             schedule_atimer(t);
         }
-        else {
-            t->next = free_atimers;
-            free_atimers = t;
-        }
+        else
+            free_atimer(t);
     }
 
     set_alarm();
@@ -411,7 +465,7 @@ void timerfd_callback(int fd, void* arg) {
 /* Do pending timers.  */
 
 void do_pending_atimers(void) {
-    if (atimers) {
+    if (atimer_heap_used) {
         sigset_t oldset;
         block_atimers(&oldset);
         run_timers();
@@ -557,7 +611,8 @@ void init_atimer(void) {
     sigev.sigev_value.sival_ptr = &alarm_timer;
     alarm_timer_ok = timer_create(CLOCK_REALTIME, &sigev, &alarm_timer) == 0;
 #endif
-    free_atimers = stopped_atimers = atimers = NULL;
+    free_atimers = stopped_atimers = NULL;
+    atimer_heap_used = live_atimers = 0;
 
     /* pending_signals is initialized in init_keyboard.  */
     struct sigaction action;
@@ -19,6 +19,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #ifndef EMACS_ATIMER_H
 #define EMACS_ATIMER_H
 
+#include <stddef.h>
 #include <time.h>
 
 /* Forward declaration.  */
@@ -62,7 +63,11 @@ struct atimer {
     /* Additional user-specified data to pass to FN.  */
     void* client_data;
 
-    /* Next in list of active or free atimers.  */
+    /* Index of this timer in the heap of active atimers, or -1 if
+       the timer is stopped or free.  */
+    ptrdiff_t heap_index;
+
+    /* Next in list of stopped or free atimers.  */
     struct atimer* next;
 };
 
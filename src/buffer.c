@@ -518,6 +518,10 @@ even if it is dead.  The return value is never nil.  */)
     b->newline_cache = 0;
     b->width_run_cache = 0;
     b->bidi_paragraph_cache = 0;
+    b->stop_index = 0;
+    b->column_index = 0;
+    b->syntax_checkpoints = 0;
+    b->undo_log = 0;
     bset_width_table(b, Qnil);
     b->prevent_redisplay_optimizations_p = 1;
 
@@ -734,6 +738,10 @@ Interactively, CLONE and INHIBIT-BUFFER-HOOKS are nil.  */)
     b->newline_cache = 0;
     b->width_run_cache = 0;
     b->bidi_paragraph_cache = 0;
+    b->stop_index = 0;
+    b->column_index = 0;
+    b->syntax_checkpoints = 0;
+    b->undo_log = 0;
     bset_width_table(b, Qnil);
 
 #ifdef HAVE_TREE_SITTER
@@ -749,7 +757,7 @@ Interactively, CLONE and INHIBIT-BUFFER-HOOKS are nil.  */)
     bset_last_name(b, name);
 
     /* An indirect buffer shares undo list of its base (Bug#18180).  */
-    bset_undo_list(b, BVAR(b->base_buffer, undo_list));
+    bset_undo_list(b, buffer_undo_list(b->base_buffer));
 
     reset_buffer(b);
     reset_buffer_local_variables(b, 1);
@@ -1929,6 +1937,9 @@ cleaning up all windows currently displaying the buffer to be killed. */)
         free_region_cache(b->bidi_paragraph_cache);
         b->bidi_paragraph_cache = 0;
     }
+    free_stop_index(b);
+    free_column_index(b);
+    free_syntax_checkpoints(b);
     bset_width_table(b, Qnil);
     unblock_input();
 
@@ -2091,7 +2102,7 @@ void set_buffer_internal_2(register struct buffer* b) {
         /* Put the undo list back in the base buffer, so that it appears
        that an indirect buffer shares the undo list of its base.  */
         if (old_buf->base_buffer)
-            bset_undo_list(old_buf->base_buffer, BVAR(old_buf, undo_list));
+            bset_undo_list(old_buf->base_buffer, buffer_undo_list(old_buf));
 
         /* If the old current buffer has markers to record PT, BEGV and ZV
        when it is not current, update them now.  */
@@ -2101,7 +2112,7 @@ void set_buffer_internal_2(register struct buffer* b) {
     /* Get the undo list from the base buffer, so that it appears
        that an indirect buffer shares the undo list of its base.  */
     if (b->base_buffer)
-        bset_undo_list(b, BVAR(b->base_buffer, undo_list));
+        bset_undo_list(b, buffer_undo_list(b->base_buffer));
 
     /* If the new current buffer has markers to record PT, BEGV and ZV
        when it is not current, fetch them now.  */
@@ -2338,10 +2349,17 @@ results, see Info node `(elisp)Swapping Text'.  */)
     swapfield(newline_cache, struct region_cache*);
     swapfield(width_run_cache, struct region_cache*);
     swapfield(bidi_paragraph_cache, struct region_cache*);
+    free_stop_index(current_buffer);
+    free_stop_index(other_buffer);
+    free_column_index(current_buffer);
+    free_column_index(other_buffer);
+    free_syntax_checkpoints(current_buffer);
+    free_syntax_checkpoints(other_buffer);
     current_buffer->prevent_redisplay_optimizations_p = 1;
     other_buffer->prevent_redisplay_optimizations_p = 1;
     swapfield(long_line_optimizations_p, bool_bf);
     swapfield_(undo_list, Lisp_Object);
+    swapfield(undo_log, struct undo_log*);
     swapfield_(mark, Lisp_Object);
     swapfield_(mark_active, Lisp_Object); /* Belongs with the `mark'.  */
     swapfield_(enable_multibyte_characters, Lisp_Object);
@@ -2458,7 +2476,7 @@ current buffer is cleared.  */)
     ptrdiff_t begv, zv;
     bool narrowed = (BEG != BEGV || Z != ZV);
     bool modified_p = !NILP(Fbuffer_modified_p(Qnil));
-    Lisp_Object old_undo = BVAR(current_buffer, undo_list);
+    Lisp_Object old_undo = buffer_undo_list(current_buffer);
 
     if (current_buffer->base_buffer)
         error("Cannot do `set-buffer-multibyte' on an indirect buffer");
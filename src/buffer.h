@@ -703,6 +703,24 @@ struct buffer {
     struct region_cache* width_run_cache;
     struct region_cache* bidi_paragraph_cache;
 
+    /* Positions where text properties and overlays change, used by the
+       display iterator to find its stop positions.  See stop_index_at
+       in xdisp.c.  */
+    struct stop_index* stop_index;
+
+    /* Columns of positions in long lines, used by current-column and
+       move-to-column.  See scan_for_column in indent.c.  */
+    struct column_index* column_index;
+
+    /* Parse states at positions of the buffer, used by
+       parse-partial-sexp and back_comment.  See scan_from_begv in
+       syntax.c.  */
+    struct syntax_checkpoints* syntax_checkpoints;
+
+    /* Changes recorded for undo that are not yet in undo_list.  See
+       flush_undo_log in undo.c.  */
+    struct undo_log* undo_log;
+
     /* Non-zero means disable redisplay optimizations when rebuilding the glyph
        matrices (but not when redrawing).  */
     bool_bf prevent_redisplay_optimizations_p : 1;
@@ -826,9 +844,23 @@ INLINE void bset_read_only(struct buffer* b, Lisp_Object val) {
 INLINE void bset_truncate_lines(struct buffer* b, Lisp_Object val) {
     b->truncate_lines_ = val;
 }
+/* Set the undo list of B to VAL.  Changes still held in the undo log
+   of B belong to the old list and are dropped with it.  */
 INLINE void bset_undo_list(struct buffer* b, Lisp_Object val) {
+    if (b->undo_log)
+        free_undo_log(b);
     b->undo_list_ = val;
 }
+/* Set the part of the undo list of B older than its undo log.  */
+INLINE void bset_undo_list_tail(struct buffer* b, Lisp_Object val) {
+    b->undo_list_ = val;
+}
+/* Return the undo list of B, including the changes in its undo log.  */
+INLINE Lisp_Object buffer_undo_list(struct buffer* b) {
+    if (b->undo_log)
+        flush_undo_log(b);
+    return BVAR(b, undo_list);
+}
 INLINE void bset_upcase_table(struct buffer* b, Lisp_Object val) {
     b->upcase_table_ = val;
 }
@@ -1460,11 +1492,15 @@ INLINE void set_per_buffer_default(int offset, Lisp_Object value) {
    variable at offset OFFSET in the buffer structure.  */
 
 INLINE Lisp_Object per_buffer_value(struct buffer* b, int offset) {
+    if (offset == PER_BUFFER_VAR_OFFSET(undo_list) && b->undo_log)
+        flush_undo_log(b);
     return *(Lisp_Object*)(offset + (char*)b);
 }
 
 INLINE void set_per_buffer_value(struct buffer* b, int offset,
                                  Lisp_Object value) {
+    if (offset == PER_BUFFER_VAR_OFFSET(undo_list) && b->undo_log)
+        free_undo_log(b);
     *(Lisp_Object*)(offset + (char*)b) = value;
 }
 
@@ -468,6 +468,8 @@ Lisp_Object exec_byte_code(Lisp_Object fun, ptrdiff_t args_template,
     register Lisp_Object* top BC_REG_TOP = NULL;
     register unsigned char const* pc BC_REG_PC = NULL;
 
+    if (closure_body_pending_p(fun))
+        fetch_closure_body(fun);
     Lisp_Object bytestr = AREF(fun, CLOSURE_CODE);
 
 setup_frame:;
@@ -753,6 +755,8 @@ setup_frame:;
                     Lisp_Object template = AREF(call_fun, CLOSURE_ARGLIST);
                     if (FIXNUMP(template)) {
                         /* Fast path for lexbound functions.  */
+                        if (closure_body_pending_p(call_fun))
+                            fetch_closure_body(call_fun);
                         fun = call_fun;
                         bytestr = AREF(call_fun, CLOSURE_CODE),
                         args_template = XFIXNUM(template);
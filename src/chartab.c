@@ -345,9 +345,30 @@ static void sub_char_table_set(Lisp_Object table, int c, Lisp_Object val,
     }
 }
 
+/* Discard what is cached about TABLE, which was just changed in
+   place, so that the caches cannot tell by looking at it.  Display
+   tables, `char-width-table' and `glyphless-char-display' affect the
+   rows cached by redisplay, the first two also the column checkpoints
+   of all buffers, and a syntax table the syntax checkpoints of the
+   buffers that use it.  Callers that store into TABLE directly, like
+   CHAR_TABLE_SET does for ASCII characters, must call this.  */
+void char_table_changed(Lisp_Object table) {
+    bool display_table = EQ(XCHAR_TABLE(table)->purpose, Qdisplay_table);
+
+    if (display_table || EQ(table, Vchar_width_table) ||
+        EQ(table, Vglyphless_char_display))
+        invalidate_layout_caches();
+    if (display_table || EQ(table, Vchar_width_table))
+        invalidate_column_indexes();
+    if (EQ(XCHAR_TABLE(table)->purpose, Qsyntax_table))
+        syntax_table_changed(table);
+}
+
 void char_table_set(Lisp_Object table, int c, Lisp_Object val) {
     struct Lisp_Char_Table* tbl = XCHAR_TABLE(table);
 
+    char_table_changed(table);
+
     if (ASCII_CHAR_P(c) && SUB_CHAR_TABLE_P(tbl->ascii))
         set_sub_char_table_contents(tbl->ascii, c, val);
     else {
@@ -401,6 +422,7 @@ void char_table_set_range(Lisp_Object table, int from, int to,
                           Lisp_Object val) {
     struct Lisp_Char_Table* tbl = XCHAR_TABLE(table);
 
+    char_table_changed(table);
     if (from == to)
         char_table_set(table, from, val);
     else {
@@ -470,6 +492,7 @@ Return PARENT.  PARENT must be either nil or another char-table.  */)
     }
 
     set_char_table_parent(char_table, parent);
+    char_table_changed(char_table);
 
     return parent;
 }
@@ -497,6 +520,7 @@ DEFUN("set-char-table-extra-slot", Fset_char_table_extra_slot,
         args_out_of_range(char_table, n);
 
     set_char_table_extras(char_table, XFIXNUM(n), value);
+    char_table_changed(char_table);
     return value;
 }
 
@@ -557,6 +581,7 @@ or a character code.  Return VALUE.  */)
     else
         error("Invalid RANGE argument to `set-char-table-range'");
 
+    char_table_changed(char_table);
     return value;
 }
 
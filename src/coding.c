@@ -6768,7 +6768,7 @@ static void decode_coding(struct coding_system* coding) {
         if (MODIFF <= SAVE_MODIFF)
             record_first_change();
 
-        undo_list = BVAR(current_buffer, undo_list);
+        undo_list = buffer_undo_list(current_buffer);
         bset_undo_list(current_buffer, Qt);
         /* Avoid running nested *-change-functions via 'produce_annotation'.
            Our callers run *-change-functions over the whole region anyway.  */
@@ -7351,7 +7351,7 @@ void decode_coding_gap(struct coding_system* coding, ptrdiff_t bytes) {
     if (!NILP(CODING_ATTR_POST_READ(attrs))) {
         ptrdiff_t prev_Z = Z, prev_Z_BYTE = Z_BYTE;
         Lisp_Object val;
-        Lisp_Object undo_list = BVAR(current_buffer, undo_list);
+        Lisp_Object undo_list = buffer_undo_list(current_buffer);
 
         record_unwind_protect(coding_restore_undo_list,
                               Fcons(undo_list, Fcurrent_buffer()));
@@ -7500,7 +7500,7 @@ void decode_coding_object(struct coding_system* coding, Lisp_Object src_object,
     if (!NILP(CODING_ATTR_POST_READ(attrs))) {
         ptrdiff_t prev_Z = Z, prev_Z_BYTE = Z_BYTE;
         Lisp_Object val;
-        Lisp_Object undo_list = BVAR(current_buffer, undo_list);
+        Lisp_Object undo_list = buffer_undo_list(current_buffer);
         specpdl_ref count1 = SPECPDL_INDEX();
 
         record_unwind_protect(coding_restore_undo_list,
@@ -58,6 +58,12 @@ static inline int stdc_trailing_zeros(unsigned int x) {
     return __builtin_ctz(x);
 }
 
+static inline int stdc_trailing_zeros_ull(unsigned long long x) {
+    if (x == 0)
+        return sizeof(unsigned long long) * CHAR_BIT;
+    return __builtin_ctzll(x);
+}
+
 ///////////
 
 #define bswap_16 __builtin_bswap16
@@ -238,6 +238,8 @@ a fixed set of types.  */)
             return Qmutex;
         case PVEC_CONDVAR:
             return Qcondition_variable;
+        case PVEC_CHANNEL:
+            return Qchannel;
         case PVEC_TERMINAL:
             return Qterminal;
         case PVEC_RECORD:
@@ -482,7 +484,8 @@ DEFUN("closurep", Fclosurep, Sclosurep, 1, 1, 0,
 DEFUN("byte-code-function-p", Fbyte_code_function_p, Sbyte_code_function_p, 1,
       1, 0, doc:/* Return t if OBJECT is a byte-compiled function object.  */)
 (Lisp_Object object) {
-    if (CLOSUREP(object) && STRINGP(AREF(object, CLOSURE_CODE)))
+    if (CLOSUREP(object) && (STRINGP(AREF(object, CLOSURE_CODE)) ||
+                             closure_body_pending_p(object)))
         return Qt;
     return Qnil;
 }
@@ -591,6 +594,14 @@ DEFUN("condition-variable-p", Fcondition_variable_p, Scondition_variable_p, 1,
     return Qnil;
 }
 
+DEFUN("channelp", Fchannelp, Schannelp, 1, 1, 0,
+      doc:/* Return t if OBJECT is a channel.  */)
+(Lisp_Object object) {
+    if (CHANNELP(object))
+        return Qt;
+    return Qnil;
+}
+
 /* Extract and set components of lists.  */
 
 DEFUN ("car", Fcar, Scar, 1, 1, 0,
@@ -2422,6 +2433,9 @@ or a byte-code object.  IDX starts at 0.  */)
 
         if (idxval < 0 || idxval >= size)
             args_out_of_range(array, idx);
+        if (CLOSUREP(array) && closure_body_pending_p(array) &&
+            (idxval == CLOSURE_CODE || idxval == CLOSURE_CONSTANTS))
+            fetch_closure_body(array);
         return AREF(array, idxval);
     }
 }
@@ -2454,6 +2468,7 @@ index IDX must both be ASCII (0-127).  */)
     else if (CHAR_TABLE_P(array)) {
         CHECK_CHARACTER(idx);
         CHAR_TABLE_SET(array, idxval, newelt);
+        char_table_changed(array);
     }
     else if (RECORDP(array)) {
         if (idxval < 0 || idxval >= PVSIZE(array))
@@ -2475,6 +2490,7 @@ index IDX must both be ASCII (0-127).  */)
             if (*p > 0x7f)
                 error("Attempt to replace non-ASCII char in multibyte string");
             *p = c;
+            STRING_CLEAR_HASH(array);
         }
         else {
             if (c > 0xff)
@@ -3921,6 +3937,7 @@ void syms_of_data(void) {
     DEFSYM(Qthread, "thread");
     DEFSYM(Qmutex, "mutex");
     DEFSYM(Qcondition_variable, "condition-variable");
+    DEFSYM(Qchannel, "channel");
     DEFSYM(Qfont_spec, "font-spec");
     DEFSYM(Qfont_entity, "font-entity");
     DEFSYM(Qfont_object, "font-object");
@@ -3981,6 +3998,7 @@ void syms_of_data(void) {
     defsubr(&Sthreadp);
     defsubr(&Smutexp);
     defsubr(&Scondition_variable_p);
+    defsubr(&Schannelp);
     defsubr(&Scar);
     defsubr(&Scdr);
     defsubr(&Scar_safe);
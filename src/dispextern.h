@@ -947,6 +947,12 @@ struct glyph_row {
     /* Whether or not a stipple was drawn in this row at some point.  */
     bool_bf stipple_p : 1;
 
+    /* True means HASH is the line hash code that frame-based redisplay
+       uses for scrolling, rather than the value of row_hash.  The code
+       travels with the row from the desired to the current matrix, so
+       that current rows need not be hashed again.  */
+    bool_bf line_hash_p : 1;
+
     /* Continuation lines width at the start of the row.  */
     int continuation_lines_width;
 };
@@ -2845,6 +2851,8 @@ bool resize_mini_window(struct window*, bool);
 void set_vertical_scroll_bar(struct window*);
 void set_horizontal_scroll_bar(struct window*);
 int try_window(Lisp_Object, struct text_pos, int);
+void free_layout_cache(struct window*);
+void mark_layout_cache(struct window*);
 void window_box(struct window*, enum glyph_row_area, int*, int*, int*, int*);
 int window_box_height(struct window*);
 int window_text_bottom_y(struct window*);
@@ -2860,6 +2868,9 @@ void remember_mouse_glyph(struct frame*, int, int, NativeRectangle*);
 
 void mark_window_display_accurate(Lisp_Object, bool);
 void redisplay_preserve_echo_area(int);
+void redisplay_for_output(int);
+void redisplay_deferred_output(int);
+struct timespec output_redisplay_delay(void);
 void init_iterator(struct it*, struct window*, ptrdiff_t, ptrdiff_t,
                    struct glyph_row*, enum face_id);
 ptrdiff_t get_small_narrowing_begv(struct window*, ptrdiff_t);
@@ -3034,6 +3045,8 @@ extern struct terminal* init_initial_terminal(void);
 /* Defined in term.c */
 
 extern void tty_turn_off_insert(struct tty_display_info*);
+extern void tty_begin_composing(struct tty_display_info*);
+extern void tty_flush_composed(struct tty_display_info*);
 extern int string_cost(const char*);
 extern int per_line_cost(const char*);
 extern void calculate_costs(struct frame*);
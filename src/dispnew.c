@@ -652,8 +652,10 @@ void clear_glyph_matrix_rows(struct glyph_matrix* matrix, int start, int end) {
              || (matrix->nrows == 0)));
     eassert(end >= 0 && end <= matrix->nrows);
 
-    for (; start < end; ++start)
+    for (; start < end; ++start) {
         matrix->rows[start].enabled_p = false;
+        matrix->rows[start].line_hash_p = false;
+    }
 }
 
 
@@ -1097,6 +1099,18 @@ static unsigned line_hash_code(struct frame* f, struct glyph_row* row) {
     return hash;
 }
 
+/* Return the line hash code of ROW of frame F, and remember it in
+   ROW.  A row of the current matrix usually got its code while it was
+   in the desired matrix, and is not hashed again.  */
+
+static unsigned cached_line_hash_code(struct frame* f, struct glyph_row* row) {
+    if (!row->line_hash_p) {
+        row->hash = line_hash_code(f, row);
+        row->line_hash_p = true;
+    }
+    return row->hash;
+}
+
 
 /* Return the cost of drawing line VPOS in MATRIX, which may
    be current or desired matrix of frame F.  The cost equals
@@ -2192,6 +2206,7 @@ void free_window_matrices(struct window* w) {
             free_glyph_matrix(w->current_matrix);
             free_glyph_matrix(w->desired_matrix);
             w->current_matrix = w->desired_matrix = NULL;
+            free_layout_cache(w);
         }
 
         /* Next window on same level.  */
@@ -2372,6 +2387,9 @@ build_frame_matrix_from_leaf_window(struct glyph_matrix* frame_matrix,
         struct glyph_row* window_row = window_matrix->rows + window_y;
         bool current_row_p = window_matrix == w->current_matrix;
 
+        /* The glyphs of the frame row are about to change.  */
+        frame_row->line_hash_p = false;
+
         /* Fill up the frame row with spaces up to the left margin of the
        window row.  */
         fill_up_frame_row_with_spaces(f, frame_row, window_matrix->matrix_x);
@@ -3392,6 +3410,7 @@ static void produce_box_line(struct frame* root, struct frame* child, int x,
                           child);
     produce_box_glyphs(BOX_HORIZONTAL, root_row, x, w, child);
     root_row->hash = row_hash(root_row);
+    root_row->line_hash_p = false;
 }
 
 /* Copy to ROOT's desired matrix what we need from CHILD.  */
@@ -3457,6 +3476,7 @@ static void copy_child_glyphs(struct frame* root, struct frame* child) {
 
         /* Compute a new hash since we changed glyphs.  */
         root_row->hash = row_hash(root_row);
+        root_row->line_hash_p = false;
     }
 }
 
@@ -3527,6 +3547,7 @@ static void update_initial_frame(struct frame* f) {
 }
 
 static void flush_terminal(struct frame* f) {
+    tty_flush_composed(FRAME_TTY(f));
     if (FRAME_TTY(f)->termscript)
         fflush(FRAME_TTY(f)->termscript);
     fflush(FRAME_TTY(f)->output);
@@ -3678,6 +3699,7 @@ void combine_updates_for_frame(struct frame* f, bool inhibit_scrolling) {
             copy_child_glyphs(root, topmost_child);
     }
 
+    tty_begin_composing(FRAME_TTY(root));
     update_begin(root);
     write_matrix(root, inhibit_scrolling, false);
     make_matrix_current(root);
@@ -3754,6 +3776,7 @@ void update_frame_with_menu(struct frame* f, int row, int col) {
     eassert(FRAME_TERMCAP_P(f));
 
     /* Update the display.  */
+    tty_begin_composing(FRAME_TTY(f));
     update_begin(f);
     write_matrix(f, true, true);
     make_matrix_current(f);
@@ -5273,14 +5296,16 @@ static void scrolling(struct frame* frame) {
             SAFE_FREE();
             return;
         }
-        old_hash[i] = line_hash_code(frame, MATRIX_ROW(current_matrix, i));
+        old_hash[i] =
+            cached_line_hash_code(frame, MATRIX_ROW(current_matrix, i));
         if (!MATRIX_ROW_ENABLED_P(desired_matrix, i)) {
             /* This line cannot be redrawn, so don't let scrolling mess it.  */
             new_hash[i] = old_hash[i];
             draw_cost[i] = SCROLL_INFINITY;
         }
         else {
-            new_hash[i] = line_hash_code(frame, MATRIX_ROW(desired_matrix, i));
+            new_hash[i] =
+                cached_line_hash_code(frame, MATRIX_ROW(desired_matrix, i));
             draw_cost[i] = line_draw_cost(frame, desired_matrix, i);
         }
 
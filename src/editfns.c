@@ -2162,7 +2162,7 @@ restart:
        Also inhibit locking the file.  */
     if (!changed && !NILP(noundo)) {
         record_unwind_protect(subst_char_in_region_unwind,
-                              BVAR(current_buffer, undo_list));
+                              buffer_undo_list(current_buffer));
         bset_undo_list(current_buffer, Qt);
         /* Don't do file-locking.  */
         record_unwind_protect(subst_char_in_region_unwind_1,
@@ -3830,7 +3830,7 @@ by calling `format-decode', which see.  */)
     /* If the undo log only contains the insertion, there's no point
        keeping it.  It's typically when we first fill a file-buffer.  */
     bool empty_undo_list_p =
-        (!NILP(visit) && NILP(BVAR(current_buffer, undo_list)) && BEG == Z);
+        (!NILP(visit) && NILP(buffer_undo_list(current_buffer)) && BEG == Z);
     Lisp_Object old_Vdeactivate_mark = Vdeactivate_mark;
     bool we_locked_file = false;
     Lisp_Object window_markers = Qnil;
@@ -4683,7 +4683,7 @@ notfound:
                 BVAR(current_buffer, enable_multibyte_characters);
             Lisp_Object unwind_data = Fcons(
                 multibyte,
-                Fcons(BVAR(current_buffer, undo_list), Fcurrent_buffer()));
+                Fcons(buffer_undo_list(current_buffer), Fcurrent_buffer()));
             specpdl_ref count1 = SPECPDL_INDEX();
 
             bset_enable_multibyte_characters(current_buffer, Qnil);
@@ -4825,7 +4825,7 @@ handled:
         specbind(Qinhibit_modification_hooks, Qt);
 
         /* Save old undo list and don't record undo for decoding.  */
-        old_undo = BVAR(current_buffer, undo_list);
+        old_undo = buffer_undo_list(current_buffer);
         bset_undo_list(current_buffer, Qt);
 
         if (NILP(replace)) {
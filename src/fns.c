@@ -28,6 +28,11 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include <stdlib.h>
 #include <sys/random.h>
 #include <unistd.h>
+#if defined __SSE2__
+#include <emmintrin.h>
+#elif defined __ARM_NEON
+#include <arm_neon.h>
+#endif
 #include "bignum.h"
 #include "buffer.h"
 #include "character.h"
@@ -246,6 +251,170 @@ If STRING is multibyte, this may be greater than the length of STRING.  */)
     return make_fixnum(SBYTES(string));
 }
 
+/* Levenshtein distances are computed on arrays of character codes, or
+   of bytes.  Against a string of at most LEV_WORD_BITS codes, the
+   column of the distance table is kept as bit vectors of its vertical
+   differences, which each code of the other string updates in a few
+   word operations: the bit-parallel algorithm of Myers, in the form
+   Hyyrö gives it for edit distance.  Longer strings are compared in a
+   band around the diagonal, which widens until it holds the
+   distance.  */
+
+enum
+{
+    LEV_WORD_BITS = 64,
+    LEV_BAND_MIN = 16
+};
+
+/* The positions of each code in a string of at most LEV_WORD_BITS
+   codes, as bit masks.  */
+struct lev_pattern {
+    int len;
+    uint64_t low[256];
+    /* The codes of 256 and above, and their masks.  */
+    int nhigh;
+    int high[LEV_WORD_BITS];
+    uint64_t high_masks[LEV_WORD_BITS];
+};
+
+/* Store into CODES the characters of STRING, or its bytes if BYTES,
+   and return their number.  */
+static ptrdiff_t lev_decode(Lisp_Object string, bool bytes, int* codes) {
+    if (bytes) {
+        ptrdiff_t n = SBYTES(string);
+        for (ptrdiff_t i = 0; i < n; i++)
+            codes[i] = SREF(string, i);
+        return n;
+    }
+    ptrdiff_t n = SCHARS(string), i = 0, i_byte = 0;
+    for (ptrdiff_t k = 0; k < n; k++)
+        codes[k] = fetch_string_char_advance(string, &i, &i_byte);
+    return n;
+}
+
+static void lev_pattern_init(struct lev_pattern* p, int const* codes,
+                             ptrdiff_t len) {
+    eassert(len <= LEV_WORD_BITS);
+    p->len = len;
+    memset(p->low, 0, sizeof p->low);
+    p->nhigh = 0;
+    for (int k = 0; k < len; k++) {
+        uint64_t bit = (uint64_t)1 << k;
+        int c = codes[k];
+        if (c < 256)
+            p->low[c] |= bit;
+        else {
+            int j = 0;
+            while (j < p->nhigh && p->high[j] != c)
+                j++;
+            if (j == p->nhigh) {
+                p->high[j] = c;
+                p->high_masks[j] = 0;
+                p->nhigh++;
+            }
+            p->high_masks[j] |= bit;
+        }
+    }
+}
+
+static uint64_t lev_pattern_match(struct lev_pattern const* p, int c) {
+    if (c < 256)
+        return p->low[c];
+    for (int j = 0; j < p->nhigh; j++)
+        if (p->high[j] == c)
+            return p->high_masks[j];
+    return 0;
+}
+
+/* Return the Levenshtein distance between the string of pattern P and
+   the N codes at S.  */
+static ptrdiff_t lev_distance_bits(struct lev_pattern const* p,
+                                   int const* s, ptrdiff_t n) {
+    if (p->len == 0)
+        return n;
+    uint64_t top = (uint64_t)1 << (p->len - 1);
+    uint64_t pv = -1, mv = 0;
+    ptrdiff_t score = p->len;
+    for (ptrdiff_t x = 0; x < n; x++) {
+        uint64_t eq = lev_pattern_match(p, s[x]);
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        if (ph & top)
+            score++;
+        else if (mh & top)
+            score--;
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+    }
+    return score;
+}
+
+/* Return the Levenshtein distance between the N1 codes at S1 and the
+   N2 codes at S2 if it is at most K, and K + 1 otherwise.  Only the
+   cells of the table within K of the diagonal are computed, in COLUMN,
+   which has room for N1 + 1 elements.  N1 and N2 differ by at most
+   K.  */
+static ptrdiff_t lev_distance_band(int const* s1, ptrdiff_t n1,
+                                   int const* s2, ptrdiff_t n2, ptrdiff_t k,
+                                   ptrdiff_t* column) {
+    ptrdiff_t big = k + 1;
+    for (ptrdiff_t y = 0; y <= n1; y++)
+        column[y] = min(y, big);
+
+    for (ptrdiff_t x = 1; x <= n2; x++) {
+        ptrdiff_t lo = max(1, x - k), hi = min(n1, x + k);
+        ptrdiff_t lastdiag = column[lo - 1];
+        column[lo - 1] = lo == 1 ? min(x, big) : big;
+        for (ptrdiff_t y = lo; y <= hi; y++) {
+            ptrdiff_t olddiag = column[y];
+            column[y] = min(min(min(olddiag + 1, column[y - 1] + 1),
+                                lastdiag + (s1[y - 1] != s2[x - 1])),
+                            big);
+            lastdiag = olddiag;
+        }
+    }
+    return column[n1];
+}
+
+/* Return the Levenshtein distance between the N1 codes at S1 and the
+   N2 codes at S2.  */
+static ptrdiff_t lev_distance(int const* s1, ptrdiff_t n1, int const* s2,
+                              ptrdiff_t n2) {
+    /* A common prefix or suffix does not change the distance.  */
+    while (n1 > 0 && n2 > 0 && *s1 == *s2)
+        s1++, s2++, n1--, n2--;
+    while (n1 > 0 && n2 > 0 && s1[n1 - 1] == s2[n2 - 1])
+        n1--, n2--;
+
+    if (n1 > n2) {
+        int const* s = s1;
+        s1 = s2;
+        s2 = s;
+        ptrdiff_t n = n1;
+        n1 = n2;
+        n2 = n;
+    }
+
+    if (n1 <= LEV_WORD_BITS) {
+        struct lev_pattern p;
+        lev_pattern_init(&p, s1, n1);
+        return lev_distance_bits(&p, s2, n2);
+    }
+
+    USE_SAFE_ALLOCA;
+    ptrdiff_t* column;
+    SAFE_NALLOCA(column, 1, n1 + 1);
+    ptrdiff_t k = max(n2 - n1, LEV_BAND_MIN), d;
+    while ((d = lev_distance_band(s1, n1, s2, n2, k, column)) > k)
+        k *= 2;
+    SAFE_FREE();
+    return d;
+}
+
 DEFUN ("string-distance", Fstring_distance, Sstring_distance, 2, 3, 0,
        doc: /* Return Levenshtein distance between STRING1 and STRING2.
 The distance is the number of deletions, insertions, and substitutions
@@ -261,49 +430,72 @@ Letter-case is significant, but text properties are ignored. */)
 
     bool use_byte_compare = !NILP(bytecompare) ||
         (!STRING_MULTIBYTE(string1) && !STRING_MULTIBYTE(string2));
-    ptrdiff_t len1 = use_byte_compare ? SBYTES(string1) : SCHARS(string1);
-    ptrdiff_t len2 = use_byte_compare ? SBYTES(string2) : SCHARS(string2);
-    ptrdiff_t x, y, lastdiag, olddiag;
 
     USE_SAFE_ALLOCA;
-    ptrdiff_t* column;
-    SAFE_NALLOCA(column, 1, len1 + 1);
-    for (y = 0; y <= len1; y++)
-        column[y] = y;
-
-    if (use_byte_compare) {
-        char* s1 = SSDATA(string1);
-        char* s2 = SSDATA(string2);
-
-        for (x = 1; x <= len2; x++) {
-            column[0] = x;
-            for (y = 1, lastdiag = x - 1; y <= len1; y++) {
-                olddiag = column[y];
-                column[y] = min(min(column[y] + 1, column[y - 1] + 1),
-                                lastdiag + (s1[y - 1] == s2[x - 1] ? 0 : 1));
-                lastdiag = olddiag;
-            }
+    int *codes1, *codes2;
+    SAFE_NALLOCA(codes1, 1, SBYTES(string1));
+    SAFE_NALLOCA(codes2, 1, SBYTES(string2));
+    ptrdiff_t len1 = lev_decode(string1, use_byte_compare, codes1);
+    ptrdiff_t len2 = lev_decode(string2, use_byte_compare, codes2);
+    ptrdiff_t distance = lev_distance(codes1, len1, codes2, len2);
+    SAFE_FREE();
+    return make_fixnum(distance);
+}
+
+DEFUN ("string-distances", Fstring_distances, Sstring_distances, 2, 3, 0,
+       doc: /* Return the Levenshtein distances between STRING and CANDIDATES.
+CANDIDATES is a list or vector of strings.  The value is a vector of
+the distances between STRING and each of them, in order, as
+`string-distance' computes them with BYTECOMPARE.  This is faster than
+calling `string-distance' for each candidate.  */)
+(Lisp_Object string, Lisp_Object candidates, Lisp_Object bytecompare) {
+    CHECK_STRING(string);
+    if (!VECTORP(candidates))
+        candidates = Fvconcat(1, &candidates);
+    ptrdiff_t ncandidates = ASIZE(candidates);
+    for (ptrdiff_t i = 0; i < ncandidates; i++)
+        CHECK_STRING(AREF(candidates, i));
+
+    /* STRING in terms of bytes and of characters, decoded on demand.  */
+    struct {
+        int* codes;
+        ptrdiff_t len;
+        struct lev_pattern pattern;
+    } query[2] = {{NULL}, {NULL}};
+
+    USE_SAFE_ALLOCA;
+    int* codes = NULL;
+    ptrdiff_t codes_size = 0;
+    Lisp_Object result = make_nil_vector(ncandidates);
+
+    for (ptrdiff_t i = 0; i < ncandidates; i++) {
+        Lisp_Object candidate = AREF(candidates, i);
+        bool bytes = !NILP(bytecompare) ||
+            (!STRING_MULTIBYTE(string) && !STRING_MULTIBYTE(candidate));
+        if (!query[bytes].codes) {
+            SAFE_NALLOCA(query[bytes].codes, 1, SBYTES(string));
+            query[bytes].len = lev_decode(string, bytes, query[bytes].codes);
+            if (query[bytes].len <= LEV_WORD_BITS)
+                lev_pattern_init(&query[bytes].pattern, query[bytes].codes,
+                                 query[bytes].len);
         }
-    }
-    else {
-        int c1, c2;
-        ptrdiff_t i1, i1_byte, i2 = 0, i2_byte = 0;
-        for (x = 1; x <= len2; x++) {
-            column[0] = x;
-            c2 = fetch_string_char_advance(string2, &i2, &i2_byte);
-            i1 = i1_byte = 0;
-            for (y = 1, lastdiag = x - 1; y <= len1; y++) {
-                olddiag = column[y];
-                c1 = fetch_string_char_advance(string1, &i1, &i1_byte);
-                column[y] = min(min(column[y] + 1, column[y - 1] + 1),
-                                lastdiag + (c1 == c2 ? 0 : 1));
-                lastdiag = olddiag;
-            }
+        if (codes_size < SBYTES(candidate)) {
+            codes_size = max(SBYTES(candidate), 2 * codes_size);
+            SAFE_NALLOCA(codes, 1, codes_size);
         }
+
+        ptrdiff_t len = lev_decode(candidate, bytes, codes);
+        ptrdiff_t distance =
+            (query[bytes].len <= LEV_WORD_BITS
+                 ? lev_distance_bits(&query[bytes].pattern, codes, len)
+                 : lev_distance(query[bytes].codes, query[bytes].len, codes,
+                                len));
+        ASET(result, i, make_fixnum(distance));
+        rarely_quit(i + 1);
     }
 
     SAFE_FREE();
-    return make_fixnum(column[len1]);
+    return result;
 }
 
 DEFUN ("string-equal", Fstring_equal, Sstring_equal, 2, 2, 0,
@@ -970,6 +1162,9 @@ Lisp_Object concat_to_list(ptrdiff_t nargs, Lisp_Object* args,
             ptrdiff_t arglen = XFIXNUM(Flength(arg));
             ptrdiff_t argindex_byte = 0;
 
+            if (CLOSUREP(arg) && closure_body_pending_p(arg))
+                fetch_closure_body(arg);
+
             /* Copy element by element.  */
             for (ptrdiff_t argindex = 0; argindex < arglen; argindex++) {
                 /* Fetch next element of `arg' arg into `elt', or break if
@@ -1021,6 +1216,9 @@ Lisp_Object concat_to_vector(ptrdiff_t nargs, Lisp_Object* args) {
         if (!(VECTORP(arg) || CONSP(arg) || NILP(arg) || STRINGP(arg) ||
               BOOL_VECTOR_P(arg) || CLOSUREP(arg)))
             wrong_type_argument(Qsequencep, arg);
+        /* Before RESULT exists, as this can signal and GC.  */
+        if (CLOSUREP(arg) && closure_body_pending_p(arg))
+            fetch_closure_body(arg);
         EMACS_INT len = XFIXNAT(Flength(arg));
         result_len += len;
         if (MOST_POSITIVE_FIXNUM < result_len)
@@ -2961,6 +3159,7 @@ ARRAY is a vector, string, char-table, or bool-vector.  */)
         for (i = 0; i < (1 << CHARTAB_SIZE_BITS_0); i++)
             set_char_table_contents(array, i, item);
         set_char_table_defalt(array, item);
+        char_table_changed(array);
     }
     else if (STRINGP(array)) {
         unsigned char* p = SDATA(array);
@@ -2987,6 +3186,7 @@ ARRAY is a vector, string, char-table, or bool-vector.  */)
                 for (idx = 0; idx < size_byte; idx++)
                     *p++ = str[idx % len];
             }
+            STRING_CLEAR_HASH(array);
         }
     }
     else if (BOOL_VECTOR_P(array))
@@ -3007,6 +3207,7 @@ removes all text properties.  This may change its length.  */)
                          string);
     if (len != 0 || STRING_MULTIBYTE(string)) {
         memset(SDATA(string), 0, len);
+        STRING_CLEAR_HASH(string);
         STRING_SET_CHARS(string, len);
         STRING_SET_UNIBYTE(string);
     }
@@ -3073,6 +3274,8 @@ static EMACS_INT mapcar1(EMACS_INT leni, Lisp_Object* vals, Lisp_Object fn,
         }
     }
     else if (VECTORP(seq) || CLOSUREP(seq)) {
+        if (CLOSUREP(seq) && closure_body_pending_p(seq))
+            fetch_closure_body(seq);
         for (ptrdiff_t i = 0; i < leni; i++) {
             Lisp_Object dummy = calln(fn, AREF(seq, i));
             if (vals)
@@ -4134,7 +4337,7 @@ static ptrdiff_t base64_decode_1(const char* from, char* to, ptrdiff_t length,
    For uses of hash tables where the O(1) behavior of table
    operations is not a requirement, it might therefore be a good idea
    not to hash.  Instead, we could just do a linear search in the
-   key_and_value vector of the hash table.  This could be done
+   entries vector of the hash table.  This could be done
    if a `:linear-search t' argument is given to make-hash-table.  */
 
 
@@ -4149,17 +4352,12 @@ static void CHECK_HASH_TABLE(Lisp_Object x) {
 static void set_hash_next_slot(struct Lisp_Hash_Table* h, ptrdiff_t idx,
                                ptrdiff_t val) {
     eassert(idx >= 0 && idx < h->table_size);
-    h->next[idx] = val;
+    h->entries[idx].next = val;
 }
 static void set_hash_hash_slot(struct Lisp_Hash_Table* h, ptrdiff_t idx,
                                hash_hash_t val) {
     eassert(idx >= 0 && idx < h->table_size);
-    h->hash[idx] = val;
-}
-static void set_hash_index_slot(struct Lisp_Hash_Table* h, ptrdiff_t idx,
-                                ptrdiff_t val) {
-    eassert(idx >= 0 && idx < hash_table_index_size(h));
-    h->index[idx] = val;
+    h->entries[idx].hash = val;
 }
 
 /* If OBJ is a Lisp hash table, return a pointer to its struct
@@ -4216,20 +4414,194 @@ Lisp_Object larger_vector(Lisp_Object vec, ptrdiff_t incr_min,
              Low-level Functions
  ***********************************************************************/
 
-/* Return the index of the next entry in H following the one at IDX,
+/* Return the index of the free entry in H following the one at IDX,
    or -1 if none.  */
 
 static ptrdiff_t HASH_NEXT(struct Lisp_Hash_Table* h, ptrdiff_t idx) {
     eassert(idx >= 0 && idx < h->table_size);
-    return h->next[idx];
+    return h->entries[idx].next;
 }
 
-/* Return the index of the element in hash table H that is the start
-   of the collision list at index IDX, or -1 if the list is empty.  */
+/* A set of slots in a group of HASH_GROUP_WIDTH index slots, as a bit
+   mask with one bit set for each slot in the set.  The bit of slot K is
+   bit K << HASH_GROUP_SLOT_SHIFT, so that the masks can be made from
+   vector comparisons of the tags without further shuffling.  */
+typedef unsigned long long hash_group_mask_t;
+
+#if defined __SSE2__
+
+enum
+{
+    HASH_GROUP_SLOT_SHIFT = 0
+};
+
+/* The slots in the group whose tags start at TAGS that have tag TAG.  */
+static inline hash_group_mask_t hash_group_match(const unsigned char* tags,
+                                                 unsigned char tag) {
+    __m128i group = _mm_loadu_si128((const __m128i*)tags);
+    __m128i match = _mm_cmpeq_epi8(group, _mm_set1_epi8(tag));
+    return (unsigned)_mm_movemask_epi8(match);
+}
 
-static ptrdiff_t HASH_INDEX(struct Lisp_Hash_Table* h, ptrdiff_t idx) {
-    eassert(idx >= 0 && idx < hash_table_index_size(h));
-    return h->index[idx];
+/* The slots in the group whose tags start at TAGS that have no entry.  */
+static inline hash_group_mask_t
+hash_group_match_free(const unsigned char* tags) {
+    __m128i group = _mm_loadu_si128((const __m128i*)tags);
+    /* The tags of these slots are the ones without their top bit.  */
+    return (unsigned)_mm_movemask_epi8(group) ^ 0xffff;
+}
+
+#elif defined __ARM_NEON
+
+enum
+{
+    HASH_GROUP_SLOT_SHIFT = 2
+};
+
+/* Narrow V, a vector of bytes that are all ones or all zeros, to a mask
+   with the top bit of nibble K set if byte K is all ones.  */
+static inline hash_group_mask_t hash_group_mask(uint8x16_t v) {
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(v), 4);
+    return (vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) &
+            0x8888888888888888u);
+}
+
+static inline hash_group_mask_t hash_group_match(const unsigned char* tags,
+                                                 unsigned char tag) {
+    return hash_group_mask(vceqq_u8(vld1q_u8(tags), vdupq_n_u8(tag)));
+}
+
+static inline hash_group_mask_t
+hash_group_match_free(const unsigned char* tags) {
+    uint8x16_t full = vdupq_n_u8(HASH_TAG_FULL);
+    return hash_group_mask(vcltq_u8(vld1q_u8(tags), full));
+}
+
+#else
+
+enum
+{
+    HASH_GROUP_SLOT_SHIFT = 0
+};
+
+static inline hash_group_mask_t hash_group_match(const unsigned char* tags,
+                                                 unsigned char tag) {
+    hash_group_mask_t mask = 0;
+    for (int k = 0; k < HASH_GROUP_WIDTH; k++)
+        mask |= (hash_group_mask_t)(tags[k] == tag) << k;
+    return mask;
+}
+
+static inline hash_group_mask_t
+hash_group_match_free(const unsigned char* tags) {
+    hash_group_mask_t mask = 0;
+    for (int k = 0; k < HASH_GROUP_WIDTH; k++)
+        mask |= (hash_group_mask_t)!(tags[k] & HASH_TAG_FULL) << k;
+    return mask;
+}
+
+#endif
+
+/* The first slot of the nonempty set MASK.  */
+static inline int hash_group_first(hash_group_mask_t mask) {
+    return stdc_trailing_zeros_ull(mask) >> HASH_GROUP_SLOT_SHIFT;
+}
+
+/* Return the group of index slots of hash table H where searches for
+   hash code HASH start, and set *TAG to the tag of an entry with that
+   hash code.  Both come from one multiplicative hash, the group from
+   its top bits and the tag from bits well below them, so that entries
+   in the same group rarely share a tag.  */
+static inline ptrdiff_t hash_index_group(struct Lisp_Hash_Table* h,
+                                         hash_hash_t hash,
+                                         unsigned char* tag) {
+    uint64_t product = hash * UINT64_C(0x9e3779b97f4a7c15);
+    *tag = HASH_TAG_FULL | ((product >> 25) & (HASH_TAG_FULL - 1));
+    /* Shift in two steps, so that this works when index_bits is 0.  */
+    ptrdiff_t slot = (product >> 32) >> (32 - h->index_bits);
+    return slot / HASH_GROUP_WIDTH;
+}
+
+/* The mask that reduces group numbers modulo the number of groups of
+   index slots in H.  An index smaller than a group is a single group
+   whose tags past the index size stay empty.  */
+static inline ptrdiff_t hash_index_group_mask(struct Lisp_Hash_Table* h) {
+    return max(hash_table_index_size(h) / HASH_GROUP_WIDTH, 1) - 1;
+}
+
+/* Searches visit the groups of an index in the order GROUP, GROUP + 1,
+   GROUP + 3, GROUP + 6 and so on, modulo the number of groups, which
+   reaches every group because that number is a power of 2.  A search
+   for a key stops at the first group with an empty slot, since an entry
+   is always put in the first group with a slot that has no entry.  */
+#define HASH_INDEX_PROBE(h, group, stride)                                     \
+    for (ptrdiff_t stride = 1, stride##_mask = hash_index_group_mask(h);;    \
+         group = (group + stride++) & stride##_mask)
+
+/* Add entry I of hash table H, whose hash code is HASH, to the index.  */
+static void hash_index_insert(struct Lisp_Hash_Table* h, ptrdiff_t i,
+                              hash_hash_t hash) {
+    unsigned char tag;
+    ptrdiff_t group = hash_index_group(h, hash, &tag);
+    unsigned char* tags = hash_table_tags(h);
+    HASH_INDEX_PROBE(h, group, stride) {
+        ptrdiff_t base = group * HASH_GROUP_WIDTH;
+        hash_group_mask_t free = hash_group_match_free(tags + base);
+        if (free) {
+            ptrdiff_t slot = base + hash_group_first(free);
+            eassert(slot < hash_table_index_size(h));
+            if (tags[slot] == HASH_TAG_DELETED)
+                h->index_deleted--;
+            tags[slot] = tag;
+            h->index[slot] = i;
+            return;
+        }
+    }
+}
+
+/* Return the index slot of entry I of hash table H.  */
+static ptrdiff_t hash_index_entry_slot(struct Lisp_Hash_Table* h,
+                                       ptrdiff_t i) {
+    unsigned char tag;
+    ptrdiff_t group = hash_index_group(h, HASH_HASH(h, i), &tag);
+    unsigned char* tags = hash_table_tags(h);
+    HASH_INDEX_PROBE(h, group, stride) {
+        ptrdiff_t base = group * HASH_GROUP_WIDTH;
+        for (hash_group_mask_t match = hash_group_match(tags + base, tag);
+             match; match &= match - 1) {
+            ptrdiff_t slot = base + hash_group_first(match);
+            if (h->index[slot] == i)
+                return slot;
+        }
+        eassert(!hash_group_match(tags + base, HASH_TAG_EMPTY));
+    }
+}
+
+/* Remove the entry in index slot SLOT from the index of H.  */
+static void hash_index_remove(struct Lisp_Hash_Table* h, ptrdiff_t slot) {
+    unsigned char* tags = hash_table_tags(h);
+    ptrdiff_t base = slot - slot % HASH_GROUP_WIDTH;
+    eassert(tags[slot] & HASH_TAG_FULL);
+    /* No search goes past a group with an empty slot, so the slot can
+       be empty again if its group has one.  */
+    if (hash_group_match(tags + base, HASH_TAG_EMPTY))
+        tags[slot] = HASH_TAG_EMPTY;
+    else {
+        tags[slot] = HASH_TAG_DELETED;
+        h->index_deleted++;
+    }
+}
+
+/* Rebuild the index of hash table H from the hash codes of its
+   entries.  This also gets rid of the slots whose entry was removed.  */
+static void hash_index_rebuild(struct Lisp_Hash_Table* h) {
+    ptrdiff_t index_size = hash_table_index_size(h);
+    memset(hash_table_tags(h), HASH_TAG_EMPTY,
+           max(index_size, HASH_GROUP_WIDTH));
+    h->index_deleted = 0;
+    for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE(h); i++)
+        if (!hash_unused_entry_key_p(HASH_KEY(h, i)))
+            hash_index_insert(h, i, HASH_HASH(h, i));
 }
 
 /* Restore a hash table's mutability after the critical section exits.  */
@@ -4341,16 +4713,23 @@ static int compute_hash_index_bits(hash_idx_t size) {
     hash_idx_t upper_bound =
         min(MOST_POSITIVE_FIXNUM,
             min(TYPE_MAXIMUM(hash_idx_t), PTRDIFF_MAX / sizeof(hash_idx_t)));
-    /* Use next higher power of 2.  This works even for size=0.  */
-    int bits = elogb(size) + 1;
+    /* Use the next power of 2 above SIZE * 8/7, so that at least an
+       eighth of the slots stay empty.  This works even for size=0.  */
+    int bits = elogb(size + size / 7) + 1;
     if (bits >= TYPE_WIDTH(uintmax_t) || ((uintmax_t)1 << bits) > upper_bound)
         error("Hash table too large");
     return bits;
 }
 
-/* Constant hash index vector used when the table size is zero.
-   This avoids allocating it from the heap.  */
-static const hash_idx_t empty_hash_index_vector[] = {-1};
+/* Constant hash index used when the table size is zero: one unused
+   slot and a group of empty tags.  This avoids allocating it from the
+   heap.  */
+static const struct empty_hash_index
+{
+    hash_idx_t index[1];
+    unsigned char tags[HASH_GROUP_WIDTH];
+} empty_hash_index = {{-1}, {HASH_TAG_EMPTY}};
+static_assert(offsetof(struct empty_hash_index, tags) == sizeof(hash_idx_t));
 
 /* Create and initialize a new hash table.
 
@@ -4376,35 +4755,29 @@ Lisp_Object make_hash_table(const struct hash_table_test* test, EMACS_INT size,
     h->table_size = size;
 
     if (size == 0) {
-        h->key_and_value = NULL;
-        h->hash = NULL;
-        h->next = NULL;
+        h->entries = NULL;
         h->index_bits = 0;
-        h->index = (hash_idx_t*)empty_hash_index_vector;
+        h->index = (hash_idx_t*)empty_hash_index.index;
         h->next_free = -1;
     }
     else {
-        h->key_and_value =
-            hash_table_alloc_bytes(2 * size * sizeof *h->key_and_value);
-        for (ptrdiff_t i = 0; i < 2 * size; i++)
-            h->key_and_value[i] = HASH_UNUSED_ENTRY_KEY;
-
-        h->hash = hash_table_alloc_bytes(size * sizeof *h->hash);
-
-        h->next = hash_table_alloc_bytes(size * sizeof *h->next);
-        for (ptrdiff_t i = 0; i < size - 1; i++)
-            h->next[i] = i + 1;
-        h->next[size - 1] = -1;
+        h->entries = hash_table_alloc_bytes(size * sizeof *h->entries);
+        for (ptrdiff_t i = 0; i < size; i++) {
+            h->entries[i].key = HASH_UNUSED_ENTRY_KEY;
+            h->entries[i].value = Qnil;
+            h->entries[i].next = i + 1;
+        }
+        h->entries[size - 1].next = -1;
 
         int index_bits = compute_hash_index_bits(size);
         h->index_bits = index_bits;
-        ptrdiff_t index_size = hash_table_index_size(h);
-        h->index = hash_table_alloc_bytes(index_size * sizeof *h->index);
-        for (ptrdiff_t i = 0; i < index_size; i++)
-            h->index[i] = -1;
+        h->index = hash_table_alloc_bytes(hash_index_bytes(index_bits));
+        memset(hash_table_tags(h), HASH_TAG_EMPTY,
+               max(hash_table_index_size(h), HASH_GROUP_WIDTH));
 
         h->next_free = 0;
     }
+    h->index_deleted = 0;
 
     h->next_weak = NULL;
     h->mutable = true;
@@ -4423,31 +4796,17 @@ static Lisp_Object copy_hash_table(struct Lisp_Hash_Table* h1) {
     h2->mutable = true;
 
     if (h1->table_size > 0) {
-        ptrdiff_t kv_bytes = 2 * h1->table_size * sizeof *h1->key_and_value;
-        h2->key_and_value = hash_table_alloc_bytes(kv_bytes);
-        memcpy(h2->key_and_value, h1->key_and_value, kv_bytes);
-
-        ptrdiff_t hash_bytes = h1->table_size * sizeof *h1->hash;
-        h2->hash = hash_table_alloc_bytes(hash_bytes);
-        memcpy(h2->hash, h1->hash, hash_bytes);
-
-        ptrdiff_t next_bytes = h1->table_size * sizeof *h1->next;
-        h2->next = hash_table_alloc_bytes(next_bytes);
-        memcpy(h2->next, h1->next, next_bytes);
+        ptrdiff_t entries_bytes = h1->table_size * sizeof *h1->entries;
+        h2->entries = hash_table_alloc_bytes(entries_bytes);
+        memcpy(h2->entries, h1->entries, entries_bytes);
 
-        ptrdiff_t index_bytes = hash_table_index_size(h1) * sizeof *h1->index;
+        ptrdiff_t index_bytes = hash_index_bytes(h1->index_bits);
         h2->index = hash_table_alloc_bytes(index_bytes);
         memcpy(h2->index, h1->index, index_bytes);
     }
     return make_lisp_hash_table(h2);
 }
 
-/* Compute index into the index vector from a hash value.  */
-static inline ptrdiff_t hash_index_index(struct Lisp_Hash_Table* h,
-                                         hash_hash_t hash) {
-    return knuth_hash(hash, h->index_bits);
-}
-
 /* Resize hash table H if it's too full.  If H cannot be resized
    because it's already too large, throw an error.  */
 
@@ -4463,55 +4822,33 @@ static void maybe_resize_hash_table(struct Lisp_Hash_Table* h) {
 
         /* Allocate all the new vectors before updating *H, to
        avoid problems if memory is exhausted.  */
-        hash_idx_t* next = hash_table_alloc_bytes(new_size * sizeof *next);
-        for (ptrdiff_t i = old_size; i < new_size - 1; i++)
-            next[i] = i + 1;
-        next[new_size - 1] = -1;
-
-        Lisp_Object* key_and_value =
-            hash_table_alloc_bytes(2 * new_size * sizeof *key_and_value);
-        memcpy(key_and_value, h->key_and_value,
-               2 * old_size * sizeof *key_and_value);
-        for (ptrdiff_t i = 2 * old_size; i < 2 * new_size; i++)
-            key_and_value[i] = HASH_UNUSED_ENTRY_KEY;
-
-        hash_hash_t* hash = hash_table_alloc_bytes(new_size * sizeof *hash);
-        memcpy(hash, h->hash, old_size * sizeof *hash);
-
-        ptrdiff_t old_index_size = hash_table_index_size(h);
-        ptrdiff_t index_bits = compute_hash_index_bits(new_size);
-        ptrdiff_t index_size = (ptrdiff_t)1 << index_bits;
-        hash_idx_t* index = hash_table_alloc_bytes(index_size * sizeof *index);
-        for (ptrdiff_t i = 0; i < index_size; i++)
-            index[i] = -1;
+        struct hash_table_entry* entries =
+            hash_table_alloc_bytes(new_size * sizeof *entries);
+        memcpy(entries, h->entries, old_size * sizeof *entries);
+        for (ptrdiff_t i = old_size; i < new_size; i++) {
+            entries[i].key = HASH_UNUSED_ENTRY_KEY;
+            entries[i].value = Qnil;
+            entries[i].next = i + 1;
+        }
+        entries[new_size - 1].next = -1;
+
+        int old_index_bits = h->index_bits;
+        int index_bits = compute_hash_index_bits(new_size);
+        hash_idx_t* index =
+            hash_table_alloc_bytes(hash_index_bytes(index_bits));
 
         h->index_bits = index_bits;
         h->table_size = new_size;
         h->next_free = old_size;
 
-        if (old_index_size > 1)
-            hash_table_free_bytes(h->index, old_index_size * sizeof *h->index);
+        if (old_index_bits > 0)
+            hash_table_free_bytes(h->index, hash_index_bytes(old_index_bits));
         h->index = index;
 
-        hash_table_free_bytes(h->key_and_value,
-                              2 * old_size * sizeof *h->key_and_value);
-        h->key_and_value = key_and_value;
-
-        hash_table_free_bytes(h->hash, old_size * sizeof *h->hash);
-        h->hash = hash;
-
-        hash_table_free_bytes(h->next, old_size * sizeof *h->next);
-        h->next = next;
-
-        h->key_and_value = key_and_value;
+        hash_table_free_bytes(h->entries, old_size * sizeof *h->entries);
+        h->entries = entries;
 
-        /* Rehash: all data occupy entries 0..old_size-1.  */
-        for (ptrdiff_t i = 0; i < old_size; i++) {
-            hash_hash_t hash_code = HASH_HASH(h, i);
-            ptrdiff_t start_of_bucket = hash_index_index(h, hash_code);
-            set_hash_next_slot(h, i, HASH_INDEX(h, start_of_bucket));
-            set_hash_index_slot(h, start_of_bucket, i);
-        }
+        hash_index_rebuild(h);
     }
 }
 
@@ -4528,7 +4865,9 @@ hash_table_test_from_std(hash_table_std_test_t test) {
     emacs_abort();
 }
 
-/* Rebuild a hash table from its frozen (dumped) form.  */
+/* Rebuild a hash table from its frozen (dumped) form.  The entries stay
+   where they were dumped; this only allocates the index, and
+   hash_table_rehash_thawed fills in the hash codes and the index.  */
 void hash_table_thaw(Lisp_Object hash_table) {
     struct Lisp_Hash_Table* h = XHASH_TABLE(hash_table);
 
@@ -4538,36 +4877,59 @@ void hash_table_thaw(Lisp_Object hash_table) {
     ptrdiff_t size = h->count;
     h->table_size = size;
     h->next_free = -1;
+    h->index_deleted = 0;
 
     if (size == 0) {
-        h->key_and_value = NULL;
-        h->hash = NULL;
-        h->next = NULL;
+        h->entries = NULL;
         h->index_bits = 0;
-        h->index = (hash_idx_t*)empty_hash_index_vector;
+        h->index = (hash_idx_t*)empty_hash_index.index;
     }
     else {
-        ptrdiff_t index_bits = compute_hash_index_bits(size);
+        int index_bits = compute_hash_index_bits(size);
         h->index_bits = index_bits;
+        h->index = hash_table_alloc_bytes(hash_index_bytes(index_bits));
+    }
+}
 
-        h->hash = hash_table_alloc_bytes(size * sizeof *h->hash);
+/* Recompute the hash codes and index of a hash table that
+   hash_table_thaw has rebuilt.  Dumped tables use only the standard
+   tests, so this neither allocates nor calls Lisp, and distinct tables
+   can be rehashed on different threads at once.  String keys normally
+   bring their cached hash from the dump; when one does not, threads
+   that share it all store the same value.  */
+void hash_table_rehash_thawed(Lisp_Object hash_table) {
+    struct Lisp_Hash_Table* h = XHASH_TABLE(hash_table);
+    ptrdiff_t size = h->count;
+    if (size == 0)
+        return;
 
-        h->next = hash_table_alloc_bytes(size * sizeof *h->next);
+    /* Recompute the hash codes for each entry in the table.  */
+    for (ptrdiff_t i = 0; i < size; i++)
+        set_hash_hash_slot(h, i, hash_from_key(h, HASH_KEY(h, i)));
 
-        ptrdiff_t index_size = hash_table_index_size(h);
-        h->index = hash_table_alloc_bytes(index_size * sizeof *h->index);
-        for (ptrdiff_t i = 0; i < index_size; i++)
-            h->index[i] = -1;
+    hash_index_rebuild(h);
+}
 
-        /* Recompute the hash codes for each entry in the table.  */
-        for (ptrdiff_t i = 0; i < size; i++) {
-            Lisp_Object key = HASH_KEY(h, i);
-            hash_hash_t hash_code = hash_from_key(h, key);
-            ptrdiff_t start_of_bucket = hash_index_index(h, hash_code);
-            set_hash_hash_slot(h, i, hash_code);
-            set_hash_next_slot(h, i, HASH_INDEX(h, start_of_bucket));
-            set_hash_index_slot(h, start_of_bucket, i);
+/* Look up KEY with hash HASH in table H.
+   Return the index slot of its entry or -1 if none.  */
+static ptrdiff_t hash_find_slot(struct Lisp_Hash_Table* h, Lisp_Object key,
+                                hash_hash_t hash) {
+    unsigned char tag;
+    ptrdiff_t group = hash_index_group(h, hash, &tag);
+    unsigned char* tags = hash_table_tags(h);
+    HASH_INDEX_PROBE(h, group, stride) {
+        ptrdiff_t base = group * HASH_GROUP_WIDTH;
+        for (hash_group_mask_t match = hash_group_match(tags + base, tag);
+             match; match &= match - 1) {
+            ptrdiff_t slot = base + hash_group_first(match);
+            ptrdiff_t i = h->index[slot];
+            if (EQ(key, HASH_KEY(h, i)) ||
+                (h->test->cmpfn && hash == HASH_HASH(h, i) &&
+                 !NILP(h->test->cmpfn(key, HASH_KEY(h, i), h))))
+                return slot;
         }
+        if (hash_group_match(tags + base, HASH_TAG_EMPTY))
+            return -1;
     }
 }
 
@@ -4575,15 +4937,8 @@ void hash_table_thaw(Lisp_Object hash_table) {
    Return entry index or -1 if none.  */
 static ptrdiff_t hash_find_with_hash(struct Lisp_Hash_Table* h, Lisp_Object key,
                                      hash_hash_t hash) {
-    ptrdiff_t start_of_bucket = hash_index_index(h, hash);
-    for (ptrdiff_t i = HASH_INDEX(h, start_of_bucket); 0 <= i;
-         i = HASH_NEXT(h, i))
-        if (EQ(key, HASH_KEY(h, i)) ||
-            (h->test->cmpfn && hash == HASH_HASH(h, i) &&
-             !NILP(h->test->cmpfn(key, HASH_KEY(h, i), h))))
-            return i;
-
-    return -1;
+    ptrdiff_t slot = hash_find_slot(h, key, hash);
+    return slot < 0 ? -1 : h->index[slot];
 }
 
 /* Look up KEY in table H.  Return entry index or -1 if none.  */
@@ -4615,9 +4970,16 @@ ptrdiff_t hash_put(struct Lisp_Hash_Table* h, Lisp_Object key,
     eassert(!hash_unused_entry_key_p(key));
     /* Increment count after resizing because resizing may fail.  */
     maybe_resize_hash_table(h);
+
+    /* Keep a sixteenth of the index slots empty, so that searches for
+       absent keys stop soon.  */
+    ptrdiff_t index_size = hash_table_index_size(h);
+    if (h->index_deleted > 0 &&
+        h->count + h->index_deleted >= index_size - index_size / 16)
+        hash_index_rebuild(h);
     h->count++;
 
-    /* Store key/value in the key_and_value vector.  */
+    /* Store key/value in a free entry.  */
     ptrdiff_t i = h->next_free;
     eassert(hash_unused_entry_key_p(HASH_KEY(h, i)));
     h->next_free = HASH_NEXT(h, i);
@@ -4627,10 +4989,7 @@ ptrdiff_t hash_put(struct Lisp_Hash_Table* h, Lisp_Object key,
     /* Remember its hash code.  */
     set_hash_hash_slot(h, i, hash);
 
-    /* Add new entry to its collision chain.  */
-    ptrdiff_t start_of_bucket = hash_index_index(h, hash);
-    set_hash_next_slot(h, i, HASH_INDEX(h, start_of_bucket));
-    set_hash_index_slot(h, start_of_bucket, i);
+    hash_index_insert(h, i, hash);
     return i;
 }
 
@@ -4638,33 +4997,18 @@ ptrdiff_t hash_put(struct Lisp_Hash_Table* h, Lisp_Object key,
 /* Remove the entry matching KEY from hash table H, if there is one.  */
 
 void hash_remove_from_table(struct Lisp_Hash_Table* h, Lisp_Object key) {
-    hash_hash_t hashval = hash_from_key(h, key);
-    ptrdiff_t start_of_bucket = hash_index_index(h, hashval);
-    ptrdiff_t prev = -1;
-
-    for (ptrdiff_t i = HASH_INDEX(h, start_of_bucket); 0 <= i;
-         i = HASH_NEXT(h, i)) {
-        if (EQ(key, HASH_KEY(h, i)) ||
-            (h->test->cmpfn && hashval == HASH_HASH(h, i) &&
-             !NILP(h->test->cmpfn(key, HASH_KEY(h, i), h)))) {
-            /* Take entry out of collision chain.  */
-            if (prev < 0)
-                set_hash_index_slot(h, start_of_bucket, HASH_NEXT(h, i));
-            else
-                set_hash_next_slot(h, prev, HASH_NEXT(h, i));
-
-            /* Clear slots in key_and_value and add the slots to
-               the free list.  */
-            set_hash_key_slot(h, i, HASH_UNUSED_ENTRY_KEY);
-            set_hash_value_slot(h, i, Qnil);
-            set_hash_next_slot(h, i, h->next_free);
-            h->next_free = i;
-            h->count--;
-            eassert(h->count >= 0);
-            break;
-        }
+    ptrdiff_t slot = hash_find_slot(h, key, hash_from_key(h, key));
+    if (slot >= 0) {
+        ptrdiff_t i = h->index[slot];
+        hash_index_remove(h, slot);
 
-        prev = i;
+        /* Clear the entry and add it to the free list.  */
+        set_hash_key_slot(h, i, HASH_UNUSED_ENTRY_KEY);
+        set_hash_value_slot(h, i, Qnil);
+        set_hash_next_slot(h, i, h->next_free);
+        h->next_free = i;
+        h->count--;
+        eassert(h->count >= 0);
     }
 }
 
@@ -4680,9 +5024,9 @@ static void hash_clear(struct Lisp_Hash_Table* h) {
             set_hash_value_slot(h, i, Qnil);
         }
 
-        ptrdiff_t index_size = hash_table_index_size(h);
-        for (ptrdiff_t i = 0; i < index_size; i++)
-            h->index[i] = -1;
+        memset(hash_table_tags(h), HASH_TAG_EMPTY,
+               max(hash_table_index_size(h), HASH_GROUP_WIDTH));
+        h->index_deleted = 0;
 
         h->next_free = 0;
         h->count = 0;
@@ -4719,59 +5063,49 @@ static inline bool keep_entry_p(hash_table_weakness_t weakness, bool strong_key,
    true if anything was marked.  */
 
 bool sweep_weak_table(struct Lisp_Hash_Table* h, bool remove_entries_p) {
-    ptrdiff_t n = hash_table_index_size(h);
+    ptrdiff_t size = HASH_TABLE_SIZE(h);
     bool marked = false;
 
-    for (ptrdiff_t bucket = 0; bucket < n; ++bucket) {
-        /* Follow collision chain, removing entries that don't survive
-           this garbage collection.  */
-        ptrdiff_t prev = -1;
-        ptrdiff_t next;
-        for (ptrdiff_t i = HASH_INDEX(h, bucket); 0 <= i; i = next) {
-            bool key_known_to_survive_p = survives_gc_p(HASH_KEY(h, i));
-            bool value_known_to_survive_p = survives_gc_p(HASH_VALUE(h, i));
-            bool remove_p = !keep_entry_p(h->weakness, key_known_to_survive_p,
-                                          value_known_to_survive_p);
-
-            next = HASH_NEXT(h, i);
-
-            if (remove_entries_p) {
-                eassert(!remove_p ==
-                        (key_known_to_survive_p && value_known_to_survive_p));
-                if (remove_p) {
-                    /* Take out of collision chain.  */
-                    if (prev < 0)
-                        set_hash_index_slot(h, bucket, next);
-                    else
-                        set_hash_next_slot(h, prev, next);
+    for (ptrdiff_t i = 0; i < size; i++) {
+        Lisp_Object key = HASH_KEY(h, i);
+        if (hash_unused_entry_key_p(key))
+            continue;
 
-                    /* Add to free list.  */
-                    set_hash_next_slot(h, i, h->next_free);
-                    h->next_free = i;
+        bool key_known_to_survive_p = survives_gc_p(key);
+        bool value_known_to_survive_p = survives_gc_p(HASH_VALUE(h, i));
+        bool remove_p = !keep_entry_p(h->weakness, key_known_to_survive_p,
+                                      value_known_to_survive_p);
 
-                    /* Clear key and value.  */
-                    set_hash_key_slot(h, i, HASH_UNUSED_ENTRY_KEY);
-                    set_hash_value_slot(h, i, Qnil);
+        if (remove_entries_p) {
+            eassert(!remove_p ==
+                    (key_known_to_survive_p && value_known_to_survive_p));
+            if (remove_p) {
+                /* Take out of the index.  */
+                hash_index_remove(h, hash_index_entry_slot(h, i));
 
-                    eassert(h->count != 0);
-                    h->count--;
-                }
-                else {
-                    prev = i;
-                }
+                /* Add to free list.  */
+                set_hash_next_slot(h, i, h->next_free);
+                h->next_free = i;
+
+                /* Clear key and value.  */
+                set_hash_key_slot(h, i, HASH_UNUSED_ENTRY_KEY);
+                set_hash_value_slot(h, i, Qnil);
+
+                eassert(h->count != 0);
+                h->count--;
             }
-            else {
-                if (!remove_p) {
-                    /* Make sure key and value survive.  */
-                    if (!key_known_to_survive_p) {
-                        mark_object(HASH_KEY(h, i));
-                        marked = true;
-                    }
+        }
+        else {
+            if (!remove_p) {
+                /* Make sure key and value survive.  */
+                if (!key_known_to_survive_p) {
+                    mark_object(key);
+                    marked = true;
+                }
 
-                    if (!value_known_to_survive_p) {
-                        mark_object(HASH_VALUE(h, i));
-                        marked = true;
-                    }
+                if (!value_known_to_survive_p) {
+                    mark_object(HASH_VALUE(h, i));
+                    marked = true;
                 }
             }
         }
@@ -4794,58 +5128,127 @@ bool sweep_weak_table(struct Lisp_Hash_Table* h, bool remove_entries_p) {
 
 #define SXHASH_MAX_LEN 7
 
-/* Return a hash for string PTR which has length LEN.  The hash value
-   can be any EMACS_UINT value.  */
+/* Multiply *A and *B, and store the low and high 64 bits of the
+   product in *A and *B.  */
+static inline void hash_mul128(uint64_t* a, uint64_t* b) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 product = (unsigned __int128)*a * *b;
+    *a = product;
+    *b = product >> 64;
+#else
+    uint64_t ah = *a >> 32, al = *a & 0xffffffff;
+    uint64_t bh = *b >> 32, bl = *b & 0xffffffff;
+    uint64_t mid1 = ah * bl, mid2 = al * bh;
+    uint64_t lo = al * bl, hi = ah * bh;
+    uint64_t t = lo + (mid1 << 32);
+    hi += (mid1 >> 32) + (t < lo);
+    lo = t + (mid2 << 32);
+    hi += (mid2 >> 32) + (lo < t);
+    *a = lo;
+    *b = hi;
+#endif
+}
 
-EMACS_UINT
-hash_char_array(char const* ptr, ptrdiff_t len) {
-    char const* p = ptr;
-    char const* end = ptr + len;
-    EMACS_UINT hash = len;
-    /* At most 8 steps.  We could reuse SXHASH_MAX_LEN, of course,
-     * but dividing by 8 is cheaper.  */
-    ptrdiff_t step = max(sizeof hash, ((end - p) >> 3));
-
-    if (p + sizeof hash <= end) {
-        do {
-            EMACS_UINT c;
-            /* We presume that the compiler will replace this `memcpy` with
-               a single load/move instruction when applicable.  */
-            memcpy(&c, p, sizeof hash);
-            p += step;
-            hash = sxhash_combine(hash, c);
-        } while (p + sizeof hash <= end);
-        /* Hash the last word's worth of bytes in the string, because that is
-           is often the part where strings differ.  This may cause some
-           bytes to be hashed twice but we assume that's not a big problem.  */
-        EMACS_UINT c;
-        memcpy(&c, end - sizeof c, sizeof c);
-        hash = sxhash_combine(hash, c);
+/* Multiply A and B, and fold the 128-bit product to 64 bits.  */
+static inline uint64_t hash_mix(uint64_t a, uint64_t b) {
+    hash_mul128(&a, &b);
+    return a ^ b;
+}
+
+static inline uint64_t hash_read64(unsigned char const* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof v);
+    return v;
+}
+
+static inline uint64_t hash_read32(unsigned char const* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof v);
+    return v;
+}
+
+/* Return a 64-bit hash for string PTR which has length LEN.
+
+   Every byte counts, so that long strings that differ only in their
+   middle do not collide.  The hash multiplies words with constants and
+   folds the 128-bit products, like wyhash; long strings are read in
+   three independent lanes of 16 bytes, so that the multiplications
+   overlap.  */
+
+static uint64_t hash_bytes(char const* ptr, ptrdiff_t len) {
+    static uint64_t const k0 = 0xa0761d6478bd642f, k1 = 0xe7037ed1a0b428db,
+                          k2 = 0x8ebc6af09c88c6e3, k3 = 0x589965cc75374cc3;
+    unsigned char const* p = (unsigned char const*)ptr;
+    uint64_t seed = hash_mix(k0, k1);
+    uint64_t a, b;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            /* Two possibly overlapping 4-byte reads from each end.  */
+            ptrdiff_t mid = (len >> 3) << 2;
+            a = (hash_read32(p) << 32) | hash_read32(p + mid);
+            b = (hash_read32(p + len - 4) << 32) |
+                hash_read32(p + len - 4 - mid);
+        }
+        else if (len > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) |
+                p[len - 1];
+            b = 0;
+        }
+        else
+            a = b = 0;
     }
     else {
-        /* String is shorter than an EMACS_UINT.  Use smaller loads.  */
-        eassume(p <= end && end - p < sizeof(EMACS_UINT));
-        EMACS_UINT tail = 0;
-        static_assert(sizeof tail <= 8);
-#if EMACS_INT_MAX > INT32_MAX
-        if (end - p >= 4) {
-            uint32_t c;
-            memcpy(&c, p, sizeof c);
-            tail = (tail << (8 * sizeof c)) + c;
-            p += sizeof c;
+        ptrdiff_t i = len;
+        if (i > 48) {
+            uint64_t lane1 = seed, lane2 = seed;
+            do {
+                seed = hash_mix(hash_read64(p) ^ k1, hash_read64(p + 8) ^ seed);
+                lane1 = hash_mix(hash_read64(p + 16) ^ k2,
+                                 hash_read64(p + 24) ^ lane1);
+                lane2 = hash_mix(hash_read64(p + 32) ^ k3,
+                                 hash_read64(p + 40) ^ lane2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= lane1 ^ lane2;
         }
-#endif
-        if (end - p >= 2) {
-            uint16_t c;
-            memcpy(&c, p, sizeof c);
-            tail = (tail << (8 * sizeof c)) + c;
-            p += sizeof c;
+        while (i > 16) {
+            seed = hash_mix(hash_read64(p) ^ k1, hash_read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
         }
-        if (p < end)
-            tail = (tail << 8) + (unsigned char)*p;
-        hash = sxhash_combine(hash, tail);
+        /* The last 16 bytes, which may overlap bytes already hashed.  */
+        a = hash_read64(p + i - 16);
+        b = hash_read64(p + i - 8);
     }
 
+    a ^= k1;
+    b ^= seed;
+    hash_mul128(&a, &b);
+    return hash_mix(a ^ k0 ^ len, b ^ k1);
+}
+
+/* Return a hash for string PTR which has length LEN, as hash_bytes
+   does.  The hash value can be any EMACS_UINT value.  */
+
+EMACS_UINT
+hash_char_array(char const* ptr, ptrdiff_t len) {
+    uint64_t hash = hash_bytes(ptr, len);
+    /* Fold the hash if EMACS_UINT is narrower.  */
+    return hash ^ (EMACS_UINT_WIDTH < 64 ? hash >> 32 : 0);
+}
+
+/* Return the hash of the data of string STRING, which is cached in
+   STRING.  */
+
+EMACS_UINT sxhash_string(Lisp_Object string) {
+    struct Lisp_String* s = XSTRING(string);
+    EMACS_UINT hash = s->u.s.hash;
+    if (hash == 0) {
+        hash = hash_char_array(SSDATA(string), SBYTES(string));
+        s->u.s.hash = hash;
+    }
     return hash;
 }
 
@@ -4943,7 +5346,7 @@ static EMACS_UINT sxhash_obj(Lisp_Object obj, int depth) {
         return XHASH(obj);
 
     case Lisp_String:
-        return hash_char_array(SSDATA(obj), SBYTES(obj));
+        return sxhash_string(obj);
 
     case Lisp_Vectorlike:
         {
@@ -5371,21 +5774,27 @@ returns nil, then (funcall TEST x1 x2) also returns nil.  */)
 
 DEFUN("internal--hash-table-histogram", Finternal__hash_table_histogram,
       Sinternal__hash_table_histogram, 1, 1, 0,
-      doc:/* Bucket size histogram of HASH-TABLE.  Internal use only. */)
+      doc:/* Probe length histogram of HASH-TABLE.  Internal use only.
+Each element is (N . COUNT), COUNT being the number of keys found in the
+Nth group of index slots that a search for them looks at.  */)
 (Lisp_Object hash_table) {
     struct Lisp_Hash_Table* h = check_hash_table(hash_table);
-    ptrdiff_t size = HASH_TABLE_SIZE(h);
-    ptrdiff_t* freq = xzalloc(size * sizeof *freq);
-    ptrdiff_t index_size = hash_table_index_size(h);
-    for (ptrdiff_t i = 0; i < index_size; i++) {
+    ptrdiff_t ngroups = hash_index_group_mask(h) + 1;
+    ptrdiff_t* freq = xzalloc(ngroups * sizeof *freq);
+    DOHASH_SAFE(h, i) {
+        unsigned char tag;
+        ptrdiff_t group = hash_index_group(h, HASH_HASH(h, i), &tag);
+        ptrdiff_t target = hash_index_entry_slot(h, i) / HASH_GROUP_WIDTH;
         ptrdiff_t n = 0;
-        for (ptrdiff_t j = HASH_INDEX(h, i); j != -1; j = HASH_NEXT(h, j))
+        HASH_INDEX_PROBE(h, group, stride) {
+            if (group == target)
+                break;
             n++;
-        if (n > 0)
-            freq[n - 1]++;
+        }
+        freq[n]++;
     }
     Lisp_Object ret = Qnil;
-    for (ptrdiff_t i = 0; i < size; i++)
+    for (ptrdiff_t i = 0; i < ngroups; i++)
         if (freq[i] > 0)
             ret = Fcons(Fcons(make_int(i + 1), make_int(freq[i])), ret);
     xfree(freq);
@@ -5396,17 +5805,22 @@ DEFUN ("internal--hash-table-buckets",
        Finternal__hash_table_buckets,
        Sinternal__hash_table_buckets,
        1, 1, 0,
-       doc: /* (KEY . HASH) in HASH-TABLE, grouped by bucket.
+       doc: /* (KEY . HASH) in HASH-TABLE, grouped by group of index slots.
 Internal use only. */)
 (Lisp_Object hash_table) {
     struct Lisp_Hash_Table* h = check_hash_table(hash_table);
     Lisp_Object ret = Qnil;
     ptrdiff_t index_size = hash_table_index_size(h);
-    for (ptrdiff_t i = 0; i < index_size; i++) {
+    unsigned char* tags = hash_table_tags(h);
+    for (ptrdiff_t base = 0; base < index_size; base += HASH_GROUP_WIDTH) {
         Lisp_Object bucket = Qnil;
-        for (ptrdiff_t j = HASH_INDEX(h, i); j != -1; j = HASH_NEXT(h, j))
-            bucket =
-                Fcons(Fcons(HASH_KEY(h, j), make_int(HASH_HASH(h, j))), bucket);
+        ptrdiff_t end = min(base + HASH_GROUP_WIDTH, index_size);
+        for (ptrdiff_t slot = base; slot < end; slot++)
+            if (tags[slot] & HASH_TAG_FULL) {
+                ptrdiff_t j = h->index[slot];
+                bucket = Fcons(Fcons(HASH_KEY(h, j), make_int(HASH_HASH(h, j))),
+                               bucket);
+            }
         if (!NILP(bucket))
             ret = Fcons(Fnreverse(bucket), ret);
     }
@@ -5455,12 +5869,40 @@ DEFUN("secure-hash-algorithms", Fsecure_hash_algorithms,
       doc:/* Return a list of all the supported `secure-hash' algorithms. */)
 (void) { return list(Qmd5, Qsha1, Qsha224, Qsha256, Qsha384, Qsha512); }
 
-/* Extract data from a string or a buffer. SPEC is a list of
-(BUFFER-OR-STRING-OR-SYMBOL START END CODING-SYSTEM NOERROR) which behave as
-specified with `secure-hash' and in Info node
-`(elisp)Format of GnuTLS Cryptography Inputs'.  */
-char* extract_data_from_object(Lisp_Object spec, ptrdiff_t* start_byte,
-                               ptrdiff_t* end_byte) {
+/* Return true if the bytes from B_BYTE to E_BYTE of the current buffer,
+which hold the characters from B to E, are what encoding them with
+CODING_SYSTEM produces.  This is the case that the fast path of
+code_convert_string handles.  */
+static bool buffer_text_encodes_as_is(Lisp_Object coding_system,
+                                      ptrdiff_t b, ptrdiff_t e,
+                                      ptrdiff_t b_byte, ptrdiff_t e_byte) {
+    if (NILP(BVAR(current_buffer, enable_multibyte_characters)))
+        return true;
+    if (e_byte - b_byte != e - b)
+        return false;
+    if (NILP(coding_system))
+        return true;
+
+    ptrdiff_t id = CODING_SYSTEM_ID(coding_system);
+    if (id < 0 || NILP(CODING_ATTR_ASCII_COMPAT(CODING_ID_ATTRS(id))))
+        return false;
+    if (EQ(CODING_ID_EOL_TYPE(id), Qunix) || inhibit_eol_conversion)
+        return true;
+
+    ptrdiff_t gpt = clip_to_bounds(b_byte, GPT_BYTE, e_byte);
+    return (!memchr(BYTE_POS_ADDR(b_byte), '\n', gpt - b_byte) &&
+            !memchr(BYTE_POS_ADDR(gpt), '\n', e_byte - gpt));
+}
+
+/* Extract data from a string or a buffer, as extract_data_from_object
+does.  If TEXT is non-null and SPEC is a region of a buffer whose text
+encodes as itself, store the buffer into *TEXT and the byte positions of
+the region into *START_BYTE and *END_BYTE, and return NULL, so that the
+caller can read the text in place instead of copying it.  */
+static char* extract_data_from_object_1(Lisp_Object spec,
+                                        ptrdiff_t* start_byte,
+                                        ptrdiff_t* end_byte,
+                                        struct buffer** text) {
     Lisp_Object object = XCAR(spec);
 
     if (CONSP(spec))
@@ -5587,6 +6029,21 @@ char* extract_data_from_object(Lisp_Object spec, ptrdiff_t* start_byte,
             }
         }
 
+        if (text) {
+            ptrdiff_t b_byte = CHAR_TO_BYTE(b), e_byte = CHAR_TO_BYTE(e);
+            if (buffer_text_encodes_as_is(coding_system, b, e, b_byte,
+                                          e_byte)) {
+                if (!NILP(BVAR(bp, enable_multibyte_characters)))
+                    Vlast_coding_system_used = coding_system;
+                set_buffer_internal(prev);
+                specpdl_ptr--;
+                *text = bp;
+                *start_byte = b_byte;
+                *end_byte = e_byte;
+                return NULL;
+            }
+        }
+
         object = make_buffer_string(b, e, false);
         set_buffer_internal(prev);
         /* Discard the unwind protect for recovering the current
@@ -5628,6 +6085,57 @@ char* extract_data_from_object(Lisp_Object spec, ptrdiff_t* start_byte,
     return SSDATA(object);
 }
 
+/* Extract data from a string or a buffer. SPEC is a list of
+(BUFFER-OR-STRING-OR-SYMBOL START END CODING-SYSTEM NOERROR) which behave as
+specified with `secure-hash' and in Info node
+`(elisp)Format of GnuTLS Cryptography Inputs'.  */
+char* extract_data_from_object(Lisp_Object spec, ptrdiff_t* start_byte,
+                               ptrdiff_t* end_byte) {
+    return extract_data_from_object_1(spec, start_byte, end_byte, NULL);
+}
+
+/* Store into DIGEST the hash with ALGORITHM of the bytes from START_BYTE
+   to END_BYTE of buffer B, reading them on both sides of the gap.  */
+
+static void secure_hash_buffer_text(Lisp_Object algorithm, struct buffer* b,
+                                    ptrdiff_t start_byte, ptrdiff_t end_byte,
+                                    char* digest) {
+    ptrdiff_t gpt = clip_to_bounds(start_byte, BUF_GPT_BYTE(b), end_byte);
+    unsigned char const* seg[2] = {BUF_BYTE_ADDRESS(b, start_byte),
+                                   BUF_BYTE_ADDRESS(b, gpt)};
+    size_t len[2] = {gpt - start_byte, end_byte - gpt};
+    union {
+        struct md5_ctx md5;
+        struct sha1_ctx sha1;
+        struct sha256_ctx sha256;
+        struct sha512_ctx sha512;
+    } ctx;
+
+#define HASH_SEGMENTS(init, process, finish, field)                            \
+    (init(&ctx.field), process(seg[0], len[0], &ctx.field),                    \
+     process(seg[1], len[1], &ctx.field), finish(&ctx.field, digest))
+
+    if (EQ(algorithm, Qmd5))
+        HASH_SEGMENTS(md5_init_ctx, md5_process_bytes, md5_finish_ctx, md5);
+    else if (EQ(algorithm, Qsha1))
+        HASH_SEGMENTS(sha1_init_ctx, sha1_process_bytes, sha1_finish_ctx,
+                      sha1);
+    else if (EQ(algorithm, Qsha224))
+        HASH_SEGMENTS(sha224_init_ctx, sha256_process_bytes, sha224_finish_ctx,
+                      sha256);
+    else if (EQ(algorithm, Qsha256))
+        HASH_SEGMENTS(sha256_init_ctx, sha256_process_bytes, sha256_finish_ctx,
+                      sha256);
+    else if (EQ(algorithm, Qsha384))
+        HASH_SEGMENTS(sha384_init_ctx, sha512_process_bytes, sha384_finish_ctx,
+                      sha512);
+    else
+        HASH_SEGMENTS(sha512_init_ctx, sha512_process_bytes, sha512_finish_ctx,
+                      sha512);
+
+#undef HASH_SEGMENTS
+}
+
 
 /* ALGORITHM is a symbol: md5, sha1, sha224 and so on. */
 
@@ -5644,9 +6152,11 @@ static Lisp_Object secure_hash(Lisp_Object algorithm, Lisp_Object object,
 
     Lisp_Object spec = list5(object, start, end, coding_system, noerror);
 
-    const char* input = extract_data_from_object(spec, &start_byte, &end_byte);
+    struct buffer* text = NULL;
+    const char* input =
+        extract_data_from_object_1(spec, &start_byte, &end_byte, &text);
 
-    if (input == NULL)
+    if (input == NULL && !text)
         error("secure_hash: Failed to extract data from object, aborting!");
 
     if (EQ(algorithm, Qmd5)) {
@@ -5680,7 +6190,13 @@ static Lisp_Object secure_hash(Lisp_Object algorithm, Lisp_Object object,
        hexified value */
     digest = make_uninit_string(digest_size * 2);
 
-    hash_func(input + start_byte, end_byte - start_byte, SSDATA(digest));
+    /* The text of a buffer is read in place, after the allocation of
+       DIGEST, which can relocate it.  */
+    if (text)
+        secure_hash_buffer_text(algorithm, text, start_byte, end_byte,
+                                SSDATA(digest));
+    else
+        hash_func(input + start_byte, end_byte - start_byte, SSDATA(digest));
 
     if (NILP(binary))
         return make_digest_string(digest, digest_size);
@@ -5757,7 +6273,90 @@ of the other hash types instead, e.g. sha256 or sha512.  */)
     return secure_hash(algorithm, object, start, end, Qnil, Qnil, binary);
 }
 
-DEFUN ("buffer-hash", Fbuffer_hash, Sbuffer_hash, 0, 1, 0,
+/* `buffer-hash' with FAST hashes the text of a buffer in chunks of
+   BUFFER_HASH_CHUNK bytes, and then the array of the chunk hashes.  The
+   chunks of a buffer of more than BUFFER_HASH_PARALLEL_MIN bytes are
+   hashed by up to BUFFER_HASH_MAX_WORKERS threads besides the main
+   one.  */
+enum
+{
+    BUFFER_HASH_CHUNK = 256 * 1024,
+    BUFFER_HASH_PARALLEL_MIN = 4 * 1024 * 1024,
+    BUFFER_HASH_MAX_WORKERS = 7
+};
+
+struct buffer_hash_job {
+    /* The text on both sides of the gap, and the size of the first
+       part.  */
+    unsigned char const* before;
+    unsigned char const* after;
+    ptrdiff_t before_bytes, bytes;
+
+    /* A copy of the chunk that the gap splits, or NULL.  */
+    unsigned char* split;
+
+    uint64_t* hashes;
+    ptrdiff_t nchunks;
+};
+
+/* Hash the chunks from START to END of the buffer_hash_job at ARG.  */
+
+static void buffer_hash_chunks(void* arg, ptrdiff_t start, ptrdiff_t end) {
+    struct buffer_hash_job* job = arg;
+    for (ptrdiff_t i = start; i < end; i++) {
+        ptrdiff_t beg = i * BUFFER_HASH_CHUNK;
+        ptrdiff_t len = min(BUFFER_HASH_CHUNK, job->bytes - beg);
+        unsigned char const* p;
+        if (beg + len <= job->before_bytes)
+            p = job->before + beg;
+        else if (beg >= job->before_bytes)
+            p = job->after + (beg - job->before_bytes);
+        else
+            p = job->split;
+        job->hashes[i] = hash_bytes((char const*)p, len);
+    }
+}
+
+/* Return the FAST hash of the text of buffer B.  */
+
+static uint64_t buffer_hash_fast(struct buffer* b) {
+    struct buffer_hash_job job = {
+        .before = BUF_BEG_ADDR(b),
+        .after = BUF_GAP_END_ADDR(b),
+        .before_bytes = BUF_GPT_BYTE(b) - BUF_BEG_BYTE(b),
+        .bytes = BUF_Z_BYTE(b) - BUF_BEG_BYTE(b),
+    };
+    job.nchunks = (job.bytes + BUFFER_HASH_CHUNK - 1) / BUFFER_HASH_CHUNK;
+    job.hashes = xnmalloc(job.nchunks, sizeof *job.hashes);
+
+    ptrdiff_t split_beg = job.before_bytes / BUFFER_HASH_CHUNK
+                          * BUFFER_HASH_CHUNK;
+    ptrdiff_t split_len = min(BUFFER_HASH_CHUNK, job.bytes - split_beg);
+    if (split_beg < job.before_bytes &&
+        job.before_bytes < split_beg + split_len) {
+        ptrdiff_t n = job.before_bytes - split_beg;
+        job.split = xmalloc(split_len);
+        memcpy(job.split, job.before + split_beg, n);
+        memcpy(job.split + n, job.after, split_len - n);
+    }
+
+    int nworkers = 0;
+    if (job.bytes >= BUFFER_HASH_PARALLEL_MIN) {
+        long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nworkers =
+            min(min(ncpus - 1, BUFFER_HASH_MAX_WORKERS), job.nchunks - 1);
+    }
+    sys_parallel("buffer-hash", buffer_hash_chunks, &job, job.nchunks, 1,
+                 nworkers);
+
+    uint64_t hash = hash_bytes((char const*)job.hashes,
+                               job.nchunks * sizeof *job.hashes);
+    xfree(job.split);
+    xfree(job.hashes);
+    return hash;
+}
+
+DEFUN ("buffer-hash", Fbuffer_hash, Sbuffer_hash, 0, 2, 0,
        doc: /* Return a hash of the contents of BUFFER-OR-NAME.
 This hash is performed on the raw internal format of the buffer,
 disregarding any coding systems.  If nil, use the current buffer.
@@ -5767,9 +6366,14 @@ Emacs, but is not guaranteed to return the same hash between different
 Emacs versions.  It should be somewhat more efficient on larger
 buffers than `secure-hash' is, and should not allocate more memory.
 
+If FAST is non-nil, return a 16-character hash that is not
+cryptographic, but much faster to compute; the text of a large buffer
+is hashed in parallel.  This is meant for noticing changes to a
+buffer.
+
 It should not be used for anything security-related.  See
 `secure-hash' for these applications.  */ )
-(Lisp_Object buffer_or_name) {
+(Lisp_Object buffer_or_name, Lisp_Object fast) {
     Lisp_Object buffer;
     struct buffer* b;
     struct sha1_ctx ctx;
@@ -5782,6 +6386,14 @@ It should not be used for anything security-related.  See
         nsberror(buffer_or_name);
 
     b = XBUFFER(buffer);
+
+    if (!NILP(fast)) {
+        uint64_t hash = buffer_hash_fast(b);
+        Lisp_Object digest = make_uninit_string(sizeof hash * 2);
+        memcpy(SDATA(digest), &hash, sizeof hash);
+        return make_digest_string(digest, sizeof hash);
+    }
+
     sha1_init_ctx(&ctx);
 
     /* Process the first part of the buffer. */
@@ -5876,6 +6488,32 @@ characters.  */ )
     return list3(make_int(lines), make_int(longest), make_float(mean));
 }
 
+/* Return the address of the first occurrence of the NLEN bytes at
+   NEEDLE in the HLEN bytes at HAY, or NULL if there is none.  The
+   group matching of the hash table index serves as a filter: it
+   compares HASH_GROUP_WIDTH bytes at once with the first byte of
+   NEEDLE, and as many with its last byte, and only the positions where
+   both match are compared in full.  */
+static char* string_search_bytes(char const* hay, ptrdiff_t hlen,
+                                 char const* needle, ptrdiff_t nlen) {
+    if (nlen < 2)
+        return memmem(hay, hlen, needle, nlen);
+
+    unsigned char const* h = (unsigned char const*)hay;
+    unsigned char first = needle[0], last = needle[nlen - 1];
+    ptrdiff_t i = 0;
+    for (; i <= hlen - nlen - (HASH_GROUP_WIDTH - 1); i += HASH_GROUP_WIDTH)
+        for (hash_group_mask_t match = (hash_group_match(h + i, first) &
+                                        hash_group_match(h + i + nlen - 1,
+                                                         last));
+             match; match &= match - 1) {
+            ptrdiff_t pos = i + hash_group_first(match);
+            if (!memcmp(hay + pos + 1, needle + 1, nlen - 2))
+                return (char*)hay + pos;
+        }
+    return memmem(hay + i, hlen - i, needle, nlen);
+}
+
 DEFUN ("string-search", Fstring_search, Sstring_search, 2, 3, 0,
        doc: /* Search for the string NEEDLE in the string HAYSTACK.
 The return value is the position of the first occurrence of NEEDLE in
@@ -5924,13 +6562,14 @@ Case is always significant and text properties are ignored. */)
              */
             return Qnil;
         else
-            res = memmem(haystart, haybytes, SSDATA(needle), SBYTES(needle));
+            res = string_search_bytes(haystart, haybytes, SSDATA(needle),
+                                      SBYTES(needle));
     }
     else if (STRING_MULTIBYTE(haystack)) /* unibyte non-ASCII needle */
     {
         Lisp_Object multi_needle = string_to_multibyte(needle);
-        res = memmem(haystart, haybytes, SSDATA(multi_needle),
-                     SBYTES(multi_needle));
+        res = string_search_bytes(haystart, haybytes, SSDATA(multi_needle),
+                                  SBYTES(multi_needle));
     }
     else /* unibyte haystack, multibyte non-ASCII needle */
     {
@@ -5949,8 +6588,8 @@ Case is always significant and text properties are ignored. */)
         /* "Raw bytes" (aka eighth-bit) are represented differently in
            multibyte and unibyte strings.  */
         Lisp_Object uni_needle = Fstring_to_unibyte(needle);
-        res =
-            memmem(haystart, haybytes, SSDATA(uni_needle), SBYTES(uni_needle));
+        res = string_search_bytes(haystart, haybytes, SSDATA(uni_needle),
+                                  SBYTES(uni_needle));
     }
 
     if (!res)
@@ -6173,6 +6812,7 @@ For best results this should end in a space.  */);
     defsubr(&Sproper_list_p);
     defsubr(&Sstring_bytes);
     defsubr(&Sstring_distance);
+    defsubr(&Sstring_distances);
     defsubr(&Sstring_equal);
     defsubr(&Scompare_strings);
     defsubr(&Sstring_lessp);
@@ -1001,6 +1001,8 @@ struct emacs_globals {
 #define pure_bytes_used globals.f_pure_bytes_used
   intmax_t f_read_process_output_max;
 #define read_process_output_max globals.f_read_process_output_max
+  intmax_t f_redisplay_max_frame_rate;
+#define redisplay_max_frame_rate globals.f_redisplay_max_frame_rate
   intmax_t f_scroll_conservatively;
 #define scroll_conservatively globals.f_scroll_conservatively
   intmax_t f_scroll_margin;
@@ -1177,6 +1179,8 @@ struct emacs_globals {
 #define load_no_native globals.f_load_no_native
   bool f_load_prefer_newer;
 #define load_prefer_newer globals.f_load_prefer_newer
+  bool f_load_use_elb_files;
+#define load_use_elb_files globals.f_load_use_elb_files
   bool f_lucid__menu_grab_keyboard;
 #define lucid__menu_grab_keyboard globals.f_lucid__menu_grab_keyboard
   bool f_make_window_start_visible;
@@ -1283,6 +1287,8 @@ struct emacs_globals {
 #define tty_cursor_movement_use_TAB_BS globals.f_tty_cursor_movement_use_TAB_BS
   bool f_tty_menu_calls_mouse_position_function;
 #define tty_menu_calls_mouse_position_function globals.f_tty_menu_calls_mouse_position_function
+  bool f_tty_synchronized_update;
+#define tty_synchronized_update globals.f_tty_synchronized_update
   bool f_undo_inhibit_record_point;
 #define undo_inhibit_record_point globals.f_undo_inhibit_record_point
   bool f_unibyte_display_via_language_environment;
@@ -1322,9 +1328,9 @@ struct emacs_globals {
 };
 extern struct emacs_globals globals;
 
-extern struct Lisp_Symbol lispsym[1701];
+extern struct Lisp_Symbol lispsym[1710];
 #ifdef DEFINE_SYMBOLS
-struct Lisp_Symbol lispsym[1701];
+struct Lisp_Symbol lispsym[1710];
 #endif
 
 #define iQnil 0
@@ -1407,3327 +1413,3345 @@ DEFINE_LISP_SYMBOL (QCcipher_ivsize)
 DEFINE_LISP_SYMBOL (QCcipher_keysize)
 #define iQCcipher_tagsize 39
 DEFINE_LISP_SYMBOL (QCcipher_tagsize)
-#define iQCcoding 40
+#define iQCcoalesced 40
+DEFINE_LISP_SYMBOL (QCcoalesced)
+#define iQCcoding 41
 DEFINE_LISP_SYMBOL (QCcoding)
-#define iQCcol 41
+#define iQCcol 42
 DEFINE_LISP_SYMBOL (QCcol)
-#define iQCcolor 42
+#define iQCcolor 43
 DEFINE_LISP_SYMBOL (QCcolor)
-#define iQCcolor_adjustment 43
+#define iQCcolor_adjustment 44
 DEFINE_LISP_SYMBOL (QCcolor_adjustment)
-#define iQCcolor_symbols 44
+#define iQCcolor_symbols 45
 DEFINE_LISP_SYMBOL (QCcolor_symbols)
-#define iQCcombining_capability 45
+#define iQCcombining_capability 46
 DEFINE_LISP_SYMBOL (QCcombining_capability)
-#define iQCcommand 46
+#define iQCcommand 47
 DEFINE_LISP_SYMBOL (QCcommand)
-#define iQCcomplete_negotiation 47
+#define iQCcomplete_negotiation 48
 DEFINE_LISP_SYMBOL (QCcomplete_negotiation)
-#define iQCcompression 48
+#define iQCcompression 49
 DEFINE_LISP_SYMBOL (QCcompression)
-#define iQCconnection_type 49
+#define iQCconnection_type 50
 DEFINE_LISP_SYMBOL (QCconnection_type)
-#define iQCconversion 50
+#define iQCconversion 51
 DEFINE_LISP_SYMBOL (QCconversion)
-#define iQCcrlfiles 51
+#define iQCcrlfiles 52
 DEFINE_LISP_SYMBOL (QCcrlfiles)
-#define iQCcrop 52
+#define iQCcrop 53
 DEFINE_LISP_SYMBOL (QCcrop)
-#define iQCcss 53
+#define iQCcss 54
 DEFINE_LISP_SYMBOL (QCcss)
-#define iQCdata 54
+#define iQCdata 55
 DEFINE_LISP_SYMBOL (QCdata)
-#define iQCdebug_on_exit 55
+#define iQCdebug_on_exit 56
 DEFINE_LISP_SYMBOL (QCdebug_on_exit)
-#define iQCdecode_translation_table 56
+#define iQCdecode_translation_table 57
 DEFINE_LISP_SYMBOL (QCdecode_translation_table)
-#define iQCdefault_char 57
+#define iQCdefault_char 58
 DEFINE_LISP_SYMBOL (QCdefault_char)
-#define iQCdestination 58
+#define iQCdeferred_for_input 59
+DEFINE_LISP_SYMBOL (QCdeferred_for_input)
+#define iQCdestination 60
 DEFINE_LISP_SYMBOL (QCdestination)
-#define iQCdevice 59
+#define iQCdevice 61
 DEFINE_LISP_SYMBOL (QCdevice)
-#define iQCdiffie_hellman_prime_bits 60
+#define iQCdiffie_hellman_prime_bits 62
 DEFINE_LISP_SYMBOL (QCdiffie_hellman_prime_bits)
-#define iQCdigest_algorithm_id 61
+#define iQCdigest_algorithm_id 63
 DEFINE_LISP_SYMBOL (QCdigest_algorithm_id)
-#define iQCdigest_algorithm_length 62
+#define iQCdigest_algorithm_length 64
 DEFINE_LISP_SYMBOL (QCdigest_algorithm_length)
-#define iQCdistant_foreground 63
+#define iQCdistant_foreground 65
 DEFINE_LISP_SYMBOL (QCdistant_foreground)
-#define iQCdocumentation 64
+#define iQCdocumentation 66
 DEFINE_LISP_SYMBOL (QCdocumentation)
-#define iQCdpi 65
+#define iQCdpi 67
 DEFINE_LISP_SYMBOL (QCdpi)
-#define iQCemergency 66
+#define iQCemergency 68
 DEFINE_LISP_SYMBOL (QCemergency)
-#define iQCenable 67
+#define iQCenable 69
 DEFINE_LISP_SYMBOL (QCenable)
-#define iQCencode_translation_table 68
+#define iQCencode_translation_table 70
 DEFINE_LISP_SYMBOL (QCencode_translation_table)
-#define iQCencrypt_then_mac 69
+#define iQCencrypt_then_mac 71
 DEFINE_LISP_SYMBOL (QCencrypt_then_mac)
-#define iQCeq_q 70
+#define iQCeq_q 72
 DEFINE_LISP_SYMBOL (QCeq_q)
-#define iQCequal 71
+#define iQCequal 73
 DEFINE_LISP_SYMBOL (QCequal)
-#define iQCerror 72
+#define iQCerror 74
 DEFINE_LISP_SYMBOL (QCerror)
-#define iQCeval 73
+#define iQCeval 75
 DEFINE_LISP_SYMBOL (QCeval)
-#define iQCexpired 74
+#define iQCexpired 76
 DEFINE_LISP_SYMBOL (QCexpired)
-#define iQCextend 75
+#define iQCextend 77
 DEFINE_LISP_SYMBOL (QCextend)
-#define iQCfalse 76
+#define iQCfalse 78
 DEFINE_LISP_SYMBOL (QCfalse)
-#define iQCfalse_object 77
+#define iQCfalse_object 79
 DEFINE_LISP_SYMBOL (QCfalse_object)
-#define iQCfamily 78
+#define iQCfamily 80
 DEFINE_LISP_SYMBOL (QCfamily)
-#define iQCfile 79
+#define iQCfile 81
 DEFINE_LISP_SYMBOL (QCfile)
-#define iQCfile_handler 80
+#define iQCfile_handler 82
 DEFINE_LISP_SYMBOL (QCfile_handler)
-#define iQCfilter 81
+#define iQCfilter 83
 DEFINE_LISP_SYMBOL (QCfilter)
-#define iQCfiltered 82
+#define iQCfiltered 84
 DEFINE_LISP_SYMBOL (QCfiltered)
-#define iQCflags 83
+#define iQCflags 85
 DEFINE_LISP_SYMBOL (QCflags)
-#define iQCflip 84
+#define iQCflip 86
 DEFINE_LISP_SYMBOL (QCflip)
-#define iQCflowcontrol 85
+#define iQCflowcontrol 87
 DEFINE_LISP_SYMBOL (QCflowcontrol)
-#define iQCfont 86
+#define iQCfont 88
 DEFINE_LISP_SYMBOL (QCfont)
-#define iQCfont_entity 87
+#define iQCfont_entity 89
 DEFINE_LISP_SYMBOL (QCfont_entity)
-#define iQCfontset 88
+#define iQCfontset 90
 DEFINE_LISP_SYMBOL (QCfontset)
-#define iQCforeground 89
+#define iQCforeground 91
 DEFINE_LISP_SYMBOL (QCforeground)
-#define iQCformat 90
+#define iQCformat 92
 DEFINE_LISP_SYMBOL (QCformat)
-#define iQCfoundry 91
+#define iQCfoundry 93
 DEFINE_LISP_SYMBOL (QCfoundry)
-#define iQCfunction 92
+#define iQCframes 94
+DEFINE_LISP_SYMBOL (QCframes)
+#define iQCfunction 95
 DEFINE_LISP_SYMBOL (QCfunction)
-#define iQCheight 93
+#define iQCheight 96
 DEFINE_LISP_SYMBOL (QCheight)
-#define iQChelp 94
+#define iQChelp 97
 DEFINE_LISP_SYMBOL (QChelp)
-#define iQCheuristic_mask 95
+#define iQCheuristic_mask 98
 DEFINE_LISP_SYMBOL (QCheuristic_mask)
-#define iQChost 96
+#define iQChost 99
 DEFINE_LISP_SYMBOL (QChost)
-#define iQChostname 97
+#define iQChostname 100
 DEFINE_LISP_SYMBOL (QChostname)
-#define iQCignore_defface 98
+#define iQCignore_defface 101
 DEFINE_LISP_SYMBOL (QCignore_defface)
-#define iQCimage 99
+#define iQCimage 102
 DEFINE_LISP_SYMBOL (QCimage)
-#define iQCin_place 100
+#define iQCin_place 103
 DEFINE_LISP_SYMBOL (QCin_place)
-#define iQCindex 101
+#define iQCindex 104
 DEFINE_LISP_SYMBOL (QCindex)
-#define iQCinherit 102
+#define iQCinherit 105
 DEFINE_LISP_SYMBOL (QCinherit)
-#define iQCinsecure 103
+#define iQCinsecure 106
 DEFINE_LISP_SYMBOL (QCinsecure)
-#define iQCinvalid 104
+#define iQCinvalid 107
 DEFINE_LISP_SYMBOL (QCinvalid)
-#define iQCinvalid_ocsp_status 105
+#define iQCinvalid_ocsp_status 108
 DEFINE_LISP_SYMBOL (QCinvalid_ocsp_status)
-#define iQCinverse_video 106
+#define iQCinverse_video 109
 DEFINE_LISP_SYMBOL (QCinverse_video)
-#define iQCissuer 107
+#define iQCissuer 110
 DEFINE_LISP_SYMBOL (QCissuer)
-#define iQCissuer_unique_id 108
+#define iQCissuer_unique_id 111
 DEFINE_LISP_SYMBOL (QCissuer_unique_id)
-#define iQCitalic 109
+#define iQCitalic 112
 DEFINE_LISP_SYMBOL (QCitalic)
-#define iQCkey 110
+#define iQCkey 113
 DEFINE_LISP_SYMBOL (QCkey)
-#define iQCkey_exchange 111
+#define iQCkey_exchange 114
 DEFINE_LISP_SYMBOL (QCkey_exchange)
-#define iQCkey_sequence 112
+#define iQCkey_sequence 115
 DEFINE_LISP_SYMBOL (QCkey_sequence)
-#define iQCkeylist 113
+#define iQCkeylist 116
 DEFINE_LISP_SYMBOL (QCkeylist)
-#define iQCkeys 114
+#define iQCkeys 117
 DEFINE_LISP_SYMBOL (QCkeys)
-#define iQClabel 115
+#define iQClabel 118
 DEFINE_LISP_SYMBOL (QClabel)
-#define iQClang 116
+#define iQClang 119
 DEFINE_LISP_SYMBOL (QClang)
-#define iQClessp 117
+#define iQClessp 120
 DEFINE_LISP_SYMBOL (QClessp)
-#define iQClientHello_Padding 118
+#define iQClientHello_Padding 121
 DEFINE_LISP_SYMBOL (QClientHello_Padding)
-#define iQCline 119
+#define iQCline 122
 DEFINE_LISP_SYMBOL (QCline)
-#define iQCline_width 120
+#define iQCline_width 123
 DEFINE_LISP_SYMBOL (QCline_width)
-#define iQCloader 121
+#define iQCloader 124
 DEFINE_LISP_SYMBOL (QCloader)
-#define iQClocal 122
+#define iQClocal 125
 DEFINE_LISP_SYMBOL (QClocal)
-#define iQClog 123
+#define iQClog 126
 DEFINE_LISP_SYMBOL (QClog)
-#define iQCloglevel 124
+#define iQCloglevel 127
 DEFINE_LISP_SYMBOL (QCloglevel)
-#define iQCmac 125
+#define iQCmac 128
 DEFINE_LISP_SYMBOL (QCmac)
-#define iQCmac_algorithm_id 126
+#define iQCmac_algorithm_id 129
 DEFINE_LISP_SYMBOL (QCmac_algorithm_id)
-#define iQCmac_algorithm_keysize 127
+#define iQCmac_algorithm_keysize 130
 DEFINE_LISP_SYMBOL (QCmac_algorithm_keysize)
-#define iQCmac_algorithm_length 128
+#define iQCmac_algorithm_length 131
 DEFINE_LISP_SYMBOL (QCmac_algorithm_length)
-#define iQCmac_algorithm_noncesize 129
+#define iQCmac_algorithm_noncesize 132
 DEFINE_LISP_SYMBOL (QCmac_algorithm_noncesize)
-#define iQCmap 130
+#define iQCmap 133
 DEFINE_LISP_SYMBOL (QCmap)
-#define iQCmargin 131
+#define iQCmargin 134
 DEFINE_LISP_SYMBOL (QCmargin)
-#define iQCmask 132
+#define iQCmask 135
 DEFINE_LISP_SYMBOL (QCmask)
-#define iQCmatch 133
+#define iQCmatch 136
 DEFINE_LISP_SYMBOL (QCmatch)
-#define iQCmatch_q 134
+#define iQCmatch_q 137
 DEFINE_LISP_SYMBOL (QCmatch_q)
-#define iQCmatrix 135
+#define iQCmatrix 138
 DEFINE_LISP_SYMBOL (QCmatrix)
-#define iQCmax_height 136
+#define iQCmax_height 139
 DEFINE_LISP_SYMBOL (QCmax_height)
-#define iQCmax_width 137
+#define iQCmax_time 140
+DEFINE_LISP_SYMBOL (QCmax_time)
+#define iQCmax_width 141
 DEFINE_LISP_SYMBOL (QCmax_width)
-#define iQCmin_prime_bits 138
+#define iQCmin_prime_bits 142
 DEFINE_LISP_SYMBOL (QCmin_prime_bits)
-#define iQCminspace 139
+#define iQCminspace 143
 DEFINE_LISP_SYMBOL (QCminspace)
-#define iQCmissing_ocsp_status 140
+#define iQCmissing_ocsp_status 144
 DEFINE_LISP_SYMBOL (QCmissing_ocsp_status)
-#define iQCmnemonic 141
+#define iQCmnemonic 145
 DEFINE_LISP_SYMBOL (QCmnemonic)
-#define iQCmouse 142
+#define iQCmouse 146
 DEFINE_LISP_SYMBOL (QCmouse)
-#define iQCname 143
+#define iQCname 147
 DEFINE_LISP_SYMBOL (QCname)
-#define iQCno_host_match 144
+#define iQCno_host_match 148
 DEFINE_LISP_SYMBOL (QCno_host_match)
-#define iQCnoquery 145
+#define iQCnoquery 149
 DEFINE_LISP_SYMBOL (QCnoquery)
-#define iQCnot_activated 146
+#define iQCnot_activated 150
 DEFINE_LISP_SYMBOL (QCnot_activated)
-#define iQCnot_ca 147
+#define iQCnot_ca 151
 DEFINE_LISP_SYMBOL (QCnot_ca)
-#define iQCnowait 148
+#define iQCnowait 152
 DEFINE_LISP_SYMBOL (QCnowait)
-#define iQCnull 149
+#define iQCnull 153
 DEFINE_LISP_SYMBOL (QCnull)
-#define iQCnull_object 150
+#define iQCnull_object 154
 DEFINE_LISP_SYMBOL (QCnull_object)
-#define iQCobject_type 151
+#define iQCobject_type 155
 DEFINE_LISP_SYMBOL (QCobject_type)
-#define iQCordinary 152
+#define iQCordinary 156
 DEFINE_LISP_SYMBOL (QCordinary)
-#define iQCotf 153
+#define iQCotf 157
 DEFINE_LISP_SYMBOL (QCotf)
-#define iQCoverline 154
+#define iQCoverline 158
 DEFINE_LISP_SYMBOL (QCoverline)
-#define iQCparity 155
+#define iQCparity 159
 DEFINE_LISP_SYMBOL (QCparity)
-#define iQCpass 156
+#define iQCpass 160
 DEFINE_LISP_SYMBOL (QCpass)
-#define iQCpem 157
+#define iQCpem 161
 DEFINE_LISP_SYMBOL (QCpem)
-#define iQCplist 158
+#define iQCplist 162
 DEFINE_LISP_SYMBOL (QCplist)
-#define iQCplus 159
+#define iQCplus 163
 DEFINE_LISP_SYMBOL (QCplus)
-#define iQCpointer 160
+#define iQCpointer 164
 DEFINE_LISP_SYMBOL (QCpointer)
-#define iQCport 161
+#define iQCport 165
 DEFINE_LISP_SYMBOL (QCport)
-#define iQCpos 162
+#define iQCpos 166
 DEFINE_LISP_SYMBOL (QCpos)
-#define iQCposition 163
+#define iQCposition 167
 DEFINE_LISP_SYMBOL (QCposition)
-#define iQCpost_read_conversion 164
+#define iQCpost_read_conversion 168
 DEFINE_LISP_SYMBOL (QCpost_read_conversion)
-#define iQCpre_write_conversion 165
+#define iQCpre_write_conversion 169
 DEFINE_LISP_SYMBOL (QCpre_write_conversion)
-#define iQCpred 166
+#define iQCpred 170
 DEFINE_LISP_SYMBOL (QCpred)
-#define iQCpred_q 167
+#define iQCpred_q 171
 DEFINE_LISP_SYMBOL (QCpred_q)
-#define iQCpriority 168
+#define iQCpriority 172
 DEFINE_LISP_SYMBOL (QCpriority)
-#define iQCprocess 169
+#define iQCprocess 173
 DEFINE_LISP_SYMBOL (QCprocess)
-#define iQCpropertize 170
+#define iQCpropertize 174
 DEFINE_LISP_SYMBOL (QCpropertize)
-#define iQCprotocol 171
+#define iQCprotocol 175
 DEFINE_LISP_SYMBOL (QCprotocol)
-#define iQCpt_height 172
+#define iQCpt_height 176
 DEFINE_LISP_SYMBOL (QCpt_height)
-#define iQCpt_width 173
+#define iQCpt_width 177
 DEFINE_LISP_SYMBOL (QCpt_width)
-#define iQCpublic_key_algorithm 174
+#define iQCpublic_key_algorithm 178
 DEFINE_LISP_SYMBOL (QCpublic_key_algorithm)
-#define iQCpublic_key_id 175
+#define iQCpublic_key_id 179
 DEFINE_LISP_SYMBOL (QCpublic_key_id)
-#define iQCpublic_key_id_sha256 176
+#define iQCpublic_key_id_sha256 180
 DEFINE_LISP_SYMBOL (QCpublic_key_id_sha256)
-#define iQCpurecopy 177
+#define iQCpurecopy 181
 DEFINE_LISP_SYMBOL (QCpurecopy)
-#define iQCpurpose_mismatch 178
+#define iQCpurpose_mismatch 182
 DEFINE_LISP_SYMBOL (QCpurpose_mismatch)
-#define iQCquestion 179
+#define iQCquestion 183
 DEFINE_LISP_SYMBOL (QCquestion)
-#define iQCradio 180
+#define iQCradio 184
 DEFINE_LISP_SYMBOL (QCradio)
-#define iQCregistry 181
+#define iQCregistry 185
 DEFINE_LISP_SYMBOL (QCregistry)
-#define iQCrehash_size 182
+#define iQCrehash_size 186
 DEFINE_LISP_SYMBOL (QCrehash_size)
-#define iQCrehash_threshold 183
+#define iQCrehash_threshold 187
 DEFINE_LISP_SYMBOL (QCrehash_threshold)
-#define iQCrelative_height 184
+#define iQCrelative_height 188
 DEFINE_LISP_SYMBOL (QCrelative_height)
-#define iQCrelative_width 185
+#define iQCrelative_width 189
 DEFINE_LISP_SYMBOL (QCrelative_width)
-#define iQCrelief 186
+#define iQCrelief 190
 DEFINE_LISP_SYMBOL (QCrelief)
-#define iQCremote 187
+#define iQCremote 191
 DEFINE_LISP_SYMBOL (QCremote)
-#define iQCreverse 188
+#define iQCreverse 192
 DEFINE_LISP_SYMBOL (QCreverse)
-#define iQCrevocation_data_issued_in_future 189
+#define iQCrevocation_data_issued_in_future 193
 DEFINE_LISP_SYMBOL (QCrevocation_data_issued_in_future)
-#define iQCrevocation_data_superseded 190
+#define iQCrevocation_data_superseded 194
 DEFINE_LISP_SYMBOL (QCrevocation_data_superseded)
-#define iQCrevoked 191
+#define iQCrevoked 195
 DEFINE_LISP_SYMBOL (QCrevoked)
-#define iQCrotation 192
+#define iQCrotation 196
 DEFINE_LISP_SYMBOL (QCrotation)
-#define iQCrtl 193
+#define iQCrtl 197
 DEFINE_LISP_SYMBOL (QCrtl)
-#define iQCsafe_renegotiation 194
+#define iQCsafe_renegotiation 198
 DEFINE_LISP_SYMBOL (QCsafe_renegotiation)
-#define iQCscalable 195
+#define iQCscalable 199
 DEFINE_LISP_SYMBOL (QCscalable)
-#define iQCscale 196
+#define iQCscale 200
 DEFINE_LISP_SYMBOL (QCscale)
-#define iQCscript 197
+#define iQCscript 201
 DEFINE_LISP_SYMBOL (QCscript)
-#define iQCself_signed 198
+#define iQCself_signed 202
 DEFINE_LISP_SYMBOL (QCself_signed)
-#define iQCsentinel 199
+#define iQCsentinel 203
 DEFINE_LISP_SYMBOL (QCsentinel)
-#define iQCserial_number 200
+#define iQCserial_number 204
 DEFINE_LISP_SYMBOL (QCserial_number)
-#define iQCserver 201
+#define iQCserver 205
 DEFINE_LISP_SYMBOL (QCserver)
-#define iQCservice 202
+#define iQCservice 206
 DEFINE_LISP_SYMBOL (QCservice)
-#define iQCsignature_algorithm 203
+#define iQCsignature_algorithm 207
 DEFINE_LISP_SYMBOL (QCsignature_algorithm)
-#define iQCsignature_failure 204
+#define iQCsignature_failure 208
 DEFINE_LISP_SYMBOL (QCsignature_failure)
-#define iQCsigner_constraints_failure 205
+#define iQCsigner_constraints_failure 209
 DEFINE_LISP_SYMBOL (QCsigner_constraints_failure)
-#define iQCsize 206
+#define iQCsize 210
 DEFINE_LISP_SYMBOL (QCsize)
-#define iQCslant 207
+#define iQCslant 211
 DEFINE_LISP_SYMBOL (QCslant)
-#define iQCspacing 208
+#define iQCspacing 212
 DEFINE_LISP_SYMBOL (QCspacing)
-#define iQCspeed 209
+#define iQCspeed 213
 DEFINE_LISP_SYMBOL (QCspeed)
-#define iQCstar 210
+#define iQCstar 214
 DEFINE_LISP_SYMBOL (QCstar)
-#define iQCstderr 211
+#define iQCstderr 215
 DEFINE_LISP_SYMBOL (QCstderr)
-#define iQCstipple 212
+#define iQCstipple 216
 DEFINE_LISP_SYMBOL (QCstipple)
-#define iQCstop 213
+#define iQCstop 217
 DEFINE_LISP_SYMBOL (QCstop)
-#define iQCstopbits 214
+#define iQCstopbits 218
 DEFINE_LISP_SYMBOL (QCstopbits)
-#define iQCstrike_through 215
+#define iQCstrike_through 219
 DEFINE_LISP_SYMBOL (QCstrike_through)
-#define iQCstyle 216
+#define iQCstyle 220
 DEFINE_LISP_SYMBOL (QCstyle)
-#define iQCsubject 217
+#define iQCsubject 221
 DEFINE_LISP_SYMBOL (QCsubject)
-#define iQCsubject_unique_id 218
+#define iQCsubject_unique_id 222
 DEFINE_LISP_SYMBOL (QCsubject_unique_id)
-#define iQCsuccess 219
+#define iQCsuccess 223
 DEFINE_LISP_SYMBOL (QCsuccess)
-#define iQCsummary 220
+#define iQCsummary 224
 DEFINE_LISP_SYMBOL (QCsummary)
-#define iQCtest 221
+#define iQCtest 225
 DEFINE_LISP_SYMBOL (QCtest)
-#define iQCtls_parameters 222
+#define iQCtls_parameters 226
 DEFINE_LISP_SYMBOL (QCtls_parameters)
-#define iQCtoggle 223
+#define iQCtoggle 227
 DEFINE_LISP_SYMBOL (QCtoggle)
-#define iQCtransform_smoothing 224
+#define iQCtotal_time 228
+DEFINE_LISP_SYMBOL (QCtotal_time)
+#define iQCtransform_smoothing 229
 DEFINE_LISP_SYMBOL (QCtransform_smoothing)
-#define iQCtrustfiles 225
+#define iQCtrustfiles 230
 DEFINE_LISP_SYMBOL (QCtrustfiles)
-#define iQCtype 226
+#define iQCtype 231
 DEFINE_LISP_SYMBOL (QCtype)
-#define iQCunderline 227
+#define iQCunderline 232
 DEFINE_LISP_SYMBOL (QCunderline)
-#define iQCunknown_ca 228
+#define iQCunknown_ca 233
 DEFINE_LISP_SYMBOL (QCunknown_ca)
-#define iQCuse_external_socket 229
+#define iQCuse_external_socket 234
 DEFINE_LISP_SYMBOL (QCuse_external_socket)
-#define iQCuser_spec 230
+#define iQCuser_spec 235
 DEFINE_LISP_SYMBOL (QCuser_spec)
-#define iQCvalid_from 231
+#define iQCvalid_from 236
 DEFINE_LISP_SYMBOL (QCvalid_from)
-#define iQCvalid_to 232
+#define iQCvalid_to 237
 DEFINE_LISP_SYMBOL (QCvalid_to)
-#define iQCverify_error 233
+#define iQCverify_error 238
 DEFINE_LISP_SYMBOL (QCverify_error)
-#define iQCverify_flags 234
+#define iQCverify_flags 239
 DEFINE_LISP_SYMBOL (QCverify_flags)
-#define iQCversion 235
+#define iQCversion 240
 DEFINE_LISP_SYMBOL (QCversion)
-#define iQCvert_only 236
+#define iQCvert_only 241
 DEFINE_LISP_SYMBOL (QCvert_only)
-#define iQCvisible 237
+#define iQCvisible 242
 DEFINE_LISP_SYMBOL (QCvisible)
-#define iQCvolume 238
+#define iQCvolume 243
 DEFINE_LISP_SYMBOL (QCvolume)
-#define iQCwarnings 239
+#define iQCwarnings 244
 DEFINE_LISP_SYMBOL (QCwarnings)
-#define iQCweakness 240
+#define iQCweakness 245
 DEFINE_LISP_SYMBOL (QCweakness)
-#define iQCweight 241
+#define iQCweight 246
 DEFINE_LISP_SYMBOL (QCweight)
-#define iQCwidth 242
+#define iQCwidth 247
 DEFINE_LISP_SYMBOL (QCwidth)
-#define iQCwindow 243
+#define iQCwindow 248
 DEFINE_LISP_SYMBOL (QCwindow)
-#define iQCwrap 244
+#define iQCwrap 249
 DEFINE_LISP_SYMBOL (QCwrap)
-#define iQDiscarded_Samples 245
+#define iQDiscarded_Samples 250
 DEFINE_LISP_SYMBOL (QDiscarded_Samples)
-#define iQFILE_NAME 246
+#define iQFILE_NAME 251
 DEFINE_LISP_SYMBOL (QFILE_NAME)
-#define iQL2R 247
+#define iQL2R 252
 DEFINE_LISP_SYMBOL (QL2R)
-#define iQPRIMARY 248
+#define iQPRIMARY 253
 DEFINE_LISP_SYMBOL (QPRIMARY)
-#define iQR2L 249
+#define iQR2L 254
 DEFINE_LISP_SYMBOL (QR2L)
-#define iQSECONDARY 250
+#define iQSECONDARY 255
 DEFINE_LISP_SYMBOL (QSECONDARY)
-#define iQTARGETS 251
+#define iQTARGETS 256
 DEFINE_LISP_SYMBOL (QTARGETS)
-#define iQTEXT 252
+#define iQTEXT 257
 DEFINE_LISP_SYMBOL (QTEXT)
-#define iQUTF8_STRING 253
+#define iQUTF8_STRING 258
 DEFINE_LISP_SYMBOL (QUTF8_STRING)
-#define iQUnknown_error 254
+#define iQUnknown_error 259
 DEFINE_LISP_SYMBOL (QUnknown_error)
-#define iQXdndActionCopy 255
+#define iQXdndActionCopy 260
 DEFINE_LISP_SYMBOL (QXdndActionCopy)
-#define iQXdndActionLink 256
+#define iQXdndActionLink 261
 DEFINE_LISP_SYMBOL (QXdndActionLink)
-#define iQXdndActionMove 257
+#define iQXdndActionMove 262
 DEFINE_LISP_SYMBOL (QXdndActionMove)
-#define iQXdndActionPrivate 258
+#define iQXdndActionPrivate 263
 DEFINE_LISP_SYMBOL (QXdndActionPrivate)
-#define iQabove 259
+#define iQabove 264
 DEFINE_LISP_SYMBOL (Qabove)
-#define iQabove_handle 260
+#define iQabove_handle 265
 DEFINE_LISP_SYMBOL (Qabove_handle)
-#define iQabove_suspended 261
+#define iQabove_suspended 266
 DEFINE_LISP_SYMBOL (Qabove_suspended)
-#define iQaccess_file 262
+#define iQaccess_file 267
 DEFINE_LISP_SYMBOL (Qaccess_file)
-#define iQactivate 263
+#define iQactivate 268
 DEFINE_LISP_SYMBOL (Qactivate)
-#define iQactivate_front 264
+#define iQactivate_front 269
 DEFINE_LISP_SYMBOL (Qactivate_front)
-#define iQactivate_input_method 265
+#define iQactivate_input_method 270
 DEFINE_LISP_SYMBOL (Qactivate_input_method)
-#define iQactivate_mark_hook 266
+#define iQactivate_mark_hook 271
 DEFINE_LISP_SYMBOL (Qactivate_mark_hook)
-#define iQactivate_menubar_hook 267
+#define iQactivate_menubar_hook 272
 DEFINE_LISP_SYMBOL (Qactivate_menubar_hook)
-#define iQadd1 268
+#define iQadd1 273
 DEFINE_LISP_SYMBOL (Qadd1)
-#define iQadd_name_to_file 269
+#define iQadd_name_to_file 274
 DEFINE_LISP_SYMBOL (Qadd_name_to_file)
-#define iQadd_to_history 270
+#define iQadd_to_history 275
 DEFINE_LISP_SYMBOL (Qadd_to_history)
-#define iQafter_change_functions 271
+#define iQafter_change_functions 276
 DEFINE_LISP_SYMBOL (Qafter_change_functions)
-#define iQafter_delete_frame_functions 272
+#define iQafter_delete_frame_functions 277
 DEFINE_LISP_SYMBOL (Qafter_delete_frame_functions)
-#define iQafter_handle 273
+#define iQafter_handle 278
 DEFINE_LISP_SYMBOL (Qafter_handle)
-#define iQafter_insert_file_set_buffer_file_coding_system 274
+#define iQafter_insert_file_set_buffer_file_coding_system 279
 DEFINE_LISP_SYMBOL (Qafter_insert_file_set_buffer_file_coding_system)
-#define iQafter_insert_file_set_coding 275
+#define iQafter_insert_file_set_coding 280
 DEFINE_LISP_SYMBOL (Qafter_insert_file_set_coding)
-#define iQafter_pdump_load_hook 276
+#define iQafter_pdump_load_hook 281
 DEFINE_LISP_SYMBOL (Qafter_pdump_load_hook)
-#define iQafter_string 277
+#define iQafter_string 282
 DEFINE_LISP_SYMBOL (Qafter_string)
-#define iQalist 278
+#define iQalist 283
 DEFINE_LISP_SYMBOL (Qalist)
-#define iQall 279
+#define iQall 284
 DEFINE_LISP_SYMBOL (Qall)
-#define iQalloc 280
+#define iQalloc 285
 DEFINE_LISP_SYMBOL (Qalloc)
-#define iQalpha 281
+#define iQalpha 286
 DEFINE_LISP_SYMBOL (Qalpha)
-#define iQalpha_background 282
+#define iQalpha_background 287
 DEFINE_LISP_SYMBOL (Qalpha_background)
-#define iQalt 283
+#define iQalt 288
 DEFINE_LISP_SYMBOL (Qalt)
-#define iQand 284
+#define iQand 289
 DEFINE_LISP_SYMBOL (Qand)
-#define iQand_optional 285
+#define iQand_optional 290
 DEFINE_LISP_SYMBOL (Qand_optional)
-#define iQand_rest 286
+#define iQand_rest 291
 DEFINE_LISP_SYMBOL (Qand_rest)
-#define iQandroid 287
+#define iQandroid 292
 DEFINE_LISP_SYMBOL (Qandroid)
-#define iQanonymous 288
+#define iQanonymous 293
 DEFINE_LISP_SYMBOL (Qanonymous)
-#define iQappend 289
+#define iQappend 294
 DEFINE_LISP_SYMBOL (Qappend)
-#define iQapply 290
+#define iQapply 295
 DEFINE_LISP_SYMBOL (Qapply)
-#define iQaref 291
+#define iQaref 296
 DEFINE_LISP_SYMBOL (Qaref)
-#define iQargs 292
+#define iQargs 297
 DEFINE_LISP_SYMBOL (Qargs)
-#define iQargs_out_of_range 293
+#define iQargs_out_of_range 298
 DEFINE_LISP_SYMBOL (Qargs_out_of_range)
-#define iQarith_error 294
+#define iQarith_error 299
 DEFINE_LISP_SYMBOL (Qarith_error)
-#define iQarray 295
+#define iQarray 300
 DEFINE_LISP_SYMBOL (Qarray)
-#define iQarrayp 296
+#define iQarrayp 301
 DEFINE_LISP_SYMBOL (Qarrayp)
-#define iQarrow 297
+#define iQarrow 302
 DEFINE_LISP_SYMBOL (Qarrow)
-#define iQascii 298
+#define iQascii 303
 DEFINE_LISP_SYMBOL (Qascii)
-#define iQascii_0 299
+#define iQascii_0 304
 DEFINE_LISP_SYMBOL (Qascii_0)
-#define iQascii_character 300
+#define iQascii_character 305
 DEFINE_LISP_SYMBOL (Qascii_character)
-#define iQaset 301
+#define iQaset 306
 DEFINE_LISP_SYMBOL (Qaset)
-#define iQask_user_about_lock 302
+#define iQask_user_about_lock 307
 DEFINE_LISP_SYMBOL (Qask_user_about_lock)
-#define iQassq_delete_all 303
+#define iQassq_delete_all 308
 DEFINE_LISP_SYMBOL (Qassq_delete_all)
-#define iQassume 304
+#define iQassume 309
 DEFINE_LISP_SYMBOL (Qassume)
-#define iQattrib 305
+#define iQattrib 310
 DEFINE_LISP_SYMBOL (Qattrib)
-#define iQauto 306
+#define iQauto 311
 DEFINE_LISP_SYMBOL (Qauto)
-#define iQauto_composed 307
+#define iQauto_composed 312
 DEFINE_LISP_SYMBOL (Qauto_composed)
-#define iQauto_fill_chars 308
+#define iQauto_fill_chars 313
 DEFINE_LISP_SYMBOL (Qauto_fill_chars)
-#define iQauto_hscroll_mode 309
+#define iQauto_hscroll_mode 314
 DEFINE_LISP_SYMBOL (Qauto_hscroll_mode)
-#define iQauto_lower 310
+#define iQauto_lower 315
 DEFINE_LISP_SYMBOL (Qauto_lower)
-#define iQauto_raise 311
+#define iQauto_raise 316
 DEFINE_LISP_SYMBOL (Qauto_raise)
-#define iQauto_save 312
+#define iQauto_save 317
 DEFINE_LISP_SYMBOL (Qauto_save)
-#define iQauto_save_coding 313
+#define iQauto_save_coding 318
 DEFINE_LISP_SYMBOL (Qauto_save_coding)
-#define iQauto_save_hook 314
+#define iQauto_save_hook 319
 DEFINE_LISP_SYMBOL (Qauto_save_hook)
-#define iQautoload 315
+#define iQautoload 320
 DEFINE_LISP_SYMBOL (Qautoload)
-#define iQautosaved 316
+#define iQautosaved 321
 DEFINE_LISP_SYMBOL (Qautosaved)
-#define iQbackground_color 317
+#define iQbackground_color 322
 DEFINE_LISP_SYMBOL (Qbackground_color)
-#define iQbackground_mode 318
+#define iQbackground_mode 323
 DEFINE_LISP_SYMBOL (Qbackground_mode)
-#define iQbackquote 319
+#define iQbackquote 324
 DEFINE_LISP_SYMBOL (Qbackquote)
-#define iQbar 320
+#define iQbar 325
 DEFINE_LISP_SYMBOL (Qbar)
-#define iQbare_symbol_p 321
+#define iQbare_symbol_p 326
 DEFINE_LISP_SYMBOL (Qbare_symbol_p)
-#define iQbefore_change_functions 322
+#define iQbefore_change_functions 327
 DEFINE_LISP_SYMBOL (Qbefore_change_functions)
-#define iQbefore_handle 323
+#define iQbefore_handle 328
 DEFINE_LISP_SYMBOL (Qbefore_handle)
-#define iQbefore_string 324
+#define iQbefore_string 329
 DEFINE_LISP_SYMBOL (Qbefore_string)
-#define iQbeginning_of_buffer 325
+#define iQbeginning_of_buffer 330
 DEFINE_LISP_SYMBOL (Qbeginning_of_buffer)
-#define iQbelow 326
+#define iQbelow 331
 DEFINE_LISP_SYMBOL (Qbelow)
-#define iQbelow_handle 327
+#define iQbelow_handle 332
 DEFINE_LISP_SYMBOL (Qbelow_handle)
-#define iQbig 328
+#define iQbig 333
 DEFINE_LISP_SYMBOL (Qbig)
-#define iQbig5 329
+#define iQbig5 334
 DEFINE_LISP_SYMBOL (Qbig5)
-#define iQbignum 330
+#define iQbignum 335
 DEFINE_LISP_SYMBOL (Qbignum)
-#define iQbinary 331
+#define iQbinary 336
 DEFINE_LISP_SYMBOL (Qbinary)
-#define iQbitmap_spec_p 332
+#define iQbitmap_spec_p 337
 DEFINE_LISP_SYMBOL (Qbitmap_spec_p)
-#define iQblack 333
+#define iQblack 338
 DEFINE_LISP_SYMBOL (Qblack)
-#define iQbmp 334
+#define iQbmp 339
 DEFINE_LISP_SYMBOL (Qbmp)
-#define iQbold 335
+#define iQbold 340
 DEFINE_LISP_SYMBOL (Qbold)
-#define iQbook 336
+#define iQbook 341
 DEFINE_LISP_SYMBOL (Qbook)
-#define iQbool_vector 337
+#define iQbool_vector 342
 DEFINE_LISP_SYMBOL (Qbool_vector)
-#define iQbool_vector_p 338
+#define iQbool_vector_p 343
 DEFINE_LISP_SYMBOL (Qbool_vector_p)
-#define iQboolean 339
+#define iQboolean 344
 DEFINE_LISP_SYMBOL (Qboolean)
-#define iQbooleanp 340
+#define iQbooleanp 345
 DEFINE_LISP_SYMBOL (Qbooleanp)
-#define iQborder 341
+#define iQborder 346
 DEFINE_LISP_SYMBOL (Qborder)
-#define iQborder_color 342
+#define iQborder_color 347
 DEFINE_LISP_SYMBOL (Qborder_color)
-#define iQborder_width 343
+#define iQborder_width 348
 DEFINE_LISP_SYMBOL (Qborder_width)
-#define iQborders_respect_alpha_background 344
+#define iQborders_respect_alpha_background 349
 DEFINE_LISP_SYMBOL (Qborders_respect_alpha_background)
-#define iQboth 345
+#define iQboth 350
 DEFINE_LISP_SYMBOL (Qboth)
-#define iQboth_horiz 346
+#define iQboth_horiz 351
 DEFINE_LISP_SYMBOL (Qboth_horiz)
-#define iQbottom 347
+#define iQbottom 352
 DEFINE_LISP_SYMBOL (Qbottom)
-#define iQbottom_divider 348
+#define iQbottom_divider 353
 DEFINE_LISP_SYMBOL (Qbottom_divider)
-#define iQbottom_divider_width 349
+#define iQbottom_divider_width 354
 DEFINE_LISP_SYMBOL (Qbottom_divider_width)
-#define iQbottom_edge 350
+#define iQbottom_edge 355
 DEFINE_LISP_SYMBOL (Qbottom_edge)
-#define iQbottom_left_corner 351
+#define iQbottom_left_corner 356
 DEFINE_LISP_SYMBOL (Qbottom_left_corner)
-#define iQbottom_right_corner 352
+#define iQbottom_right_corner 357
 DEFINE_LISP_SYMBOL (Qbottom_right_corner)
-#define iQboundary 353
+#define iQboundary 358
 DEFINE_LISP_SYMBOL (Qboundary)
-#define iQbounds 354
+#define iQbounds 359
 DEFINE_LISP_SYMBOL (Qbounds)
-#define iQbox 355
+#define iQbox 360
 DEFINE_LISP_SYMBOL (Qbox)
-#define iQbuffer 356
+#define iQbuffer 361
 DEFINE_LISP_SYMBOL (Qbuffer)
-#define iQbuffer_access_fontify_functions 357
+#define iQbuffer_access_fontify_functions 362
 DEFINE_LISP_SYMBOL (Qbuffer_access_fontify_functions)
-#define iQbuffer_file_coding_system 358
+#define iQbuffer_file_coding_system 363
 DEFINE_LISP_SYMBOL (Qbuffer_file_coding_system)
-#define iQbuffer_file_name 359
+#define iQbuffer_file_name 364
 DEFINE_LISP_SYMBOL (Qbuffer_file_name)
-#define iQbuffer_file_number 360
+#define iQbuffer_file_number 365
 DEFINE_LISP_SYMBOL (Qbuffer_file_number)
-#define iQbuffer_list 361
+#define iQbuffer_list 366
 DEFINE_LISP_SYMBOL (Qbuffer_list)
-#define iQbuffer_list_update_hook 362
+#define iQbuffer_list_update_hook 367
 DEFINE_LISP_SYMBOL (Qbuffer_list_update_hook)
-#define iQbuffer_name_history 363
+#define iQbuffer_name_history 368
 DEFINE_LISP_SYMBOL (Qbuffer_name_history)
-#define iQbuffer_or_string_p 364
+#define iQbuffer_or_string_p 369
 DEFINE_LISP_SYMBOL (Qbuffer_or_string_p)
-#define iQbuffer_position 365
+#define iQbuffer_position 370
 DEFINE_LISP_SYMBOL (Qbuffer_position)
-#define iQbuffer_predicate 366
+#define iQbuffer_predicate 371
 DEFINE_LISP_SYMBOL (Qbuffer_predicate)
-#define iQbuffer_read_only 367
+#define iQbuffer_read_only 372
 DEFINE_LISP_SYMBOL (Qbuffer_read_only)
-#define iQbuffer_save_without_query 368
+#define iQbuffer_save_without_query 373
 DEFINE_LISP_SYMBOL (Qbuffer_save_without_query)
-#define iQbuffer_stale_function 369
+#define iQbuffer_stale_function 374
 DEFINE_LISP_SYMBOL (Qbuffer_stale_function)
-#define iQbuffer_undo_list 370
+#define iQbuffer_undo_list 375
 DEFINE_LISP_SYMBOL (Qbuffer_undo_list)
-#define iQbuffered 371
+#define iQbuffered 376
 DEFINE_LISP_SYMBOL (Qbuffered)
-#define iQbufferp 372
+#define iQbufferp 377
 DEFINE_LISP_SYMBOL (Qbufferp)
-#define iQbuffers 373
+#define iQbuffers 378
 DEFINE_LISP_SYMBOL (Qbuffers)
-#define iQburied_buffer_list 374
+#define iQburied_buffer_list 379
 DEFINE_LISP_SYMBOL (Qburied_buffer_list)
-#define iQbyte_code_function 375
+#define iQbyte_code_function 380
 DEFINE_LISP_SYMBOL (Qbyte_code_function)
-#define iQbyte_code_function_p 376
+#define iQbyte_code_function_p 381
 DEFINE_LISP_SYMBOL (Qbyte_code_function_p)
-#define iQbyte_code_meter 377
+#define iQbyte_code_meter 382
 DEFINE_LISP_SYMBOL (Qbyte_code_meter)
-#define iQbyte_run_unescaped_character_literals_warning 378
+#define iQbyte_run_unescaped_character_literals_warning 383
 DEFINE_LISP_SYMBOL (Qbyte_run_unescaped_character_literals_warning)
-#define iQc 379
+#define iQc 384
 DEFINE_LISP_SYMBOL (Qc)
-#define iQcall 380
+#define iQcall 385
 DEFINE_LISP_SYMBOL (Qcall)
-#define iQcall_process 381
+#define iQcall_process 386
 DEFINE_LISP_SYMBOL (Qcall_process)
-#define iQcall_process_region 382
+#define iQcall_process_region 387
 DEFINE_LISP_SYMBOL (Qcall_process_region)
-#define iQcallref 383
+#define iQcallref 388
 DEFINE_LISP_SYMBOL (Qcallref)
-#define iQcancel_timer 384
+#define iQcancel_timer 389
 DEFINE_LISP_SYMBOL (Qcancel_timer)
-#define iQcanonical_combining_class 385
+#define iQcanonical_combining_class 390
 DEFINE_LISP_SYMBOL (Qcanonical_combining_class)
-#define iQcar 386
+#define iQcar 391
 DEFINE_LISP_SYMBOL (Qcar)
-#define iQcar_less_than_car 387
+#define iQcar_less_than_car 392
 DEFINE_LISP_SYMBOL (Qcar_less_than_car)
-#define iQcase_fold_search 388
+#define iQcase_fold_search 393
 DEFINE_LISP_SYMBOL (Qcase_fold_search)
-#define iQcase_symbols_as_words 389
+#define iQcase_symbols_as_words 394
 DEFINE_LISP_SYMBOL (Qcase_symbols_as_words)
-#define iQcase_table 390
+#define iQcase_table 395
 DEFINE_LISP_SYMBOL (Qcase_table)
-#define iQcase_table_p 391
+#define iQcase_table_p 396
 DEFINE_LISP_SYMBOL (Qcase_table_p)
-#define iQcatcher 392
+#define iQcatcher 397
 DEFINE_LISP_SYMBOL (Qcatcher)
-#define iQcategory 393
+#define iQcategory 398
 DEFINE_LISP_SYMBOL (Qcategory)
-#define iQcategory_table 394
+#define iQcategory_table 399
 DEFINE_LISP_SYMBOL (Qcategory_table)
-#define iQcategory_table_p 395
+#define iQcategory_table_p 400
 DEFINE_LISP_SYMBOL (Qcategory_table_p)
-#define iQcategoryp 396
+#define iQcategoryp 401
 DEFINE_LISP_SYMBOL (Qcategoryp)
-#define iQcategorysetp 397
+#define iQcategorysetp 402
 DEFINE_LISP_SYMBOL (Qcategorysetp)
-#define iQccl 398
+#define iQccl 403
 DEFINE_LISP_SYMBOL (Qccl)
-#define iQccl_program_idx 399
+#define iQccl_program_idx 404
 DEFINE_LISP_SYMBOL (Qccl_program_idx)
-#define iQcclp 400
+#define iQcclp 405
 DEFINE_LISP_SYMBOL (Qcclp)
-#define iQcdr 401
+#define iQcdr 406
 DEFINE_LISP_SYMBOL (Qcdr)
-#define iQceiling 402
+#define iQceiling 407
 DEFINE_LISP_SYMBOL (Qceiling)
-#define iQcenter 403
+#define iQcenter 408
 DEFINE_LISP_SYMBOL (Qcenter)
-#define iQch 404
+#define iQch 409
 DEFINE_LISP_SYMBOL (Qch)
-#define iQchange_frame_size 405
+#define iQchange_frame_size 410
 DEFINE_LISP_SYMBOL (Qchange_frame_size)
-#define iQchange_major_mode_hook 406
+#define iQchange_major_mode_hook 411
 DEFINE_LISP_SYMBOL (Qchange_major_mode_hook)
-#define iQchar_code_property_table 407
+#define iQchannel 412
+DEFINE_LISP_SYMBOL (Qchannel)
+#define iQchannelp 413
+DEFINE_LISP_SYMBOL (Qchannelp)
+#define iQchar_code_property_table 414
 DEFINE_LISP_SYMBOL (Qchar_code_property_table)
-#define iQchar_from_name 408
+#define iQchar_from_name 415
 DEFINE_LISP_SYMBOL (Qchar_from_name)
-#define iQchar_or_string_p 409
+#define iQchar_or_string_p 416
 DEFINE_LISP_SYMBOL (Qchar_or_string_p)
-#define iQchar_script_table 410
+#define iQchar_script_table 417
 DEFINE_LISP_SYMBOL (Qchar_script_table)
-#define iQchar_table 411
+#define iQchar_table 418
 DEFINE_LISP_SYMBOL (Qchar_table)
-#define iQchar_table_extra_slots 412
+#define iQchar_table_extra_slots 419
 DEFINE_LISP_SYMBOL (Qchar_table_extra_slots)
-#define iQchar_table_p 413
+#define iQchar_table_p 420
 DEFINE_LISP_SYMBOL (Qchar_table_p)
-#define iQcharacterp 414
+#define iQcharacterp 421
 DEFINE_LISP_SYMBOL (Qcharacterp)
-#define iQcharset 415
+#define iQcharset 422
 DEFINE_LISP_SYMBOL (Qcharset)
-#define iQcharsetp 416
+#define iQcharsetp 423
 DEFINE_LISP_SYMBOL (Qcharsetp)
-#define iQchild_frame_border 417
+#define iQchild_frame_border 424
 DEFINE_LISP_SYMBOL (Qchild_frame_border)
-#define iQchild_frame_border_width 418
+#define iQchild_frame_border_width 425
 DEFINE_LISP_SYMBOL (Qchild_frame_border_width)
-#define iQchoice 419
+#define iQchoice 426
 DEFINE_LISP_SYMBOL (Qchoice)
-#define iQciphers 420
+#define iQciphers 427
 DEFINE_LISP_SYMBOL (Qciphers)
-#define iQcircle 421
+#define iQcircle 428
 DEFINE_LISP_SYMBOL (Qcircle)
-#define iQcircular_list 422
+#define iQcircular_list 429
 DEFINE_LISP_SYMBOL (Qcircular_list)
-#define iQclone_indirect_buffer_hook 423
+#define iQclone_indirect_buffer_hook 430
 DEFINE_LISP_SYMBOL (Qclone_indirect_buffer_hook)
-#define iQclone_of 424
+#define iQclone_of 431
 DEFINE_LISP_SYMBOL (Qclone_of)
-#define iQcloned_from 425
+#define iQcloned_from 432
 DEFINE_LISP_SYMBOL (Qcloned_from)
-#define iQclose_tab 426
+#define iQclose_tab 433
 DEFINE_LISP_SYMBOL (Qclose_tab)
-#define iQclosed 427
+#define iQclosed 434
 DEFINE_LISP_SYMBOL (Qclosed)
-#define iQcmajflt 428
+#define iQcmajflt 435
 DEFINE_LISP_SYMBOL (Qcmajflt)
-#define iQcminflt 429
+#define iQcminflt 436
 DEFINE_LISP_SYMBOL (Qcminflt)
-#define iQcocoa 430
+#define iQcocoa 437
 DEFINE_LISP_SYMBOL (Qcocoa)
-#define iQcode_conversion_map 431
+#define iQcode_conversion_map 438
 DEFINE_LISP_SYMBOL (Qcode_conversion_map)
-#define iQcode_conversion_map_id 432
+#define iQcode_conversion_map_id 439
 DEFINE_LISP_SYMBOL (Qcode_conversion_map_id)
-#define iQcodeset 433
+#define iQcodeset 440
 DEFINE_LISP_SYMBOL (Qcodeset)
-#define iQcoding 434
+#define iQcoding 441
 DEFINE_LISP_SYMBOL (Qcoding)
-#define iQcoding_system 435
+#define iQcoding_system 442
 DEFINE_LISP_SYMBOL (Qcoding_system)
-#define iQcoding_system_define_form 436
+#define iQcoding_system_define_form 443
 DEFINE_LISP_SYMBOL (Qcoding_system_define_form)
-#define iQcoding_system_error 437
+#define iQcoding_system_error 444
 DEFINE_LISP_SYMBOL (Qcoding_system_error)
-#define iQcoding_system_for_write 438
+#define iQcoding_system_for_write 445
 DEFINE_LISP_SYMBOL (Qcoding_system_for_write)
-#define iQcoding_system_history 439
+#define iQcoding_system_history 446
 DEFINE_LISP_SYMBOL (Qcoding_system_history)
-#define iQcoding_system_p 440
+#define iQcoding_system_p 447
 DEFINE_LISP_SYMBOL (Qcoding_system_p)
-#define iQcolor 441
+#define iQcolor 448
 DEFINE_LISP_SYMBOL (Qcolor)
-#define iQcolumns 442
+#define iQcolumns 449
 DEFINE_LISP_SYMBOL (Qcolumns)
-#define iQcomm 443
+#define iQcomm 450
 DEFINE_LISP_SYMBOL (Qcomm)
-#define iQcomma 444
+#define iQcomma 451
 DEFINE_LISP_SYMBOL (Qcomma)
-#define iQcomma_at 445
+#define iQcomma_at 452
 DEFINE_LISP_SYMBOL (Qcomma_at)
-#define iQcommand_debug_status 446
+#define iQcommand_debug_status 453
 DEFINE_LISP_SYMBOL (Qcommand_debug_status)
-#define iQcommand_error_default_function 447
+#define iQcommand_error_default_function 454
 DEFINE_LISP_SYMBOL (Qcommand_error_default_function)
-#define iQcommand_execute 448
+#define iQcommand_execute 455
 DEFINE_LISP_SYMBOL (Qcommand_execute)
-#define iQcommand_history 449
+#define iQcommand_history 456
 DEFINE_LISP_SYMBOL (Qcommand_history)
-#define iQcommand_line_processed 450
+#define iQcommand_line_processed 457
 DEFINE_LISP_SYMBOL (Qcommand_line_processed)
-#define iQcommand_modes 451
+#define iQcommand_modes 458
 DEFINE_LISP_SYMBOL (Qcommand_modes)
-#define iQcommandp 452
+#define iQcommandp 459
 DEFINE_LISP_SYMBOL (Qcommandp)
-#define iQcomment 453
+#define iQcomment 460
 DEFINE_LISP_SYMBOL (Qcomment)
-#define iQcomment_end_can_be_escaped 454
+#define iQcomment_end_can_be_escaped 461
 DEFINE_LISP_SYMBOL (Qcomment_end_can_be_escaped)
-#define iQcomp_libgccjit_reproducer 455
+#define iQcomp_libgccjit_reproducer 462
 DEFINE_LISP_SYMBOL (Qcomp_libgccjit_reproducer)
-#define iQcomp_maybe_gc_or_quit 456
+#define iQcomp_maybe_gc_or_quit 463
 DEFINE_LISP_SYMBOL (Qcomp_maybe_gc_or_quit)
-#define iQcomp_mvar 457
+#define iQcomp_mvar 464
 DEFINE_LISP_SYMBOL (Qcomp_mvar)
-#define iQcomp_sanitizer_error 458
+#define iQcomp_sanitizer_error 465
 DEFINE_LISP_SYMBOL (Qcomp_sanitizer_error)
-#define iQcomp_subr_trampoline_install 459
+#define iQcomp_subr_trampoline_install 466
 DEFINE_LISP_SYMBOL (Qcomp_subr_trampoline_install)
-#define iQcompleting_read_function 460
+#define iQcompleting_read_function 467
 DEFINE_LISP_SYMBOL (Qcompleting_read_function)
-#define iQcompletion_ignore_case 461
+#define iQcompletion_ignore_case 468
 DEFINE_LISP_SYMBOL (Qcompletion_ignore_case)
-#define iQcomposition 462
+#define iQcomposition 469
 DEFINE_LISP_SYMBOL (Qcomposition)
-#define iQconcat 463
+#define iQconcat 470
 DEFINE_LISP_SYMBOL (Qconcat)
-#define iQcond_jump 464
+#define iQcond_jump 471
 DEFINE_LISP_SYMBOL (Qcond_jump)
-#define iQcond_jump_narg_leq 465
+#define iQcond_jump_narg_leq 472
 DEFINE_LISP_SYMBOL (Qcond_jump_narg_leq)
-#define iQcondensed 466
+#define iQcondensed 473
 DEFINE_LISP_SYMBOL (Qcondensed)
-#define iQcondition_case 467
+#define iQcondition_case 474
 DEFINE_LISP_SYMBOL (Qcondition_case)
-#define iQcondition_variable 468
+#define iQcondition_variable 475
 DEFINE_LISP_SYMBOL (Qcondition_variable)
-#define iQcondition_variable_p 469
+#define iQcondition_variable_p 476
 DEFINE_LISP_SYMBOL (Qcondition_variable_p)
-#define iQconfig_changed_event 470
+#define iQconfig_changed_event 477
 DEFINE_LISP_SYMBOL (Qconfig_changed_event)
-#define iQconfiguration 471
+#define iQconfiguration 478
 DEFINE_LISP_SYMBOL (Qconfiguration)
-#define iQconnect 472
+#define iQconnect 479
 DEFINE_LISP_SYMBOL (Qconnect)
-#define iQcons 473
+#define iQcons 480
 DEFINE_LISP_SYMBOL (Qcons)
-#define iQconses 474
+#define iQconses 481
 DEFINE_LISP_SYMBOL (Qconses)
-#define iQconsp 475
+#define iQconsp 482
 DEFINE_LISP_SYMBOL (Qconsp)
-#define iQcontinuation 476
+#define iQcontinuation 483
 DEFINE_LISP_SYMBOL (Qcontinuation)
-#define iQcontrol 477
+#define iQcontrol 484
 DEFINE_LISP_SYMBOL (Qcontrol)
-#define iQcopy_directory 478
+#define iQcopy_directory 485
 DEFINE_LISP_SYMBOL (Qcopy_directory)
-#define iQcopy_file 479
+#define iQcopy_file 486
 DEFINE_LISP_SYMBOL (Qcopy_file)
-#define iQcount 480
+#define iQcount 487
 DEFINE_LISP_SYMBOL (Qcount)
-#define iQcreate 481
+#define iQcreate 488
 DEFINE_LISP_SYMBOL (Qcreate)
-#define iQcritical 482
+#define iQcritical 489
 DEFINE_LISP_SYMBOL (Qcritical)
-#define iQcrop 483
+#define iQcrop 490
 DEFINE_LISP_SYMBOL (Qcrop)
-#define iQcstime 484
+#define iQcstime 491
 DEFINE_LISP_SYMBOL (Qcstime)
-#define iQctime 485
+#define iQctime 492
 DEFINE_LISP_SYMBOL (Qctime)
-#define iQcurrent 486
+#define iQcurrent 493
 DEFINE_LISP_SYMBOL (Qcurrent)
-#define iQcurrent_input_method 487
+#define iQcurrent_input_method 494
 DEFINE_LISP_SYMBOL (Qcurrent_input_method)
-#define iQcurrent_key_remap_sequence 488
+#define iQcurrent_key_remap_sequence 495
 DEFINE_LISP_SYMBOL (Qcurrent_key_remap_sequence)
-#define iQcurrent_line 489
+#define iQcurrent_line 496
 DEFINE_LISP_SYMBOL (Qcurrent_line)
-#define iQcurrent_load_list 490
+#define iQcurrent_load_list 497
 DEFINE_LISP_SYMBOL (Qcurrent_load_list)
-#define iQcurrent_minibuffer_command 491
+#define iQcurrent_minibuffer_command 498
 DEFINE_LISP_SYMBOL (Qcurrent_minibuffer_command)
-#define iQcursor 492
+#define iQcursor 499
 DEFINE_LISP_SYMBOL (Qcursor)
-#define iQcursor_color 493
+#define iQcursor_color 500
 DEFINE_LISP_SYMBOL (Qcursor_color)
-#define iQcursor_in_echo_area 494
+#define iQcursor_in_echo_area 501
 DEFINE_LISP_SYMBOL (Qcursor_in_echo_area)
-#define iQcursor_type 495
+#define iQcursor_type 502
 DEFINE_LISP_SYMBOL (Qcursor_type)
-#define iQcurve 496
+#define iQcurve 503
 DEFINE_LISP_SYMBOL (Qcurve)
-#define iQcustom_delayed_init_variables 497
+#define iQcustom_delayed_init_variables 504
 DEFINE_LISP_SYMBOL (Qcustom_delayed_init_variables)
-#define iQcustom_variable_history 498
+#define iQcustom_variable_history 505
 DEFINE_LISP_SYMBOL (Qcustom_variable_history)
-#define iQcustom_variable_p 499
+#define iQcustom_variable_p 506
 DEFINE_LISP_SYMBOL (Qcustom_variable_p)
-#define iQcutime 500
+#define iQcutime 507
 DEFINE_LISP_SYMBOL (Qcutime)
-#define iQcw 501
+#define iQcw 508
 DEFINE_LISP_SYMBOL (Qcw)
-#define iQcycle_sort_function 502
+#define iQcycle_sort_function 509
 DEFINE_LISP_SYMBOL (Qcycle_sort_function)
-#define iQcyclic_function_indirection 503
+#define iQcyclic_function_indirection 510
 DEFINE_LISP_SYMBOL (Qcyclic_function_indirection)
-#define iQcyclic_variable_indirection 504
+#define iQcyclic_variable_indirection 511
 DEFINE_LISP_SYMBOL (Qcyclic_variable_indirection)
-#define iQd 505
+#define iQd 512
 DEFINE_LISP_SYMBOL (Qd)
-#define iQd_default 506
+#define iQd_default 513
 DEFINE_LISP_SYMBOL (Qd_default)
-#define iQd_ephemeral 507
+#define iQd_ephemeral 514
 DEFINE_LISP_SYMBOL (Qd_ephemeral)
-#define iQdark 508
+#define iQdark 515
 DEFINE_LISP_SYMBOL (Qdark)
-#define iQdashes 509
+#define iQdashes 516
 DEFINE_LISP_SYMBOL (Qdashes)
-#define iQdata 510
+#define iQdata 517
 DEFINE_LISP_SYMBOL (Qdata)
-#define iQdatagram 511
+#define iQdatagram 518
 DEFINE_LISP_SYMBOL (Qdatagram)
-#define iQdays 512
+#define iQdays 519
 DEFINE_LISP_SYMBOL (Qdays)
-#define iQdbus_event 513
+#define iQdbus_event 520
 DEFINE_LISP_SYMBOL (Qdbus_event)
-#define iQdeactivate_mark 514
+#define iQdeactivate_mark 521
 DEFINE_LISP_SYMBOL (Qdeactivate_mark)
-#define iQdebug 515
+#define iQdebug 522
 DEFINE_LISP_SYMBOL (Qdebug)
-#define iQdebug_early 516
+#define iQdebug_early 523
 DEFINE_LISP_SYMBOL (Qdebug_early)
-#define iQdebug_early__handler 517
+#define iQdebug_early__handler 524
 DEFINE_LISP_SYMBOL (Qdebug_early__handler)
-#define iQdebug_early__muted 518
+#define iQdebug_early__muted 525
 DEFINE_LISP_SYMBOL (Qdebug_early__muted)
-#define iQdebug_on_next_call 519
+#define iQdebug_on_next_call 526
 DEFINE_LISP_SYMBOL (Qdebug_on_next_call)
-#define iQdebugger 520
+#define iQdebugger 527
 DEFINE_LISP_SYMBOL (Qdebugger)
-#define iQdebugger_may_continue 521
+#define iQdebugger_may_continue 528
 DEFINE_LISP_SYMBOL (Qdebugger_may_continue)
-#define iQdecomposed_characters 522
+#define iQdecomposed_characters 529
 DEFINE_LISP_SYMBOL (Qdecomposed_characters)
-#define iQdedicated 523
+#define iQdedicated 530
 DEFINE_LISP_SYMBOL (Qdedicated)
-#define iQdefalias_fset_function 524
+#define iQdefalias_fset_function 531
 DEFINE_LISP_SYMBOL (Qdefalias_fset_function)
-#define iQdefault 525
+#define iQdefault 532
 DEFINE_LISP_SYMBOL (Qdefault)
-#define iQdefault_directory 526
+#define iQdefault_directory 533
 DEFINE_LISP_SYMBOL (Qdefault_directory)
-#define iQdefault_keyboard_coding_system 527
+#define iQdefault_keyboard_coding_system 534
 DEFINE_LISP_SYMBOL (Qdefault_keyboard_coding_system)
-#define iQdefault_terminal_coding_system 528
+#define iQdefault_terminal_coding_system 535
 DEFINE_LISP_SYMBOL (Qdefault_terminal_coding_system)
-#define iQdefine_charset_internal 529
+#define iQdefine_charset_internal 536
 DEFINE_LISP_SYMBOL (Qdefine_charset_internal)
-#define iQdefine_coding_system_internal 530
+#define iQdefine_coding_system_internal 537
 DEFINE_LISP_SYMBOL (Qdefine_coding_system_internal)
-#define iQdefun 531
+#define iQdefun 538
 DEFINE_LISP_SYMBOL (Qdefun)
-#define iQdefvaralias 532
+#define iQdefvaralias 539
 DEFINE_LISP_SYMBOL (Qdefvaralias)
-#define iQdelay 533
+#define iQdelay 540
 DEFINE_LISP_SYMBOL (Qdelay)
-#define iQdelayed_warnings_hook 534
+#define iQdelayed_warnings_hook 541
 DEFINE_LISP_SYMBOL (Qdelayed_warnings_hook)
-#define iQdelete 535
+#define iQdelete 542
 DEFINE_LISP_SYMBOL (Qdelete)
-#define iQdelete_auto_save_file_if_necessary 536
+#define iQdelete_auto_save_file_if_necessary 543
 DEFINE_LISP_SYMBOL (Qdelete_auto_save_file_if_necessary)
-#define iQdelete_before 537
+#define iQdelete_before 544
 DEFINE_LISP_SYMBOL (Qdelete_before)
-#define iQdelete_by_moving_to_trash 538
+#define iQdelete_by_moving_to_trash 545
 DEFINE_LISP_SYMBOL (Qdelete_by_moving_to_trash)
-#define iQdelete_directory 539
+#define iQdelete_directory 546
 DEFINE_LISP_SYMBOL (Qdelete_directory)
-#define iQdelete_file 540
+#define iQdelete_file 547
 DEFINE_LISP_SYMBOL (Qdelete_file)
-#define iQdelete_file_internal 541
+#define iQdelete_file_internal 548
 DEFINE_LISP_SYMBOL (Qdelete_file_internal)
-#define iQdelete_frame 542
+#define iQdelete_frame 549
 DEFINE_LISP_SYMBOL (Qdelete_frame)
-#define iQdelete_frame_functions 543
+#define iQdelete_frame_functions 550
 DEFINE_LISP_SYMBOL (Qdelete_frame_functions)
-#define iQdelete_terminal_functions 544
+#define iQdelete_terminal_functions 551
 DEFINE_LISP_SYMBOL (Qdelete_terminal_functions)
-#define iQdelete_window 545
+#define iQdelete_window 552
 DEFINE_LISP_SYMBOL (Qdelete_window)
-#define iQdigests 546
+#define iQdigests 553
 DEFINE_LISP_SYMBOL (Qdigests)
-#define iQdir_ok 547
+#define iQdir_ok 554
 DEFINE_LISP_SYMBOL (Qdir_ok)
-#define iQdirect_call 548
+#define iQdirect_call 555
 DEFINE_LISP_SYMBOL (Qdirect_call)
-#define iQdirect_callref 549
+#define iQdirect_callref 556
 DEFINE_LISP_SYMBOL (Qdirect_callref)
-#define iQdirect_color 550
+#define iQdirect_color 557
 DEFINE_LISP_SYMBOL (Qdirect_color)
-#define iQdirectory_file_name 551
+#define iQdirectory_file_name 558
 DEFINE_LISP_SYMBOL (Qdirectory_file_name)
-#define iQdirectory_files 552
+#define iQdirectory_files 559
 DEFINE_LISP_SYMBOL (Qdirectory_files)
-#define iQdirectory_files_and_attributes 553
+#define iQdirectory_files_and_attributes 560
 DEFINE_LISP_SYMBOL (Qdirectory_files_and_attributes)
-#define iQdisable_eval 554
+#define iQdisable_eval 561
 DEFINE_LISP_SYMBOL (Qdisable_eval)
-#define iQdisabled 555
+#define iQdisabled 562
 DEFINE_LISP_SYMBOL (Qdisabled)
-#define iQdisplay 556
+#define iQdisplay 563
 DEFINE_LISP_SYMBOL (Qdisplay)
-#define iQdisplay_buffer 557
+#define iQdisplay_buffer 564
 DEFINE_LISP_SYMBOL (Qdisplay_buffer)
-#define iQdisplay_fill_column_indicator 558
+#define iQdisplay_fill_column_indicator 565
 DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator)
-#define iQdisplay_fill_column_indicator_character 559
+#define iQdisplay_fill_column_indicator_character 566
 DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator_character)
-#define iQdisplay_fill_column_indicator_column 560
+#define iQdisplay_fill_column_indicator_column 567
 DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator_column)
-#define iQdisplay_line_numbers 561
+#define iQdisplay_line_numbers 568
 DEFINE_LISP_SYMBOL (Qdisplay_line_numbers)
-#define iQdisplay_line_numbers_disable 562
+#define iQdisplay_line_numbers_disable 569
 DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_disable)
-#define iQdisplay_line_numbers_offset 563
+#define iQdisplay_line_numbers_offset 570
 DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_offset)
-#define iQdisplay_line_numbers_widen 564
+#define iQdisplay_line_numbers_widen 571
 DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_widen)
-#define iQdisplay_line_numbers_width 565
+#define iQdisplay_line_numbers_width 572
 DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_width)
-#define iQdisplay_monitors_changed_functions 566
+#define iQdisplay_monitors_changed_functions 573
 DEFINE_LISP_SYMBOL (Qdisplay_monitors_changed_functions)
-#define iQdisplay_table 567
+#define iQdisplay_table 574
 DEFINE_LISP_SYMBOL (Qdisplay_table)
-#define iQdisplay_type 568
+#define iQdisplay_type 575
 DEFINE_LISP_SYMBOL (Qdisplay_type)
-#define iQdisplay_warning 569
+#define iQdisplay_warning 576
 DEFINE_LISP_SYMBOL (Qdisplay_warning)
-#define iQdo_after_load_evaluation 570
+#define iQdo_after_load_evaluation 577
 DEFINE_LISP_SYMBOL (Qdo_after_load_evaluation)
-#define iQdomain_error 571
+#define iQdomain_error 578
 DEFINE_LISP_SYMBOL (Qdomain_error)
-#define iQdont_clear_message 572
+#define iQdont_clear_message 579
 DEFINE_LISP_SYMBOL (Qdont_clear_message)
-#define iQdos 573
+#define iQdos 580
 DEFINE_LISP_SYMBOL (Qdos)
-#define iQdots 574
+#define iQdots 581
 DEFINE_LISP_SYMBOL (Qdots)
-#define iQdouble_line 575
+#define iQdouble_line 582
 DEFINE_LISP_SYMBOL (Qdouble_line)
-#define iQdown 576
+#define iQdown 583
 DEFINE_LISP_SYMBOL (Qdown)
-#define iQdrag_internal_border 577
+#define iQdrag_internal_border 584
 DEFINE_LISP_SYMBOL (Qdrag_internal_border)
-#define iQdrag_n_drop 578
+#define iQdrag_n_drop 585
 DEFINE_LISP_SYMBOL (Qdrag_n_drop)
-#define iQdrag_source 579
+#define iQdrag_source 586
 DEFINE_LISP_SYMBOL (Qdrag_source)
-#define iQdrag_with_header_line 580
+#define iQdrag_with_header_line 587
 DEFINE_LISP_SYMBOL (Qdrag_with_header_line)
-#define iQdrag_with_mode_line 581
+#define iQdrag_with_mode_line 588
 DEFINE_LISP_SYMBOL (Qdrag_with_mode_line)
-#define iQdrag_with_tab_line 582
+#define iQdrag_with_tab_line 589
 DEFINE_LISP_SYMBOL (Qdrag_with_tab_line)
-#define iQdragging 583
+#define iQdragging 590
 DEFINE_LISP_SYMBOL (Qdragging)
-#define iQdropping 584
+#define iQdropping 591
 DEFINE_LISP_SYMBOL (Qdropping)
-#define iQdump_emacs_portable__sort_predicate 585
+#define iQdump_emacs_portable__sort_predicate 592
 DEFINE_LISP_SYMBOL (Qdump_emacs_portable__sort_predicate)
-#define iQdump_emacs_portable__sort_predicate_copied 586
+#define iQdump_emacs_portable__sort_predicate_copied 593
 DEFINE_LISP_SYMBOL (Qdump_emacs_portable__sort_predicate_copied)
-#define iQdump_file_name 587
+#define iQdump_file_name 594
 DEFINE_LISP_SYMBOL (Qdump_file_name)
-#define iQdumped_with_pdumper 588
+#define iQdumped_with_pdumper 595
 DEFINE_LISP_SYMBOL (Qdumped_with_pdumper)
-#define iQecho_area_clear_hook 589
+#define iQecho_area_clear_hook 596
 DEFINE_LISP_SYMBOL (Qecho_area_clear_hook)
-#define iQecho_keystrokes 590
+#define iQecho_keystrokes 597
 DEFINE_LISP_SYMBOL (Qecho_keystrokes)
-#define iQedge_detection 591
+#define iQedge_detection 598
 DEFINE_LISP_SYMBOL (Qedge_detection)
-#define iQegid 592
+#define iQegid 599
 DEFINE_LISP_SYMBOL (Qegid)
-#define iQeight_bit 593
+#define iQeight_bit 600
 DEFINE_LISP_SYMBOL (Qeight_bit)
-#define iQelt 594
+#define iQelt 601
 DEFINE_LISP_SYMBOL (Qelt)
-#define iQem 595
+#define iQem 602
 DEFINE_LISP_SYMBOL (Qem)
-#define iQemacs 596
+#define iQemacs 603
 DEFINE_LISP_SYMBOL (Qemacs)
-#define iQemacs_mule 597
+#define iQemacs_mule 604
 DEFINE_LISP_SYMBOL (Qemacs_mule)
-#define iQemboss 598
+#define iQemboss 605
 DEFINE_LISP_SYMBOL (Qemboss)
-#define iQemoji 599
+#define iQemoji 606
 DEFINE_LISP_SYMBOL (Qemoji)
-#define iQempty_box 600
+#define iQempty_box 607
 DEFINE_LISP_SYMBOL (Qempty_box)
-#define iQempty_line 601
+#define iQempty_line 608
 DEFINE_LISP_SYMBOL (Qempty_line)
-#define iQenable_recursive_minibuffers 602
+#define iQenable_recursive_minibuffers 609
 DEFINE_LISP_SYMBOL (Qenable_recursive_minibuffers)
-#define iQencode_time 603
+#define iQencode_time 610
 DEFINE_LISP_SYMBOL (Qencode_time)
-#define iQencoded 604
+#define iQencoded 611
 DEFINE_LISP_SYMBOL (Qencoded)
-#define iQend_of_buffer 605
+#define iQend_of_buffer 612
 DEFINE_LISP_SYMBOL (Qend_of_buffer)
-#define iQend_of_file 606
+#define iQend_of_file 613
 DEFINE_LISP_SYMBOL (Qend_of_file)
-#define iQend_scroll 607
+#define iQend_scroll 614
 DEFINE_LISP_SYMBOL (Qend_scroll)
-#define iQend_session 608
+#define iQend_session 615
 DEFINE_LISP_SYMBOL (Qend_session)
-#define iQentry 609
+#define iQentry 616
 DEFINE_LISP_SYMBOL (Qentry)
-#define iQeq 610
+#define iQeq 617
 DEFINE_LISP_SYMBOL (Qeq)
-#define iQeql 611
+#define iQeql 618
 DEFINE_LISP_SYMBOL (Qeql)
-#define iQequal 612
+#define iQequal 619
 DEFINE_LISP_SYMBOL (Qequal)
-#define iQerror_conditions 613
+#define iQerror_conditions 620
 DEFINE_LISP_SYMBOL (Qerror_conditions)
-#define iQerror_message 614
+#define iQerror_message 621
 DEFINE_LISP_SYMBOL (Qerror_message)
-#define iQescape_glyph 615
+#define iQescape_glyph 622
 DEFINE_LISP_SYMBOL (Qescape_glyph)
-#define iQetime 616
+#define iQetime 623
 DEFINE_LISP_SYMBOL (Qetime)
-#define iQeuid 617
+#define iQeuid 624
 DEFINE_LISP_SYMBOL (Qeuid)
-#define iQeval 618
+#define iQeval 625
 DEFINE_LISP_SYMBOL (Qeval)
-#define iQeval_buffer_list 619
+#define iQeval_buffer_list 626
 DEFINE_LISP_SYMBOL (Qeval_buffer_list)
-#define iQeval_minibuffer 620
+#define iQeval_minibuffer 627
 DEFINE_LISP_SYMBOL (Qeval_minibuffer)
-#define iQevaporate 621
+#define iQevaporate 628
 DEFINE_LISP_SYMBOL (Qevaporate)
-#define iQeven 622
+#define iQeven 629
 DEFINE_LISP_SYMBOL (Qeven)
-#define iQevent_kind 623
+#define iQevent_kind 630
 DEFINE_LISP_SYMBOL (Qevent_kind)
-#define iQevent_symbol_element_mask 624
+#define iQevent_symbol_element_mask 631
 DEFINE_LISP_SYMBOL (Qevent_symbol_element_mask)
-#define iQevent_symbol_elements 625
+#define iQevent_symbol_elements 632
 DEFINE_LISP_SYMBOL (Qevent_symbol_elements)
-#define iQexcessive_lisp_nesting 626
+#define iQexcessive_lisp_nesting 633
 DEFINE_LISP_SYMBOL (Qexcessive_lisp_nesting)
-#define iQexcessive_variable_binding 627
+#define iQexcessive_variable_binding 634
 DEFINE_LISP_SYMBOL (Qexcessive_variable_binding)
-#define iQexcl 628
+#define iQexcl 635
 DEFINE_LISP_SYMBOL (Qexcl)
-#define iQexit 629
+#define iQexit 636
 DEFINE_LISP_SYMBOL (Qexit)
-#define iQexpand_abbrev 630
+#define iQexpand_abbrev 637
 DEFINE_LISP_SYMBOL (Qexpand_abbrev)
-#define iQexpand_file_name 631
+#define iQexpand_file_name 638
 DEFINE_LISP_SYMBOL (Qexpand_file_name)
-#define iQexpanded 632
+#define iQexpanded 639
 DEFINE_LISP_SYMBOL (Qexpanded)
-#define iQexplicit 633
+#define iQexplicit 640
 DEFINE_LISP_SYMBOL (Qexplicit)
-#define iQexplicit_name 634
+#define iQexplicit_name 641
 DEFINE_LISP_SYMBOL (Qexplicit_name)
-#define iQexpose_hidden_buffer 635
+#define iQexpose_hidden_buffer 642
 DEFINE_LISP_SYMBOL (Qexpose_hidden_buffer)
-#define iQextend 636
+#define iQextend 643
 DEFINE_LISP_SYMBOL (Qextend)
-#define iQextension_data 637
+#define iQextension_data 644
 DEFINE_LISP_SYMBOL (Qextension_data)
-#define iQexternal_border_size 638
+#define iQexternal_border_size 645
 DEFINE_LISP_SYMBOL (Qexternal_border_size)
-#define iQexternal_debugging_output 639
+#define iQexternal_debugging_output 646
 DEFINE_LISP_SYMBOL (Qexternal_debugging_output)
-#define iQextra 640
+#define iQextra 647
 DEFINE_LISP_SYMBOL (Qextra)
-#define iQextra_bold 641
+#define iQextra_bold 648
 DEFINE_LISP_SYMBOL (Qextra_bold)
-#define iQextra_light 642
+#define iQextra_light 649
 DEFINE_LISP_SYMBOL (Qextra_light)
-#define iQf0 643
+#define iQf0 650
 DEFINE_LISP_SYMBOL (Qf0)
-#define iQf10 644
+#define iQf10 651
 DEFINE_LISP_SYMBOL (Qf10)
-#define iQface 645
+#define iQface 652
 DEFINE_LISP_SYMBOL (Qface)
-#define iQface_alias 646
+#define iQface_alias 653
 DEFINE_LISP_SYMBOL (Qface_alias)
-#define iQface_no_inherit 647
+#define iQface_no_inherit 654
 DEFINE_LISP_SYMBOL (Qface_no_inherit)
-#define iQface_remapping_alist 648
+#define iQface_remapping_alist 655
 DEFINE_LISP_SYMBOL (Qface_remapping_alist)
-#define iQface_set_after_frame_default 649
+#define iQface_set_after_frame_default 656
 DEFINE_LISP_SYMBOL (Qface_set_after_frame_default)
-#define iQfailed 650
+#define iQfailed 657
 DEFINE_LISP_SYMBOL (Qfailed)
-#define iQfalse 651
+#define iQfalse 658
 DEFINE_LISP_SYMBOL (Qfalse)
-#define iQfboundp 652
+#define iQfboundp 659
 DEFINE_LISP_SYMBOL (Qfboundp)
-#define iQfeatures 653
+#define iQfeatures 660
 DEFINE_LISP_SYMBOL (Qfeatures)
-#define iQfetch_handler 654
+#define iQfetch_handler 661
 DEFINE_LISP_SYMBOL (Qfetch_handler)
-#define iQfield 655
+#define iQfield 662
 DEFINE_LISP_SYMBOL (Qfield)
-#define iQfile 656
+#define iQfile 663
 DEFINE_LISP_SYMBOL (Qfile)
-#define iQfile_accessible_directory_p 657
+#define iQfile_accessible_directory_p 664
 DEFINE_LISP_SYMBOL (Qfile_accessible_directory_p)
-#define iQfile_acl 658
+#define iQfile_acl 665
 DEFINE_LISP_SYMBOL (Qfile_acl)
-#define iQfile_already_exists 659
+#define iQfile_already_exists 666
 DEFINE_LISP_SYMBOL (Qfile_already_exists)
-#define iQfile_attributes 660
+#define iQfile_attributes 667
 DEFINE_LISP_SYMBOL (Qfile_attributes)
-#define iQfile_attributes_lessp 661
+#define iQfile_attributes_lessp 668
 DEFINE_LISP_SYMBOL (Qfile_attributes_lessp)
-#define iQfile_date_error 662
+#define iQfile_date_error 669
 DEFINE_LISP_SYMBOL (Qfile_date_error)
-#define iQfile_directory_p 663
+#define iQfile_directory_p 670
 DEFINE_LISP_SYMBOL (Qfile_directory_p)
-#define iQfile_error 664
+#define iQfile_error 671
 DEFINE_LISP_SYMBOL (Qfile_error)
-#define iQfile_executable_p 665
+#define iQfile_executable_p 672
 DEFINE_LISP_SYMBOL (Qfile_executable_p)
-#define iQfile_exists_p 666
+#define iQfile_exists_p 673
 DEFINE_LISP_SYMBOL (Qfile_exists_p)
-#define iQfile_locked_p 667
+#define iQfile_locked_p 674
 DEFINE_LISP_SYMBOL (Qfile_locked_p)
-#define iQfile_missing 668
+#define iQfile_missing 675
 DEFINE_LISP_SYMBOL (Qfile_missing)
-#define iQfile_modes 669
+#define iQfile_modes 676
 DEFINE_LISP_SYMBOL (Qfile_modes)
-#define iQfile_name_all_completions 670
+#define iQfile_name_all_completions 677
 DEFINE_LISP_SYMBOL (Qfile_name_all_completions)
-#define iQfile_name_as_directory 671
+#define iQfile_name_as_directory 678
 DEFINE_LISP_SYMBOL (Qfile_name_as_directory)
-#define iQfile_name_case_insensitive_p 672
+#define iQfile_name_case_insensitive_p 679
 DEFINE_LISP_SYMBOL (Qfile_name_case_insensitive_p)
-#define iQfile_name_completion 673
+#define iQfile_name_completion 680
 DEFINE_LISP_SYMBOL (Qfile_name_completion)
-#define iQfile_name_directory 674
+#define iQfile_name_directory 681
 DEFINE_LISP_SYMBOL (Qfile_name_directory)
-#define iQfile_name_handler_alist 675
+#define iQfile_name_handler_alist 682
 DEFINE_LISP_SYMBOL (Qfile_name_handler_alist)
-#define iQfile_name_history 676
+#define iQfile_name_history 683
 DEFINE_LISP_SYMBOL (Qfile_name_history)
-#define iQfile_name_nondirectory 677
+#define iQfile_name_nondirectory 684
 DEFINE_LISP_SYMBOL (Qfile_name_nondirectory)
-#define iQfile_newer_than_file_p 678
+#define iQfile_newer_than_file_p 685
 DEFINE_LISP_SYMBOL (Qfile_newer_than_file_p)
-#define iQfile_notify 679
+#define iQfile_notify 686
 DEFINE_LISP_SYMBOL (Qfile_notify)
-#define iQfile_notify_error 680
+#define iQfile_notify_error 687
 DEFINE_LISP_SYMBOL (Qfile_notify_error)
-#define iQfile_offset 681
+#define iQfile_offset 688
 DEFINE_LISP_SYMBOL (Qfile_offset)
-#define iQfile_readable_p 682
+#define iQfile_readable_p 689
 DEFINE_LISP_SYMBOL (Qfile_readable_p)
-#define iQfile_regular_p 683
+#define iQfile_regular_p 690
 DEFINE_LISP_SYMBOL (Qfile_regular_p)
-#define iQfile_remote_p 684
+#define iQfile_remote_p 691
 DEFINE_LISP_SYMBOL (Qfile_remote_p)
-#define iQfile_selinux_context 685
+#define iQfile_selinux_context 692
 DEFINE_LISP_SYMBOL (Qfile_selinux_context)
-#define iQfile_symlink_p 686
+#define iQfile_symlink_p 693
 DEFINE_LISP_SYMBOL (Qfile_symlink_p)
-#define iQfile_system_info 687
+#define iQfile_system_info 694
 DEFINE_LISP_SYMBOL (Qfile_system_info)
-#define iQfile_truename 688
+#define iQfile_truename 695
 DEFINE_LISP_SYMBOL (Qfile_truename)
-#define iQfile_writable_p 689
+#define iQfile_writable_p 696
 DEFINE_LISP_SYMBOL (Qfile_writable_p)
-#define iQfilenamep 690
+#define iQfilenamep 697
 DEFINE_LISP_SYMBOL (Qfilenamep)
-#define iQfill_column_indicator 691
+#define iQfill_column_indicator 698
 DEFINE_LISP_SYMBOL (Qfill_column_indicator)
-#define iQfinalizer 692
+#define iQfinalizer 699
 DEFINE_LISP_SYMBOL (Qfinalizer)
-#define iQfirst_change_hook 693
+#define iQfirst_change_hook 700
 DEFINE_LISP_SYMBOL (Qfirst_change_hook)
-#define iQfixnum 694
+#define iQfixnum 701
 DEFINE_LISP_SYMBOL (Qfixnum)
-#define iQfixnum_or_symbol_with_pos_p 695
+#define iQfixnum_or_symbol_with_pos_p 702
 DEFINE_LISP_SYMBOL (Qfixnum_or_symbol_with_pos_p)
-#define iQfixnump 696
+#define iQfixnump 703
 DEFINE_LISP_SYMBOL (Qfixnump)
-#define iQflat_button 697
+#define iQflat_button 704
 DEFINE_LISP_SYMBOL (Qflat_button)
-#define iQfloat 698
+#define iQfloat 705
 DEFINE_LISP_SYMBOL (Qfloat)
-#define iQfloat_output_format 699
+#define iQfloat_output_format 706
 DEFINE_LISP_SYMBOL (Qfloat_output_format)
-#define iQfloatp 700
+#define iQfloatp 707
 DEFINE_LISP_SYMBOL (Qfloatp)
-#define iQfloats 701
+#define iQfloats 708
 DEFINE_LISP_SYMBOL (Qfloats)
-#define iQfloor 702
+#define iQfloor 709
 DEFINE_LISP_SYMBOL (Qfloor)
-#define iQfocus_in 703
+#define iQfocus_in 710
 DEFINE_LISP_SYMBOL (Qfocus_in)
-#define iQfocus_out 704
+#define iQfocus_out 711
 DEFINE_LISP_SYMBOL (Qfocus_out)
-#define iQfont 705
+#define iQfont 712
 DEFINE_LISP_SYMBOL (Qfont)
-#define iQfont_backend 706
+#define iQfont_backend 713
 DEFINE_LISP_SYMBOL (Qfont_backend)
-#define iQfont_driver_superseded_by 707
+#define iQfont_driver_superseded_by 714
 DEFINE_LISP_SYMBOL (Qfont_driver_superseded_by)
-#define iQfont_entity 708
+#define iQfont_entity 715
 DEFINE_LISP_SYMBOL (Qfont_entity)
-#define iQfont_extra_type 709
+#define iQfont_extra_type 716
 DEFINE_LISP_SYMBOL (Qfont_extra_type)
-#define iQfont_lock_face 710
+#define iQfont_lock_face 717
 DEFINE_LISP_SYMBOL (Qfont_lock_face)
-#define iQfont_object 711
+#define iQfont_object 718
 DEFINE_LISP_SYMBOL (Qfont_object)
-#define iQfont_parameter 712
+#define iQfont_parameter 719
 DEFINE_LISP_SYMBOL (Qfont_parameter)
-#define iQfont_spec 713
+#define iQfont_spec 720
 DEFINE_LISP_SYMBOL (Qfont_spec)
-#define iQfontification_functions 714
+#define iQfontification_functions 721
 DEFINE_LISP_SYMBOL (Qfontification_functions)
-#define iQfontified 715
+#define iQfontified 722
 DEFINE_LISP_SYMBOL (Qfontified)
-#define iQfontset 716
+#define iQfontset 723
 DEFINE_LISP_SYMBOL (Qfontset)
-#define iQfontset_info 717
+#define iQfontset_info 724
 DEFINE_LISP_SYMBOL (Qfontset_info)
-#define iQfontset_startup 718
+#define iQfontset_startup 725
 DEFINE_LISP_SYMBOL (Qfontset_startup)
-#define iQfontsize 719
+#define iQfontsize 726
 DEFINE_LISP_SYMBOL (Qfontsize)
-#define iQforce 720
+#define iQforce 727
 DEFINE_LISP_SYMBOL (Qforce)
-#define iQforeground_color 721
+#define iQforeground_color 728
 DEFINE_LISP_SYMBOL (Qforeground_color)
-#define iQformat_annotate_function 722
+#define iQformat_annotate_function 729
 DEFINE_LISP_SYMBOL (Qformat_annotate_function)
-#define iQformat_decode 723
+#define iQformat_decode 730
 DEFINE_LISP_SYMBOL (Qformat_decode)
-#define iQformat_prompt 724
+#define iQformat_prompt 731
 DEFINE_LISP_SYMBOL (Qformat_prompt)
-#define iQfraction 725
+#define iQfraction 732
 DEFINE_LISP_SYMBOL (Qfraction)
-#define iQframe 726
+#define iQframe 733
 DEFINE_LISP_SYMBOL (Qframe)
-#define iQframe__z_order_lessp 727
+#define iQframe__z_order_lessp 734
 DEFINE_LISP_SYMBOL (Qframe__z_order_lessp)
-#define iQframe_edges 728
+#define iQframe_edges 735
 DEFINE_LISP_SYMBOL (Qframe_edges)
-#define iQframe_id 729
+#define iQframe_id 736
 DEFINE_LISP_SYMBOL (Qframe_id)
-#define iQframe_live_p 730
+#define iQframe_live_p 737
 DEFINE_LISP_SYMBOL (Qframe_live_p)
-#define iQframe_monitor_attributes 731
+#define iQframe_monitor_attributes 738
 DEFINE_LISP_SYMBOL (Qframe_monitor_attributes)
-#define iQframe_set_background_mode 732
+#define iQframe_set_background_mode 739
 DEFINE_LISP_SYMBOL (Qframe_set_background_mode)
-#define iQframe_title_format 733
+#define iQframe_title_format 740
 DEFINE_LISP_SYMBOL (Qframe_title_format)
-#define iQframe_windows_min_size 734
+#define iQframe_windows_min_size 741
 DEFINE_LISP_SYMBOL (Qframe_windows_min_size)
-#define iQframep 735
+#define iQframep 742
 DEFINE_LISP_SYMBOL (Qframep)
-#define iQframes 736
+#define iQframes 743
 DEFINE_LISP_SYMBOL (Qframes)
-#define iQfringe 737
+#define iQfringe 744
 DEFINE_LISP_SYMBOL (Qfringe)
-#define iQfrom__tty_menu_p 738
+#define iQfrom__tty_menu_p 745
 DEFINE_LISP_SYMBOL (Qfrom__tty_menu_p)
-#define iQfront_sticky 739
+#define iQfront_sticky 746
 DEFINE_LISP_SYMBOL (Qfront_sticky)
-#define iQfull 740
+#define iQfull 747
 DEFINE_LISP_SYMBOL (Qfull)
-#define iQfullboth 741
+#define iQfullboth 748
 DEFINE_LISP_SYMBOL (Qfullboth)
-#define iQfullheight 742
+#define iQfullheight 749
 DEFINE_LISP_SYMBOL (Qfullheight)
-#define iQfullscreen 743
+#define iQfullscreen 750
 DEFINE_LISP_SYMBOL (Qfullscreen)
-#define iQfullwidth 744
+#define iQfullwidth 751
 DEFINE_LISP_SYMBOL (Qfullwidth)
-#define iQfuncall 745
+#define iQfuncall 752
 DEFINE_LISP_SYMBOL (Qfuncall)
-#define iQfuncall_interactively 746
+#define iQfuncall_interactively 753
 DEFINE_LISP_SYMBOL (Qfuncall_interactively)
-#define iQfunction 747
+#define iQfunction 754
 DEFINE_LISP_SYMBOL (Qfunction)
-#define iQfunction_documentation 748
+#define iQfunction_documentation 755
 DEFINE_LISP_SYMBOL (Qfunction_documentation)
-#define iQfunction_history 749
+#define iQfunction_history 756
 DEFINE_LISP_SYMBOL (Qfunction_history)
-#define iQfunction_key 750
+#define iQfunction_key 757
 DEFINE_LISP_SYMBOL (Qfunction_key)
-#define iQfunctionp 751
+#define iQfunctionp 758
 DEFINE_LISP_SYMBOL (Qfunctionp)
-#define iQfundamental_mode 752
+#define iQfundamental_mode 759
 DEFINE_LISP_SYMBOL (Qfundamental_mode)
-#define iQgc_cons_percentage 753
+#define iQgc_cons_percentage 760
 DEFINE_LISP_SYMBOL (Qgc_cons_percentage)
-#define iQgc_cons_threshold 754
+#define iQgc_cons_threshold 761
 DEFINE_LISP_SYMBOL (Qgc_cons_threshold)
-#define iQgccjit 755
+#define iQgccjit 762
 DEFINE_LISP_SYMBOL (Qgccjit)
-#define iQgdiplus 756
+#define iQgdiplus 763
 DEFINE_LISP_SYMBOL (Qgdiplus)
-#define iQgdk_pixbuf 757
+#define iQgdk_pixbuf 764
 DEFINE_LISP_SYMBOL (Qgdk_pixbuf)
-#define iQgeometry 758
+#define iQgeometry 765
 DEFINE_LISP_SYMBOL (Qgeometry)
-#define iQget_buffer_window_list 759
+#define iQget_buffer_window_list 766
 DEFINE_LISP_SYMBOL (Qget_buffer_window_list)
-#define iQget_emacs_mule_file_char 760
+#define iQget_emacs_mule_file_char 767
 DEFINE_LISP_SYMBOL (Qget_emacs_mule_file_char)
-#define iQget_file_buffer 761
+#define iQget_file_buffer 768
 DEFINE_LISP_SYMBOL (Qget_file_buffer)
-#define iQget_file_char 762
+#define iQget_file_char 769
 DEFINE_LISP_SYMBOL (Qget_file_char)
-#define iQget_mru_frame 763
+#define iQget_mru_frame 770
 DEFINE_LISP_SYMBOL (Qget_mru_frame)
-#define iQget_mru_window 764
+#define iQget_mru_window 771
 DEFINE_LISP_SYMBOL (Qget_mru_window)
-#define iQget_scratch_buffer_create 765
+#define iQget_scratch_buffer_create 772
 DEFINE_LISP_SYMBOL (Qget_scratch_buffer_create)
-#define iQgif 766
+#define iQgif 773
 DEFINE_LISP_SYMBOL (Qgif)
-#define iQgio 767
+#define iQgio 774
 DEFINE_LISP_SYMBOL (Qgio)
-#define iQglib 768
+#define iQglib 775
 DEFINE_LISP_SYMBOL (Qglib)
-#define iQglyphless_char 769
+#define iQglyphless_char 776
 DEFINE_LISP_SYMBOL (Qglyphless_char)
-#define iQglyphless_char_display 770
+#define iQglyphless_char_display 777
 DEFINE_LISP_SYMBOL (Qglyphless_char_display)
-#define iQgnustep 771
+#define iQgnustep 778
 DEFINE_LISP_SYMBOL (Qgnustep)
-#define iQgnutls 772
+#define iQgnutls 779
 DEFINE_LISP_SYMBOL (Qgnutls)
-#define iQgnutls3 773
+#define iQgnutls3 780
 DEFINE_LISP_SYMBOL (Qgnutls3)
-#define iQgnutls_anon 774
+#define iQgnutls_anon 781
 DEFINE_LISP_SYMBOL (Qgnutls_anon)
-#define iQgnutls_code 775
+#define iQgnutls_code 782
 DEFINE_LISP_SYMBOL (Qgnutls_code)
-#define iQgnutls_e_again 776
+#define iQgnutls_e_again 783
 DEFINE_LISP_SYMBOL (Qgnutls_e_again)
-#define iQgnutls_e_interrupted 777
+#define iQgnutls_e_interrupted 784
 DEFINE_LISP_SYMBOL (Qgnutls_e_interrupted)
-#define iQgnutls_e_invalid_session 778
+#define iQgnutls_e_invalid_session 785
 DEFINE_LISP_SYMBOL (Qgnutls_e_invalid_session)
-#define iQgnutls_e_not_ready_for_handshake 779
+#define iQgnutls_e_not_ready_for_handshake 786
 DEFINE_LISP_SYMBOL (Qgnutls_e_not_ready_for_handshake)
-#define iQgnutls_pkcs_null_password 780
+#define iQgnutls_pkcs_null_password 787
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_null_password)
-#define iQgnutls_pkcs_pbes1_des_md5 781
+#define iQgnutls_pkcs_pbes1_des_md5 788
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes1_des_md5)
-#define iQgnutls_pkcs_pbes2_3des 782
+#define iQgnutls_pkcs_pbes2_3des 789
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_3des)
-#define iQgnutls_pkcs_pbes2_aes_128 783
+#define iQgnutls_pkcs_pbes2_aes_128 790
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_128)
-#define iQgnutls_pkcs_pbes2_aes_192 784
+#define iQgnutls_pkcs_pbes2_aes_192 791
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_192)
-#define iQgnutls_pkcs_pbes2_aes_256 785
+#define iQgnutls_pkcs_pbes2_aes_256 792
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_256)
-#define iQgnutls_pkcs_pbes2_des 786
+#define iQgnutls_pkcs_pbes2_des 793
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_des)
-#define iQgnutls_pkcs_pbes2_gost_cpa 787
+#define iQgnutls_pkcs_pbes2_gost_cpa 794
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpa)
-#define iQgnutls_pkcs_pbes2_gost_cpb 788
+#define iQgnutls_pkcs_pbes2_gost_cpb 795
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpb)
-#define iQgnutls_pkcs_pbes2_gost_cpc 789
+#define iQgnutls_pkcs_pbes2_gost_cpc 796
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpc)
-#define iQgnutls_pkcs_pbes2_gost_cpd 790
+#define iQgnutls_pkcs_pbes2_gost_cpd 797
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpd)
-#define iQgnutls_pkcs_pbes2_gost_tc26z 791
+#define iQgnutls_pkcs_pbes2_gost_tc26z 798
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_tc26z)
-#define iQgnutls_pkcs_pkcs12_3des 792
+#define iQgnutls_pkcs_pkcs12_3des 799
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_3des)
-#define iQgnutls_pkcs_pkcs12_arcfour 793
+#define iQgnutls_pkcs_pkcs12_arcfour 800
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_arcfour)
-#define iQgnutls_pkcs_pkcs12_rc2_40 794
+#define iQgnutls_pkcs_pkcs12_rc2_40 801
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_rc2_40)
-#define iQgnutls_pkcs_plain 795
+#define iQgnutls_pkcs_plain 802
 DEFINE_LISP_SYMBOL (Qgnutls_pkcs_plain)
-#define iQgnutls_type_cipher 796
+#define iQgnutls_type_cipher 803
 DEFINE_LISP_SYMBOL (Qgnutls_type_cipher)
-#define iQgnutls_type_digest_algorithm 797
+#define iQgnutls_type_digest_algorithm 804
 DEFINE_LISP_SYMBOL (Qgnutls_type_digest_algorithm)
-#define iQgnutls_type_mac_algorithm 798
+#define iQgnutls_type_mac_algorithm 805
 DEFINE_LISP_SYMBOL (Qgnutls_type_mac_algorithm)
-#define iQgnutls_x509pki 799
+#define iQgnutls_x509pki 806
 DEFINE_LISP_SYMBOL (Qgnutls_x509pki)
-#define iQgobject 800
+#define iQgobject 807
 DEFINE_LISP_SYMBOL (Qgobject)
-#define iQgrave 801
+#define iQgrave 808
 DEFINE_LISP_SYMBOL (Qgrave)
-#define iQgray_scale 802
+#define iQgray_scale 809
 DEFINE_LISP_SYMBOL (Qgray_scale)
-#define iQgroup 803
+#define iQgroup 810
 DEFINE_LISP_SYMBOL (Qgroup)
-#define iQgrow_only 804
+#define iQgrow_only 811
 DEFINE_LISP_SYMBOL (Qgrow_only)
-#define iQgs_load_image 805
+#define iQgs_load_image 812
 DEFINE_LISP_SYMBOL (Qgs_load_image)
-#define iQgui_figure_window_size 806
+#define iQgui_figure_window_size 813
 DEFINE_LISP_SYMBOL (Qgui_figure_window_size)
-#define iQgui_set_selection 807
+#define iQgui_set_selection 814
 DEFINE_LISP_SYMBOL (Qgui_set_selection)
-#define iQhaiku 808
+#define iQhaiku 815
 DEFINE_LISP_SYMBOL (Qhaiku)
-#define iQhand 809
+#define iQhand 816
 DEFINE_LISP_SYMBOL (Qhand)
-#define iQhandle 810
+#define iQhandle 817
 DEFINE_LISP_SYMBOL (Qhandle)
-#define iQhandle_select_window 811
+#define iQhandle_select_window 818
 DEFINE_LISP_SYMBOL (Qhandle_select_window)
-#define iQhandle_shift_selection 812
+#define iQhandle_shift_selection 819
 DEFINE_LISP_SYMBOL (Qhandle_shift_selection)
-#define iQhandle_switch_frame 813
+#define iQhandle_switch_frame 820
 DEFINE_LISP_SYMBOL (Qhandle_switch_frame)
-#define iQhas_error 814
+#define iQhas_error 821
 DEFINE_LISP_SYMBOL (Qhas_error)
-#define iQhash_table 815
+#define iQhash_table 822
 DEFINE_LISP_SYMBOL (Qhash_table)
-#define iQhash_table_p 816
+#define iQhash_table_p 823
 DEFINE_LISP_SYMBOL (Qhash_table_p)
-#define iQhash_table_test 817
+#define iQhash_table_test 824
 DEFINE_LISP_SYMBOL (Qhash_table_test)
-#define iQhbar 818
+#define iQhbar 825
 DEFINE_LISP_SYMBOL (Qhbar)
-#define iQhdrag 819
+#define iQhdrag 826
 DEFINE_LISP_SYMBOL (Qhdrag)
-#define iQheader_line 820
+#define iQheader_line 827
 DEFINE_LISP_SYMBOL (Qheader_line)
-#define iQheader_line_active 821
+#define iQheader_line_active 828
 DEFINE_LISP_SYMBOL (Qheader_line_active)
-#define iQheader_line_format 822
+#define iQheader_line_format 829
 DEFINE_LISP_SYMBOL (Qheader_line_format)
-#define iQheader_line_inactive 823
+#define iQheader_line_inactive 830
 DEFINE_LISP_SYMBOL (Qheader_line_inactive)
-#define iQheap 824
+#define iQheap 831
 DEFINE_LISP_SYMBOL (Qheap)
-#define iQheavy 825
+#define iQheavy 832
 DEFINE_LISP_SYMBOL (Qheavy)
-#define iQheic 826
+#define iQheic 833
 DEFINE_LISP_SYMBOL (Qheic)
-#define iQheight 827
+#define iQheight 834
 DEFINE_LISP_SYMBOL (Qheight)
-#define iQheight_only 828
+#define iQheight_only 835
 DEFINE_LISP_SYMBOL (Qheight_only)
-#define iQhelp__append_keystrokes_help 829
+#define iQhelp__append_keystrokes_help 836
 DEFINE_LISP_SYMBOL (Qhelp__append_keystrokes_help)
-#define iQhelp__describe_map_tree 830
+#define iQhelp__describe_map_tree 837
 DEFINE_LISP_SYMBOL (Qhelp__describe_map_tree)
-#define iQhelp_echo 831
+#define iQhelp_echo 838
 DEFINE_LISP_SYMBOL (Qhelp_echo)
-#define iQhelp_echo_inhibit_substitution 832
+#define iQhelp_echo_inhibit_substitution 839
 DEFINE_LISP_SYMBOL (Qhelp_echo_inhibit_substitution)
-#define iQhelp_form_show 833
+#define iQhelp_form_show 840
 DEFINE_LISP_SYMBOL (Qhelp_form_show)
-#define iQhelp_key_binding 834
+#define iQhelp_key_binding 841
 DEFINE_LISP_SYMBOL (Qhelp_key_binding)
-#define iQhelper_sanitizer_assert 835
+#define iQhelper_sanitizer_assert 842
 DEFINE_LISP_SYMBOL (Qhelper_sanitizer_assert)
-#define iQhelper_save_restriction 836
+#define iQhelper_save_restriction 843
 DEFINE_LISP_SYMBOL (Qhelper_save_restriction)
-#define iQhelper_unbind_n 837
+#define iQhelper_unbind_n 844
 DEFINE_LISP_SYMBOL (Qhelper_unbind_n)
-#define iQhelper_unwind_protect 838
+#define iQhelper_unwind_protect 845
 DEFINE_LISP_SYMBOL (Qhelper_unwind_protect)
-#define iQheuristic 839
+#define iQheuristic 846
 DEFINE_LISP_SYMBOL (Qheuristic)
-#define iQhex_code 840
+#define iQhex_code 847
 DEFINE_LISP_SYMBOL (Qhex_code)
-#define iQhide 841
+#define iQhide 848
 DEFINE_LISP_SYMBOL (Qhide)
-#define iQhollow 842
+#define iQhollow 849
 DEFINE_LISP_SYMBOL (Qhollow)
-#define iQhollow_small 843
+#define iQhollow_small 850
 DEFINE_LISP_SYMBOL (Qhollow_small)
-#define iQhorizontal_handle 844
+#define iQhorizontal_handle 851
 DEFINE_LISP_SYMBOL (Qhorizontal_handle)
-#define iQhorizontal_scroll_bar 845
+#define iQhorizontal_scroll_bar 852
 DEFINE_LISP_SYMBOL (Qhorizontal_scroll_bar)
-#define iQhorizontal_scroll_bars 846
+#define iQhorizontal_scroll_bars 853
 DEFINE_LISP_SYMBOL (Qhorizontal_scroll_bars)
-#define iQhourglass 847
+#define iQhourglass 854
 DEFINE_LISP_SYMBOL (Qhourglass)
-#define iQhw 848
+#define iQhw 855
 DEFINE_LISP_SYMBOL (Qhw)
-#define iQhyper 849
+#define iQhyper 856
 DEFINE_LISP_SYMBOL (Qhyper)
-#define iQicon 850
+#define iQicon 857
 DEFINE_LISP_SYMBOL (Qicon)
-#define iQicon_left 851
+#define iQicon_left 858
 DEFINE_LISP_SYMBOL (Qicon_left)
-#define iQicon_name 852
+#define iQicon_name 859
 DEFINE_LISP_SYMBOL (Qicon_name)
-#define iQicon_title_format 853
+#define iQicon_title_format 860
 DEFINE_LISP_SYMBOL (Qicon_title_format)
-#define iQicon_top 854
+#define iQicon_top 861
 DEFINE_LISP_SYMBOL (Qicon_top)
-#define iQicon_type 855
+#define iQicon_type 862
 DEFINE_LISP_SYMBOL (Qicon_type)
-#define iQiconify_frame 856
+#define iQiconify_frame 863
 DEFINE_LISP_SYMBOL (Qiconify_frame)
-#define iQiconify_top_level 857
+#define iQiconify_top_level 864
 DEFINE_LISP_SYMBOL (Qiconify_top_level)
-#define iQidentity 858
+#define iQidentity 865
 DEFINE_LISP_SYMBOL (Qidentity)
-#define iQif 859
+#define iQif 866
 DEFINE_LISP_SYMBOL (Qif)
-#define iQif_regular 860
+#define iQif_regular 867
 DEFINE_LISP_SYMBOL (Qif_regular)
-#define iQignore_self_insert 861
+#define iQignore_self_insert 868
 DEFINE_LISP_SYMBOL (Qignore_self_insert)
-#define iQignored 862
+#define iQignored 869
 DEFINE_LISP_SYMBOL (Qignored)
-#define iQimage 863
+#define iQimage 870
 DEFINE_LISP_SYMBOL (Qimage)
-#define iQimage_format_suffixes 864
+#define iQimage_format_suffixes 871
 DEFINE_LISP_SYMBOL (Qimage_format_suffixes)
-#define iQimagemagick 865
+#define iQimagemagick 872
 DEFINE_LISP_SYMBOL (Qimagemagick)
-#define iQinc_args 866
+#define iQinc_args 873
 DEFINE_LISP_SYMBOL (Qinc_args)
-#define iQinformational 867
+#define iQinformational 874
 DEFINE_LISP_SYMBOL (Qinformational)
-#define iQinhibit 868
+#define iQinhibit 875
 DEFINE_LISP_SYMBOL (Qinhibit)
-#define iQinhibit_changing_match_data 869
+#define iQinhibit_changing_match_data 876
 DEFINE_LISP_SYMBOL (Qinhibit_changing_match_data)
-#define iQinhibit_debugger 870
+#define iQinhibit_debugger 877
 DEFINE_LISP_SYMBOL (Qinhibit_debugger)
-#define iQinhibit_double_buffering 871
+#define iQinhibit_double_buffering 878
 DEFINE_LISP_SYMBOL (Qinhibit_double_buffering)
-#define iQinhibit_eval_during_redisplay 872
+#define iQinhibit_eval_during_redisplay 879
 DEFINE_LISP_SYMBOL (Qinhibit_eval_during_redisplay)
-#define iQinhibit_file_name_operation 873
+#define iQinhibit_file_name_operation 880
 DEFINE_LISP_SYMBOL (Qinhibit_file_name_operation)
-#define iQinhibit_free_realized_faces 874
+#define iQinhibit_free_realized_faces 881
 DEFINE_LISP_SYMBOL (Qinhibit_free_realized_faces)
-#define iQinhibit_menubar_update 875
+#define iQinhibit_menubar_update 882
 DEFINE_LISP_SYMBOL (Qinhibit_menubar_update)
-#define iQinhibit_modification_hooks 876
+#define iQinhibit_modification_hooks 883
 DEFINE_LISP_SYMBOL (Qinhibit_modification_hooks)
-#define iQinhibit_point_motion_hooks 877
+#define iQinhibit_point_motion_hooks 884
 DEFINE_LISP_SYMBOL (Qinhibit_point_motion_hooks)
-#define iQinhibit_quit 878
+#define iQinhibit_quit 885
 DEFINE_LISP_SYMBOL (Qinhibit_quit)
-#define iQinhibit_read_only 879
+#define iQinhibit_read_only 886
 DEFINE_LISP_SYMBOL (Qinhibit_read_only)
-#define iQinhibit_redisplay 880
+#define iQinhibit_redisplay 887
 DEFINE_LISP_SYMBOL (Qinhibit_redisplay)
-#define iQinhibited_interaction 881
+#define iQinhibited_interaction 888
 DEFINE_LISP_SYMBOL (Qinhibited_interaction)
-#define iQinitial_major_mode 882
+#define iQinitial_major_mode 889
 DEFINE_LISP_SYMBOL (Qinitial_major_mode)
-#define iQinner_edges 883
+#define iQinner_edges 890
 DEFINE_LISP_SYMBOL (Qinner_edges)
-#define iQinput_method_exit_on_first_char 884
+#define iQinput_method_exit_on_first_char 891
 DEFINE_LISP_SYMBOL (Qinput_method_exit_on_first_char)
-#define iQinput_method_use_echo_area 885
+#define iQinput_method_use_echo_area 892
 DEFINE_LISP_SYMBOL (Qinput_method_use_echo_area)
-#define iQinsert_behind_hooks 886
+#define iQinsert_behind_hooks 893
 DEFINE_LISP_SYMBOL (Qinsert_behind_hooks)
-#define iQinsert_file_contents 887
+#define iQinsert_file_contents 894
 DEFINE_LISP_SYMBOL (Qinsert_file_contents)
-#define iQinsert_in_front_hooks 888
+#define iQinsert_in_front_hooks 895
 DEFINE_LISP_SYMBOL (Qinsert_in_front_hooks)
-#define iQinserted_chars 889
+#define iQinserted_chars 896
 DEFINE_LISP_SYMBOL (Qinserted_chars)
-#define iQinsufficient_source 890
+#define iQinsufficient_source 897
 DEFINE_LISP_SYMBOL (Qinsufficient_source)
-#define iQintangible 891
+#define iQintangible 898
 DEFINE_LISP_SYMBOL (Qintangible)
-#define iQinteger 892
+#define iQinteger 899
 DEFINE_LISP_SYMBOL (Qinteger)
-#define iQinteger_or_marker_p 893
+#define iQinteger_or_marker_p 900
 DEFINE_LISP_SYMBOL (Qinteger_or_marker_p)
-#define iQintegerp 894
+#define iQintegerp 901
 DEFINE_LISP_SYMBOL (Qintegerp)
-#define iQinteractive 895
+#define iQinteractive 902
 DEFINE_LISP_SYMBOL (Qinteractive)
-#define iQinteractive_args 896
+#define iQinteractive_args 903
 DEFINE_LISP_SYMBOL (Qinteractive_args)
-#define iQinteractive_form 897
+#define iQinteractive_form 904
 DEFINE_LISP_SYMBOL (Qinteractive_form)
-#define iQinteractive_p 898
+#define iQinteractive_p 905
 DEFINE_LISP_SYMBOL (Qinteractive_p)
-#define iQinternal__syntax_propertize 899
+#define iQinternal__syntax_propertize 906
 DEFINE_LISP_SYMBOL (Qinternal__syntax_propertize)
-#define iQinternal_auto_fill 900
+#define iQinternal_auto_fill 907
 DEFINE_LISP_SYMBOL (Qinternal_auto_fill)
-#define iQinternal_border 901
+#define iQinternal_border 908
 DEFINE_LISP_SYMBOL (Qinternal_border)
-#define iQinternal_border_width 902
+#define iQinternal_border_width 909
 DEFINE_LISP_SYMBOL (Qinternal_border_width)
-#define iQinternal_complete_buffer 903
+#define iQinternal_complete_buffer 910
 DEFINE_LISP_SYMBOL (Qinternal_complete_buffer)
-#define iQinternal_default_interrupt_process 904
+#define iQinternal_default_interrupt_process 911
 DEFINE_LISP_SYMBOL (Qinternal_default_interrupt_process)
-#define iQinternal_default_process_filter 905
+#define iQinternal_default_process_filter 912
 DEFINE_LISP_SYMBOL (Qinternal_default_process_filter)
-#define iQinternal_default_process_sentinel 906
+#define iQinternal_default_process_sentinel 913
 DEFINE_LISP_SYMBOL (Qinternal_default_process_sentinel)
-#define iQinternal_default_signal_process 907
+#define iQinternal_default_signal_process 914
 DEFINE_LISP_SYMBOL (Qinternal_default_signal_process)
-#define iQinternal_echo_keystrokes_prefix 908
+#define iQinternal_echo_keystrokes_prefix 915
 DEFINE_LISP_SYMBOL (Qinternal_echo_keystrokes_prefix)
-#define iQinternal_interpreter_environment 909
+#define iQinternal_interpreter_environment 916
 DEFINE_LISP_SYMBOL (Qinternal_interpreter_environment)
-#define iQinternal_macroexpand_for_load 910
+#define iQinternal_macroexpand_for_load 917
 DEFINE_LISP_SYMBOL (Qinternal_macroexpand_for_load)
-#define iQinternal_timer_start_idle 911
+#define iQinternal_timer_start_idle 918
 DEFINE_LISP_SYMBOL (Qinternal_timer_start_idle)
-#define iQinternal_when_entered_debugger 912
+#define iQinternal_when_entered_debugger 919
 DEFINE_LISP_SYMBOL (Qinternal_when_entered_debugger)
-#define iQinterpreted_function 913
+#define iQinterpreted_function 920
 DEFINE_LISP_SYMBOL (Qinterpreted_function)
-#define iQinterrupt_process_functions 914
+#define iQinterrupt_process_functions 921
 DEFINE_LISP_SYMBOL (Qinterrupt_process_functions)
-#define iQinterrupted 915
+#define iQinterrupted 922
 DEFINE_LISP_SYMBOL (Qinterrupted)
-#define iQintervals 916
+#define iQintervals 923
 DEFINE_LISP_SYMBOL (Qintervals)
-#define iQinvalid_arity 917
+#define iQinvalid_arity 924
 DEFINE_LISP_SYMBOL (Qinvalid_arity)
-#define iQinvalid_function 918
+#define iQinvalid_function 925
 DEFINE_LISP_SYMBOL (Qinvalid_function)
-#define iQinvalid_read_syntax 919
+#define iQinvalid_read_syntax 926
 DEFINE_LISP_SYMBOL (Qinvalid_read_syntax)
-#define iQinvalid_regexp 920
+#define iQinvalid_regexp 927
 DEFINE_LISP_SYMBOL (Qinvalid_regexp)
-#define iQinvalid_source 921
+#define iQinvalid_source 928
 DEFINE_LISP_SYMBOL (Qinvalid_source)
-#define iQinvisible 922
+#define iQinvisible 929
 DEFINE_LISP_SYMBOL (Qinvisible)
-#define iQipv4 923
+#define iQipv4 930
 DEFINE_LISP_SYMBOL (Qipv4)
-#define iQipv6 924
+#define iQipv6 931
 DEFINE_LISP_SYMBOL (Qipv6)
-#define iQiso10646_1 925
+#define iQiso10646_1 932
 DEFINE_LISP_SYMBOL (Qiso10646_1)
-#define iQiso8859_1 926
+#define iQiso8859_1 933
 DEFINE_LISP_SYMBOL (Qiso8859_1)
-#define iQiso_2022 927
+#define iQiso_2022 934
 DEFINE_LISP_SYMBOL (Qiso_2022)
-#define iQiso_8859_1 928
+#define iQiso_8859_1 935
 DEFINE_LISP_SYMBOL (Qiso_8859_1)
-#define iQitalic 929
+#define iQitalic 936
 DEFINE_LISP_SYMBOL (Qitalic)
-#define iQiv_auto 930
+#define iQiv_auto 937
 DEFINE_LISP_SYMBOL (Qiv_auto)
-#define iQja 931
+#define iQja 938
 DEFINE_LISP_SYMBOL (Qja)
-#define iQjka_compr_load_suffixes 932
+#define iQjka_compr_load_suffixes 939
 DEFINE_LISP_SYMBOL (Qjka_compr_load_suffixes)
-#define iQjpeg 933
+#define iQjpeg 940
 DEFINE_LISP_SYMBOL (Qjpeg)
-#define iQjson_end_of_file 934
+#define iQjson_end_of_file 941
 DEFINE_LISP_SYMBOL (Qjson_end_of_file)
-#define iQjson_error 935
+#define iQjson_error 942
 DEFINE_LISP_SYMBOL (Qjson_error)
-#define iQjson_escape_sequence_error 936
+#define iQjson_escape_sequence_error 943
 DEFINE_LISP_SYMBOL (Qjson_escape_sequence_error)
-#define iQjson_invalid_surrogate_error 937
+#define iQjson_invalid_surrogate_error 944
 DEFINE_LISP_SYMBOL (Qjson_invalid_surrogate_error)
-#define iQjson_number_out_of_range 938
+#define iQjson_number_out_of_range 945
 DEFINE_LISP_SYMBOL (Qjson_number_out_of_range)
-#define iQjson_object_too_deep 939
+#define iQjson_object_too_deep 946
 DEFINE_LISP_SYMBOL (Qjson_object_too_deep)
-#define iQjson_out_of_memory 940
+#define iQjson_out_of_memory 947
 DEFINE_LISP_SYMBOL (Qjson_out_of_memory)
-#define iQjson_parse_error 941
+#define iQjson_parse_error 948
 DEFINE_LISP_SYMBOL (Qjson_parse_error)
-#define iQjson_trailing_content 942
+#define iQjson_trailing_content 949
 DEFINE_LISP_SYMBOL (Qjson_trailing_content)
-#define iQjson_utf8_decode_error 943
+#define iQjson_utf8_decode_error 950
 DEFINE_LISP_SYMBOL (Qjson_utf8_decode_error)
-#define iQjson_value_p 944
+#define iQjson_value_p 951
 DEFINE_LISP_SYMBOL (Qjson_value_p)
-#define iQjump 945
+#define iQjump 952
 DEFINE_LISP_SYMBOL (Qjump)
-#define iQkbd_macro_termination_hook 946
+#define iQkbd_macro_termination_hook 953
 DEFINE_LISP_SYMBOL (Qkbd_macro_termination_hook)
-#define iQkeep_ratio 947
+#define iQkeep_ratio 954
 DEFINE_LISP_SYMBOL (Qkeep_ratio)
-#define iQkey 948
+#define iQkey 955
 DEFINE_LISP_SYMBOL (Qkey)
-#define iQkey_and_value 949
+#define iQkey_and_value 956
 DEFINE_LISP_SYMBOL (Qkey_and_value)
-#define iQkey_or_value 950
+#define iQkey_or_value 957
 DEFINE_LISP_SYMBOL (Qkey_or_value)
-#define iQkey_parse 951
+#define iQkey_parse 958
 DEFINE_LISP_SYMBOL (Qkey_parse)
-#define iQkey_valid_p 952
+#define iQkey_valid_p 959
 DEFINE_LISP_SYMBOL (Qkey_valid_p)
-#define iQkeymap 953
+#define iQkeymap 960
 DEFINE_LISP_SYMBOL (Qkeymap)
-#define iQkeymap_canonicalize 954
+#define iQkeymap_canonicalize 961
 DEFINE_LISP_SYMBOL (Qkeymap_canonicalize)
-#define iQkeymapp 955
+#define iQkeymapp 962
 DEFINE_LISP_SYMBOL (Qkeymapp)
-#define iQkill_buffer__possibly_save 956
+#define iQkill_buffer__possibly_save 963
 DEFINE_LISP_SYMBOL (Qkill_buffer__possibly_save)
-#define iQkill_buffer_hook 957
+#define iQkill_buffer_hook 964
 DEFINE_LISP_SYMBOL (Qkill_buffer_hook)
-#define iQkill_buffer_query_functions 958
+#define iQkill_buffer_query_functions 965
 DEFINE_LISP_SYMBOL (Qkill_buffer_query_functions)
-#define iQkill_emacs 959
+#define iQkill_emacs 966
 DEFINE_LISP_SYMBOL (Qkill_emacs)
-#define iQkill_emacs_hook 960
+#define iQkill_emacs_hook 967
 DEFINE_LISP_SYMBOL (Qkill_emacs_hook)
-#define iQkill_forward_chars 961
+#define iQkill_forward_chars 968
 DEFINE_LISP_SYMBOL (Qkill_forward_chars)
-#define iQko 962
+#define iQko 969
 DEFINE_LISP_SYMBOL (Qko)
-#define iQlang_version_mismatch 963
+#define iQlang_version_mismatch 970
 DEFINE_LISP_SYMBOL (Qlang_version_mismatch)
-#define iQlanguage_change 964
+#define iQlanguage_change 971
 DEFINE_LISP_SYMBOL (Qlanguage_change)
-#define iQlaplace 965
+#define iQlaplace 972
 DEFINE_LISP_SYMBOL (Qlaplace)
-#define iQlast_arrow_position 966
+#define iQlast_arrow_position 973
 DEFINE_LISP_SYMBOL (Qlast_arrow_position)
-#define iQlast_arrow_string 967
+#define iQlast_arrow_string 974
 DEFINE_LISP_SYMBOL (Qlast_arrow_string)
-#define iQlast_nonmenu_event 968
+#define iQlast_nonmenu_event 975
 DEFINE_LISP_SYMBOL (Qlast_nonmenu_event)
-#define iQlate 969
+#define iQlate 976
 DEFINE_LISP_SYMBOL (Qlate)
-#define iQlatin 970
+#define iQlatin 977
 DEFINE_LISP_SYMBOL (Qlatin)
-#define iQleft 971
+#define iQleft 978
 DEFINE_LISP_SYMBOL (Qleft)
-#define iQleft_edge 972
+#define iQleft_edge 979
 DEFINE_LISP_SYMBOL (Qleft_edge)
-#define iQleft_fringe 973
+#define iQleft_fringe 980
 DEFINE_LISP_SYMBOL (Qleft_fringe)
-#define iQleft_fringe_help 974
+#define iQleft_fringe_help 981
 DEFINE_LISP_SYMBOL (Qleft_fringe_help)
-#define iQleft_margin 975
+#define iQleft_margin 982
 DEFINE_LISP_SYMBOL (Qleft_margin)
-#define iQleft_only 976
+#define iQleft_only 983
 DEFINE_LISP_SYMBOL (Qleft_only)
-#define iQleft_to_right 977
+#define iQleft_to_right 984
 DEFINE_LISP_SYMBOL (Qleft_to_right)
-#define iQleftmost 978
+#define iQleftmost 985
 DEFINE_LISP_SYMBOL (Qleftmost)
-#define iQlet 979
+#define iQlet 986
 DEFINE_LISP_SYMBOL (Qlet)
-#define iQletx 980
+#define iQletx 987
 DEFINE_LISP_SYMBOL (Qletx)
-#define iQlexical_binding 981
+#define iQlexical_binding 988
 DEFINE_LISP_SYMBOL (Qlexical_binding)
-#define iQlibgif_version 982
+#define iQlibgif_version 989
 DEFINE_LISP_SYMBOL (Qlibgif_version)
-#define iQlibjpeg_version 983
+#define iQlibjpeg_version 990
 DEFINE_LISP_SYMBOL (Qlibjpeg_version)
-#define iQlibpng_version 984
+#define iQlibpng_version 991
 DEFINE_LISP_SYMBOL (Qlibpng_version)
-#define iQlight 985
+#define iQlight 992
 DEFINE_LISP_SYMBOL (Qlight)
-#define iQline 986
+#define iQline 993
 DEFINE_LISP_SYMBOL (Qline)
-#define iQline_height 987
+#define iQline_height 994
 DEFINE_LISP_SYMBOL (Qline_height)
-#define iQline_number 988
+#define iQline_number 995
 DEFINE_LISP_SYMBOL (Qline_number)
-#define iQline_number_current_line 989
+#define iQline_number_current_line 996
 DEFINE_LISP_SYMBOL (Qline_number_current_line)
-#define iQline_number_major_tick 990
+#define iQline_number_major_tick 997
 DEFINE_LISP_SYMBOL (Qline_number_major_tick)
-#define iQline_number_minor_tick 991
+#define iQline_number_minor_tick 998
 DEFINE_LISP_SYMBOL (Qline_number_minor_tick)
-#define iQline_prefix 992
+#define iQline_prefix 999
 DEFINE_LISP_SYMBOL (Qline_prefix)
-#define iQline_spacing 993
+#define iQline_spacing 1000
 DEFINE_LISP_SYMBOL (Qline_spacing)
-#define iQlink 994
+#define iQlink 1001
 DEFINE_LISP_SYMBOL (Qlink)
-#define iQlisp_directory 995
+#define iQlisp_directory 1002
 DEFINE_LISP_SYMBOL (Qlisp_directory)
-#define iQlist 996
+#define iQlist 1003
 DEFINE_LISP_SYMBOL (Qlist)
-#define iQlist_or_vector_p 997
+#define iQlist_or_vector_p 1004
 DEFINE_LISP_SYMBOL (Qlist_or_vector_p)
-#define iQlist_system_processes 998
+#define iQlist_system_processes 1005
 DEFINE_LISP_SYMBOL (Qlist_system_processes)
-#define iQlisten 999
+#define iQlisten 1006
 DEFINE_LISP_SYMBOL (Qlisten)
-#define iQlistp 1000
+#define iQlistp 1007
 DEFINE_LISP_SYMBOL (Qlistp)
-#define iQlittle 1001
+#define iQlittle 1008
 DEFINE_LISP_SYMBOL (Qlittle)
-#define iQlive 1002
+#define iQlive 1009
 DEFINE_LISP_SYMBOL (Qlive)
-#define iQload 1003
+#define iQload 1010
 DEFINE_LISP_SYMBOL (Qload)
-#define iQload_file_name 1004
+#define iQload_file_name 1011
 DEFINE_LISP_SYMBOL (Qload_file_name)
-#define iQload_force_doc_strings 1005
+#define iQload_force_doc_strings 1012
 DEFINE_LISP_SYMBOL (Qload_force_doc_strings)
-#define iQload_in_progress 1006
+#define iQload_in_progress 1013
 DEFINE_LISP_SYMBOL (Qload_in_progress)
-#define iQload_time 1007
+#define iQload_phases 1014
+DEFINE_LISP_SYMBOL (Qload_phases)
+#define iQload_threads 1015
+DEFINE_LISP_SYMBOL (Qload_threads)
+#define iQload_time 1016
 DEFINE_LISP_SYMBOL (Qload_time)
-#define iQload_true_file_name 1008
+#define iQload_true_file_name 1017
 DEFINE_LISP_SYMBOL (Qload_true_file_name)
-#define iQlocal 1009
+#define iQlocal 1018
 DEFINE_LISP_SYMBOL (Qlocal)
-#define iQlocal_map 1010
+#define iQlocal_map 1019
 DEFINE_LISP_SYMBOL (Qlocal_map)
-#define iQlock_file 1011
+#define iQlock_file 1020
 DEFINE_LISP_SYMBOL (Qlock_file)
-#define iQlong 1012
+#define iQlong 1021
 DEFINE_LISP_SYMBOL (Qlong)
-#define iQlong_line_optimizations_in_command_hooks 1013
+#define iQlong_line_optimizations_in_command_hooks 1022
 DEFINE_LISP_SYMBOL (Qlong_line_optimizations_in_command_hooks)
-#define iQlong_line_optimizations_in_fontification_functions 1014
+#define iQlong_line_optimizations_in_fontification_functions 1023
 DEFINE_LISP_SYMBOL (Qlong_line_optimizations_in_fontification_functions)
-#define iQlosing_value 1015
+#define iQlosing_value 1024
 DEFINE_LISP_SYMBOL (Qlosing_value)
-#define iQlowercase 1016
+#define iQlowercase 1025
 DEFINE_LISP_SYMBOL (Qlowercase)
-#define iQlread_unescaped_character_literals 1017
+#define iQlread_unescaped_character_literals 1026
 DEFINE_LISP_SYMBOL (Qlread_unescaped_character_literals)
-#define iQm 1018
+#define iQm 1027
 DEFINE_LISP_SYMBOL (Qm)
-#define iQmac 1019
+#define iQmac 1028
 DEFINE_LISP_SYMBOL (Qmac)
-#define iQmac_ct 1020
+#define iQmac_ct 1029
 DEFINE_LISP_SYMBOL (Qmac_ct)
-#define iQmacro 1021
+#define iQmacro 1030
 DEFINE_LISP_SYMBOL (Qmacro)
-#define iQmacroexp__dynvars 1022
+#define iQmacroexp__dynvars 1031
 DEFINE_LISP_SYMBOL (Qmacroexp__dynvars)
-#define iQmacs 1023
+#define iQmacs 1032
 DEFINE_LISP_SYMBOL (Qmacs)
-#define iQmajflt 1024
+#define iQmajflt 1033
 DEFINE_LISP_SYMBOL (Qmajflt)
-#define iQmake_cursor_line_fully_visible 1025
+#define iQmake_cursor_line_fully_visible 1034
 DEFINE_LISP_SYMBOL (Qmake_cursor_line_fully_visible)
-#define iQmake_directory 1026
+#define iQmake_directory 1035
 DEFINE_LISP_SYMBOL (Qmake_directory)
-#define iQmake_directory_internal 1027
+#define iQmake_directory_internal 1036
 DEFINE_LISP_SYMBOL (Qmake_directory_internal)
-#define iQmake_frame_visible 1028
+#define iQmake_frame_visible 1037
 DEFINE_LISP_SYMBOL (Qmake_frame_visible)
-#define iQmake_initial_minibuffer_frame 1029
+#define iQmake_initial_minibuffer_frame 1038
 DEFINE_LISP_SYMBOL (Qmake_initial_minibuffer_frame)
-#define iQmake_invisible 1030
+#define iQmake_invisible 1039
 DEFINE_LISP_SYMBOL (Qmake_invisible)
-#define iQmake_lock_file_name 1031
+#define iQmake_lock_file_name 1040
 DEFINE_LISP_SYMBOL (Qmake_lock_file_name)
-#define iQmake_process 1032
+#define iQmake_process 1041
 DEFINE_LISP_SYMBOL (Qmake_process)
-#define iQmake_symbolic_link 1033
+#define iQmake_symbolic_link 1042
 DEFINE_LISP_SYMBOL (Qmake_symbolic_link)
-#define iQmake_window_start_visible 1034
+#define iQmake_window_start_visible 1043
 DEFINE_LISP_SYMBOL (Qmake_window_start_visible)
-#define iQmakunbound 1035
+#define iQmakunbound 1044
 DEFINE_LISP_SYMBOL (Qmakunbound)
-#define iQmalformed_keyword_arg_list 1036
+#define iQmalformed_keyword_arg_list 1045
 DEFINE_LISP_SYMBOL (Qmalformed_keyword_arg_list)
-#define iQmany 1037
+#define iQmany 1046
 DEFINE_LISP_SYMBOL (Qmany)
-#define iQmap_keymap_sorted 1038
+#define iQmap_keymap_sorted 1047
 DEFINE_LISP_SYMBOL (Qmap_keymap_sorted)
-#define iQmargin 1039
+#define iQmargin 1048
 DEFINE_LISP_SYMBOL (Qmargin)
-#define iQmark_for_redisplay 1040
+#define iQmark_for_redisplay 1049
 DEFINE_LISP_SYMBOL (Qmark_for_redisplay)
-#define iQmark_inactive 1041
+#define iQmark_inactive 1050
 DEFINE_LISP_SYMBOL (Qmark_inactive)
-#define iQmarker 1042
+#define iQmarker 1051
 DEFINE_LISP_SYMBOL (Qmarker)
-#define iQmarkerp 1043
+#define iQmarkerp 1052
 DEFINE_LISP_SYMBOL (Qmarkerp)
-#define iQmaximized 1044
+#define iQmaximized 1053
 DEFINE_LISP_SYMBOL (Qmaximized)
-#define iQmd5 1045
+#define iQmd5 1054
 DEFINE_LISP_SYMBOL (Qmd5)
-#define iQmedium 1046
+#define iQmedium 1055
 DEFINE_LISP_SYMBOL (Qmedium)
-#define iQmemory_buffer_too_small 1047
+#define iQmemory_buffer_too_small 1056
 DEFINE_LISP_SYMBOL (Qmemory_buffer_too_small)
-#define iQmemory_info 1048
+#define iQmemory_info 1057
 DEFINE_LISP_SYMBOL (Qmemory_info)
-#define iQmenu 1049
+#define iQmenu 1058
 DEFINE_LISP_SYMBOL (Qmenu)
-#define iQmenu_bar 1050
+#define iQmenu_bar 1059
 DEFINE_LISP_SYMBOL (Qmenu_bar)
-#define iQmenu_bar_external 1051
+#define iQmenu_bar_external 1060
 DEFINE_LISP_SYMBOL (Qmenu_bar_external)
-#define iQmenu_bar_lines 1052
+#define iQmenu_bar_lines 1061
 DEFINE_LISP_SYMBOL (Qmenu_bar_lines)
-#define iQmenu_bar_size 1053
+#define iQmenu_bar_size 1062
 DEFINE_LISP_SYMBOL (Qmenu_bar_size)
-#define iQmenu_bar_update_hook 1054
+#define iQmenu_bar_update_hook 1063
 DEFINE_LISP_SYMBOL (Qmenu_bar_update_hook)
-#define iQmenu_enable 1055
+#define iQmenu_enable 1064
 DEFINE_LISP_SYMBOL (Qmenu_enable)
-#define iQmenu_item 1056
+#define iQmenu_item 1065
 DEFINE_LISP_SYMBOL (Qmenu_item)
-#define iQmessage 1057
+#define iQmessage 1066
 DEFINE_LISP_SYMBOL (Qmessage)
-#define iQmessages_buffer_mode 1058
+#define iQmessages_buffer_mode 1067
 DEFINE_LISP_SYMBOL (Qmessages_buffer_mode)
-#define iQmeta 1059
+#define iQmeta 1068
 DEFINE_LISP_SYMBOL (Qmeta)
-#define iQmetadata 1060
+#define iQmetadata 1069
 DEFINE_LISP_SYMBOL (Qmetadata)
-#define iQmin_height 1061
+#define iQmin_height 1070
 DEFINE_LISP_SYMBOL (Qmin_height)
-#define iQmin_width 1062
+#define iQmin_width 1071
 DEFINE_LISP_SYMBOL (Qmin_width)
-#define iQminflt 1063
+#define iQminflt 1072
 DEFINE_LISP_SYMBOL (Qminflt)
-#define iQminibuffer 1064
+#define iQminibuffer 1073
 DEFINE_LISP_SYMBOL (Qminibuffer)
-#define iQminibuffer_completing_file_name 1065
+#define iQminibuffer_completing_file_name 1074
 DEFINE_LISP_SYMBOL (Qminibuffer_completing_file_name)
-#define iQminibuffer_completion_table 1066
+#define iQminibuffer_completion_table 1075
 DEFINE_LISP_SYMBOL (Qminibuffer_completion_table)
-#define iQminibuffer_default 1067
+#define iQminibuffer_default 1076
 DEFINE_LISP_SYMBOL (Qminibuffer_default)
-#define iQminibuffer_exit 1068
+#define iQminibuffer_exit 1077
 DEFINE_LISP_SYMBOL (Qminibuffer_exit)
-#define iQminibuffer_exit_hook 1069
+#define iQminibuffer_exit_hook 1078
 DEFINE_LISP_SYMBOL (Qminibuffer_exit_hook)
-#define iQminibuffer_follows_selected_frame 1070
+#define iQminibuffer_follows_selected_frame 1079
 DEFINE_LISP_SYMBOL (Qminibuffer_follows_selected_frame)
-#define iQminibuffer_history 1071
+#define iQminibuffer_history 1080
 DEFINE_LISP_SYMBOL (Qminibuffer_history)
-#define iQminibuffer_inactive_mode 1072
+#define iQminibuffer_inactive_mode 1081
 DEFINE_LISP_SYMBOL (Qminibuffer_inactive_mode)
-#define iQminibuffer_mode 1073
+#define iQminibuffer_mode 1082
 DEFINE_LISP_SYMBOL (Qminibuffer_mode)
-#define iQminibuffer_prompt 1074
+#define iQminibuffer_prompt 1083
 DEFINE_LISP_SYMBOL (Qminibuffer_prompt)
-#define iQminibuffer_quit 1075
+#define iQminibuffer_quit 1084
 DEFINE_LISP_SYMBOL (Qminibuffer_quit)
-#define iQminibuffer_quit_recursive_edit 1076
+#define iQminibuffer_quit_recursive_edit 1085
 DEFINE_LISP_SYMBOL (Qminibuffer_quit_recursive_edit)
-#define iQminibuffer_setup_hook 1077
+#define iQminibuffer_setup_hook 1086
 DEFINE_LISP_SYMBOL (Qminibuffer_setup_hook)
-#define iQminus 1078
+#define iQminus 1087
 DEFINE_LISP_SYMBOL (Qminus)
-#define iQmissing 1079
+#define iQmissing 1088
 DEFINE_LISP_SYMBOL (Qmissing)
-#define iQmissing_module_init_function 1080
+#define iQmissing_module_init_function 1089
 DEFINE_LISP_SYMBOL (Qmissing_module_init_function)
-#define iQmm_size 1081
+#define iQmm_size 1090
 DEFINE_LISP_SYMBOL (Qmm_size)
-#define iQmode_class 1082
+#define iQmode_class 1091
 DEFINE_LISP_SYMBOL (Qmode_class)
-#define iQmode_line 1083
+#define iQmode_line 1092
 DEFINE_LISP_SYMBOL (Qmode_line)
-#define iQmode_line_active 1084
+#define iQmode_line_active 1093
 DEFINE_LISP_SYMBOL (Qmode_line_active)
-#define iQmode_line_default_help_echo 1085
+#define iQmode_line_default_help_echo 1094
 DEFINE_LISP_SYMBOL (Qmode_line_default_help_echo)
-#define iQmode_line_elt_no 1086
+#define iQmode_line_elt_no 1095
 DEFINE_LISP_SYMBOL (Qmode_line_elt_no)
-#define iQmode_line_format 1087
+#define iQmode_line_format 1096
 DEFINE_LISP_SYMBOL (Qmode_line_format)
-#define iQmode_line_inactive 1088
+#define iQmode_line_inactive 1097
 DEFINE_LISP_SYMBOL (Qmode_line_inactive)
-#define iQmodeline 1089
+#define iQmodeline 1098
 DEFINE_LISP_SYMBOL (Qmodeline)
-#define iQmodification_hooks 1090
+#define iQmodification_hooks 1099
 DEFINE_LISP_SYMBOL (Qmodification_hooks)
-#define iQmodifier_cache 1091
+#define iQmodifier_cache 1100
 DEFINE_LISP_SYMBOL (Qmodifier_cache)
-#define iQmodifier_value 1092
+#define iQmodifier_value 1101
 DEFINE_LISP_SYMBOL (Qmodifier_value)
-#define iQmodule_function 1093
+#define iQmodule_function 1102
 DEFINE_LISP_SYMBOL (Qmodule_function)
-#define iQmodule_function_p 1094
+#define iQmodule_function_p 1103
 DEFINE_LISP_SYMBOL (Qmodule_function_p)
-#define iQmodule_init_failed 1095
+#define iQmodule_init_failed 1104
 DEFINE_LISP_SYMBOL (Qmodule_init_failed)
-#define iQmodule_load_failed 1096
+#define iQmodule_load_failed 1105
 DEFINE_LISP_SYMBOL (Qmodule_load_failed)
-#define iQmodule_not_gpl_compatible 1097
+#define iQmodule_not_gpl_compatible 1106
 DEFINE_LISP_SYMBOL (Qmodule_not_gpl_compatible)
-#define iQmodule_open_failed 1098
+#define iQmodule_open_failed 1107
 DEFINE_LISP_SYMBOL (Qmodule_open_failed)
-#define iQmodule_out_of_memory 1099
+#define iQmodule_out_of_memory 1108
 DEFINE_LISP_SYMBOL (Qmodule_out_of_memory)
-#define iQmonitors_changed 1100
+#define iQmonitors_changed 1109
 DEFINE_LISP_SYMBOL (Qmonitors_changed)
-#define iQmonths 1101
+#define iQmonths 1110
 DEFINE_LISP_SYMBOL (Qmonths)
-#define iQmouse 1102
+#define iQmouse 1111
 DEFINE_LISP_SYMBOL (Qmouse)
-#define iQmouse_click 1103
+#define iQmouse_click 1112
 DEFINE_LISP_SYMBOL (Qmouse_click)
-#define iQmouse_color 1104
+#define iQmouse_color 1113
 DEFINE_LISP_SYMBOL (Qmouse_color)
-#define iQmouse_face 1105
+#define iQmouse_face 1114
 DEFINE_LISP_SYMBOL (Qmouse_face)
-#define iQmouse_fixup_help_message 1106
+#define iQmouse_fixup_help_message 1115
 DEFINE_LISP_SYMBOL (Qmouse_fixup_help_message)
-#define iQmouse_leave_buffer_hook 1107
+#define iQmouse_leave_buffer_hook 1116
 DEFINE_LISP_SYMBOL (Qmouse_leave_buffer_hook)
-#define iQmouse_movement 1108
+#define iQmouse_movement 1117
 DEFINE_LISP_SYMBOL (Qmouse_movement)
-#define iQmouse_wheel_frame 1109
+#define iQmouse_wheel_frame 1118
 DEFINE_LISP_SYMBOL (Qmouse_wheel_frame)
-#define iQmove_frame 1110
+#define iQmove_frame 1119
 DEFINE_LISP_SYMBOL (Qmove_frame)
-#define iQmove_toolbar 1111
+#define iQmove_toolbar 1120
 DEFINE_LISP_SYMBOL (Qmove_toolbar)
-#define iQmutex 1112
+#define iQmutex 1121
 DEFINE_LISP_SYMBOL (Qmutex)
-#define iQmutexp 1113
+#define iQmutexp 1122
 DEFINE_LISP_SYMBOL (Qmutexp)
-#define iQname 1114
+#define iQname 1123
 DEFINE_LISP_SYMBOL (Qname)
-#define iQnamed 1115
+#define iQnamed 1124
 DEFINE_LISP_SYMBOL (Qnamed)
-#define iQnative__compile_async 1116
+#define iQnative__compile_async 1125
 DEFINE_LISP_SYMBOL (Qnative__compile_async)
-#define iQnative_comp_compiler_options 1117
+#define iQnative_comp_compiler_options 1126
 DEFINE_LISP_SYMBOL (Qnative_comp_compiler_options)
-#define iQnative_comp_debug 1118
+#define iQnative_comp_debug 1127
 DEFINE_LISP_SYMBOL (Qnative_comp_debug)
-#define iQnative_comp_driver_options 1119
+#define iQnative_comp_driver_options 1128
 DEFINE_LISP_SYMBOL (Qnative_comp_driver_options)
-#define iQnative_comp_function 1120
+#define iQnative_comp_function 1129
 DEFINE_LISP_SYMBOL (Qnative_comp_function)
-#define iQnative_comp_speed 1121
+#define iQnative_comp_speed 1130
 DEFINE_LISP_SYMBOL (Qnative_comp_speed)
-#define iQnative_comp_unit 1122
+#define iQnative_comp_unit 1131
 DEFINE_LISP_SYMBOL (Qnative_comp_unit)
-#define iQnative_comp_warning_on_missing_source 1123
+#define iQnative_comp_warning_on_missing_source 1132
 DEFINE_LISP_SYMBOL (Qnative_comp_warning_on_missing_source)
-#define iQnative_compiler 1124
+#define iQnative_compiler 1133
 DEFINE_LISP_SYMBOL (Qnative_compiler)
-#define iQnative_compiler_error 1125
+#define iQnative_compiler_error 1134
 DEFINE_LISP_SYMBOL (Qnative_compiler_error)
-#define iQnative_edges 1126
+#define iQnative_edges 1135
 DEFINE_LISP_SYMBOL (Qnative_edges)
-#define iQnative_ice 1127
+#define iQnative_ice 1136
 DEFINE_LISP_SYMBOL (Qnative_ice)
-#define iQnative_image 1128
+#define iQnative_image 1137
 DEFINE_LISP_SYMBOL (Qnative_image)
-#define iQnative_lisp_file_inconsistent 1129
+#define iQnative_lisp_file_inconsistent 1138
 DEFINE_LISP_SYMBOL (Qnative_lisp_file_inconsistent)
-#define iQnative_lisp_load_failed 1130
+#define iQnative_lisp_load_failed 1139
 DEFINE_LISP_SYMBOL (Qnative_lisp_load_failed)
-#define iQnative_lisp_wrong_reloc 1131
+#define iQnative_lisp_wrong_reloc 1140
 DEFINE_LISP_SYMBOL (Qnative_lisp_wrong_reloc)
-#define iQnatnump 1132
+#define iQnatnump 1141
 DEFINE_LISP_SYMBOL (Qnatnump)
-#define iQnegate 1133
+#define iQnegate 1142
 DEFINE_LISP_SYMBOL (Qnegate)
-#define iQnetwork 1134
+#define iQnetwork 1143
 DEFINE_LISP_SYMBOL (Qnetwork)
-#define iQnhdrag 1135
+#define iQnhdrag 1144
 DEFINE_LISP_SYMBOL (Qnhdrag)
-#define iQnice 1136
+#define iQnice 1145
 DEFINE_LISP_SYMBOL (Qnice)
-#define iQno_accept_focus 1137
+#define iQno_accept_focus 1146
 DEFINE_LISP_SYMBOL (Qno_accept_focus)
-#define iQno_catch 1138
+#define iQno_catch 1147
 DEFINE_LISP_SYMBOL (Qno_catch)
-#define iQno_conversion 1139
+#define iQno_conversion 1148
 DEFINE_LISP_SYMBOL (Qno_conversion)
-#define iQno_focus_on_map 1140
+#define iQno_focus_on_map 1149
 DEFINE_LISP_SYMBOL (Qno_focus_on_map)
-#define iQno_other_frame 1141
+#define iQno_other_frame 1150
 DEFINE_LISP_SYMBOL (Qno_other_frame)
-#define iQno_other_window 1142
+#define iQno_other_window 1151
 DEFINE_LISP_SYMBOL (Qno_other_window)
-#define iQno_record 1143
+#define iQno_record 1152
 DEFINE_LISP_SYMBOL (Qno_record)
-#define iQno_self_insert 1144
+#define iQno_self_insert 1153
 DEFINE_LISP_SYMBOL (Qno_self_insert)
-#define iQno_special_glyphs 1145
+#define iQno_special_glyphs 1154
 DEFINE_LISP_SYMBOL (Qno_special_glyphs)
-#define iQnobreak_hyphen 1146
+#define iQnobreak_hyphen 1155
 DEFINE_LISP_SYMBOL (Qnobreak_hyphen)
-#define iQnobreak_space 1147
+#define iQnobreak_space 1156
 DEFINE_LISP_SYMBOL (Qnobreak_space)
-#define iQnoelisp 1148
+#define iQnoelisp 1157
 DEFINE_LISP_SYMBOL (Qnoelisp)
-#define iQnon_ascii 1149
+#define iQnon_ascii 1158
 DEFINE_LISP_SYMBOL (Qnon_ascii)
-#define iQnon_key_event 1150
+#define iQnon_key_event 1159
 DEFINE_LISP_SYMBOL (Qnon_key_event)
-#define iQnon_retained 1151
+#define iQnon_retained 1160
 DEFINE_LISP_SYMBOL (Qnon_retained)
-#define iQnone 1152
+#define iQnone 1161
 DEFINE_LISP_SYMBOL (Qnone)
-#define iQnormal 1153
+#define iQnormal 1162
 DEFINE_LISP_SYMBOL (Qnormal)
-#define iQnot 1154
+#define iQnot 1163
 DEFINE_LISP_SYMBOL (Qnot)
-#define iQnot_found 1155
+#define iQnot_found 1164
 DEFINE_LISP_SYMBOL (Qnot_found)
-#define iQnow 1156
+#define iQnow 1165
 DEFINE_LISP_SYMBOL (Qnow)
-#define iQns 1157
+#define iQns 1166
 DEFINE_LISP_SYMBOL (Qns)
-#define iQns_appearance 1158
+#define iQns_appearance 1167
 DEFINE_LISP_SYMBOL (Qns_appearance)
-#define iQns_drag_operation_copy 1159
+#define iQns_drag_operation_copy 1168
 DEFINE_LISP_SYMBOL (Qns_drag_operation_copy)
-#define iQns_drag_operation_generic 1160
+#define iQns_drag_operation_generic 1169
 DEFINE_LISP_SYMBOL (Qns_drag_operation_generic)
-#define iQns_drag_operation_link 1161
+#define iQns_drag_operation_link 1170
 DEFINE_LISP_SYMBOL (Qns_drag_operation_link)
-#define iQns_handle_drag_motion 1162
+#define iQns_handle_drag_motion 1171
 DEFINE_LISP_SYMBOL (Qns_handle_drag_motion)
-#define iQns_in_echo_area 1163
+#define iQns_in_echo_area 1172
 DEFINE_LISP_SYMBOL (Qns_in_echo_area)
-#define iQns_parse_geometry 1164
+#define iQns_parse_geometry 1173
 DEFINE_LISP_SYMBOL (Qns_parse_geometry)
-#define iQns_put_working_text 1165
+#define iQns_put_working_text 1174
 DEFINE_LISP_SYMBOL (Qns_put_working_text)
-#define iQns_transparent_titlebar 1166
+#define iQns_transparent_titlebar 1175
 DEFINE_LISP_SYMBOL (Qns_transparent_titlebar)
-#define iQns_unput_working_text 1167
+#define iQns_unput_working_text 1176
 DEFINE_LISP_SYMBOL (Qns_unput_working_text)
-#define iQnsm_verify_connection 1168
+#define iQnsm_verify_connection 1177
 DEFINE_LISP_SYMBOL (Qnsm_verify_connection)
-#define iQnth 1169
+#define iQnth 1178
 DEFINE_LISP_SYMBOL (Qnth)
-#define iQnull 1170
+#define iQnull 1179
 DEFINE_LISP_SYMBOL (Qnull)
-#define iQnumber_or_marker_p 1171
+#define iQnumber_or_marker_p 1180
 DEFINE_LISP_SYMBOL (Qnumber_or_marker_p)
-#define iQnumberp 1172
+#define iQnumberp 1181
 DEFINE_LISP_SYMBOL (Qnumberp)
-#define iQnumeric 1173
+#define iQnumeric 1182
 DEFINE_LISP_SYMBOL (Qnumeric)
-#define iQobarray 1174
+#define iQobarray 1183
 DEFINE_LISP_SYMBOL (Qobarray)
-#define iQobarray_cache 1175
+#define iQobarray_cache 1184
 DEFINE_LISP_SYMBOL (Qobarray_cache)
-#define iQobarrayp 1176
+#define iQobarrayp 1185
 DEFINE_LISP_SYMBOL (Qobarrayp)
-#define iQobject 1177
+#define iQobject 1186
 DEFINE_LISP_SYMBOL (Qobject)
-#define iQoblique 1178
+#define iQoblique 1187
 DEFINE_LISP_SYMBOL (Qoblique)
-#define iQoclosure_interactive_form 1179
+#define iQoclosure_interactive_form 1188
 DEFINE_LISP_SYMBOL (Qoclosure_interactive_form)
-#define iQodd 1180
+#define iQodd 1189
 DEFINE_LISP_SYMBOL (Qodd)
-#define iQonly 1181
+#define iQonly 1190
 DEFINE_LISP_SYMBOL (Qonly)
-#define iQopen 1182
+#define iQopen 1191
 DEFINE_LISP_SYMBOL (Qopen)
-#define iQopen_network_stream 1183
+#define iQopen_network_stream 1192
 DEFINE_LISP_SYMBOL (Qopen_network_stream)
-#define iQopentype 1184
+#define iQopentype 1193
 DEFINE_LISP_SYMBOL (Qopentype)
-#define iQoperations 1185
+#define iQoperations 1194
 DEFINE_LISP_SYMBOL (Qoperations)
-#define iQor 1186
+#define iQor 1195
 DEFINE_LISP_SYMBOL (Qor)
-#define iQoutdated 1187
+#define iQoutdated 1196
 DEFINE_LISP_SYMBOL (Qoutdated)
-#define iQouter_border_width 1188
+#define iQouter_border_width 1197
 DEFINE_LISP_SYMBOL (Qouter_border_width)
-#define iQouter_edges 1189
+#define iQouter_edges 1198
 DEFINE_LISP_SYMBOL (Qouter_edges)
-#define iQouter_position 1190
+#define iQouter_position 1199
 DEFINE_LISP_SYMBOL (Qouter_position)
-#define iQouter_size 1191
+#define iQouter_size 1200
 DEFINE_LISP_SYMBOL (Qouter_size)
-#define iQouter_window_id 1192
+#define iQouter_window_id 1201
 DEFINE_LISP_SYMBOL (Qouter_window_id)
-#define iQoutermost_restriction 1193
+#define iQoutermost_restriction 1202
 DEFINE_LISP_SYMBOL (Qoutermost_restriction)
-#define iQoverflow_error 1194
+#define iQoverflow_error 1203
 DEFINE_LISP_SYMBOL (Qoverflow_error)
-#define iQoverlay 1195
+#define iQoverlay 1204
 DEFINE_LISP_SYMBOL (Qoverlay)
-#define iQoverlay_arrow 1196
+#define iQoverlay_arrow 1205
 DEFINE_LISP_SYMBOL (Qoverlay_arrow)
-#define iQoverlay_arrow_bitmap 1197
+#define iQoverlay_arrow_bitmap 1206
 DEFINE_LISP_SYMBOL (Qoverlay_arrow_bitmap)
-#define iQoverlay_arrow_string 1198
+#define iQoverlay_arrow_string 1207
 DEFINE_LISP_SYMBOL (Qoverlay_arrow_string)
-#define iQoverlayp 1199
+#define iQoverlayp 1208
 DEFINE_LISP_SYMBOL (Qoverlayp)
-#define iQoverride_redirect 1200
+#define iQoverride_redirect 1209
 DEFINE_LISP_SYMBOL (Qoverride_redirect)
-#define iQoverriding_local_map 1201
+#define iQoverriding_local_map 1210
 DEFINE_LISP_SYMBOL (Qoverriding_local_map)
-#define iQoverriding_plist_environment 1202
+#define iQoverriding_plist_environment 1211
 DEFINE_LISP_SYMBOL (Qoverriding_plist_environment)
-#define iQoverriding_terminal_local_map 1203
+#define iQoverriding_terminal_local_map 1212
 DEFINE_LISP_SYMBOL (Qoverriding_terminal_local_map)
-#define iQoverwrite_mode 1204
+#define iQoverwrite_mode 1213
 DEFINE_LISP_SYMBOL (Qoverwrite_mode)
-#define iQoverwrite_mode_binary 1205
+#define iQoverwrite_mode_binary 1214
 DEFINE_LISP_SYMBOL (Qoverwrite_mode_binary)
-#define iQp 1206
+#define iQp 1215
 DEFINE_LISP_SYMBOL (Qp)
-#define iQpaper 1207
+#define iQpaper 1216
 DEFINE_LISP_SYMBOL (Qpaper)
-#define iQparent_frame 1208
+#define iQparent_frame 1217
 DEFINE_LISP_SYMBOL (Qparent_frame)
-#define iQparent_id 1209
+#define iQparent_id 1218
 DEFINE_LISP_SYMBOL (Qparent_id)
-#define iQpbm 1210
+#define iQpbm 1219
 DEFINE_LISP_SYMBOL (Qpbm)
-#define iQpc 1211
+#define iQpc 1220
 DEFINE_LISP_SYMBOL (Qpc)
-#define iQpcpu 1212
+#define iQpcpu 1221
 DEFINE_LISP_SYMBOL (Qpcpu)
-#define iQpermanent_local 1213
+#define iQpermanent_local 1222
 DEFINE_LISP_SYMBOL (Qpermanent_local)
-#define iQpermanent_local_hook 1214
+#define iQpermanent_local_hook 1223
 DEFINE_LISP_SYMBOL (Qpermanent_local_hook)
-#define iQpermission_denied 1215
+#define iQpermission_denied 1224
 DEFINE_LISP_SYMBOL (Qpermission_denied)
-#define iQpgrp 1216
+#define iQpgrp 1225
 DEFINE_LISP_SYMBOL (Qpgrp)
-#define iQpgtk 1217
+#define iQpgtk 1226
 DEFINE_LISP_SYMBOL (Qpgtk)
-#define iQphi 1218
+#define iQphi 1227
 DEFINE_LISP_SYMBOL (Qphi)
-#define iQpinch 1219
+#define iQpinch 1228
 DEFINE_LISP_SYMBOL (Qpinch)
-#define iQpipe 1220
+#define iQpipe 1229
 DEFINE_LISP_SYMBOL (Qpipe)
-#define iQpipe_process_p 1221
+#define iQpipe_process_p 1230
 DEFINE_LISP_SYMBOL (Qpipe_process_p)
-#define iQplay_sound_functions 1222
+#define iQplay_sound_functions 1231
 DEFINE_LISP_SYMBOL (Qplay_sound_functions)
-#define iQplist 1223
+#define iQplist 1232
 DEFINE_LISP_SYMBOL (Qplist)
-#define iQplistp 1224
+#define iQplistp 1233
 DEFINE_LISP_SYMBOL (Qplistp)
-#define iQplus 1225
+#define iQplus 1234
 DEFINE_LISP_SYMBOL (Qplus)
-#define iQpmem 1226
+#define iQpmem 1235
 DEFINE_LISP_SYMBOL (Qpmem)
-#define iQpng 1227
+#define iQpng 1236
 DEFINE_LISP_SYMBOL (Qpng)
-#define iQpoint_entered 1228
+#define iQpoint_entered 1237
 DEFINE_LISP_SYMBOL (Qpoint_entered)
-#define iQpoint_left 1229
+#define iQpoint_left 1238
 DEFINE_LISP_SYMBOL (Qpoint_left)
-#define iQpointer 1230
+#define iQpointer 1239
 DEFINE_LISP_SYMBOL (Qpointer)
-#define iQpolling_period 1231
+#define iQpolling_period 1240
 DEFINE_LISP_SYMBOL (Qpolling_period)
-#define iQpoly 1232
+#define iQpoly 1241
 DEFINE_LISP_SYMBOL (Qpoly)
-#define iQpop_handler 1233
+#define iQpop_handler 1242
 DEFINE_LISP_SYMBOL (Qpop_handler)
-#define iQposition 1234
+#define iQposition 1243
 DEFINE_LISP_SYMBOL (Qposition)
-#define iQpost_command_hook 1235
+#define iQpost_command_hook 1244
 DEFINE_LISP_SYMBOL (Qpost_command_hook)
-#define iQpost_gc_hook 1236
+#define iQpost_gc_hook 1245
 DEFINE_LISP_SYMBOL (Qpost_gc_hook)
-#define iQpost_select_region_hook 1237
+#define iQpost_select_region_hook 1246
 DEFINE_LISP_SYMBOL (Qpost_select_region_hook)
-#define iQpost_self_insert_hook 1238
+#define iQpost_self_insert_hook 1247
 DEFINE_LISP_SYMBOL (Qpost_self_insert_hook)
-#define iQpost_wake 1239
+#define iQpost_wake 1248
 DEFINE_LISP_SYMBOL (Qpost_wake)
-#define iQpostscript 1240
+#define iQpostscript 1249
 DEFINE_LISP_SYMBOL (Qpostscript)
-#define iQppid 1241
+#define iQppid 1250
 DEFINE_LISP_SYMBOL (Qppid)
-#define iQpre_command_hook 1242
+#define iQpre_command_hook 1251
 DEFINE_LISP_SYMBOL (Qpre_command_hook)
-#define iQpre_sleep 1243
+#define iQpre_sleep 1252
 DEFINE_LISP_SYMBOL (Qpre_sleep)
-#define iQpreedit_text 1244
+#define iQpreedit_text 1253
 DEFINE_LISP_SYMBOL (Qpreedit_text)
-#define iQpressed_button 1245
+#define iQpressed_button 1254
 DEFINE_LISP_SYMBOL (Qpressed_button)
-#define iQpri 1246
+#define iQpri 1255
 DEFINE_LISP_SYMBOL (Qpri)
-#define iQprimitive_function 1247
+#define iQprimitive_function 1256
 DEFINE_LISP_SYMBOL (Qprimitive_function)
-#define iQprinc 1248
+#define iQprinc 1257
 DEFINE_LISP_SYMBOL (Qprinc)
-#define iQprint__unreadable_callback_buffer 1249
+#define iQprint__unreadable_callback_buffer 1258
 DEFINE_LISP_SYMBOL (Qprint__unreadable_callback_buffer)
-#define iQprint_escape_multibyte 1250
+#define iQprint_escape_multibyte 1259
 DEFINE_LISP_SYMBOL (Qprint_escape_multibyte)
-#define iQprint_escape_nonascii 1251
+#define iQprint_escape_nonascii 1260
 DEFINE_LISP_SYMBOL (Qprint_escape_nonascii)
-#define iQprint_symbols_bare 1252
+#define iQprint_symbols_bare 1261
 DEFINE_LISP_SYMBOL (Qprint_symbols_bare)
-#define iQprint_unreadable_function 1253
+#define iQprint_unreadable_function 1262
 DEFINE_LISP_SYMBOL (Qprint_unreadable_function)
-#define iQpriority 1254
+#define iQpriority 1263
 DEFINE_LISP_SYMBOL (Qpriority)
-#define iQprocess 1255
+#define iQprocess 1264
 DEFINE_LISP_SYMBOL (Qprocess)
-#define iQprocess_attributes 1256
+#define iQprocess_attributes 1265
 DEFINE_LISP_SYMBOL (Qprocess_attributes)
-#define iQprocessp 1257
+#define iQprocessp 1266
 DEFINE_LISP_SYMBOL (Qprocessp)
-#define iQprogn 1258
+#define iQprogn 1267
 DEFINE_LISP_SYMBOL (Qprogn)
-#define iQpropertize 1259
+#define iQpropertize 1268
 DEFINE_LISP_SYMBOL (Qpropertize)
-#define iQprotected_field 1260
+#define iQprotected_field 1269
 DEFINE_LISP_SYMBOL (Qprotected_field)
-#define iQprovide 1261
+#define iQprovide 1270
 DEFINE_LISP_SYMBOL (Qprovide)
-#define iQpseudo_color 1262
+#define iQpseudo_color 1271
 DEFINE_LISP_SYMBOL (Qpseudo_color)
-#define iQpty 1263
+#define iQpty 1272
 DEFINE_LISP_SYMBOL (Qpty)
-#define iQpurecopy 1264
+#define iQpurecopy 1273
 DEFINE_LISP_SYMBOL (Qpurecopy)
-#define iQpush_handler 1265
+#define iQpush_handler 1274
 DEFINE_LISP_SYMBOL (Qpush_handler)
-#define iQpush_window_buffer_onto_prev 1266
+#define iQpush_window_buffer_onto_prev 1275
 DEFINE_LISP_SYMBOL (Qpush_window_buffer_onto_prev)
-#define iQquit 1267
+#define iQquit 1276
 DEFINE_LISP_SYMBOL (Qquit)
-#define iQquit_restore 1268
+#define iQquit_restore 1277
 DEFINE_LISP_SYMBOL (Qquit_restore)
-#define iQquit_restore_prev 1269
+#define iQquit_restore_prev 1278
 DEFINE_LISP_SYMBOL (Qquit_restore_prev)
-#define iQquote 1270
+#define iQquote 1279
 DEFINE_LISP_SYMBOL (Qquote)
-#define iQraise 1271
+#define iQraise 1280
 DEFINE_LISP_SYMBOL (Qraise)
-#define iQrange 1272
+#define iQrange 1281
 DEFINE_LISP_SYMBOL (Qrange)
-#define iQrange_error 1273
+#define iQrange_error 1282
 DEFINE_LISP_SYMBOL (Qrange_error)
-#define iQratio 1274
+#define iQratio 1283
 DEFINE_LISP_SYMBOL (Qratio)
-#define iQraw_text 1275
+#define iQraw_text 1284
 DEFINE_LISP_SYMBOL (Qraw_text)
-#define iQread 1276
+#define iQread 1285
 DEFINE_LISP_SYMBOL (Qread)
-#define iQread_char 1277
+#define iQread_char 1286
 DEFINE_LISP_SYMBOL (Qread_char)
-#define iQread_file_name 1278
+#define iQread_file_name 1287
 DEFINE_LISP_SYMBOL (Qread_file_name)
-#define iQread_minibuffer 1279
+#define iQread_minibuffer 1288
 DEFINE_LISP_SYMBOL (Qread_minibuffer)
-#define iQread_number 1280
+#define iQread_number 1289
 DEFINE_LISP_SYMBOL (Qread_number)
-#define iQread_only 1281
+#define iQread_only 1290
 DEFINE_LISP_SYMBOL (Qread_only)
-#define iQread_symbol_shorthands 1282
+#define iQread_symbol_shorthands 1291
 DEFINE_LISP_SYMBOL (Qread_symbol_shorthands)
-#define iQreal 1283
+#define iQreal 1292
 DEFINE_LISP_SYMBOL (Qreal)
-#define iQreal_this_command 1284
+#define iQreal_this_command 1293
 DEFINE_LISP_SYMBOL (Qreal_this_command)
-#define iQrear_nonsticky 1285
+#define iQrear_nonsticky 1294
 DEFINE_LISP_SYMBOL (Qrear_nonsticky)
-#define iQrecord 1286
+#define iQrecord 1295
 DEFINE_LISP_SYMBOL (Qrecord)
-#define iQrecord_unwind_current_buffer 1287
+#define iQrecord_unwind_current_buffer 1296
 DEFINE_LISP_SYMBOL (Qrecord_unwind_current_buffer)
-#define iQrecord_unwind_protect_excursion 1288
+#define iQrecord_unwind_protect_excursion 1297
 DEFINE_LISP_SYMBOL (Qrecord_unwind_protect_excursion)
-#define iQrecord_window_buffer 1289
+#define iQrecord_window_buffer 1298
 DEFINE_LISP_SYMBOL (Qrecord_window_buffer)
-#define iQrecordp 1290
+#define iQrecordp 1299
 DEFINE_LISP_SYMBOL (Qrecordp)
-#define iQrect 1291
+#define iQrect 1300
 DEFINE_LISP_SYMBOL (Qrect)
-#define iQrecursion_error 1292
+#define iQrecursion_error 1301
 DEFINE_LISP_SYMBOL (Qrecursion_error)
-#define iQredisplay_internal_xC_functionx 1293
+#define iQredisplay_internal_xC_functionx 1302
 DEFINE_LISP_SYMBOL (Qredisplay_internal_xC_functionx)
-#define iQrelative 1294
+#define iQrelative 1303
 DEFINE_LISP_SYMBOL (Qrelative)
-#define iQreleased_button 1295
+#define iQreleased_button 1304
 DEFINE_LISP_SYMBOL (Qreleased_button)
-#define iQremap 1296
+#define iQremap 1305
 DEFINE_LISP_SYMBOL (Qremap)
-#define iQremote_file_error 1297
+#define iQremote_file_error 1306
 DEFINE_LISP_SYMBOL (Qremote_file_error)
-#define iQrename 1298
+#define iQrename 1307
 DEFINE_LISP_SYMBOL (Qrename)
-#define iQrename_auto_save_file 1299
+#define iQrename_auto_save_file 1308
 DEFINE_LISP_SYMBOL (Qrename_auto_save_file)
-#define iQrename_file 1300
+#define iQrename_file 1309
 DEFINE_LISP_SYMBOL (Qrename_file)
-#define iQreplace_buffer_in_windows 1301
+#define iQreplace_buffer_in_windows 1310
 DEFINE_LISP_SYMBOL (Qreplace_buffer_in_windows)
-#define iQrequire 1302
+#define iQrequire 1311
 DEFINE_LISP_SYMBOL (Qrequire)
-#define iQreset 1303
+#define iQreset 1312
 DEFINE_LISP_SYMBOL (Qreset)
-#define iQresume_tty_functions 1304
+#define iQresume_tty_functions 1313
 DEFINE_LISP_SYMBOL (Qresume_tty_functions)
-#define iQretained 1305
+#define iQretained 1314
 DEFINE_LISP_SYMBOL (Qretained)
-#define iQreturn 1306
+#define iQreturn 1315
 DEFINE_LISP_SYMBOL (Qreturn)
-#define iQreverse_italic 1307
+#define iQreverse_italic 1316
 DEFINE_LISP_SYMBOL (Qreverse_italic)
-#define iQrevoke 1308
+#define iQrevoke 1317
 DEFINE_LISP_SYMBOL (Qrevoke)
-#define iQright 1309
+#define iQright 1318
 DEFINE_LISP_SYMBOL (Qright)
-#define iQright_divider 1310
+#define iQright_divider 1319
 DEFINE_LISP_SYMBOL (Qright_divider)
-#define iQright_divider_width 1311
+#define iQright_divider_width 1320
 DEFINE_LISP_SYMBOL (Qright_divider_width)
-#define iQright_edge 1312
+#define iQright_edge 1321
 DEFINE_LISP_SYMBOL (Qright_edge)
-#define iQright_fringe 1313
+#define iQright_fringe 1322
 DEFINE_LISP_SYMBOL (Qright_fringe)
-#define iQright_fringe_help 1314
+#define iQright_fringe_help 1323
 DEFINE_LISP_SYMBOL (Qright_fringe_help)
-#define iQright_margin 1315
+#define iQright_margin 1324
 DEFINE_LISP_SYMBOL (Qright_margin)
-#define iQright_to_left 1316
+#define iQright_to_left 1325
 DEFINE_LISP_SYMBOL (Qright_to_left)
-#define iQrightmost 1317
+#define iQrightmost 1326
 DEFINE_LISP_SYMBOL (Qrightmost)
-#define iQrisky_local_variable 1318
+#define iQrisky_local_variable 1327
 DEFINE_LISP_SYMBOL (Qrisky_local_variable)
-#define iQrotate 1319
+#define iQrotate 1328
 DEFINE_LISP_SYMBOL (Qrotate)
-#define iQrotate90 1320
+#define iQrotate90 1329
 DEFINE_LISP_SYMBOL (Qrotate90)
-#define iQrss 1321
+#define iQrss 1330
 DEFINE_LISP_SYMBOL (Qrss)
-#define iQrun 1322
+#define iQrun 1331
 DEFINE_LISP_SYMBOL (Qrun)
-#define iQrun_at_time 1323
+#define iQrun_at_time 1332
 DEFINE_LISP_SYMBOL (Qrun_at_time)
-#define iQrun_hook_query_error_with_timeout 1324
+#define iQrun_hook_query_error_with_timeout 1333
 DEFINE_LISP_SYMBOL (Qrun_hook_query_error_with_timeout)
-#define iQrun_hook_with_args 1325
+#define iQrun_hook_with_args 1334
 DEFINE_LISP_SYMBOL (Qrun_hook_with_args)
-#define iQsafe 1326
+#define iQsafe 1335
 DEFINE_LISP_SYMBOL (Qsafe)
-#define iQsafe_magic 1327
+#define iQsafe_magic 1336
 DEFINE_LISP_SYMBOL (Qsafe_magic)
-#define iQsave_excursion 1328
+#define iQsave_excursion 1337
 DEFINE_LISP_SYMBOL (Qsave_excursion)
-#define iQsave_session 1329
+#define iQsave_session 1338
 DEFINE_LISP_SYMBOL (Qsave_session)
-#define iQscale 1330
+#define iQscale 1339
 DEFINE_LISP_SYMBOL (Qscale)
-#define iQscale_factor 1331
+#define iQscale_factor 1340
 DEFINE_LISP_SYMBOL (Qscale_factor)
-#define iQscan_error 1332
+#define iQscan_error 1341
 DEFINE_LISP_SYMBOL (Qscan_error)
-#define iQscratch 1333
+#define iQscratch 1342
 DEFINE_LISP_SYMBOL (Qscratch)
-#define iQscreen_gamma 1334
+#define iQscreen_gamma 1343
 DEFINE_LISP_SYMBOL (Qscreen_gamma)
-#define iQscroll_bar 1335
+#define iQscroll_bar 1344
 DEFINE_LISP_SYMBOL (Qscroll_bar)
-#define iQscroll_bar_background 1336
+#define iQscroll_bar_background 1345
 DEFINE_LISP_SYMBOL (Qscroll_bar_background)
-#define iQscroll_bar_foreground 1337
+#define iQscroll_bar_foreground 1346
 DEFINE_LISP_SYMBOL (Qscroll_bar_foreground)
-#define iQscroll_bar_height 1338
+#define iQscroll_bar_height 1347
 DEFINE_LISP_SYMBOL (Qscroll_bar_height)
-#define iQscroll_bar_movement 1339
+#define iQscroll_bar_movement 1348
 DEFINE_LISP_SYMBOL (Qscroll_bar_movement)
-#define iQscroll_bar_width 1340
+#define iQscroll_bar_width 1349
 DEFINE_LISP_SYMBOL (Qscroll_bar_width)
-#define iQscroll_command 1341
+#define iQscroll_command 1350
 DEFINE_LISP_SYMBOL (Qscroll_command)
-#define iQscroll_down 1342
+#define iQscroll_down 1351
 DEFINE_LISP_SYMBOL (Qscroll_down)
-#define iQscroll_up 1343
+#define iQscroll_up 1352
 DEFINE_LISP_SYMBOL (Qscroll_up)
-#define iQsearch_failed 1344
+#define iQsearch_failed 1353
 DEFINE_LISP_SYMBOL (Qsearch_failed)
-#define iQselect_frame_set_input_focus 1345
+#define iQselect_frame_set_input_focus 1354
 DEFINE_LISP_SYMBOL (Qselect_frame_set_input_focus)
-#define iQselect_window 1346
+#define iQselect_window 1355
 DEFINE_LISP_SYMBOL (Qselect_window)
-#define iQselection_request 1347
+#define iQselection_request 1356
 DEFINE_LISP_SYMBOL (Qselection_request)
-#define iQself_insert_command 1348
+#define iQself_insert_command 1357
 DEFINE_LISP_SYMBOL (Qself_insert_command)
-#define iQsemi_bold 1349
+#define iQsemi_bold 1358
 DEFINE_LISP_SYMBOL (Qsemi_bold)
-#define iQsemi_light 1350
+#define iQsemi_light 1359
 DEFINE_LISP_SYMBOL (Qsemi_light)
-#define iQseqpacket 1351
+#define iQseqpacket 1360
 DEFINE_LISP_SYMBOL (Qseqpacket)
-#define iQsequencep 1352
+#define iQsequencep 1361
 DEFINE_LISP_SYMBOL (Qsequencep)
-#define iQserial 1353
+#define iQserial 1362
 DEFINE_LISP_SYMBOL (Qserial)
-#define iQsess 1354
+#define iQsess 1363
 DEFINE_LISP_SYMBOL (Qsess)
-#define iQset 1355
+#define iQset 1364
 DEFINE_LISP_SYMBOL (Qset)
-#define iQset_args_to_local 1356
+#define iQset_args_to_local 1365
 DEFINE_LISP_SYMBOL (Qset_args_to_local)
-#define iQset_buffer_multibyte 1357
+#define iQset_buffer_multibyte 1366
 DEFINE_LISP_SYMBOL (Qset_buffer_multibyte)
-#define iQset_default 1358
+#define iQset_default 1367
 DEFINE_LISP_SYMBOL (Qset_default)
-#define iQset_file_acl 1359
+#define iQset_file_acl 1368
 DEFINE_LISP_SYMBOL (Qset_file_acl)
-#define iQset_file_modes 1360
+#define iQset_file_modes 1369
 DEFINE_LISP_SYMBOL (Qset_file_modes)
-#define iQset_file_selinux_context 1361
+#define iQset_file_selinux_context 1370
 DEFINE_LISP_SYMBOL (Qset_file_selinux_context)
-#define iQset_file_times 1362
+#define iQset_file_times 1371
 DEFINE_LISP_SYMBOL (Qset_file_times)
-#define iQset_internal 1363
+#define iQset_internal 1372
 DEFINE_LISP_SYMBOL (Qset_internal)
-#define iQset_par_to_local 1364
+#define iQset_par_to_local 1373
 DEFINE_LISP_SYMBOL (Qset_par_to_local)
-#define iQset_rest_args_to_local 1365
+#define iQset_rest_args_to_local 1374
 DEFINE_LISP_SYMBOL (Qset_rest_args_to_local)
-#define iQset_visited_file_modtime 1366
+#define iQset_visited_file_modtime 1375
 DEFINE_LISP_SYMBOL (Qset_visited_file_modtime)
-#define iQset_window_configuration 1367
+#define iQset_window_configuration 1376
 DEFINE_LISP_SYMBOL (Qset_window_configuration)
-#define iQsetcar 1368
+#define iQsetcar 1377
 DEFINE_LISP_SYMBOL (Qsetcar)
-#define iQsetcdr 1369
+#define iQsetcdr 1378
 DEFINE_LISP_SYMBOL (Qsetcdr)
-#define iQsetimm 1370
+#define iQsetimm 1379
 DEFINE_LISP_SYMBOL (Qsetimm)
-#define iQsetq 1371
+#define iQsetq 1380
 DEFINE_LISP_SYMBOL (Qsetq)
-#define iQsetting_constant 1372
+#define iQsetting_constant 1381
 DEFINE_LISP_SYMBOL (Qsetting_constant)
-#define iQsha1 1373
+#define iQsha1 1382
 DEFINE_LISP_SYMBOL (Qsha1)
-#define iQsha224 1374
+#define iQsha224 1383
 DEFINE_LISP_SYMBOL (Qsha224)
-#define iQsha256 1375
+#define iQsha256 1384
 DEFINE_LISP_SYMBOL (Qsha256)
-#define iQsha384 1376
+#define iQsha384 1385
 DEFINE_LISP_SYMBOL (Qsha384)
-#define iQsha512 1377
+#define iQsha512 1386
 DEFINE_LISP_SYMBOL (Qsha512)
-#define iQshaded 1378
+#define iQshaded 1387
 DEFINE_LISP_SYMBOL (Qshaded)
-#define iQshift_jis 1379
+#define iQshift_jis 1388
 DEFINE_LISP_SYMBOL (Qshift_jis)
-#define iQshlwapi 1380
+#define iQshlwapi 1389
 DEFINE_LISP_SYMBOL (Qshlwapi)
-#define iQsignal 1381
+#define iQsignal 1390
 DEFINE_LISP_SYMBOL (Qsignal)
-#define iQsignal_process_functions 1382
+#define iQsignal_process_functions 1391
 DEFINE_LISP_SYMBOL (Qsignal_process_functions)
-#define iQsigusr2 1383
+#define iQsigusr2 1392
 DEFINE_LISP_SYMBOL (Qsigusr2)
-#define iQsilently 1384
+#define iQsilently 1393
 DEFINE_LISP_SYMBOL (Qsilently)
-#define iQsingularity_error 1385
+#define iQsingularity_error 1394
 DEFINE_LISP_SYMBOL (Qsingularity_error)
-#define iQsize 1386
+#define iQsize 1395
 DEFINE_LISP_SYMBOL (Qsize)
-#define iQsize_and_position 1387
+#define iQsize_and_position 1396
 DEFINE_LISP_SYMBOL (Qsize_and_position)
-#define iQskip_taskbar 1388
+#define iQskip_taskbar 1397
 DEFINE_LISP_SYMBOL (Qskip_taskbar)
-#define iQsleep_event 1389
+#define iQsleep_event 1398
 DEFINE_LISP_SYMBOL (Qsleep_event)
-#define iQslice 1390
+#define iQslice 1399
 DEFINE_LISP_SYMBOL (Qslice)
-#define iQsound 1391
+#define iQsound 1400
 DEFINE_LISP_SYMBOL (Qsound)
-#define iQsource 1392
+#define iQsource 1401
 DEFINE_LISP_SYMBOL (Qsource)
-#define iQspace 1393
+#define iQspace 1402
 DEFINE_LISP_SYMBOL (Qspace)
-#define iQspace_width 1394
+#define iQspace_width 1403
 DEFINE_LISP_SYMBOL (Qspace_width)
-#define iQspecial_form 1395
+#define iQspecial_form 1404
 DEFINE_LISP_SYMBOL (Qspecial_form)
-#define iQspecial_lowercase 1396
+#define iQspecial_lowercase 1405
 DEFINE_LISP_SYMBOL (Qspecial_lowercase)
-#define iQspecial_titlecase 1397
+#define iQspecial_titlecase 1406
 DEFINE_LISP_SYMBOL (Qspecial_titlecase)
-#define iQspecial_uppercase 1398
+#define iQspecial_uppercase 1407
 DEFINE_LISP_SYMBOL (Qspecial_uppercase)
-#define iQsqlite 1399
+#define iQsqlite 1408
 DEFINE_LISP_SYMBOL (Qsqlite)
-#define iQsqlite3 1400
+#define iQsqlite3 1409
 DEFINE_LISP_SYMBOL (Qsqlite3)
-#define iQsqlite_error 1401
+#define iQsqlite_error 1410
 DEFINE_LISP_SYMBOL (Qsqlite_error)
-#define iQsqlite_locked_error 1402
+#define iQsqlite_locked_error 1411
 DEFINE_LISP_SYMBOL (Qsqlite_locked_error)
-#define iQsqlitep 1403
+#define iQsqlitep 1412
 DEFINE_LISP_SYMBOL (Qsqlitep)
-#define iQstandard_input 1404
+#define iQstandard_input 1413
 DEFINE_LISP_SYMBOL (Qstandard_input)
-#define iQstandard_output 1405
+#define iQstandard_output 1414
 DEFINE_LISP_SYMBOL (Qstandard_output)
-#define iQstart 1406
+#define iQstart 1415
 DEFINE_LISP_SYMBOL (Qstart)
-#define iQstart_process 1407
+#define iQstart_process 1416
 DEFINE_LISP_SYMBOL (Qstart_process)
-#define iQstate 1408
+#define iQstate 1417
 DEFINE_LISP_SYMBOL (Qstate)
-#define iQstatic_gray 1409
+#define iQstatic_gray 1418
 DEFINE_LISP_SYMBOL (Qstatic_gray)
-#define iQstderr 1410
+#define iQstderr 1419
 DEFINE_LISP_SYMBOL (Qstderr)
-#define iQstdin 1411
+#define iQstdin 1420
 DEFINE_LISP_SYMBOL (Qstdin)
-#define iQstdout 1412
+#define iQstdout 1421
 DEFINE_LISP_SYMBOL (Qstdout)
-#define iQsticky 1413
+#define iQsticky 1422
 DEFINE_LISP_SYMBOL (Qsticky)
-#define iQstime 1414
+#define iQstime 1423
 DEFINE_LISP_SYMBOL (Qstime)
-#define iQstop 1415
+#define iQstop 1424
 DEFINE_LISP_SYMBOL (Qstop)
-#define iQstraight 1416
+#define iQstraight 1425
 DEFINE_LISP_SYMBOL (Qstraight)
-#define iQstring 1417
+#define iQstring 1426
 DEFINE_LISP_SYMBOL (Qstring)
-#define iQstring_bytes 1418
+#define iQstring_bytes 1427
 DEFINE_LISP_SYMBOL (Qstring_bytes)
-#define iQstring_lessp 1419
+#define iQstring_lessp 1428
 DEFINE_LISP_SYMBOL (Qstring_lessp)
-#define iQstring_replace 1420
+#define iQstring_replace 1429
 DEFINE_LISP_SYMBOL (Qstring_replace)
-#define iQstringp 1421
+#define iQstringp 1430
 DEFINE_LISP_SYMBOL (Qstringp)
-#define iQstrings 1422
+#define iQstrings 1431
 DEFINE_LISP_SYMBOL (Qstrings)
-#define iQsub1 1423
+#define iQsub1 1432
 DEFINE_LISP_SYMBOL (Qsub1)
-#define iQsub_char_table 1424
+#define iQsub_char_table 1433
 DEFINE_LISP_SYMBOL (Qsub_char_table)
-#define iQsubfeatures 1425
+#define iQsubfeatures 1434
 DEFINE_LISP_SYMBOL (Qsubfeatures)
-#define iQsubr 1426
+#define iQsubr 1435
 DEFINE_LISP_SYMBOL (Qsubr)
-#define iQsubr_native_elisp 1427
+#define iQsubr_native_elisp 1436
 DEFINE_LISP_SYMBOL (Qsubr_native_elisp)
-#define iQsubrp 1428
+#define iQsubrp 1437
 DEFINE_LISP_SYMBOL (Qsubrp)
-#define iQsubstitute_command_keys 1429
+#define iQsubstitute_command_keys 1438
 DEFINE_LISP_SYMBOL (Qsubstitute_command_keys)
-#define iQsubstitute_env_in_file_name 1430
+#define iQsubstitute_env_in_file_name 1439
 DEFINE_LISP_SYMBOL (Qsubstitute_env_in_file_name)
-#define iQsubstitute_in_file_name 1431
+#define iQsubstitute_in_file_name 1440
 DEFINE_LISP_SYMBOL (Qsubstitute_in_file_name)
-#define iQsuper 1432
+#define iQsuper 1441
 DEFINE_LISP_SYMBOL (Qsuper)
-#define iQsuppress_keymap 1433
+#define iQsuppress_keymap 1442
 DEFINE_LISP_SYMBOL (Qsuppress_keymap)
-#define iQsuspend_hook 1434
+#define iQsuspend_hook 1443
 DEFINE_LISP_SYMBOL (Qsuspend_hook)
-#define iQsuspend_resume_hook 1435
+#define iQsuspend_resume_hook 1444
 DEFINE_LISP_SYMBOL (Qsuspend_resume_hook)
-#define iQsuspend_tty_functions 1436
+#define iQsuspend_tty_functions 1445
 DEFINE_LISP_SYMBOL (Qsuspend_tty_functions)
-#define iQsvg 1437
+#define iQsvg 1446
 DEFINE_LISP_SYMBOL (Qsvg)
-#define iQsw 1438
+#define iQsw 1447
 DEFINE_LISP_SYMBOL (Qsw)
-#define iQswitch_frame 1439
+#define iQswitch_frame 1448
 DEFINE_LISP_SYMBOL (Qswitch_frame)
-#define iQsymbol 1440
+#define iQsymbol 1449
 DEFINE_LISP_SYMBOL (Qsymbol)
-#define iQsymbol_error 1441
+#define iQsymbol_error 1450
 DEFINE_LISP_SYMBOL (Qsymbol_error)
-#define iQsymbol_with_pos 1442
+#define iQsymbol_with_pos 1451
 DEFINE_LISP_SYMBOL (Qsymbol_with_pos)
-#define iQsymbol_with_pos_p 1443
+#define iQsymbol_with_pos_p 1452
 DEFINE_LISP_SYMBOL (Qsymbol_with_pos_p)
-#define iQsymbolp 1444
+#define iQsymbolp 1453
 DEFINE_LISP_SYMBOL (Qsymbolp)
-#define iQsymbols 1445
+#define iQsymbols 1454
 DEFINE_LISP_SYMBOL (Qsymbols)
-#define iQsymbols_with_pos_enabled 1446
+#define iQsymbols_with_pos_enabled 1455
 DEFINE_LISP_SYMBOL (Qsymbols_with_pos_enabled)
-#define iQsyntax_ppss 1447
+#define iQsyntax_ppss 1456
 DEFINE_LISP_SYMBOL (Qsyntax_ppss)
-#define iQsyntax_ppss_flush_cache 1448
+#define iQsyntax_ppss_flush_cache 1457
 DEFINE_LISP_SYMBOL (Qsyntax_ppss_flush_cache)
-#define iQsyntax_table 1449
+#define iQsyntax_table 1458
 DEFINE_LISP_SYMBOL (Qsyntax_table)
-#define iQsyntax_table_p 1450
+#define iQsyntax_table_p 1459
 DEFINE_LISP_SYMBOL (Qsyntax_table_p)
-#define iQtab_bar 1451
+#define iQtab_bar 1460
 DEFINE_LISP_SYMBOL (Qtab_bar)
-#define iQtab_bar_lines 1452
+#define iQtab_bar_lines 1461
 DEFINE_LISP_SYMBOL (Qtab_bar_lines)
-#define iQtab_bar_size 1453
+#define iQtab_bar_size 1462
 DEFINE_LISP_SYMBOL (Qtab_bar_size)
-#define iQtab_line 1454
+#define iQtab_line 1463
 DEFINE_LISP_SYMBOL (Qtab_line)
-#define iQtab_line_format 1455
+#define iQtab_line_format 1464
 DEFINE_LISP_SYMBOL (Qtab_line_format)
-#define iQtarget_idx 1456
+#define iQtarget_idx 1465
 DEFINE_LISP_SYMBOL (Qtarget_idx)
-#define iQtemp_buffer_setup_hook 1457
+#define iQtemp_buffer_setup_hook 1466
 DEFINE_LISP_SYMBOL (Qtemp_buffer_setup_hook)
-#define iQtemp_buffer_show_hook 1458
+#define iQtemp_buffer_show_hook 1467
 DEFINE_LISP_SYMBOL (Qtemp_buffer_show_hook)
-#define iQterminal 1459
+#define iQterminal 1468
 DEFINE_LISP_SYMBOL (Qterminal)
-#define iQterminal_frame 1460
+#define iQterminal_frame 1469
 DEFINE_LISP_SYMBOL (Qterminal_frame)
-#define iQterminal_live_p 1461
+#define iQterminal_live_p 1470
 DEFINE_LISP_SYMBOL (Qterminal_live_p)
-#define iQtest 1462
+#define iQtest 1471
 DEFINE_LISP_SYMBOL (Qtest)
-#define iQtext 1463
+#define iQtext 1472
 DEFINE_LISP_SYMBOL (Qtext)
-#define iQtext_conversion 1464
+#define iQtext_conversion 1473
 DEFINE_LISP_SYMBOL (Qtext_conversion)
-#define iQtext_image_horiz 1465
+#define iQtext_image_horiz 1474
 DEFINE_LISP_SYMBOL (Qtext_image_horiz)
-#define iQtext_pixels 1466
+#define iQtext_pixels 1475
 DEFINE_LISP_SYMBOL (Qtext_pixels)
-#define iQtext_property_default_nonsticky 1467
+#define iQtext_property_default_nonsticky 1476
 DEFINE_LISP_SYMBOL (Qtext_property_default_nonsticky)
-#define iQtext_read_only 1468
+#define iQtext_read_only 1477
 DEFINE_LISP_SYMBOL (Qtext_read_only)
-#define iQthcount 1469
+#define iQthcount 1478
 DEFINE_LISP_SYMBOL (Qthcount)
-#define iQthin 1470
+#define iQthin 1479
 DEFINE_LISP_SYMBOL (Qthin)
-#define iQthin_space 1471
+#define iQthin_space 1480
 DEFINE_LISP_SYMBOL (Qthin_space)
-#define iQthread 1472
+#define iQthread 1481
 DEFINE_LISP_SYMBOL (Qthread)
-#define iQthread_buffer_killed 1473
+#define iQthread_buffer_killed 1482
 DEFINE_LISP_SYMBOL (Qthread_buffer_killed)
-#define iQthread_event 1474
+#define iQthread_event 1483
 DEFINE_LISP_SYMBOL (Qthread_event)
-#define iQthreadp 1475
+#define iQthreadp 1484
 DEFINE_LISP_SYMBOL (Qthreadp)
-#define iQtiff 1476
+#define iQtiff 1485
 DEFINE_LISP_SYMBOL (Qtiff)
-#define iQtime 1477
+#define iQtime 1486
 DEFINE_LISP_SYMBOL (Qtime)
-#define iQtimer_event_handler 1478
+#define iQtimer_event_handler 1487
 DEFINE_LISP_SYMBOL (Qtimer_event_handler)
-#define iQtip_frame 1479
+#define iQtip_frame 1488
 DEFINE_LISP_SYMBOL (Qtip_frame)
-#define iQtitle 1480
+#define iQtitle 1489
 DEFINE_LISP_SYMBOL (Qtitle)
-#define iQtitle_bar_size 1481
+#define iQtitle_bar_size 1490
 DEFINE_LISP_SYMBOL (Qtitle_bar_size)
-#define iQtitlecase 1482
+#define iQtitlecase 1491
 DEFINE_LISP_SYMBOL (Qtitlecase)
-#define iQtool_bar 1483
+#define iQtool_bar 1492
 DEFINE_LISP_SYMBOL (Qtool_bar)
-#define iQtool_bar_external 1484
+#define iQtool_bar_external 1493
 DEFINE_LISP_SYMBOL (Qtool_bar_external)
-#define iQtool_bar_lines 1485
+#define iQtool_bar_lines 1494
 DEFINE_LISP_SYMBOL (Qtool_bar_lines)
-#define iQtool_bar_position 1486
+#define iQtool_bar_position 1495
 DEFINE_LISP_SYMBOL (Qtool_bar_position)
-#define iQtool_bar_size 1487
+#define iQtool_bar_size 1496
 DEFINE_LISP_SYMBOL (Qtool_bar_size)
-#define iQtoolkit_theme_changed 1488
+#define iQtoolkit_theme_changed 1497
 DEFINE_LISP_SYMBOL (Qtoolkit_theme_changed)
-#define iQtoolkit_theme_set_functions 1489
+#define iQtoolkit_theme_set_functions 1498
 DEFINE_LISP_SYMBOL (Qtoolkit_theme_set_functions)
-#define iQtooltip 1490
+#define iQtooltip 1499
 DEFINE_LISP_SYMBOL (Qtooltip)
-#define iQtop 1491
+#define iQtop 1500
 DEFINE_LISP_SYMBOL (Qtop)
-#define iQtop_bottom 1492
+#define iQtop_bottom 1501
 DEFINE_LISP_SYMBOL (Qtop_bottom)
-#define iQtop_edge 1493
+#define iQtop_edge 1502
 DEFINE_LISP_SYMBOL (Qtop_edge)
-#define iQtop_left_corner 1494
+#define iQtop_left_corner 1503
 DEFINE_LISP_SYMBOL (Qtop_left_corner)
-#define iQtop_level 1495
+#define iQtop_level 1504
 DEFINE_LISP_SYMBOL (Qtop_level)
-#define iQtop_only 1496
+#define iQtop_only 1505
 DEFINE_LISP_SYMBOL (Qtop_only)
-#define iQtop_right_corner 1497
+#define iQtop_right_corner 1506
 DEFINE_LISP_SYMBOL (Qtop_right_corner)
-#define iQtouch_end 1498
+#define iQtouch_end 1507
 DEFINE_LISP_SYMBOL (Qtouch_end)
-#define iQtouchscreen 1499
+#define iQtouchscreen 1508
 DEFINE_LISP_SYMBOL (Qtouchscreen)
-#define iQtouchscreen_begin 1500
+#define iQtouchscreen_begin 1509
 DEFINE_LISP_SYMBOL (Qtouchscreen_begin)
-#define iQtouchscreen_end 1501
+#define iQtouchscreen_end 1510
 DEFINE_LISP_SYMBOL (Qtouchscreen_end)
-#define iQtouchscreen_update 1502
+#define iQtouchscreen_update 1511
 DEFINE_LISP_SYMBOL (Qtouchscreen_update)
-#define iQtpgid 1503
+#define iQtpgid 1512
 DEFINE_LISP_SYMBOL (Qtpgid)
-#define iQtrailing_whitespace 1504
+#define iQtrailing_whitespace 1513
 DEFINE_LISP_SYMBOL (Qtrailing_whitespace)
-#define iQtranslation_table 1505
+#define iQtranslation_table 1514
 DEFINE_LISP_SYMBOL (Qtranslation_table)
-#define iQtranslation_table_id 1506
+#define iQtranslation_table_id 1515
 DEFINE_LISP_SYMBOL (Qtranslation_table_id)
-#define iQtrapping_constant 1507
+#define iQtrapping_constant 1516
 DEFINE_LISP_SYMBOL (Qtrapping_constant)
-#define iQtree_sitter 1508
+#define iQtree_sitter 1517
 DEFINE_LISP_SYMBOL (Qtree_sitter)
-#define iQtree_sitter__library_abi 1509
+#define iQtree_sitter__library_abi 1518
 DEFINE_LISP_SYMBOL (Qtree_sitter__library_abi)
-#define iQtreesit_buffer_too_large 1510
+#define iQtreesit_buffer_too_large 1519
 DEFINE_LISP_SYMBOL (Qtreesit_buffer_too_large)
-#define iQtreesit_compiled_query 1511
+#define iQtreesit_compiled_query 1520
 DEFINE_LISP_SYMBOL (Qtreesit_compiled_query)
-#define iQtreesit_compiled_query_p 1512
+#define iQtreesit_compiled_query_p 1521
 DEFINE_LISP_SYMBOL (Qtreesit_compiled_query_p)
-#define iQtreesit_error 1513
+#define iQtreesit_error 1522
 DEFINE_LISP_SYMBOL (Qtreesit_error)
-#define iQtreesit_invalid_predicate 1514
+#define iQtreesit_invalid_predicate 1523
 DEFINE_LISP_SYMBOL (Qtreesit_invalid_predicate)
-#define iQtreesit_language_remap_alist 1515
+#define iQtreesit_language_remap_alist 1524
 DEFINE_LISP_SYMBOL (Qtreesit_language_remap_alist)
-#define iQtreesit_load_language_error 1516
+#define iQtreesit_load_language_error 1525
 DEFINE_LISP_SYMBOL (Qtreesit_load_language_error)
-#define iQtreesit_node 1517
+#define iQtreesit_node 1526
 DEFINE_LISP_SYMBOL (Qtreesit_node)
-#define iQtreesit_node_buffer_killed 1518
+#define iQtreesit_node_buffer_killed 1527
 DEFINE_LISP_SYMBOL (Qtreesit_node_buffer_killed)
-#define iQtreesit_node_outdated 1519
+#define iQtreesit_node_outdated 1528
 DEFINE_LISP_SYMBOL (Qtreesit_node_outdated)
-#define iQtreesit_node_p 1520
+#define iQtreesit_node_p 1529
 DEFINE_LISP_SYMBOL (Qtreesit_node_p)
-#define iQtreesit_parse_error 1521
+#define iQtreesit_parse_error 1530
 DEFINE_LISP_SYMBOL (Qtreesit_parse_error)
-#define iQtreesit_parser 1522
+#define iQtreesit_parser 1531
 DEFINE_LISP_SYMBOL (Qtreesit_parser)
-#define iQtreesit_parser_deleted 1523
+#define iQtreesit_parser_deleted 1532
 DEFINE_LISP_SYMBOL (Qtreesit_parser_deleted)
-#define iQtreesit_parser_p 1524
+#define iQtreesit_parser_p 1533
 DEFINE_LISP_SYMBOL (Qtreesit_parser_p)
-#define iQtreesit_pattern_expand 1525
+#define iQtreesit_pattern_expand 1534
 DEFINE_LISP_SYMBOL (Qtreesit_pattern_expand)
-#define iQtreesit_predicate_not_found 1526
+#define iQtreesit_predicate_not_found 1535
 DEFINE_LISP_SYMBOL (Qtreesit_predicate_not_found)
-#define iQtreesit_query_error 1527
+#define iQtreesit_query_error 1536
 DEFINE_LISP_SYMBOL (Qtreesit_query_error)
-#define iQtreesit_query_p 1528
+#define iQtreesit_query_p 1537
 DEFINE_LISP_SYMBOL (Qtreesit_query_p)
-#define iQtreesit_range_invalid 1529
+#define iQtreesit_range_invalid 1538
 DEFINE_LISP_SYMBOL (Qtreesit_range_invalid)
-#define iQtreesit_thing_symbol 1530
+#define iQtreesit_thing_symbol 1539
 DEFINE_LISP_SYMBOL (Qtreesit_thing_symbol)
-#define iQtrue_color 1531
+#define iQtrue_color 1540
 DEFINE_LISP_SYMBOL (Qtrue_color)
-#define iQtruncation 1532
+#define iQtruncation 1541
 DEFINE_LISP_SYMBOL (Qtruncation)
-#define iQttname 1533
+#define iQttname 1542
 DEFINE_LISP_SYMBOL (Qttname)
-#define iQtty 1534
+#define iQtty 1543
 DEFINE_LISP_SYMBOL (Qtty)
-#define iQtty_color_alist 1535
+#define iQtty_color_alist 1544
 DEFINE_LISP_SYMBOL (Qtty_color_alist)
-#define iQtty_color_by_index 1536
+#define iQtty_color_by_index 1545
 DEFINE_LISP_SYMBOL (Qtty_color_by_index)
-#define iQtty_color_desc 1537
+#define iQtty_color_desc 1546
 DEFINE_LISP_SYMBOL (Qtty_color_desc)
-#define iQtty_color_mode 1538
+#define iQtty_color_mode 1547
 DEFINE_LISP_SYMBOL (Qtty_color_mode)
-#define iQtty_color_standard_values 1539
+#define iQtty_color_standard_values 1548
 DEFINE_LISP_SYMBOL (Qtty_color_standard_values)
-#define iQtty_defined_color_alist 1540
+#define iQtty_defined_color_alist 1549
 DEFINE_LISP_SYMBOL (Qtty_defined_color_alist)
-#define iQtty_menu_disabled_face 1541
+#define iQtty_menu_disabled_face 1550
 DEFINE_LISP_SYMBOL (Qtty_menu_disabled_face)
-#define iQtty_menu_enabled_face 1542
+#define iQtty_menu_enabled_face 1551
 DEFINE_LISP_SYMBOL (Qtty_menu_enabled_face)
-#define iQtty_menu_exit 1543
+#define iQtty_menu_exit 1552
 DEFINE_LISP_SYMBOL (Qtty_menu_exit)
-#define iQtty_menu_ignore 1544
+#define iQtty_menu_ignore 1553
 DEFINE_LISP_SYMBOL (Qtty_menu_ignore)
-#define iQtty_menu_mouse_movement 1545
+#define iQtty_menu_mouse_movement 1554
 DEFINE_LISP_SYMBOL (Qtty_menu_mouse_movement)
-#define iQtty_menu_navigation_map 1546
+#define iQtty_menu_navigation_map 1555
 DEFINE_LISP_SYMBOL (Qtty_menu_navigation_map)
-#define iQtty_menu_next_item 1547
+#define iQtty_menu_next_item 1556
 DEFINE_LISP_SYMBOL (Qtty_menu_next_item)
-#define iQtty_menu_next_menu 1548
+#define iQtty_menu_next_menu 1557
 DEFINE_LISP_SYMBOL (Qtty_menu_next_menu)
-#define iQtty_menu_open_use_tmm 1549
+#define iQtty_menu_open_use_tmm 1558
 DEFINE_LISP_SYMBOL (Qtty_menu_open_use_tmm)
-#define iQtty_menu_prev_item 1550
+#define iQtty_menu_prev_item 1559
 DEFINE_LISP_SYMBOL (Qtty_menu_prev_item)
-#define iQtty_menu_prev_menu 1551
+#define iQtty_menu_prev_menu 1560
 DEFINE_LISP_SYMBOL (Qtty_menu_prev_menu)
-#define iQtty_menu_select 1552
+#define iQtty_menu_select 1561
 DEFINE_LISP_SYMBOL (Qtty_menu_select)
-#define iQtty_mode_reset_strings 1553
+#define iQtty_mode_reset_strings 1562
 DEFINE_LISP_SYMBOL (Qtty_mode_reset_strings)
-#define iQtty_mode_set_strings 1554
+#define iQtty_mode_set_strings 1563
 DEFINE_LISP_SYMBOL (Qtty_mode_set_strings)
-#define iQtty_non_selected_cursor 1555
+#define iQtty_non_selected_cursor 1564
 DEFINE_LISP_SYMBOL (Qtty_non_selected_cursor)
-#define iQtty_select_active_regions 1556
+#define iQtty_select_active_regions 1565
 DEFINE_LISP_SYMBOL (Qtty_select_active_regions)
-#define iQtty_set_up_initial_frame_faces 1557
+#define iQtty_set_up_initial_frame_faces 1566
 DEFINE_LISP_SYMBOL (Qtty_set_up_initial_frame_faces)
-#define iQtty_type 1558
+#define iQtty_type 1567
 DEFINE_LISP_SYMBOL (Qtty_type)
-#define iQtype_mismatch 1559
+#define iQtype_mismatch 1568
 DEFINE_LISP_SYMBOL (Qtype_mismatch)
-#define iQultra_bold 1560
+#define iQultra_bold 1569
 DEFINE_LISP_SYMBOL (Qultra_bold)
-#define iQultra_heavy 1561
+#define iQultra_heavy 1570
 DEFINE_LISP_SYMBOL (Qultra_heavy)
-#define iQultra_light 1562
+#define iQultra_light 1571
 DEFINE_LISP_SYMBOL (Qultra_light)
-#define iQundecided 1563
+#define iQundecided 1572
 DEFINE_LISP_SYMBOL (Qundecided)
-#define iQundecorated 1564
+#define iQundecorated 1573
 DEFINE_LISP_SYMBOL (Qundecorated)
-#define iQundefined 1565
+#define iQundefined 1574
 DEFINE_LISP_SYMBOL (Qundefined)
-#define iQundeleted 1566
+#define iQundeleted 1575
 DEFINE_LISP_SYMBOL (Qundeleted)
-#define iQunderflow_error 1567
+#define iQunderflow_error 1576
 DEFINE_LISP_SYMBOL (Qunderflow_error)
-#define iQunderline_minimum_offset 1568
+#define iQunderline_minimum_offset 1577
 DEFINE_LISP_SYMBOL (Qunderline_minimum_offset)
-#define iQundo_auto__add_boundary 1569
+#define iQundo_auto__add_boundary 1578
 DEFINE_LISP_SYMBOL (Qundo_auto__add_boundary)
-#define iQundo_auto__last_boundary_cause 1570
+#define iQundo_auto__last_boundary_cause 1579
 DEFINE_LISP_SYMBOL (Qundo_auto__last_boundary_cause)
-#define iQundo_auto__this_command_amalgamating 1571
+#define iQundo_auto__this_command_amalgamating 1580
 DEFINE_LISP_SYMBOL (Qundo_auto__this_command_amalgamating)
-#define iQundo_auto__undoable_change 1572
+#define iQundo_auto__undoable_change 1581
 DEFINE_LISP_SYMBOL (Qundo_auto__undoable_change)
-#define iQundo_auto__undoably_changed_buffers 1573
+#define iQundo_auto__undoably_changed_buffers 1582
 DEFINE_LISP_SYMBOL (Qundo_auto__undoably_changed_buffers)
-#define iQundo_auto_amalgamate 1574
+#define iQundo_auto_amalgamate 1583
 DEFINE_LISP_SYMBOL (Qundo_auto_amalgamate)
-#define iQunevalled 1575
+#define iQunevalled 1584
 DEFINE_LISP_SYMBOL (Qunevalled)
-#define iQunhandled_file_name_directory 1576
+#define iQunhandled_file_name_directory 1585
 DEFINE_LISP_SYMBOL (Qunhandled_file_name_directory)
-#define iQunicode 1577
+#define iQunicode 1586
 DEFINE_LISP_SYMBOL (Qunicode)
-#define iQunicode_bmp 1578
+#define iQunicode_bmp 1587
 DEFINE_LISP_SYMBOL (Qunicode_bmp)
-#define iQunicode_string_p 1579
+#define iQunicode_string_p 1588
 DEFINE_LISP_SYMBOL (Qunicode_string_p)
-#define iQuniquify__rename_buffer_advice 1580
+#define iQuniquify__rename_buffer_advice 1589
 DEFINE_LISP_SYMBOL (Quniquify__rename_buffer_advice)
-#define iQunix 1581
+#define iQunix 1590
 DEFINE_LISP_SYMBOL (Qunix)
-#define iQunlet 1582
+#define iQunlet 1591
 DEFINE_LISP_SYMBOL (Qunlet)
-#define iQunlock_file 1583
+#define iQunlock_file 1592
 DEFINE_LISP_SYMBOL (Qunlock_file)
-#define iQunreachable 1584
+#define iQunreachable 1593
 DEFINE_LISP_SYMBOL (Qunreachable)
-#define iQunspecified 1585
+#define iQunspecified 1594
 DEFINE_LISP_SYMBOL (Qunspecified)
-#define iQunsplittable 1586
+#define iQunsplittable 1595
 DEFINE_LISP_SYMBOL (Qunsplittable)
-#define iQup 1587
+#define iQup 1596
 DEFINE_LISP_SYMBOL (Qup)
-#define iQuppercase 1588
+#define iQuppercase 1597
 DEFINE_LISP_SYMBOL (Quppercase)
-#define iQurl 1589
+#define iQurl 1598
 DEFINE_LISP_SYMBOL (Qurl)
-#define iQus_ascii 1590
+#define iQus_ascii 1599
 DEFINE_LISP_SYMBOL (Qus_ascii)
-#define iQuse_frame_synchronization 1591
+#define iQuse_frame_synchronization 1600
 DEFINE_LISP_SYMBOL (Quse_frame_synchronization)
-#define iQuse_region_p 1592
+#define iQuse_region_p 1601
 DEFINE_LISP_SYMBOL (Quse_region_p)
-#define iQuser 1593
+#define iQuser 1602
 DEFINE_LISP_SYMBOL (Quser)
-#define iQuser_emacs_directory 1594
+#define iQuser_emacs_directory 1603
 DEFINE_LISP_SYMBOL (Quser_emacs_directory)
-#define iQuser_error 1595
+#define iQuser_error 1604
 DEFINE_LISP_SYMBOL (Quser_error)
-#define iQuser_position 1596
+#define iQuser_position 1605
 DEFINE_LISP_SYMBOL (Quser_position)
-#define iQuser_ptr 1597
+#define iQuser_ptr 1606
 DEFINE_LISP_SYMBOL (Quser_ptr)
-#define iQuser_ptrp 1598
+#define iQuser_ptrp 1607
 DEFINE_LISP_SYMBOL (Quser_ptrp)
-#define iQuser_search_failed 1599
+#define iQuser_search_failed 1608
 DEFINE_LISP_SYMBOL (Quser_search_failed)
-#define iQuser_size 1600
+#define iQuser_size 1609
 DEFINE_LISP_SYMBOL (Quser_size)
-#define iQuserlock__ask_user_about_supersession_threat 1601
+#define iQuserlock__ask_user_about_supersession_threat 1610
 DEFINE_LISP_SYMBOL (Quserlock__ask_user_about_supersession_threat)
-#define iQuserlock__handle_unlock_error 1602
+#define iQuserlock__handle_unlock_error 1611
 DEFINE_LISP_SYMBOL (Quserlock__handle_unlock_error)
-#define iQutf_16 1603
+#define iQutf_16 1612
 DEFINE_LISP_SYMBOL (Qutf_16)
-#define iQutf_16le 1604
+#define iQutf_16le 1613
 DEFINE_LISP_SYMBOL (Qutf_16le)
-#define iQutf_8 1605
+#define iQutf_8 1614
 DEFINE_LISP_SYMBOL (Qutf_8)
-#define iQutf_8_emacs 1606
+#define iQutf_8_emacs 1615
 DEFINE_LISP_SYMBOL (Qutf_8_emacs)
-#define iQutf_8_string_p 1607
+#define iQutf_8_string_p 1616
 DEFINE_LISP_SYMBOL (Qutf_8_string_p)
-#define iQutf_8_unix 1608
+#define iQutf_8_unix 1617
 DEFINE_LISP_SYMBOL (Qutf_8_unix)
-#define iQutime 1609
+#define iQutime 1618
 DEFINE_LISP_SYMBOL (Qutime)
-#define iQvalue 1610
+#define iQvalue 1619
 DEFINE_LISP_SYMBOL (Qvalue)
-#define iQvaluelt 1611
+#define iQvaluelt 1620
 DEFINE_LISP_SYMBOL (Qvaluelt)
-#define iQvariable_documentation 1612
+#define iQvariable_documentation 1621
 DEFINE_LISP_SYMBOL (Qvariable_documentation)
-#define iQvdrag 1613
+#define iQvdrag 1622
 DEFINE_LISP_SYMBOL (Qvdrag)
-#define iQvector 1614
+#define iQvector 1623
 DEFINE_LISP_SYMBOL (Qvector)
-#define iQvector_or_char_table_p 1615
+#define iQvector_or_char_table_p 1624
 DEFINE_LISP_SYMBOL (Qvector_or_char_table_p)
-#define iQvector_slots 1616
+#define iQvector_slots 1625
 DEFINE_LISP_SYMBOL (Qvector_slots)
-#define iQvectorp 1617
+#define iQvectorp 1626
 DEFINE_LISP_SYMBOL (Qvectorp)
-#define iQvectors 1618
+#define iQvectors 1627
 DEFINE_LISP_SYMBOL (Qvectors)
-#define iQverify_visited_file_modtime 1619
+#define iQverify_visited_file_modtime 1628
 DEFINE_LISP_SYMBOL (Qverify_visited_file_modtime)
-#define iQvertical_border 1620
+#define iQvertical_border 1629
 DEFINE_LISP_SYMBOL (Qvertical_border)
-#define iQvertical_line 1621
+#define iQvertical_line 1630
 DEFINE_LISP_SYMBOL (Qvertical_line)
-#define iQvertical_scroll_bar 1622
+#define iQvertical_scroll_bar 1631
 DEFINE_LISP_SYMBOL (Qvertical_scroll_bar)
-#define iQvertical_scroll_bars 1623
+#define iQvertical_scroll_bars 1632
 DEFINE_LISP_SYMBOL (Qvertical_scroll_bars)
-#define iQvisibility 1624
+#define iQvisibility 1633
 DEFINE_LISP_SYMBOL (Qvisibility)
-#define iQvisible 1625
+#define iQvisible 1634
 DEFINE_LISP_SYMBOL (Qvisible)
-#define iQvisual 1626
+#define iQvisual 1635
 DEFINE_LISP_SYMBOL (Qvisual)
-#define iQvoid_function 1627
+#define iQvoid_function 1636
 DEFINE_LISP_SYMBOL (Qvoid_function)
-#define iQvoid_variable 1628
+#define iQvoid_variable 1637
 DEFINE_LISP_SYMBOL (Qvoid_variable)
-#define iQvsize 1629
+#define iQvsize 1638
 DEFINE_LISP_SYMBOL (Qvsize)
-#define iQw32 1630
+#define iQw32 1639
 DEFINE_LISP_SYMBOL (Qw32)
-#define iQwait_for_wm 1631
+#define iQwait_for_wm 1640
 DEFINE_LISP_SYMBOL (Qwait_for_wm)
-#define iQwall 1632
+#define iQwall 1641
 DEFINE_LISP_SYMBOL (Qwall)
-#define iQwatchers 1633
+#define iQwatchers 1642
 DEFINE_LISP_SYMBOL (Qwatchers)
-#define iQwave 1634
+#define iQwave 1643
 DEFINE_LISP_SYMBOL (Qwave)
-#define iQweakness 1635
+#define iQweakness 1644
 DEFINE_LISP_SYMBOL (Qweakness)
-#define iQwebp 1636
+#define iQwebp 1645
 DEFINE_LISP_SYMBOL (Qwebp)
-#define iQwebpdemux 1637
+#define iQwebpdemux 1646
 DEFINE_LISP_SYMBOL (Qwebpdemux)
-#define iQwhen 1638
+#define iQwhen 1647
 DEFINE_LISP_SYMBOL (Qwhen)
-#define iQwholenump 1639
+#define iQwholenump 1648
 DEFINE_LISP_SYMBOL (Qwholenump)
-#define iQwidget_type 1640
+#define iQwidget_type 1649
 DEFINE_LISP_SYMBOL (Qwidget_type)
-#define iQwidth 1641
+#define iQwidth 1650
 DEFINE_LISP_SYMBOL (Qwidth)
-#define iQwidth_only 1642
+#define iQwidth_only 1651
 DEFINE_LISP_SYMBOL (Qwidth_only)
-#define iQwindow 1643
+#define iQwindow 1652
 DEFINE_LISP_SYMBOL (Qwindow)
-#define iQwindow__pixel_to_total 1644
+#define iQwindow__pixel_to_total 1653
 DEFINE_LISP_SYMBOL (Qwindow__pixel_to_total)
-#define iQwindow__resize_mini_frame 1645
+#define iQwindow__resize_mini_frame 1654
 DEFINE_LISP_SYMBOL (Qwindow__resize_mini_frame)
-#define iQwindow__resize_root_window 1646
+#define iQwindow__resize_root_window 1655
 DEFINE_LISP_SYMBOL (Qwindow__resize_root_window)
-#define iQwindow__resize_root_window_vertically 1647
+#define iQwindow__resize_root_window_vertically 1656
 DEFINE_LISP_SYMBOL (Qwindow__resize_root_window_vertically)
-#define iQwindow_buffer_change_functions 1648
+#define iQwindow_buffer_change_functions 1657
 DEFINE_LISP_SYMBOL (Qwindow_buffer_change_functions)
-#define iQwindow_configuration 1649
+#define iQwindow_configuration 1658
 DEFINE_LISP_SYMBOL (Qwindow_configuration)
-#define iQwindow_configuration_change_hook 1650
+#define iQwindow_configuration_change_hook 1659
 DEFINE_LISP_SYMBOL (Qwindow_configuration_change_hook)
-#define iQwindow_configuration_p 1651
+#define iQwindow_configuration_p 1660
 DEFINE_LISP_SYMBOL (Qwindow_configuration_p)
-#define iQwindow_deletable_p 1652
+#define iQwindow_deletable_p 1661
 DEFINE_LISP_SYMBOL (Qwindow_deletable_p)
-#define iQwindow_divider 1653
+#define iQwindow_divider 1662
 DEFINE_LISP_SYMBOL (Qwindow_divider)
-#define iQwindow_divider_first_pixel 1654
+#define iQwindow_divider_first_pixel 1663
 DEFINE_LISP_SYMBOL (Qwindow_divider_first_pixel)
-#define iQwindow_divider_last_pixel 1655
+#define iQwindow_divider_last_pixel 1664
 DEFINE_LISP_SYMBOL (Qwindow_divider_last_pixel)
-#define iQwindow_edges 1656
+#define iQwindow_edges 1665
 DEFINE_LISP_SYMBOL (Qwindow_edges)
-#define iQwindow_id 1657
+#define iQwindow_id 1666
 DEFINE_LISP_SYMBOL (Qwindow_id)
-#define iQwindow_live_p 1658
+#define iQwindow_live_p 1667
 DEFINE_LISP_SYMBOL (Qwindow_live_p)
-#define iQwindow_point_insertion_type 1659
+#define iQwindow_point_insertion_type 1668
 DEFINE_LISP_SYMBOL (Qwindow_point_insertion_type)
-#define iQwindow_scroll_functions 1660
+#define iQwindow_scroll_functions 1669
 DEFINE_LISP_SYMBOL (Qwindow_scroll_functions)
-#define iQwindow_selection_change_functions 1661
+#define iQwindow_selection_change_functions 1670
 DEFINE_LISP_SYMBOL (Qwindow_selection_change_functions)
-#define iQwindow_size 1662
+#define iQwindow_size 1671
 DEFINE_LISP_SYMBOL (Qwindow_size)
-#define iQwindow_size_change_functions 1663
+#define iQwindow_size_change_functions 1672
 DEFINE_LISP_SYMBOL (Qwindow_size_change_functions)
-#define iQwindow_state_change_functions 1664
+#define iQwindow_state_change_functions 1673
 DEFINE_LISP_SYMBOL (Qwindow_state_change_functions)
-#define iQwindow_state_change_hook 1665
+#define iQwindow_state_change_hook 1674
 DEFINE_LISP_SYMBOL (Qwindow_state_change_hook)
-#define iQwindow_valid_p 1666
+#define iQwindow_valid_p 1675
 DEFINE_LISP_SYMBOL (Qwindow_valid_p)
-#define iQwindowp 1667
+#define iQwindowp 1676
 DEFINE_LISP_SYMBOL (Qwindowp)
-#define iQworkarea 1668
+#define iQworkarea 1677
 DEFINE_LISP_SYMBOL (Qworkarea)
-#define iQwrap_prefix 1669
+#define iQwrap_prefix 1678
 DEFINE_LISP_SYMBOL (Qwrap_prefix)
-#define iQwrite 1670
+#define iQwrite 1679
 DEFINE_LISP_SYMBOL (Qwrite)
-#define iQwrite_region 1671
+#define iQwrite_region 1680
 DEFINE_LISP_SYMBOL (Qwrite_region)
-#define iQwrite_region_annotate_functions 1672
+#define iQwrite_region_annotate_functions 1681
 DEFINE_LISP_SYMBOL (Qwrite_region_annotate_functions)
-#define iQwrong_length_argument 1673
+#define iQwrong_length_argument 1682
 DEFINE_LISP_SYMBOL (Qwrong_length_argument)
-#define iQwrong_number_of_arguments 1674
+#define iQwrong_number_of_arguments 1683
 DEFINE_LISP_SYMBOL (Qwrong_number_of_arguments)
-#define iQwrong_register_subr_call 1675
+#define iQwrong_register_subr_call 1684
 DEFINE_LISP_SYMBOL (Qwrong_register_subr_call)
-#define iQwrong_type_argument 1676
+#define iQwrong_type_argument 1685
 DEFINE_LISP_SYMBOL (Qwrong_type_argument)
-#define iQx 1677
+#define iQx 1686
 DEFINE_LISP_SYMBOL (Qx)
-#define iQx_create_frame_1 1678
+#define iQx_create_frame_1 1687
 DEFINE_LISP_SYMBOL (Qx_create_frame_1)
-#define iQx_create_frame_2 1679
+#define iQx_create_frame_2 1688
 DEFINE_LISP_SYMBOL (Qx_create_frame_2)
-#define iQx_frame_parameter 1680
+#define iQx_frame_parameter 1689
 DEFINE_LISP_SYMBOL (Qx_frame_parameter)
-#define iQx_hide_tip 1681
+#define iQx_hide_tip 1690
 DEFINE_LISP_SYMBOL (Qx_hide_tip)
-#define iQx_pre_popup_menu_hook 1682
+#define iQx_pre_popup_menu_hook 1691
 DEFINE_LISP_SYMBOL (Qx_pre_popup_menu_hook)
-#define iQx_resource_name 1683
+#define iQx_resource_name 1692
 DEFINE_LISP_SYMBOL (Qx_resource_name)
-#define iQx_set_menu_bar_lines 1684
+#define iQx_set_menu_bar_lines 1693
 DEFINE_LISP_SYMBOL (Qx_set_menu_bar_lines)
-#define iQx_set_window_size_1 1685
+#define iQx_set_window_size_1 1694
 DEFINE_LISP_SYMBOL (Qx_set_window_size_1)
-#define iQx_underline_at_descent_line 1686
+#define iQx_underline_at_descent_line 1695
 DEFINE_LISP_SYMBOL (Qx_underline_at_descent_line)
-#define iQx_use_underline_position_properties 1687
+#define iQx_use_underline_position_properties 1696
 DEFINE_LISP_SYMBOL (Qx_use_underline_position_properties)
-#define iQxbm 1688
+#define iQxbm 1697
 DEFINE_LISP_SYMBOL (Qxbm)
-#define iQxg_frame_set_char_size 1689
+#define iQxg_frame_set_char_size 1698
 DEFINE_LISP_SYMBOL (Qxg_frame_set_char_size)
-#define iQxpm 1690
+#define iQxpm 1699
 DEFINE_LISP_SYMBOL (Qxpm)
-#define iQxterm__set_selection 1691
+#define iQxterm__set_selection 1700
 DEFINE_LISP_SYMBOL (Qxterm__set_selection)
-#define iQxwidget 1692
+#define iQxwidget 1701
 DEFINE_LISP_SYMBOL (Qxwidget)
-#define iQxwidget_display_event 1693
+#define iQxwidget_display_event 1702
 DEFINE_LISP_SYMBOL (Qxwidget_display_event)
-#define iQxwidget_event 1694
+#define iQxwidget_event 1703
 DEFINE_LISP_SYMBOL (Qxwidget_event)
-#define iQxwidget_view 1695
+#define iQxwidget_view 1704
 DEFINE_LISP_SYMBOL (Qxwidget_view)
-#define iQy_or_n_p 1696
+#define iQy_or_n_p 1705
 DEFINE_LISP_SYMBOL (Qy_or_n_p)
-#define iQyes_or_no_p 1697
+#define iQyes_or_no_p 1706
 DEFINE_LISP_SYMBOL (Qyes_or_no_p)
-#define iQyes_or_no_p_history 1698
+#define iQyes_or_no_p_history 1707
 DEFINE_LISP_SYMBOL (Qyes_or_no_p_history)
-#define iQz_group 1699
+#define iQz_group 1708
 DEFINE_LISP_SYMBOL (Qz_group)
-#define iQzero_width 1700
+#define iQzero_width 1709
 DEFINE_LISP_SYMBOL (Qzero_width)
 EXFUN (Fabort_minibuffers, 0);
 _Noreturn EXFUN (Fabort_recursive_edit, 0) ATTRIBUTE_COLD;
@@ -4797,7 +4821,7 @@ EXFUN (Fbuffer_base_buffer, 1);
 EXFUN (Fbuffer_chars_modified_tick, 1);
 EXFUN (Fbuffer_enable_undo, 1);
 EXFUN (Fbuffer_file_name, 1);
-EXFUN (Fbuffer_hash, 1);
+EXFUN (Fbuffer_hash, 2);
 EXFUN (Fbuffer_last_name, 1);
 EXFUN (Fbuffer_line_statistics, 1);
 EXFUN (Fbuffer_list, 1);
@@ -4844,6 +4868,12 @@ EXFUN (Fccl_program_p, 1);
 EXFUN (Fcdr, 1);
 EXFUN (Fcdr_safe, 1);
 EXFUN (Fceiling, 2);
+EXFUN (Fchannel_length, 1);
+EXFUN (Fchannel_name, 1);
+EXFUN (Fchannel_receive, 1);
+EXFUN (Fchannel_send, 2);
+EXFUN (Fchannel_try_receive, 2);
+EXFUN (Fchannelp, 1);
 EXFUN (Fchar_after, 1);
 EXFUN (Fchar_before, 1);
 EXFUN (Fchar_category_set, 1);
@@ -5027,9 +5057,10 @@ EXFUN (Fdowncase_region, 3);
 EXFUN (Fdowncase_word, 1);
 EXFUN (Fdraw_string, 2);
 EXFUN (Fdump_colors, 0);
-EXFUN (Fdump_emacs_portable, 2);
+EXFUN (Fdump_emacs_portable, 3);
 EXFUN (Fdump_emacs_portable__sort_predicate, 2);
 EXFUN (Fdump_emacs_portable__sort_predicate_copied, 2);
+EXFUN (Fdump_emacs_snapshot, 2);
 EXFUN (Fdump_face, 1);
 EXFUN (Fdump_frame_glyph_matrix, 0);
 EXFUN (Fdump_glyph_matrix, 1);
@@ -5305,6 +5336,7 @@ EXFUN (Finternal__hash_table_index_size, 1);
 EXFUN (Finternal__labeled_narrow_to_region, 3);
 EXFUN (Finternal__labeled_widen, 1);
 EXFUN (Finternal__obarray_buckets, 1);
+EXFUN (Finternal__obarray_stats, 1);
 EXFUN (Finternal__set_buffer_modified_tick, 2);
 EXFUN (Finternal_char_font, 2);
 EXFUN (Finternal_complete_buffer, 3);
@@ -5393,6 +5425,7 @@ EXFUN (Flist_system_processes, 0);
 EXFUN (Flistp, 1) ATTRIBUTE_CONST;
 EXFUN (Fload, 5);
 EXFUN (Fload_average, 1);
+EXFUN (Fload_files, 2);
 EXFUN (Flocal_variable_if_set_p, 2);
 EXFUN (Flocal_variable_p, 2);
 EXFUN (Flocale_info, 1);
@@ -5420,6 +5453,7 @@ EXFUN (Fmake_bool_vector, 2);
 EXFUN (Fmake_byte_code, MANY);
 EXFUN (Fmake_category_set, 1);
 EXFUN (Fmake_category_table, 0);
+EXFUN (Fmake_channel, 2);
 EXFUN (Fmake_char, 5);
 EXFUN (Fmake_char_table, 2);
 EXFUN (Fmake_closure, MANY);
@@ -5615,6 +5649,7 @@ EXFUN (Foverlayp, 1);
 EXFUN (Foverlays_at, 2);
 EXFUN (Foverlays_in, 2);
 EXFUN (Fparse_partial_sexp, 6);
+EXFUN (Fpdumper_page_trace, 0);
 EXFUN (Fpdumper_stats, 0);
 EXFUN (Fplay_sound_internal, 1);
 EXFUN (Fplist_get, 3);
@@ -5734,6 +5769,7 @@ EXFUN (Frecursive_edit, 0);
 EXFUN (Fredirect_debugging_output, 2);
 EXFUN (Fredirect_frame_focus, 2);
 EXFUN (Fredisplay, 1);
+EXFUN (Fredisplay_frame_statistics, 1);
 EXFUN (Fredraw_display, 0);
 EXFUN (Fredraw_frame, 1);
 EXFUN (Fregexp_quote, 1);
@@ -5927,6 +5963,7 @@ EXFUN (Fstring_bytes, 1);
 EXFUN (Fstring_collate_equalp, 4);
 EXFUN (Fstring_collate_lessp, 4);
 EXFUN (Fstring_distance, 3);
+EXFUN (Fstring_distances, 3);
 EXFUN (Fstring_equal, 2);
 EXFUN (Fstring_lessp, 2);
 EXFUN (Fstring_make_multibyte, 1);
@@ -6094,6 +6131,8 @@ EXFUN (Ftty_top_frame, 1);
 EXFUN (Ftty_type, 1);
 EXFUN (Ftype_of, 1);
 EXFUN (Funcombine_window, 1);
+EXFUN (Fundo__needs_boundary_p, 0);
+EXFUN (Fundo__pop_boundary, 0);
 EXFUN (Fundo_boundary, 0);
 EXFUN (Funencodable_char_position, 5);
 EXFUN (Funhandled_file_name_directory, 1);
@@ -6207,6 +6246,7 @@ EXFUN (Fwindow_valid_p, 1);
 EXFUN (Fwindow_vscroll, 2);
 EXFUN (Fwindowp, 1);
 EXFUN (Fwrite_char, 2);
+EXFUN (Fwrite_elb_file, 1);
 EXFUN (Fwrite_region, 7);
 EXFUN (Fx_close_connection, 1);
 EXFUN (Fx_create_frame, 1);
@@ -6285,6 +6325,7 @@ static char const *const defsym_name[] = {
 	":cipher-ivsize",
 	":cipher-keysize",
 	":cipher-tagsize",
+	":coalesced",
 	":coding",
 	":col",
 	":color",
@@ -6303,6 +6344,7 @@ static char const *const defsym_name[] = {
 	":debug-on-exit",
 	":decode-translation-table",
 	":default-char",
+	":deferred-for-input",
 	":destination",
 	":device",
 	":diffie-hellman-prime-bits",
@@ -6337,6 +6379,7 @@ static char const *const defsym_name[] = {
 	":foreground",
 	":format",
 	":foundry",
+	":frames",
 	":function",
 	":height",
 	":help",
@@ -6382,6 +6425,7 @@ static char const *const defsym_name[] = {
 	":match?",
 	":matrix",
 	":max-height",
+	":max-time",
 	":max-width",
 	":min-prime-bits",
 	":minspace",
@@ -6469,6 +6513,7 @@ static char const *const defsym_name[] = {
 	":test",
 	":tls-parameters",
 	":toggle",
+	":total-time",
 	":transform-smoothing",
 	":trustfiles",
 	":type",
@@ -6652,6 +6697,8 @@ static char const *const defsym_name[] = {
 	"ch",
 	"change_frame_size",
 	"change-major-mode-hook",
+	"channel",
+	"channelp",
 	"char-code-property-table",
 	"char-from-name",
 	"char-or-string-p",
@@ -7252,6 +7299,8 @@ static char const *const defsym_name[] = {
 	"load-file-name",
 	"load-force-doc-strings",
 	"load-in-progress",
+	"load-phases",
+	"load-threads",
 	"load-time",
 	"load-true-file-name",
 	"local",
@@ -7989,1665 +8038,1674 @@ static char const *const defsym_name[] = {
 # define QCcipher_ivsize builtin_lisp_symbol (37)
 # define QCcipher_keysize builtin_lisp_symbol (38)
 # define QCcipher_tagsize builtin_lisp_symbol (39)
-# define QCcoding builtin_lisp_symbol (40)
-# define QCcol builtin_lisp_symbol (41)
-# define QCcolor builtin_lisp_symbol (42)
-# define QCcolor_adjustment builtin_lisp_symbol (43)
-# define QCcolor_symbols builtin_lisp_symbol (44)
-# define QCcombining_capability builtin_lisp_symbol (45)
-# define QCcommand builtin_lisp_symbol (46)
-# define QCcomplete_negotiation builtin_lisp_symbol (47)
-# define QCcompression builtin_lisp_symbol (48)
-# define QCconnection_type builtin_lisp_symbol (49)
-# define QCconversion builtin_lisp_symbol (50)
-# define QCcrlfiles builtin_lisp_symbol (51)
-# define QCcrop builtin_lisp_symbol (52)
-# define QCcss builtin_lisp_symbol (53)
-# define QCdata builtin_lisp_symbol (54)
-# define QCdebug_on_exit builtin_lisp_symbol (55)
-# define QCdecode_translation_table builtin_lisp_symbol (56)
-# define QCdefault_char builtin_lisp_symbol (57)
-# define QCdestination builtin_lisp_symbol (58)
-# define QCdevice builtin_lisp_symbol (59)
-# define QCdiffie_hellman_prime_bits builtin_lisp_symbol (60)
-# define QCdigest_algorithm_id builtin_lisp_symbol (61)
-# define QCdigest_algorithm_length builtin_lisp_symbol (62)
-# define QCdistant_foreground builtin_lisp_symbol (63)
-# define QCdocumentation builtin_lisp_symbol (64)
-# define QCdpi builtin_lisp_symbol (65)
-# define QCemergency builtin_lisp_symbol (66)
-# define QCenable builtin_lisp_symbol (67)
-# define QCencode_translation_table builtin_lisp_symbol (68)
-# define QCencrypt_then_mac builtin_lisp_symbol (69)
-# define QCeq_q builtin_lisp_symbol (70)
-# define QCequal builtin_lisp_symbol (71)
-# define QCerror builtin_lisp_symbol (72)
-# define QCeval builtin_lisp_symbol (73)
-# define QCexpired builtin_lisp_symbol (74)
-# define QCextend builtin_lisp_symbol (75)
-# define QCfalse builtin_lisp_symbol (76)
-# define QCfalse_object builtin_lisp_symbol (77)
-# define QCfamily builtin_lisp_symbol (78)
-# define QCfile builtin_lisp_symbol (79)
-# define QCfile_handler builtin_lisp_symbol (80)
-# define QCfilter builtin_lisp_symbol (81)
-# define QCfiltered builtin_lisp_symbol (82)
-# define QCflags builtin_lisp_symbol (83)
-# define QCflip builtin_lisp_symbol (84)
-# define QCflowcontrol builtin_lisp_symbol (85)
-# define QCfont builtin_lisp_symbol (86)
-# define QCfont_entity builtin_lisp_symbol (87)
-# define QCfontset builtin_lisp_symbol (88)
-# define QCforeground builtin_lisp_symbol (89)
-# define QCformat builtin_lisp_symbol (90)
-# define QCfoundry builtin_lisp_symbol (91)
-# define QCfunction builtin_lisp_symbol (92)
-# define QCheight builtin_lisp_symbol (93)
-# define QChelp builtin_lisp_symbol (94)
-# define QCheuristic_mask builtin_lisp_symbol (95)
-# define QChost builtin_lisp_symbol (96)
-# define QChostname builtin_lisp_symbol (97)
-# define QCignore_defface builtin_lisp_symbol (98)
-# define QCimage builtin_lisp_symbol (99)
-# define QCin_place builtin_lisp_symbol (100)
-# define QCindex builtin_lisp_symbol (101)
-# define QCinherit builtin_lisp_symbol (102)
-# define QCinsecure builtin_lisp_symbol (103)
-# define QCinvalid builtin_lisp_symbol (104)
-# define QCinvalid_ocsp_status builtin_lisp_symbol (105)
-# define QCinverse_video builtin_lisp_symbol (106)
-# define QCissuer builtin_lisp_symbol (107)
-# define QCissuer_unique_id builtin_lisp_symbol (108)
-# define QCitalic builtin_lisp_symbol (109)
-# define QCkey builtin_lisp_symbol (110)
-# define QCkey_exchange builtin_lisp_symbol (111)
-# define QCkey_sequence builtin_lisp_symbol (112)
-# define QCkeylist builtin_lisp_symbol (113)
-# define QCkeys builtin_lisp_symbol (114)
-# define QClabel builtin_lisp_symbol (115)
-# define QClang builtin_lisp_symbol (116)
-# define QClessp builtin_lisp_symbol (117)
-# define QClientHello_Padding builtin_lisp_symbol (118)
-# define QCline builtin_lisp_symbol (119)
-# define QCline_width builtin_lisp_symbol (120)
-# define QCloader builtin_lisp_symbol (121)
-# define QClocal builtin_lisp_symbol (122)
-# define QClog builtin_lisp_symbol (123)
-# define QCloglevel builtin_lisp_symbol (124)
-# define QCmac builtin_lisp_symbol (125)
-# define QCmac_algorithm_id builtin_lisp_symbol (126)
-# define QCmac_algorithm_keysize builtin_lisp_symbol (127)
-# define QCmac_algorithm_length builtin_lisp_symbol (128)
-# define QCmac_algorithm_noncesize builtin_lisp_symbol (129)
-# define QCmap builtin_lisp_symbol (130)
-# define QCmargin builtin_lisp_symbol (131)
-# define QCmask builtin_lisp_symbol (132)
-# define QCmatch builtin_lisp_symbol (133)
-# define QCmatch_q builtin_lisp_symbol (134)
-# define QCmatrix builtin_lisp_symbol (135)
-# define QCmax_height builtin_lisp_symbol (136)
-# define QCmax_width builtin_lisp_symbol (137)
-# define QCmin_prime_bits builtin_lisp_symbol (138)
-# define QCminspace builtin_lisp_symbol (139)
-# define QCmissing_ocsp_status builtin_lisp_symbol (140)
-# define QCmnemonic builtin_lisp_symbol (141)
-# define QCmouse builtin_lisp_symbol (142)
-# define QCname builtin_lisp_symbol (143)
-# define QCno_host_match builtin_lisp_symbol (144)
-# define QCnoquery builtin_lisp_symbol (145)
-# define QCnot_activated builtin_lisp_symbol (146)
-# define QCnot_ca builtin_lisp_symbol (147)
-# define QCnowait builtin_lisp_symbol (148)
-# define QCnull builtin_lisp_symbol (149)
-# define QCnull_object builtin_lisp_symbol (150)
-# define QCobject_type builtin_lisp_symbol (151)
-# define QCordinary builtin_lisp_symbol (152)
-# define QCotf builtin_lisp_symbol (153)
-# define QCoverline builtin_lisp_symbol (154)
-# define QCparity builtin_lisp_symbol (155)
-# define QCpass builtin_lisp_symbol (156)
-# define QCpem builtin_lisp_symbol (157)
-# define QCplist builtin_lisp_symbol (158)
-# define QCplus builtin_lisp_symbol (159)
-# define QCpointer builtin_lisp_symbol (160)
-# define QCport builtin_lisp_symbol (161)
-# define QCpos builtin_lisp_symbol (162)
-# define QCposition builtin_lisp_symbol (163)
-# define QCpost_read_conversion builtin_lisp_symbol (164)
-# define QCpre_write_conversion builtin_lisp_symbol (165)
-# define QCpred builtin_lisp_symbol (166)
-# define QCpred_q builtin_lisp_symbol (167)
-# define QCpriority builtin_lisp_symbol (168)
-# define QCprocess builtin_lisp_symbol (169)
-# define QCpropertize builtin_lisp_symbol (170)
-# define QCprotocol builtin_lisp_symbol (171)
-# define QCpt_height builtin_lisp_symbol (172)
-# define QCpt_width builtin_lisp_symbol (173)
-# define QCpublic_key_algorithm builtin_lisp_symbol (174)
-# define QCpublic_key_id builtin_lisp_symbol (175)
-# define QCpublic_key_id_sha256 builtin_lisp_symbol (176)
-# define QCpurecopy builtin_lisp_symbol (177)
-# define QCpurpose_mismatch builtin_lisp_symbol (178)
-# define QCquestion builtin_lisp_symbol (179)
-# define QCradio builtin_lisp_symbol (180)
-# define QCregistry builtin_lisp_symbol (181)
-# define QCrehash_size builtin_lisp_symbol (182)
-# define QCrehash_threshold builtin_lisp_symbol (183)
-# define QCrelative_height builtin_lisp_symbol (184)
-# define QCrelative_width builtin_lisp_symbol (185)
-# define QCrelief builtin_lisp_symbol (186)
-# define QCremote builtin_lisp_symbol (187)
-# define QCreverse builtin_lisp_symbol (188)
-# define QCrevocation_data_issued_in_future builtin_lisp_symbol (189)
-# define QCrevocation_data_superseded builtin_lisp_symbol (190)
-# define QCrevoked builtin_lisp_symbol (191)
-# define QCrotation builtin_lisp_symbol (192)
-# define QCrtl builtin_lisp_symbol (193)
-# define QCsafe_renegotiation builtin_lisp_symbol (194)
-# define QCscalable builtin_lisp_symbol (195)
-# define QCscale builtin_lisp_symbol (196)
-# define QCscript builtin_lisp_symbol (197)
-# define QCself_signed builtin_lisp_symbol (198)
-# define QCsentinel builtin_lisp_symbol (199)
-# define QCserial_number builtin_lisp_symbol (200)
-# define QCserver builtin_lisp_symbol (201)
-# define QCservice builtin_lisp_symbol (202)
-# define QCsignature_algorithm builtin_lisp_symbol (203)
-# define QCsignature_failure builtin_lisp_symbol (204)
-# define QCsigner_constraints_failure builtin_lisp_symbol (205)
-# define QCsize builtin_lisp_symbol (206)
-# define QCslant builtin_lisp_symbol (207)
-# define QCspacing builtin_lisp_symbol (208)
-# define QCspeed builtin_lisp_symbol (209)
-# define QCstar builtin_lisp_symbol (210)
-# define QCstderr builtin_lisp_symbol (211)
-# define QCstipple builtin_lisp_symbol (212)
-# define QCstop builtin_lisp_symbol (213)
-# define QCstopbits builtin_lisp_symbol (214)
-# define QCstrike_through builtin_lisp_symbol (215)
-# define QCstyle builtin_lisp_symbol (216)
-# define QCsubject builtin_lisp_symbol (217)
-# define QCsubject_unique_id builtin_lisp_symbol (218)
-# define QCsuccess builtin_lisp_symbol (219)
-# define QCsummary builtin_lisp_symbol (220)
-# define QCtest builtin_lisp_symbol (221)
-# define QCtls_parameters builtin_lisp_symbol (222)
-# define QCtoggle builtin_lisp_symbol (223)
-# define QCtransform_smoothing builtin_lisp_symbol (224)
-# define QCtrustfiles builtin_lisp_symbol (225)
-# define QCtype builtin_lisp_symbol (226)
-# define QCunderline builtin_lisp_symbol (227)
-# define QCunknown_ca builtin_lisp_symbol (228)
-# define QCuse_external_socket builtin_lisp_symbol (229)
-# define QCuser_spec builtin_lisp_symbol (230)
-# define QCvalid_from builtin_lisp_symbol (231)
-# define QCvalid_to builtin_lisp_symbol (232)
-# define QCverify_error builtin_lisp_symbol (233)
-# define QCverify_flags builtin_lisp_symbol (234)
-# define QCversion builtin_lisp_symbol (235)
-# define QCvert_only builtin_lisp_symbol (236)
-# define QCvisible builtin_lisp_symbol (237)
-# define QCvolume builtin_lisp_symbol (238)
-# define QCwarnings builtin_lisp_symbol (239)
-# define QCweakness builtin_lisp_symbol (240)
-# define QCweight builtin_lisp_symbol (241)
-# define QCwidth builtin_lisp_symbol (242)
-# define QCwindow builtin_lisp_symbol (243)
-# define QCwrap builtin_lisp_symbol (244)
-# define QDiscarded_Samples builtin_lisp_symbol (245)
-# define QFILE_NAME builtin_lisp_symbol (246)
-# define QL2R builtin_lisp_symbol (247)
-# define QPRIMARY builtin_lisp_symbol (248)
-# define QR2L builtin_lisp_symbol (249)
-# define QSECONDARY builtin_lisp_symbol (250)
-# define QTARGETS builtin_lisp_symbol (251)
-# define QTEXT builtin_lisp_symbol (252)
-# define QUTF8_STRING builtin_lisp_symbol (253)
-# define QUnknown_error builtin_lisp_symbol (254)
-# define QXdndActionCopy builtin_lisp_symbol (255)
-# define QXdndActionLink builtin_lisp_symbol (256)
-# define QXdndActionMove builtin_lisp_symbol (257)
-# define QXdndActionPrivate builtin_lisp_symbol (258)
-# define Qabove builtin_lisp_symbol (259)
-# define Qabove_handle builtin_lisp_symbol (260)
-# define Qabove_suspended builtin_lisp_symbol (261)
-# define Qaccess_file builtin_lisp_symbol (262)
-# define Qactivate builtin_lisp_symbol (263)
-# define Qactivate_front builtin_lisp_symbol (264)
-# define Qactivate_input_method builtin_lisp_symbol (265)
-# define Qactivate_mark_hook builtin_lisp_symbol (266)
-# define Qactivate_menubar_hook builtin_lisp_symbol (267)
-# define Qadd1 builtin_lisp_symbol (268)
-# define Qadd_name_to_file builtin_lisp_symbol (269)
-# define Qadd_to_history builtin_lisp_symbol (270)
-# define Qafter_change_functions builtin_lisp_symbol (271)
-# define Qafter_delete_frame_functions builtin_lisp_symbol (272)
-# define Qafter_handle builtin_lisp_symbol (273)
-# define Qafter_insert_file_set_buffer_file_coding_system builtin_lisp_symbol (274)
-# define Qafter_insert_file_set_coding builtin_lisp_symbol (275)
-# define Qafter_pdump_load_hook builtin_lisp_symbol (276)
-# define Qafter_string builtin_lisp_symbol (277)
-# define Qalist builtin_lisp_symbol (278)
-# define Qall builtin_lisp_symbol (279)
-# define Qalloc builtin_lisp_symbol (280)
-# define Qalpha builtin_lisp_symbol (281)
-# define Qalpha_background builtin_lisp_symbol (282)
-# define Qalt builtin_lisp_symbol (283)
-# define Qand builtin_lisp_symbol (284)
-# define Qand_optional builtin_lisp_symbol (285)
-# define Qand_rest builtin_lisp_symbol (286)
-# define Qandroid builtin_lisp_symbol (287)
-# define Qanonymous builtin_lisp_symbol (288)
-# define Qappend builtin_lisp_symbol (289)
-# define Qapply builtin_lisp_symbol (290)
-# define Qaref builtin_lisp_symbol (291)
-# define Qargs builtin_lisp_symbol (292)
-# define Qargs_out_of_range builtin_lisp_symbol (293)
-# define Qarith_error builtin_lisp_symbol (294)
-# define Qarray builtin_lisp_symbol (295)
-# define Qarrayp builtin_lisp_symbol (296)
-# define Qarrow builtin_lisp_symbol (297)
-# define Qascii builtin_lisp_symbol (298)
-# define Qascii_0 builtin_lisp_symbol (299)
-# define Qascii_character builtin_lisp_symbol (300)
-# define Qaset builtin_lisp_symbol (301)
-# define Qask_user_about_lock builtin_lisp_symbol (302)
-# define Qassq_delete_all builtin_lisp_symbol (303)
-# define Qassume builtin_lisp_symbol (304)
-# define Qattrib builtin_lisp_symbol (305)
-# define Qauto builtin_lisp_symbol (306)
-# define Qauto_composed builtin_lisp_symbol (307)
-# define Qauto_fill_chars builtin_lisp_symbol (308)
-# define Qauto_hscroll_mode builtin_lisp_symbol (309)
-# define Qauto_lower builtin_lisp_symbol (310)
-# define Qauto_raise builtin_lisp_symbol (311)
-# define Qauto_save builtin_lisp_symbol (312)
-# define Qauto_save_coding builtin_lisp_symbol (313)
-# define Qauto_save_hook builtin_lisp_symbol (314)
-# define Qautoload builtin_lisp_symbol (315)
-# define Qautosaved builtin_lisp_symbol (316)
-# define Qbackground_color builtin_lisp_symbol (317)
-# define Qbackground_mode builtin_lisp_symbol (318)
-# define Qbackquote builtin_lisp_symbol (319)
-# define Qbar builtin_lisp_symbol (320)
-# define Qbare_symbol_p builtin_lisp_symbol (321)
-# define Qbefore_change_functions builtin_lisp_symbol (322)
-# define Qbefore_handle builtin_lisp_symbol (323)
-# define Qbefore_string builtin_lisp_symbol (324)
-# define Qbeginning_of_buffer builtin_lisp_symbol (325)
-# define Qbelow builtin_lisp_symbol (326)
-# define Qbelow_handle builtin_lisp_symbol (327)
-# define Qbig builtin_lisp_symbol (328)
-# define Qbig5 builtin_lisp_symbol (329)
-# define Qbignum builtin_lisp_symbol (330)
-# define Qbinary builtin_lisp_symbol (331)
-# define Qbitmap_spec_p builtin_lisp_symbol (332)
-# define Qblack builtin_lisp_symbol (333)
-# define Qbmp builtin_lisp_symbol (334)
-# define Qbold builtin_lisp_symbol (335)
-# define Qbook builtin_lisp_symbol (336)
-# define Qbool_vector builtin_lisp_symbol (337)
-# define Qbool_vector_p builtin_lisp_symbol (338)
-# define Qboolean builtin_lisp_symbol (339)
-# define Qbooleanp builtin_lisp_symbol (340)
-# define Qborder builtin_lisp_symbol (341)
-# define Qborder_color builtin_lisp_symbol (342)
-# define Qborder_width builtin_lisp_symbol (343)
-# define Qborders_respect_alpha_background builtin_lisp_symbol (344)
-# define Qboth builtin_lisp_symbol (345)
-# define Qboth_horiz builtin_lisp_symbol (346)
-# define Qbottom builtin_lisp_symbol (347)
-# define Qbottom_divider builtin_lisp_symbol (348)
-# define Qbottom_divider_width builtin_lisp_symbol (349)
-# define Qbottom_edge builtin_lisp_symbol (350)
-# define Qbottom_left_corner builtin_lisp_symbol (351)
-# define Qbottom_right_corner builtin_lisp_symbol (352)
-# define Qboundary builtin_lisp_symbol (353)
-# define Qbounds builtin_lisp_symbol (354)
-# define Qbox builtin_lisp_symbol (355)
-# define Qbuffer builtin_lisp_symbol (356)
-# define Qbuffer_access_fontify_functions builtin_lisp_symbol (357)
-# define Qbuffer_file_coding_system builtin_lisp_symbol (358)
-# define Qbuffer_file_name builtin_lisp_symbol (359)
-# define Qbuffer_file_number builtin_lisp_symbol (360)
-# define Qbuffer_list builtin_lisp_symbol (361)
-# define Qbuffer_list_update_hook builtin_lisp_symbol (362)
-# define Qbuffer_name_history builtin_lisp_symbol (363)
-# define Qbuffer_or_string_p builtin_lisp_symbol (364)
-# define Qbuffer_position builtin_lisp_symbol (365)
-# define Qbuffer_predicate builtin_lisp_symbol (366)
-# define Qbuffer_read_only builtin_lisp_symbol (367)
-# define Qbuffer_save_without_query builtin_lisp_symbol (368)
-# define Qbuffer_stale_function builtin_lisp_symbol (369)
-# define Qbuffer_undo_list builtin_lisp_symbol (370)
-# define Qbuffered builtin_lisp_symbol (371)
-# define Qbufferp builtin_lisp_symbol (372)
-# define Qbuffers builtin_lisp_symbol (373)
-# define Qburied_buffer_list builtin_lisp_symbol (374)
-# define Qbyte_code_function builtin_lisp_symbol (375)
-# define Qbyte_code_function_p builtin_lisp_symbol (376)
-# define Qbyte_code_meter builtin_lisp_symbol (377)
-# define Qbyte_run_unescaped_character_literals_warning builtin_lisp_symbol (378)
-# define Qc builtin_lisp_symbol (379)
-# define Qcall builtin_lisp_symbol (380)
-# define Qcall_process builtin_lisp_symbol (381)
-# define Qcall_process_region builtin_lisp_symbol (382)
-# define Qcallref builtin_lisp_symbol (383)
-# define Qcancel_timer builtin_lisp_symbol (384)
-# define Qcanonical_combining_class builtin_lisp_symbol (385)
-# define Qcar builtin_lisp_symbol (386)
-# define Qcar_less_than_car builtin_lisp_symbol (387)
-# define Qcase_fold_search builtin_lisp_symbol (388)
-# define Qcase_symbols_as_words builtin_lisp_symbol (389)
-# define Qcase_table builtin_lisp_symbol (390)
-# define Qcase_table_p builtin_lisp_symbol (391)
-# define Qcatcher builtin_lisp_symbol (392)
-# define Qcategory builtin_lisp_symbol (393)
-# define Qcategory_table builtin_lisp_symbol (394)
-# define Qcategory_table_p builtin_lisp_symbol (395)
-# define Qcategoryp builtin_lisp_symbol (396)
-# define Qcategorysetp builtin_lisp_symbol (397)
-# define Qccl builtin_lisp_symbol (398)
-# define Qccl_program_idx builtin_lisp_symbol (399)
-# define Qcclp builtin_lisp_symbol (400)
-# define Qcdr builtin_lisp_symbol (401)
-# define Qceiling builtin_lisp_symbol (402)
-# define Qcenter builtin_lisp_symbol (403)
-# define Qch builtin_lisp_symbol (404)
-# define Qchange_frame_size builtin_lisp_symbol (405)
-# define Qchange_major_mode_hook builtin_lisp_symbol (406)
-# define Qchar_code_property_table builtin_lisp_symbol (407)
-# define Qchar_from_name builtin_lisp_symbol (408)
-# define Qchar_or_string_p builtin_lisp_symbol (409)
-# define Qchar_script_table builtin_lisp_symbol (410)
-# define Qchar_table builtin_lisp_symbol (411)
-# define Qchar_table_extra_slots builtin_lisp_symbol (412)
-# define Qchar_table_p builtin_lisp_symbol (413)
-# define Qcharacterp builtin_lisp_symbol (414)
-# define Qcharset builtin_lisp_symbol (415)
-# define Qcharsetp builtin_lisp_symbol (416)
-# define Qchild_frame_border builtin_lisp_symbol (417)
-# define Qchild_frame_border_width builtin_lisp_symbol (418)
-# define Qchoice builtin_lisp_symbol (419)
-# define Qciphers builtin_lisp_symbol (420)
-# define Qcircle builtin_lisp_symbol (421)
-# define Qcircular_list builtin_lisp_symbol (422)
-# define Qclone_indirect_buffer_hook builtin_lisp_symbol (423)
-# define Qclone_of builtin_lisp_symbol (424)
-# define Qcloned_from builtin_lisp_symbol (425)
-# define Qclose_tab builtin_lisp_symbol (426)
-# define Qclosed builtin_lisp_symbol (427)
-# define Qcmajflt builtin_lisp_symbol (428)
-# define Qcminflt builtin_lisp_symbol (429)
-# define Qcocoa builtin_lisp_symbol (430)
-# define Qcode_conversion_map builtin_lisp_symbol (431)
-# define Qcode_conversion_map_id builtin_lisp_symbol (432)
-# define Qcodeset builtin_lisp_symbol (433)
-# define Qcoding builtin_lisp_symbol (434)
-# define Qcoding_system builtin_lisp_symbol (435)
-# define Qcoding_system_define_form builtin_lisp_symbol (436)
-# define Qcoding_system_error builtin_lisp_symbol (437)
-# define Qcoding_system_for_write builtin_lisp_symbol (438)
-# define Qcoding_system_history builtin_lisp_symbol (439)
-# define Qcoding_system_p builtin_lisp_symbol (440)
-# define Qcolor builtin_lisp_symbol (441)
-# define Qcolumns builtin_lisp_symbol (442)
-# define Qcomm builtin_lisp_symbol (443)
-# define Qcomma builtin_lisp_symbol (444)
-# define Qcomma_at builtin_lisp_symbol (445)
-# define Qcommand_debug_status builtin_lisp_symbol (446)
-# define Qcommand_error_default_function builtin_lisp_symbol (447)
-# define Qcommand_execute builtin_lisp_symbol (448)
-# define Qcommand_history builtin_lisp_symbol (449)
-# define Qcommand_line_processed builtin_lisp_symbol (450)
-# define Qcommand_modes builtin_lisp_symbol (451)
-# define Qcommandp builtin_lisp_symbol (452)
-# define Qcomment builtin_lisp_symbol (453)
-# define Qcomment_end_can_be_escaped builtin_lisp_symbol (454)
-# define Qcomp_libgccjit_reproducer builtin_lisp_symbol (455)
-# define Qcomp_maybe_gc_or_quit builtin_lisp_symbol (456)
-# define Qcomp_mvar builtin_lisp_symbol (457)
-# define Qcomp_sanitizer_error builtin_lisp_symbol (458)
-# define Qcomp_subr_trampoline_install builtin_lisp_symbol (459)
-# define Qcompleting_read_function builtin_lisp_symbol (460)
-# define Qcompletion_ignore_case builtin_lisp_symbol (461)
-# define Qcomposition builtin_lisp_symbol (462)
-# define Qconcat builtin_lisp_symbol (463)
-# define Qcond_jump builtin_lisp_symbol (464)
-# define Qcond_jump_narg_leq builtin_lisp_symbol (465)
-# define Qcondensed builtin_lisp_symbol (466)
-# define Qcondition_case builtin_lisp_symbol (467)
-# define Qcondition_variable builtin_lisp_symbol (468)
-# define Qcondition_variable_p builtin_lisp_symbol (469)
-# define Qconfig_changed_event builtin_lisp_symbol (470)
-# define Qconfiguration builtin_lisp_symbol (471)
-# define Qconnect builtin_lisp_symbol (472)
-# define Qcons builtin_lisp_symbol (473)
-# define Qconses builtin_lisp_symbol (474)
-# define Qconsp builtin_lisp_symbol (475)
-# define Qcontinuation builtin_lisp_symbol (476)
-# define Qcontrol builtin_lisp_symbol (477)
-# define Qcopy_directory builtin_lisp_symbol (478)
-# define Qcopy_file builtin_lisp_symbol (479)
-# define Qcount builtin_lisp_symbol (480)
-# define Qcreate builtin_lisp_symbol (481)
-# define Qcritical builtin_lisp_symbol (482)
-# define Qcrop builtin_lisp_symbol (483)
-# define Qcstime builtin_lisp_symbol (484)
-# define Qctime builtin_lisp_symbol (485)
-# define Qcurrent builtin_lisp_symbol (486)
-# define Qcurrent_input_method builtin_lisp_symbol (487)
-# define Qcurrent_key_remap_sequence builtin_lisp_symbol (488)
-# define Qcurrent_line builtin_lisp_symbol (489)
-# define Qcurrent_load_list builtin_lisp_symbol (490)
-# define Qcurrent_minibuffer_command builtin_lisp_symbol (491)
-# define Qcursor builtin_lisp_symbol (492)
-# define Qcursor_color builtin_lisp_symbol (493)
-# define Qcursor_in_echo_area builtin_lisp_symbol (494)
-# define Qcursor_type builtin_lisp_symbol (495)
-# define Qcurve builtin_lisp_symbol (496)
-# define Qcustom_delayed_init_variables builtin_lisp_symbol (497)
-# define Qcustom_variable_history builtin_lisp_symbol (498)
-# define Qcustom_variable_p builtin_lisp_symbol (499)
-# define Qcutime builtin_lisp_symbol (500)
-# define Qcw builtin_lisp_symbol (501)
-# define Qcycle_sort_function builtin_lisp_symbol (502)
-# define Qcyclic_function_indirection builtin_lisp_symbol (503)
-# define Qcyclic_variable_indirection builtin_lisp_symbol (504)
-# define Qd builtin_lisp_symbol (505)
-# define Qd_default builtin_lisp_symbol (506)
-# define Qd_ephemeral builtin_lisp_symbol (507)
-# define Qdark builtin_lisp_symbol (508)
-# define Qdashes builtin_lisp_symbol (509)
-# define Qdata builtin_lisp_symbol (510)
-# define Qdatagram builtin_lisp_symbol (511)
-# define Qdays builtin_lisp_symbol (512)
-# define Qdbus_event builtin_lisp_symbol (513)
-# define Qdeactivate_mark builtin_lisp_symbol (514)
-# define Qdebug builtin_lisp_symbol (515)
-# define Qdebug_early builtin_lisp_symbol (516)
-# define Qdebug_early__handler builtin_lisp_symbol (517)
-# define Qdebug_early__muted builtin_lisp_symbol (518)
-# define Qdebug_on_next_call builtin_lisp_symbol (519)
-# define Qdebugger builtin_lisp_symbol (520)
-# define Qdebugger_may_continue builtin_lisp_symbol (521)
-# define Qdecomposed_characters builtin_lisp_symbol (522)
-# define Qdedicated builtin_lisp_symbol (523)
-# define Qdefalias_fset_function builtin_lisp_symbol (524)
-# define Qdefault builtin_lisp_symbol (525)
-# define Qdefault_directory builtin_lisp_symbol (526)
-# define Qdefault_keyboard_coding_system builtin_lisp_symbol (527)
-# define Qdefault_terminal_coding_system builtin_lisp_symbol (528)
-# define Qdefine_charset_internal builtin_lisp_symbol (529)
-# define Qdefine_coding_system_internal builtin_lisp_symbol (530)
-# define Qdefun builtin_lisp_symbol (531)
-# define Qdefvaralias builtin_lisp_symbol (532)
-# define Qdelay builtin_lisp_symbol (533)
-# define Qdelayed_warnings_hook builtin_lisp_symbol (534)
-# define Qdelete builtin_lisp_symbol (535)
-# define Qdelete_auto_save_file_if_necessary builtin_lisp_symbol (536)
-# define Qdelete_before builtin_lisp_symbol (537)
-# define Qdelete_by_moving_to_trash builtin_lisp_symbol (538)
-# define Qdelete_directory builtin_lisp_symbol (539)
-# define Qdelete_file builtin_lisp_symbol (540)
-# define Qdelete_file_internal builtin_lisp_symbol (541)
-# define Qdelete_frame builtin_lisp_symbol (542)
-# define Qdelete_frame_functions builtin_lisp_symbol (543)
-# define Qdelete_terminal_functions builtin_lisp_symbol (544)
-# define Qdelete_window builtin_lisp_symbol (545)
-# define Qdigests builtin_lisp_symbol (546)
-# define Qdir_ok builtin_lisp_symbol (547)
-# define Qdirect_call builtin_lisp_symbol (548)
-# define Qdirect_callref builtin_lisp_symbol (549)
-# define Qdirect_color builtin_lisp_symbol (550)
-# define Qdirectory_file_name builtin_lisp_symbol (551)
-# define Qdirectory_files builtin_lisp_symbol (552)
-# define Qdirectory_files_and_attributes builtin_lisp_symbol (553)
-# define Qdisable_eval builtin_lisp_symbol (554)
-# define Qdisabled builtin_lisp_symbol (555)
-# define Qdisplay builtin_lisp_symbol (556)
-# define Qdisplay_buffer builtin_lisp_symbol (557)
-# define Qdisplay_fill_column_indicator builtin_lisp_symbol (558)
-# define Qdisplay_fill_column_indicator_character builtin_lisp_symbol (559)
-# define Qdisplay_fill_column_indicator_column builtin_lisp_symbol (560)
-# define Qdisplay_line_numbers builtin_lisp_symbol (561)
-# define Qdisplay_line_numbers_disable builtin_lisp_symbol (562)
-# define Qdisplay_line_numbers_offset builtin_lisp_symbol (563)
-# define Qdisplay_line_numbers_widen builtin_lisp_symbol (564)
-# define Qdisplay_line_numbers_width builtin_lisp_symbol (565)
-# define Qdisplay_monitors_changed_functions builtin_lisp_symbol (566)
-# define Qdisplay_table builtin_lisp_symbol (567)
-# define Qdisplay_type builtin_lisp_symbol (568)
-# define Qdisplay_warning builtin_lisp_symbol (569)
-# define Qdo_after_load_evaluation builtin_lisp_symbol (570)
-# define Qdomain_error builtin_lisp_symbol (571)
-# define Qdont_clear_message builtin_lisp_symbol (572)
-# define Qdos builtin_lisp_symbol (573)
-# define Qdots builtin_lisp_symbol (574)
-# define Qdouble_line builtin_lisp_symbol (575)
-# define Qdown builtin_lisp_symbol (576)
-# define Qdrag_internal_border builtin_lisp_symbol (577)
-# define Qdrag_n_drop builtin_lisp_symbol (578)
-# define Qdrag_source builtin_lisp_symbol (579)
-# define Qdrag_with_header_line builtin_lisp_symbol (580)
-# define Qdrag_with_mode_line builtin_lisp_symbol (581)
-# define Qdrag_with_tab_line builtin_lisp_symbol (582)
-# define Qdragging builtin_lisp_symbol (583)
-# define Qdropping builtin_lisp_symbol (584)
-# define Qdump_emacs_portable__sort_predicate builtin_lisp_symbol (585)
-# define Qdump_emacs_portable__sort_predicate_copied builtin_lisp_symbol (586)
-# define Qdump_file_name builtin_lisp_symbol (587)
-# define Qdumped_with_pdumper builtin_lisp_symbol (588)
-# define Qecho_area_clear_hook builtin_lisp_symbol (589)
-# define Qecho_keystrokes builtin_lisp_symbol (590)
-# define Qedge_detection builtin_lisp_symbol (591)
-# define Qegid builtin_lisp_symbol (592)
-# define Qeight_bit builtin_lisp_symbol (593)
-# define Qelt builtin_lisp_symbol (594)
-# define Qem builtin_lisp_symbol (595)
-# define Qemacs builtin_lisp_symbol (596)
-# define Qemacs_mule builtin_lisp_symbol (597)
-# define Qemboss builtin_lisp_symbol (598)
-# define Qemoji builtin_lisp_symbol (599)
-# define Qempty_box builtin_lisp_symbol (600)
-# define Qempty_line builtin_lisp_symbol (601)
-# define Qenable_recursive_minibuffers builtin_lisp_symbol (602)
-# define Qencode_time builtin_lisp_symbol (603)
-# define Qencoded builtin_lisp_symbol (604)
-# define Qend_of_buffer builtin_lisp_symbol (605)
-# define Qend_of_file builtin_lisp_symbol (606)
-# define Qend_scroll builtin_lisp_symbol (607)
-# define Qend_session builtin_lisp_symbol (608)
-# define Qentry builtin_lisp_symbol (609)
-# define Qeq builtin_lisp_symbol (610)
-# define Qeql builtin_lisp_symbol (611)
-# define Qequal builtin_lisp_symbol (612)
-# define Qerror_conditions builtin_lisp_symbol (613)
-# define Qerror_message builtin_lisp_symbol (614)
-# define Qescape_glyph builtin_lisp_symbol (615)
-# define Qetime builtin_lisp_symbol (616)
-# define Qeuid builtin_lisp_symbol (617)
-# define Qeval builtin_lisp_symbol (618)
-# define Qeval_buffer_list builtin_lisp_symbol (619)
-# define Qeval_minibuffer builtin_lisp_symbol (620)
-# define Qevaporate builtin_lisp_symbol (621)
-# define Qeven builtin_lisp_symbol (622)
-# define Qevent_kind builtin_lisp_symbol (623)
-# define Qevent_symbol_element_mask builtin_lisp_symbol (624)
-# define Qevent_symbol_elements builtin_lisp_symbol (625)
-# define Qexcessive_lisp_nesting builtin_lisp_symbol (626)
-# define Qexcessive_variable_binding builtin_lisp_symbol (627)
-# define Qexcl builtin_lisp_symbol (628)
-# define Qexit builtin_lisp_symbol (629)
-# define Qexpand_abbrev builtin_lisp_symbol (630)
-# define Qexpand_file_name builtin_lisp_symbol (631)
-# define Qexpanded builtin_lisp_symbol (632)
-# define Qexplicit builtin_lisp_symbol (633)
-# define Qexplicit_name builtin_lisp_symbol (634)
-# define Qexpose_hidden_buffer builtin_lisp_symbol (635)
-# define Qextend builtin_lisp_symbol (636)
-# define Qextension_data builtin_lisp_symbol (637)
-# define Qexternal_border_size builtin_lisp_symbol (638)
-# define Qexternal_debugging_output builtin_lisp_symbol (639)
-# define Qextra builtin_lisp_symbol (640)
-# define Qextra_bold builtin_lisp_symbol (641)
-# define Qextra_light builtin_lisp_symbol (642)
-# define Qf0 builtin_lisp_symbol (643)
-# define Qf10 builtin_lisp_symbol (644)
-# define Qface builtin_lisp_symbol (645)
-# define Qface_alias builtin_lisp_symbol (646)
-# define Qface_no_inherit builtin_lisp_symbol (647)
-# define Qface_remapping_alist builtin_lisp_symbol (648)
-# define Qface_set_after_frame_default builtin_lisp_symbol (649)
-# define Qfailed builtin_lisp_symbol (650)
-# define Qfalse builtin_lisp_symbol (651)
-# define Qfboundp builtin_lisp_symbol (652)
-# define Qfeatures builtin_lisp_symbol (653)
-# define Qfetch_handler builtin_lisp_symbol (654)
-# define Qfield builtin_lisp_symbol (655)
-# define Qfile builtin_lisp_symbol (656)
-# define Qfile_accessible_directory_p builtin_lisp_symbol (657)
-# define Qfile_acl builtin_lisp_symbol (658)
-# define Qfile_already_exists builtin_lisp_symbol (659)
-# define Qfile_attributes builtin_lisp_symbol (660)
-# define Qfile_attributes_lessp builtin_lisp_symbol (661)
-# define Qfile_date_error builtin_lisp_symbol (662)
-# define Qfile_directory_p builtin_lisp_symbol (663)
-# define Qfile_error builtin_lisp_symbol (664)
-# define Qfile_executable_p builtin_lisp_symbol (665)
-# define Qfile_exists_p builtin_lisp_symbol (666)
-# define Qfile_locked_p builtin_lisp_symbol (667)
-# define Qfile_missing builtin_lisp_symbol (668)
-# define Qfile_modes builtin_lisp_symbol (669)
-# define Qfile_name_all_completions builtin_lisp_symbol (670)
-# define Qfile_name_as_directory builtin_lisp_symbol (671)
-# define Qfile_name_case_insensitive_p builtin_lisp_symbol (672)
-# define Qfile_name_completion builtin_lisp_symbol (673)
-# define Qfile_name_directory builtin_lisp_symbol (674)
-# define Qfile_name_handler_alist builtin_lisp_symbol (675)
-# define Qfile_name_history builtin_lisp_symbol (676)
-# define Qfile_name_nondirectory builtin_lisp_symbol (677)
-# define Qfile_newer_than_file_p builtin_lisp_symbol (678)
-# define Qfile_notify builtin_lisp_symbol (679)
-# define Qfile_notify_error builtin_lisp_symbol (680)
-# define Qfile_offset builtin_lisp_symbol (681)
-# define Qfile_readable_p builtin_lisp_symbol (682)
-# define Qfile_regular_p builtin_lisp_symbol (683)
-# define Qfile_remote_p builtin_lisp_symbol (684)
-# define Qfile_selinux_context builtin_lisp_symbol (685)
-# define Qfile_symlink_p builtin_lisp_symbol (686)
-# define Qfile_system_info builtin_lisp_symbol (687)
-# define Qfile_truename builtin_lisp_symbol (688)
-# define Qfile_writable_p builtin_lisp_symbol (689)
-# define Qfilenamep builtin_lisp_symbol (690)
-# define Qfill_column_indicator builtin_lisp_symbol (691)
-# define Qfinalizer builtin_lisp_symbol (692)
-# define Qfirst_change_hook builtin_lisp_symbol (693)
-# define Qfixnum builtin_lisp_symbol (694)
-# define Qfixnum_or_symbol_with_pos_p builtin_lisp_symbol (695)
-# define Qfixnump builtin_lisp_symbol (696)
-# define Qflat_button builtin_lisp_symbol (697)
-# define Qfloat builtin_lisp_symbol (698)
-# define Qfloat_output_format builtin_lisp_symbol (699)
-# define Qfloatp builtin_lisp_symbol (700)
-# define Qfloats builtin_lisp_symbol (701)
-# define Qfloor builtin_lisp_symbol (702)
-# define Qfocus_in builtin_lisp_symbol (703)
-# define Qfocus_out builtin_lisp_symbol (704)
-# define Qfont builtin_lisp_symbol (705)
-# define Qfont_backend builtin_lisp_symbol (706)
-# define Qfont_driver_superseded_by builtin_lisp_symbol (707)
-# define Qfont_entity builtin_lisp_symbol (708)
-# define Qfont_extra_type builtin_lisp_symbol (709)
-# define Qfont_lock_face builtin_lisp_symbol (710)
-# define Qfont_object builtin_lisp_symbol (711)
-# define Qfont_parameter builtin_lisp_symbol (712)
-# define Qfont_spec builtin_lisp_symbol (713)
-# define Qfontification_functions builtin_lisp_symbol (714)
-# define Qfontified builtin_lisp_symbol (715)
-# define Qfontset builtin_lisp_symbol (716)
-# define Qfontset_info builtin_lisp_symbol (717)
-# define Qfontset_startup builtin_lisp_symbol (718)
-# define Qfontsize builtin_lisp_symbol (719)
-# define Qforce builtin_lisp_symbol (720)
-# define Qforeground_color builtin_lisp_symbol (721)
-# define Qformat_annotate_function builtin_lisp_symbol (722)
-# define Qformat_decode builtin_lisp_symbol (723)
-# define Qformat_prompt builtin_lisp_symbol (724)
-# define Qfraction builtin_lisp_symbol (725)
-# define Qframe builtin_lisp_symbol (726)
-# define Qframe__z_order_lessp builtin_lisp_symbol (727)
-# define Qframe_edges builtin_lisp_symbol (728)
-# define Qframe_id builtin_lisp_symbol (729)
-# define Qframe_live_p builtin_lisp_symbol (730)
-# define Qframe_monitor_attributes builtin_lisp_symbol (731)
-# define Qframe_set_background_mode builtin_lisp_symbol (732)
-# define Qframe_title_format builtin_lisp_symbol (733)
-# define Qframe_windows_min_size builtin_lisp_symbol (734)
-# define Qframep builtin_lisp_symbol (735)
-# define Qframes builtin_lisp_symbol (736)
-# define Qfringe builtin_lisp_symbol (737)
-# define Qfrom__tty_menu_p builtin_lisp_symbol (738)
-# define Qfront_sticky builtin_lisp_symbol (739)
-# define Qfull builtin_lisp_symbol (740)
-# define Qfullboth builtin_lisp_symbol (741)
-# define Qfullheight builtin_lisp_symbol (742)
-# define Qfullscreen builtin_lisp_symbol (743)
-# define Qfullwidth builtin_lisp_symbol (744)
-# define Qfuncall builtin_lisp_symbol (745)
-# define Qfuncall_interactively builtin_lisp_symbol (746)
-# define Qfunction builtin_lisp_symbol (747)
-# define Qfunction_documentation builtin_lisp_symbol (748)
-# define Qfunction_history builtin_lisp_symbol (749)
-# define Qfunction_key builtin_lisp_symbol (750)
-# define Qfunctionp builtin_lisp_symbol (751)
-# define Qfundamental_mode builtin_lisp_symbol (752)
-# define Qgc_cons_percentage builtin_lisp_symbol (753)
-# define Qgc_cons_threshold builtin_lisp_symbol (754)
-# define Qgccjit builtin_lisp_symbol (755)
-# define Qgdiplus builtin_lisp_symbol (756)
-# define Qgdk_pixbuf builtin_lisp_symbol (757)
-# define Qgeometry builtin_lisp_symbol (758)
-# define Qget_buffer_window_list builtin_lisp_symbol (759)
-# define Qget_emacs_mule_file_char builtin_lisp_symbol (760)
-# define Qget_file_buffer builtin_lisp_symbol (761)
-# define Qget_file_char builtin_lisp_symbol (762)
-# define Qget_mru_frame builtin_lisp_symbol (763)
-# define Qget_mru_window builtin_lisp_symbol (764)
-# define Qget_scratch_buffer_create builtin_lisp_symbol (765)
-# define Qgif builtin_lisp_symbol (766)
-# define Qgio builtin_lisp_symbol (767)
-# define Qglib builtin_lisp_symbol (768)
-# define Qglyphless_char builtin_lisp_symbol (769)
-# define Qglyphless_char_display builtin_lisp_symbol (770)
-# define Qgnustep builtin_lisp_symbol (771)
-# define Qgnutls builtin_lisp_symbol (772)
-# define Qgnutls3 builtin_lisp_symbol (773)
-# define Qgnutls_anon builtin_lisp_symbol (774)
-# define Qgnutls_code builtin_lisp_symbol (775)
-# define Qgnutls_e_again builtin_lisp_symbol (776)
-# define Qgnutls_e_interrupted builtin_lisp_symbol (777)
-# define Qgnutls_e_invalid_session builtin_lisp_symbol (778)
-# define Qgnutls_e_not_ready_for_handshake builtin_lisp_symbol (779)
-# define Qgnutls_pkcs_null_password builtin_lisp_symbol (780)
-# define Qgnutls_pkcs_pbes1_des_md5 builtin_lisp_symbol (781)
-# define Qgnutls_pkcs_pbes2_3des builtin_lisp_symbol (782)
-# define Qgnutls_pkcs_pbes2_aes_128 builtin_lisp_symbol (783)
-# define Qgnutls_pkcs_pbes2_aes_192 builtin_lisp_symbol (784)
-# define Qgnutls_pkcs_pbes2_aes_256 builtin_lisp_symbol (785)
-# define Qgnutls_pkcs_pbes2_des builtin_lisp_symbol (786)
-# define Qgnutls_pkcs_pbes2_gost_cpa builtin_lisp_symbol (787)
-# define Qgnutls_pkcs_pbes2_gost_cpb builtin_lisp_symbol (788)
-# define Qgnutls_pkcs_pbes2_gost_cpc builtin_lisp_symbol (789)
-# define Qgnutls_pkcs_pbes2_gost_cpd builtin_lisp_symbol (790)
-# define Qgnutls_pkcs_pbes2_gost_tc26z builtin_lisp_symbol (791)
-# define Qgnutls_pkcs_pkcs12_3des builtin_lisp_symbol (792)
-# define Qgnutls_pkcs_pkcs12_arcfour builtin_lisp_symbol (793)
-# define Qgnutls_pkcs_pkcs12_rc2_40 builtin_lisp_symbol (794)
-# define Qgnutls_pkcs_plain builtin_lisp_symbol (795)
-# define Qgnutls_type_cipher builtin_lisp_symbol (796)
-# define Qgnutls_type_digest_algorithm builtin_lisp_symbol (797)
-# define Qgnutls_type_mac_algorithm builtin_lisp_symbol (798)
-# define Qgnutls_x509pki builtin_lisp_symbol (799)
-# define Qgobject builtin_lisp_symbol (800)
-# define Qgrave builtin_lisp_symbol (801)
-# define Qgray_scale builtin_lisp_symbol (802)
-# define Qgroup builtin_lisp_symbol (803)
-# define Qgrow_only builtin_lisp_symbol (804)
-# define Qgs_load_image builtin_lisp_symbol (805)
-# define Qgui_figure_window_size builtin_lisp_symbol (806)
-# define Qgui_set_selection builtin_lisp_symbol (807)
-# define Qhaiku builtin_lisp_symbol (808)
-# define Qhand builtin_lisp_symbol (809)
-# define Qhandle builtin_lisp_symbol (810)
-# define Qhandle_select_window builtin_lisp_symbol (811)
-# define Qhandle_shift_selection builtin_lisp_symbol (812)
-# define Qhandle_switch_frame builtin_lisp_symbol (813)
-# define Qhas_error builtin_lisp_symbol (814)
-# define Qhash_table builtin_lisp_symbol (815)
-# define Qhash_table_p builtin_lisp_symbol (816)
-# define Qhash_table_test builtin_lisp_symbol (817)
-# define Qhbar builtin_lisp_symbol (818)
-# define Qhdrag builtin_lisp_symbol (819)
-# define Qheader_line builtin_lisp_symbol (820)
-# define Qheader_line_active builtin_lisp_symbol (821)
-# define Qheader_line_format builtin_lisp_symbol (822)
-# define Qheader_line_inactive builtin_lisp_symbol (823)
-# define Qheap builtin_lisp_symbol (824)
-# define Qheavy builtin_lisp_symbol (825)
-# define Qheic builtin_lisp_symbol (826)
-# define Qheight builtin_lisp_symbol (827)
-# define Qheight_only builtin_lisp_symbol (828)
-# define Qhelp__append_keystrokes_help builtin_lisp_symbol (829)
-# define Qhelp__describe_map_tree builtin_lisp_symbol (830)
-# define Qhelp_echo builtin_lisp_symbol (831)
-# define Qhelp_echo_inhibit_substitution builtin_lisp_symbol (832)
-# define Qhelp_form_show builtin_lisp_symbol (833)
-# define Qhelp_key_binding builtin_lisp_symbol (834)
-# define Qhelper_sanitizer_assert builtin_lisp_symbol (835)
-# define Qhelper_save_restriction builtin_lisp_symbol (836)
-# define Qhelper_unbind_n builtin_lisp_symbol (837)
-# define Qhelper_unwind_protect builtin_lisp_symbol (838)
-# define Qheuristic builtin_lisp_symbol (839)
-# define Qhex_code builtin_lisp_symbol (840)
-# define Qhide builtin_lisp_symbol (841)
-# define Qhollow builtin_lisp_symbol (842)
-# define Qhollow_small builtin_lisp_symbol (843)
-# define Qhorizontal_handle builtin_lisp_symbol (844)
-# define Qhorizontal_scroll_bar builtin_lisp_symbol (845)
-# define Qhorizontal_scroll_bars builtin_lisp_symbol (846)
-# define Qhourglass builtin_lisp_symbol (847)
-# define Qhw builtin_lisp_symbol (848)
-# define Qhyper builtin_lisp_symbol (849)
-# define Qicon builtin_lisp_symbol (850)
-# define Qicon_left builtin_lisp_symbol (851)
-# define Qicon_name builtin_lisp_symbol (852)
-# define Qicon_title_format builtin_lisp_symbol (853)
-# define Qicon_top builtin_lisp_symbol (854)
-# define Qicon_type builtin_lisp_symbol (855)
-# define Qiconify_frame builtin_lisp_symbol (856)
-# define Qiconify_top_level builtin_lisp_symbol (857)
-# define Qidentity builtin_lisp_symbol (858)
-# define Qif builtin_lisp_symbol (859)
-# define Qif_regular builtin_lisp_symbol (860)
-# define Qignore_self_insert builtin_lisp_symbol (861)
-# define Qignored builtin_lisp_symbol (862)
-# define Qimage builtin_lisp_symbol (863)
-# define Qimage_format_suffixes builtin_lisp_symbol (864)
-# define Qimagemagick builtin_lisp_symbol (865)
-# define Qinc_args builtin_lisp_symbol (866)
-# define Qinformational builtin_lisp_symbol (867)
-# define Qinhibit builtin_lisp_symbol (868)
-# define Qinhibit_changing_match_data builtin_lisp_symbol (869)
-# define Qinhibit_debugger builtin_lisp_symbol (870)
-# define Qinhibit_double_buffering builtin_lisp_symbol (871)
-# define Qinhibit_eval_during_redisplay builtin_lisp_symbol (872)
-# define Qinhibit_file_name_operation builtin_lisp_symbol (873)
-# define Qinhibit_free_realized_faces builtin_lisp_symbol (874)
-# define Qinhibit_menubar_update builtin_lisp_symbol (875)
-# define Qinhibit_modification_hooks builtin_lisp_symbol (876)
-# define Qinhibit_point_motion_hooks builtin_lisp_symbol (877)
-# define Qinhibit_quit builtin_lisp_symbol (878)
-# define Qinhibit_read_only builtin_lisp_symbol (879)
-# define Qinhibit_redisplay builtin_lisp_symbol (880)
-# define Qinhibited_interaction builtin_lisp_symbol (881)
-# define Qinitial_major_mode builtin_lisp_symbol (882)
-# define Qinner_edges builtin_lisp_symbol (883)
-# define Qinput_method_exit_on_first_char builtin_lisp_symbol (884)
-# define Qinput_method_use_echo_area builtin_lisp_symbol (885)
-# define Qinsert_behind_hooks builtin_lisp_symbol (886)
-# define Qinsert_file_contents builtin_lisp_symbol (887)
-# define Qinsert_in_front_hooks builtin_lisp_symbol (888)
-# define Qinserted_chars builtin_lisp_symbol (889)
-# define Qinsufficient_source builtin_lisp_symbol (890)
-# define Qintangible builtin_lisp_symbol (891)
-# define Qinteger builtin_lisp_symbol (892)
-# define Qinteger_or_marker_p builtin_lisp_symbol (893)
-# define Qintegerp builtin_lisp_symbol (894)
-# define Qinteractive builtin_lisp_symbol (895)
-# define Qinteractive_args builtin_lisp_symbol (896)
-# define Qinteractive_form builtin_lisp_symbol (897)
-# define Qinteractive_p builtin_lisp_symbol (898)
-# define Qinternal__syntax_propertize builtin_lisp_symbol (899)
-# define Qinternal_auto_fill builtin_lisp_symbol (900)
-# define Qinternal_border builtin_lisp_symbol (901)
-# define Qinternal_border_width builtin_lisp_symbol (902)
-# define Qinternal_complete_buffer builtin_lisp_symbol (903)
-# define Qinternal_default_interrupt_process builtin_lisp_symbol (904)
-# define Qinternal_default_process_filter builtin_lisp_symbol (905)
-# define Qinternal_default_process_sentinel builtin_lisp_symbol (906)
-# define Qinternal_default_signal_process builtin_lisp_symbol (907)
-# define Qinternal_echo_keystrokes_prefix builtin_lisp_symbol (908)
-# define Qinternal_interpreter_environment builtin_lisp_symbol (909)
-# define Qinternal_macroexpand_for_load builtin_lisp_symbol (910)
-# define Qinternal_timer_start_idle builtin_lisp_symbol (911)
-# define Qinternal_when_entered_debugger builtin_lisp_symbol (912)
-# define Qinterpreted_function builtin_lisp_symbol (913)
-# define Qinterrupt_process_functions builtin_lisp_symbol (914)
-# define Qinterrupted builtin_lisp_symbol (915)
-# define Qintervals builtin_lisp_symbol (916)
-# define Qinvalid_arity builtin_lisp_symbol (917)
-# define Qinvalid_function builtin_lisp_symbol (918)
-# define Qinvalid_read_syntax builtin_lisp_symbol (919)
-# define Qinvalid_regexp builtin_lisp_symbol (920)
-# define Qinvalid_source builtin_lisp_symbol (921)
-# define Qinvisible builtin_lisp_symbol (922)
-# define Qipv4 builtin_lisp_symbol (923)
-# define Qipv6 builtin_lisp_symbol (924)
-# define Qiso10646_1 builtin_lisp_symbol (925)
-# define Qiso8859_1 builtin_lisp_symbol (926)
-# define Qiso_2022 builtin_lisp_symbol (927)
-# define Qiso_8859_1 builtin_lisp_symbol (928)
-# define Qitalic builtin_lisp_symbol (929)
-# define Qiv_auto builtin_lisp_symbol (930)
-# define Qja builtin_lisp_symbol (931)
-# define Qjka_compr_load_suffixes builtin_lisp_symbol (932)
-# define Qjpeg builtin_lisp_symbol (933)
-# define Qjson_end_of_file builtin_lisp_symbol (934)
-# define Qjson_error builtin_lisp_symbol (935)
-# define Qjson_escape_sequence_error builtin_lisp_symbol (936)
-# define Qjson_invalid_surrogate_error builtin_lisp_symbol (937)
-# define Qjson_number_out_of_range builtin_lisp_symbol (938)
-# define Qjson_object_too_deep builtin_lisp_symbol (939)
-# define Qjson_out_of_memory builtin_lisp_symbol (940)
-# define Qjson_parse_error builtin_lisp_symbol (941)
-# define Qjson_trailing_content builtin_lisp_symbol (942)
-# define Qjson_utf8_decode_error builtin_lisp_symbol (943)
-# define Qjson_value_p builtin_lisp_symbol (944)
-# define Qjump builtin_lisp_symbol (945)
-# define Qkbd_macro_termination_hook builtin_lisp_symbol (946)
-# define Qkeep_ratio builtin_lisp_symbol (947)
-# define Qkey builtin_lisp_symbol (948)
-# define Qkey_and_value builtin_lisp_symbol (949)
-# define Qkey_or_value builtin_lisp_symbol (950)
-# define Qkey_parse builtin_lisp_symbol (951)
-# define Qkey_valid_p builtin_lisp_symbol (952)
-# define Qkeymap builtin_lisp_symbol (953)
-# define Qkeymap_canonicalize builtin_lisp_symbol (954)
-# define Qkeymapp builtin_lisp_symbol (955)
-# define Qkill_buffer__possibly_save builtin_lisp_symbol (956)
-# define Qkill_buffer_hook builtin_lisp_symbol (957)
-# define Qkill_buffer_query_functions builtin_lisp_symbol (958)
-# define Qkill_emacs builtin_lisp_symbol (959)
-# define Qkill_emacs_hook builtin_lisp_symbol (960)
-# define Qkill_forward_chars builtin_lisp_symbol (961)
-# define Qko builtin_lisp_symbol (962)
-# define Qlang_version_mismatch builtin_lisp_symbol (963)
-# define Qlanguage_change builtin_lisp_symbol (964)
-# define Qlaplace builtin_lisp_symbol (965)
-# define Qlast_arrow_position builtin_lisp_symbol (966)
-# define Qlast_arrow_string builtin_lisp_symbol (967)
-# define Qlast_nonmenu_event builtin_lisp_symbol (968)
-# define Qlate builtin_lisp_symbol (969)
-# define Qlatin builtin_lisp_symbol (970)
-# define Qleft builtin_lisp_symbol (971)
-# define Qleft_edge builtin_lisp_symbol (972)
-# define Qleft_fringe builtin_lisp_symbol (973)
-# define Qleft_fringe_help builtin_lisp_symbol (974)
-# define Qleft_margin builtin_lisp_symbol (975)
-# define Qleft_only builtin_lisp_symbol (976)
-# define Qleft_to_right builtin_lisp_symbol (977)
-# define Qleftmost builtin_lisp_symbol (978)
-# define Qlet builtin_lisp_symbol (979)
-# define Qletx builtin_lisp_symbol (980)
-# define Qlexical_binding builtin_lisp_symbol (981)
-# define Qlibgif_version builtin_lisp_symbol (982)
-# define Qlibjpeg_version builtin_lisp_symbol (983)
-# define Qlibpng_version builtin_lisp_symbol (984)
-# define Qlight builtin_lisp_symbol (985)
-# define Qline builtin_lisp_symbol (986)
-# define Qline_height builtin_lisp_symbol (987)
-# define Qline_number builtin_lisp_symbol (988)
-# define Qline_number_current_line builtin_lisp_symbol (989)
-# define Qline_number_major_tick builtin_lisp_symbol (990)
-# define Qline_number_minor_tick builtin_lisp_symbol (991)
-# define Qline_prefix builtin_lisp_symbol (992)
-# define Qline_spacing builtin_lisp_symbol (993)
-# define Qlink builtin_lisp_symbol (994)
-# define Qlisp_directory builtin_lisp_symbol (995)
-# define Qlist builtin_lisp_symbol (996)
-# define Qlist_or_vector_p builtin_lisp_symbol (997)
-# define Qlist_system_processes builtin_lisp_symbol (998)
-# define Qlisten builtin_lisp_symbol (999)
-# define Qlistp builtin_lisp_symbol (1000)
-# define Qlittle builtin_lisp_symbol (1001)
-# define Qlive builtin_lisp_symbol (1002)
-# define Qload builtin_lisp_symbol (1003)
-# define Qload_file_name builtin_lisp_symbol (1004)
-# define Qload_force_doc_strings builtin_lisp_symbol (1005)
-# define Qload_in_progress builtin_lisp_symbol (1006)
-# define Qload_time builtin_lisp_symbol (1007)
-# define Qload_true_file_name builtin_lisp_symbol (1008)
-# define Qlocal builtin_lisp_symbol (1009)
-# define Qlocal_map builtin_lisp_symbol (1010)
-# define Qlock_file builtin_lisp_symbol (1011)
-# define Qlong builtin_lisp_symbol (1012)
-# define Qlong_line_optimizations_in_command_hooks builtin_lisp_symbol (1013)
-# define Qlong_line_optimizations_in_fontification_functions builtin_lisp_symbol (1014)
-# define Qlosing_value builtin_lisp_symbol (1015)
-# define Qlowercase builtin_lisp_symbol (1016)
-# define Qlread_unescaped_character_literals builtin_lisp_symbol (1017)
-# define Qm builtin_lisp_symbol (1018)
-# define Qmac builtin_lisp_symbol (1019)
-# define Qmac_ct builtin_lisp_symbol (1020)
-# define Qmacro builtin_lisp_symbol (1021)
-# define Qmacroexp__dynvars builtin_lisp_symbol (1022)
-# define Qmacs builtin_lisp_symbol (1023)
-# define Qmajflt builtin_lisp_symbol (1024)
-# define Qmake_cursor_line_fully_visible builtin_lisp_symbol (1025)
-# define Qmake_directory builtin_lisp_symbol (1026)
-# define Qmake_directory_internal builtin_lisp_symbol (1027)
-# define Qmake_frame_visible builtin_lisp_symbol (1028)
-# define Qmake_initial_minibuffer_frame builtin_lisp_symbol (1029)
-# define Qmake_invisible builtin_lisp_symbol (1030)
-# define Qmake_lock_file_name builtin_lisp_symbol (1031)
-# define Qmake_process builtin_lisp_symbol (1032)
-# define Qmake_symbolic_link builtin_lisp_symbol (1033)
-# define Qmake_window_start_visible builtin_lisp_symbol (1034)
-# define Qmakunbound builtin_lisp_symbol (1035)
-# define Qmalformed_keyword_arg_list builtin_lisp_symbol (1036)
-# define Qmany builtin_lisp_symbol (1037)
-# define Qmap_keymap_sorted builtin_lisp_symbol (1038)
-# define Qmargin builtin_lisp_symbol (1039)
-# define Qmark_for_redisplay builtin_lisp_symbol (1040)
-# define Qmark_inactive builtin_lisp_symbol (1041)
-# define Qmarker builtin_lisp_symbol (1042)
-# define Qmarkerp builtin_lisp_symbol (1043)
-# define Qmaximized builtin_lisp_symbol (1044)
-# define Qmd5 builtin_lisp_symbol (1045)
-# define Qmedium builtin_lisp_symbol (1046)
-# define Qmemory_buffer_too_small builtin_lisp_symbol (1047)
-# define Qmemory_info builtin_lisp_symbol (1048)
-# define Qmenu builtin_lisp_symbol (1049)
-# define Qmenu_bar builtin_lisp_symbol (1050)
-# define Qmenu_bar_external builtin_lisp_symbol (1051)
-# define Qmenu_bar_lines builtin_lisp_symbol (1052)
-# define Qmenu_bar_size builtin_lisp_symbol (1053)
-# define Qmenu_bar_update_hook builtin_lisp_symbol (1054)
-# define Qmenu_enable builtin_lisp_symbol (1055)
-# define Qmenu_item builtin_lisp_symbol (1056)
-# define Qmessage builtin_lisp_symbol (1057)
-# define Qmessages_buffer_mode builtin_lisp_symbol (1058)
-# define Qmeta builtin_lisp_symbol (1059)
-# define Qmetadata builtin_lisp_symbol (1060)
-# define Qmin_height builtin_lisp_symbol (1061)
-# define Qmin_width builtin_lisp_symbol (1062)
-# define Qminflt builtin_lisp_symbol (1063)
-# define Qminibuffer builtin_lisp_symbol (1064)
-# define Qminibuffer_completing_file_name builtin_lisp_symbol (1065)
-# define Qminibuffer_completion_table builtin_lisp_symbol (1066)
-# define Qminibuffer_default builtin_lisp_symbol (1067)
-# define Qminibuffer_exit builtin_lisp_symbol (1068)
-# define Qminibuffer_exit_hook builtin_lisp_symbol (1069)
-# define Qminibuffer_follows_selected_frame builtin_lisp_symbol (1070)
-# define Qminibuffer_history builtin_lisp_symbol (1071)
-# define Qminibuffer_inactive_mode builtin_lisp_symbol (1072)
-# define Qminibuffer_mode builtin_lisp_symbol (1073)
-# define Qminibuffer_prompt builtin_lisp_symbol (1074)
-# define Qminibuffer_quit builtin_lisp_symbol (1075)
-# define Qminibuffer_quit_recursive_edit builtin_lisp_symbol (1076)
-# define Qminibuffer_setup_hook builtin_lisp_symbol (1077)
-# define Qminus builtin_lisp_symbol (1078)
-# define Qmissing builtin_lisp_symbol (1079)
-# define Qmissing_module_init_function builtin_lisp_symbol (1080)
-# define Qmm_size builtin_lisp_symbol (1081)
-# define Qmode_class builtin_lisp_symbol (1082)
-# define Qmode_line builtin_lisp_symbol (1083)
-# define Qmode_line_active builtin_lisp_symbol (1084)
-# define Qmode_line_default_help_echo builtin_lisp_symbol (1085)
-# define Qmode_line_elt_no builtin_lisp_symbol (1086)
-# define Qmode_line_format builtin_lisp_symbol (1087)
-# define Qmode_line_inactive builtin_lisp_symbol (1088)
-# define Qmodeline builtin_lisp_symbol (1089)
-# define Qmodification_hooks builtin_lisp_symbol (1090)
-# define Qmodifier_cache builtin_lisp_symbol (1091)
-# define Qmodifier_value builtin_lisp_symbol (1092)
-# define Qmodule_function builtin_lisp_symbol (1093)
-# define Qmodule_function_p builtin_lisp_symbol (1094)
-# define Qmodule_init_failed builtin_lisp_symbol (1095)
-# define Qmodule_load_failed builtin_lisp_symbol (1096)
-# define Qmodule_not_gpl_compatible builtin_lisp_symbol (1097)
-# define Qmodule_open_failed builtin_lisp_symbol (1098)
-# define Qmodule_out_of_memory builtin_lisp_symbol (1099)
-# define Qmonitors_changed builtin_lisp_symbol (1100)
-# define Qmonths builtin_lisp_symbol (1101)
-# define Qmouse builtin_lisp_symbol (1102)
-# define Qmouse_click builtin_lisp_symbol (1103)
-# define Qmouse_color builtin_lisp_symbol (1104)
-# define Qmouse_face builtin_lisp_symbol (1105)
-# define Qmouse_fixup_help_message builtin_lisp_symbol (1106)
-# define Qmouse_leave_buffer_hook builtin_lisp_symbol (1107)
-# define Qmouse_movement builtin_lisp_symbol (1108)
-# define Qmouse_wheel_frame builtin_lisp_symbol (1109)
-# define Qmove_frame builtin_lisp_symbol (1110)
-# define Qmove_toolbar builtin_lisp_symbol (1111)
-# define Qmutex builtin_lisp_symbol (1112)
-# define Qmutexp builtin_lisp_symbol (1113)
-# define Qname builtin_lisp_symbol (1114)
-# define Qnamed builtin_lisp_symbol (1115)
-# define Qnative__compile_async builtin_lisp_symbol (1116)
-# define Qnative_comp_compiler_options builtin_lisp_symbol (1117)
-# define Qnative_comp_debug builtin_lisp_symbol (1118)
-# define Qnative_comp_driver_options builtin_lisp_symbol (1119)
-# define Qnative_comp_function builtin_lisp_symbol (1120)
-# define Qnative_comp_speed builtin_lisp_symbol (1121)
-# define Qnative_comp_unit builtin_lisp_symbol (1122)
-# define Qnative_comp_warning_on_missing_source builtin_lisp_symbol (1123)
-# define Qnative_compiler builtin_lisp_symbol (1124)
-# define Qnative_compiler_error builtin_lisp_symbol (1125)
-# define Qnative_edges builtin_lisp_symbol (1126)
-# define Qnative_ice builtin_lisp_symbol (1127)
-# define Qnative_image builtin_lisp_symbol (1128)
-# define Qnative_lisp_file_inconsistent builtin_lisp_symbol (1129)
-# define Qnative_lisp_load_failed builtin_lisp_symbol (1130)
-# define Qnative_lisp_wrong_reloc builtin_lisp_symbol (1131)
-# define Qnatnump builtin_lisp_symbol (1132)
-# define Qnegate builtin_lisp_symbol (1133)
-# define Qnetwork builtin_lisp_symbol (1134)
-# define Qnhdrag builtin_lisp_symbol (1135)
-# define Qnice builtin_lisp_symbol (1136)
-# define Qno_accept_focus builtin_lisp_symbol (1137)
-# define Qno_catch builtin_lisp_symbol (1138)
-# define Qno_conversion builtin_lisp_symbol (1139)
-# define Qno_focus_on_map builtin_lisp_symbol (1140)
-# define Qno_other_frame builtin_lisp_symbol (1141)
-# define Qno_other_window builtin_lisp_symbol (1142)
-# define Qno_record builtin_lisp_symbol (1143)
-# define Qno_self_insert builtin_lisp_symbol (1144)
-# define Qno_special_glyphs builtin_lisp_symbol (1145)
-# define Qnobreak_hyphen builtin_lisp_symbol (1146)
-# define Qnobreak_space builtin_lisp_symbol (1147)
-# define Qnoelisp builtin_lisp_symbol (1148)
-# define Qnon_ascii builtin_lisp_symbol (1149)
-# define Qnon_key_event builtin_lisp_symbol (1150)
-# define Qnon_retained builtin_lisp_symbol (1151)
-# define Qnone builtin_lisp_symbol (1152)
-# define Qnormal builtin_lisp_symbol (1153)
-# define Qnot builtin_lisp_symbol (1154)
-# define Qnot_found builtin_lisp_symbol (1155)
-# define Qnow builtin_lisp_symbol (1156)
-# define Qns builtin_lisp_symbol (1157)
-# define Qns_appearance builtin_lisp_symbol (1158)
-# define Qns_drag_operation_copy builtin_lisp_symbol (1159)
-# define Qns_drag_operation_generic builtin_lisp_symbol (1160)
-# define Qns_drag_operation_link builtin_lisp_symbol (1161)
-# define Qns_handle_drag_motion builtin_lisp_symbol (1162)
-# define Qns_in_echo_area builtin_lisp_symbol (1163)
-# define Qns_parse_geometry builtin_lisp_symbol (1164)
-# define Qns_put_working_text builtin_lisp_symbol (1165)
-# define Qns_transparent_titlebar builtin_lisp_symbol (1166)
-# define Qns_unput_working_text builtin_lisp_symbol (1167)
-# define Qnsm_verify_connection builtin_lisp_symbol (1168)
-# define Qnth builtin_lisp_symbol (1169)
-# define Qnull builtin_lisp_symbol (1170)
-# define Qnumber_or_marker_p builtin_lisp_symbol (1171)
-# define Qnumberp builtin_lisp_symbol (1172)
-# define Qnumeric builtin_lisp_symbol (1173)
-# define Qobarray builtin_lisp_symbol (1174)
-# define Qobarray_cache builtin_lisp_symbol (1175)
-# define Qobarrayp builtin_lisp_symbol (1176)
-# define Qobject builtin_lisp_symbol (1177)
-# define Qoblique builtin_lisp_symbol (1178)
-# define Qoclosure_interactive_form builtin_lisp_symbol (1179)
-# define Qodd builtin_lisp_symbol (1180)
-# define Qonly builtin_lisp_symbol (1181)
-# define Qopen builtin_lisp_symbol (1182)
-# define Qopen_network_stream builtin_lisp_symbol (1183)
-# define Qopentype builtin_lisp_symbol (1184)
-# define Qoperations builtin_lisp_symbol (1185)
-# define Qor builtin_lisp_symbol (1186)
-# define Qoutdated builtin_lisp_symbol (1187)
-# define Qouter_border_width builtin_lisp_symbol (1188)
-# define Qouter_edges builtin_lisp_symbol (1189)
-# define Qouter_position builtin_lisp_symbol (1190)
-# define Qouter_size builtin_lisp_symbol (1191)
-# define Qouter_window_id builtin_lisp_symbol (1192)
-# define Qoutermost_restriction builtin_lisp_symbol (1193)
-# define Qoverflow_error builtin_lisp_symbol (1194)
-# define Qoverlay builtin_lisp_symbol (1195)
-# define Qoverlay_arrow builtin_lisp_symbol (1196)
-# define Qoverlay_arrow_bitmap builtin_lisp_symbol (1197)
-# define Qoverlay_arrow_string builtin_lisp_symbol (1198)
-# define Qoverlayp builtin_lisp_symbol (1199)
-# define Qoverride_redirect builtin_lisp_symbol (1200)
-# define Qoverriding_local_map builtin_lisp_symbol (1201)
-# define Qoverriding_plist_environment builtin_lisp_symbol (1202)
-# define Qoverriding_terminal_local_map builtin_lisp_symbol (1203)
-# define Qoverwrite_mode builtin_lisp_symbol (1204)
-# define Qoverwrite_mode_binary builtin_lisp_symbol (1205)
-# define Qp builtin_lisp_symbol (1206)
-# define Qpaper builtin_lisp_symbol (1207)
-# define Qparent_frame builtin_lisp_symbol (1208)
-# define Qparent_id builtin_lisp_symbol (1209)
-# define Qpbm builtin_lisp_symbol (1210)
-# define Qpc builtin_lisp_symbol (1211)
-# define Qpcpu builtin_lisp_symbol (1212)
-# define Qpermanent_local builtin_lisp_symbol (1213)
-# define Qpermanent_local_hook builtin_lisp_symbol (1214)
-# define Qpermission_denied builtin_lisp_symbol (1215)
-# define Qpgrp builtin_lisp_symbol (1216)
-# define Qpgtk builtin_lisp_symbol (1217)
-# define Qphi builtin_lisp_symbol (1218)
-# define Qpinch builtin_lisp_symbol (1219)
-# define Qpipe builtin_lisp_symbol (1220)
-# define Qpipe_process_p builtin_lisp_symbol (1221)
-# define Qplay_sound_functions builtin_lisp_symbol (1222)
-# define Qplist builtin_lisp_symbol (1223)
-# define Qplistp builtin_lisp_symbol (1224)
-# define Qplus builtin_lisp_symbol (1225)
-# define Qpmem builtin_lisp_symbol (1226)
-# define Qpng builtin_lisp_symbol (1227)
-# define Qpoint_entered builtin_lisp_symbol (1228)
-# define Qpoint_left builtin_lisp_symbol (1229)
-# define Qpointer builtin_lisp_symbol (1230)
-# define Qpolling_period builtin_lisp_symbol (1231)
-# define Qpoly builtin_lisp_symbol (1232)
-# define Qpop_handler builtin_lisp_symbol (1233)
-# define Qposition builtin_lisp_symbol (1234)
-# define Qpost_command_hook builtin_lisp_symbol (1235)
-# define Qpost_gc_hook builtin_lisp_symbol (1236)
-# define Qpost_select_region_hook builtin_lisp_symbol (1237)
-# define Qpost_self_insert_hook builtin_lisp_symbol (1238)
-# define Qpost_wake builtin_lisp_symbol (1239)
-# define Qpostscript builtin_lisp_symbol (1240)
-# define Qppid builtin_lisp_symbol (1241)
-# define Qpre_command_hook builtin_lisp_symbol (1242)
-# define Qpre_sleep builtin_lisp_symbol (1243)
-# define Qpreedit_text builtin_lisp_symbol (1244)
-# define Qpressed_button builtin_lisp_symbol (1245)
-# define Qpri builtin_lisp_symbol (1246)
-# define Qprimitive_function builtin_lisp_symbol (1247)
-# define Qprinc builtin_lisp_symbol (1248)
-# define Qprint__unreadable_callback_buffer builtin_lisp_symbol (1249)
-# define Qprint_escape_multibyte builtin_lisp_symbol (1250)
-# define Qprint_escape_nonascii builtin_lisp_symbol (1251)
-# define Qprint_symbols_bare builtin_lisp_symbol (1252)
-# define Qprint_unreadable_function builtin_lisp_symbol (1253)
-# define Qpriority builtin_lisp_symbol (1254)
-# define Qprocess builtin_lisp_symbol (1255)
-# define Qprocess_attributes builtin_lisp_symbol (1256)
-# define Qprocessp builtin_lisp_symbol (1257)
-# define Qprogn builtin_lisp_symbol (1258)
-# define Qpropertize builtin_lisp_symbol (1259)
-# define Qprotected_field builtin_lisp_symbol (1260)
-# define Qprovide builtin_lisp_symbol (1261)
-# define Qpseudo_color builtin_lisp_symbol (1262)
-# define Qpty builtin_lisp_symbol (1263)
-# define Qpurecopy builtin_lisp_symbol (1264)
-# define Qpush_handler builtin_lisp_symbol (1265)
-# define Qpush_window_buffer_onto_prev builtin_lisp_symbol (1266)
-# define Qquit builtin_lisp_symbol (1267)
-# define Qquit_restore builtin_lisp_symbol (1268)
-# define Qquit_restore_prev builtin_lisp_symbol (1269)
-# define Qquote builtin_lisp_symbol (1270)
-# define Qraise builtin_lisp_symbol (1271)
-# define Qrange builtin_lisp_symbol (1272)
-# define Qrange_error builtin_lisp_symbol (1273)
-# define Qratio builtin_lisp_symbol (1274)
-# define Qraw_text builtin_lisp_symbol (1275)
-# define Qread builtin_lisp_symbol (1276)
-# define Qread_char builtin_lisp_symbol (1277)
-# define Qread_file_name builtin_lisp_symbol (1278)
-# define Qread_minibuffer builtin_lisp_symbol (1279)
-# define Qread_number builtin_lisp_symbol (1280)
-# define Qread_only builtin_lisp_symbol (1281)
-# define Qread_symbol_shorthands builtin_lisp_symbol (1282)
-# define Qreal builtin_lisp_symbol (1283)
-# define Qreal_this_command builtin_lisp_symbol (1284)
-# define Qrear_nonsticky builtin_lisp_symbol (1285)
-# define Qrecord builtin_lisp_symbol (1286)
-# define Qrecord_unwind_current_buffer builtin_lisp_symbol (1287)
-# define Qrecord_unwind_protect_excursion builtin_lisp_symbol (1288)
-# define Qrecord_window_buffer builtin_lisp_symbol (1289)
-# define Qrecordp builtin_lisp_symbol (1290)
-# define Qrect builtin_lisp_symbol (1291)
-# define Qrecursion_error builtin_lisp_symbol (1292)
-# define Qredisplay_internal_xC_functionx builtin_lisp_symbol (1293)
-# define Qrelative builtin_lisp_symbol (1294)
-# define Qreleased_button builtin_lisp_symbol (1295)
-# define Qremap builtin_lisp_symbol (1296)
-# define Qremote_file_error builtin_lisp_symbol (1297)
-# define Qrename builtin_lisp_symbol (1298)
-# define Qrename_auto_save_file builtin_lisp_symbol (1299)
-# define Qrename_file builtin_lisp_symbol (1300)
-# define Qreplace_buffer_in_windows builtin_lisp_symbol (1301)
-# define Qrequire builtin_lisp_symbol (1302)
-# define Qreset builtin_lisp_symbol (1303)
-# define Qresume_tty_functions builtin_lisp_symbol (1304)
-# define Qretained builtin_lisp_symbol (1305)
-# define Qreturn builtin_lisp_symbol (1306)
-# define Qreverse_italic builtin_lisp_symbol (1307)
-# define Qrevoke builtin_lisp_symbol (1308)
-# define Qright builtin_lisp_symbol (1309)
-# define Qright_divider builtin_lisp_symbol (1310)
-# define Qright_divider_width builtin_lisp_symbol (1311)
-# define Qright_edge builtin_lisp_symbol (1312)
-# define Qright_fringe builtin_lisp_symbol (1313)
-# define Qright_fringe_help builtin_lisp_symbol (1314)
-# define Qright_margin builtin_lisp_symbol (1315)
-# define Qright_to_left builtin_lisp_symbol (1316)
-# define Qrightmost builtin_lisp_symbol (1317)
-# define Qrisky_local_variable builtin_lisp_symbol (1318)
-# define Qrotate builtin_lisp_symbol (1319)
-# define Qrotate90 builtin_lisp_symbol (1320)
-# define Qrss builtin_lisp_symbol (1321)
-# define Qrun builtin_lisp_symbol (1322)
-# define Qrun_at_time builtin_lisp_symbol (1323)
-# define Qrun_hook_query_error_with_timeout builtin_lisp_symbol (1324)
-# define Qrun_hook_with_args builtin_lisp_symbol (1325)
-# define Qsafe builtin_lisp_symbol (1326)
-# define Qsafe_magic builtin_lisp_symbol (1327)
-# define Qsave_excursion builtin_lisp_symbol (1328)
-# define Qsave_session builtin_lisp_symbol (1329)
-# define Qscale builtin_lisp_symbol (1330)
-# define Qscale_factor builtin_lisp_symbol (1331)
-# define Qscan_error builtin_lisp_symbol (1332)
-# define Qscratch builtin_lisp_symbol (1333)
-# define Qscreen_gamma builtin_lisp_symbol (1334)
-# define Qscroll_bar builtin_lisp_symbol (1335)
-# define Qscroll_bar_background builtin_lisp_symbol (1336)
-# define Qscroll_bar_foreground builtin_lisp_symbol (1337)
-# define Qscroll_bar_height builtin_lisp_symbol (1338)
-# define Qscroll_bar_movement builtin_lisp_symbol (1339)
-# define Qscroll_bar_width builtin_lisp_symbol (1340)
-# define Qscroll_command builtin_lisp_symbol (1341)
-# define Qscroll_down builtin_lisp_symbol (1342)
-# define Qscroll_up builtin_lisp_symbol (1343)
-# define Qsearch_failed builtin_lisp_symbol (1344)
-# define Qselect_frame_set_input_focus builtin_lisp_symbol (1345)
-# define Qselect_window builtin_lisp_symbol (1346)
-# define Qselection_request builtin_lisp_symbol (1347)
-# define Qself_insert_command builtin_lisp_symbol (1348)
-# define Qsemi_bold builtin_lisp_symbol (1349)
-# define Qsemi_light builtin_lisp_symbol (1350)
-# define Qseqpacket builtin_lisp_symbol (1351)
-# define Qsequencep builtin_lisp_symbol (1352)
-# define Qserial builtin_lisp_symbol (1353)
-# define Qsess builtin_lisp_symbol (1354)
-# define Qset builtin_lisp_symbol (1355)
-# define Qset_args_to_local builtin_lisp_symbol (1356)
-# define Qset_buffer_multibyte builtin_lisp_symbol (1357)
-# define Qset_default builtin_lisp_symbol (1358)
-# define Qset_file_acl builtin_lisp_symbol (1359)
-# define Qset_file_modes builtin_lisp_symbol (1360)
-# define Qset_file_selinux_context builtin_lisp_symbol (1361)
-# define Qset_file_times builtin_lisp_symbol (1362)
-# define Qset_internal builtin_lisp_symbol (1363)
-# define Qset_par_to_local builtin_lisp_symbol (1364)
-# define Qset_rest_args_to_local builtin_lisp_symbol (1365)
-# define Qset_visited_file_modtime builtin_lisp_symbol (1366)
-# define Qset_window_configuration builtin_lisp_symbol (1367)
-# define Qsetcar builtin_lisp_symbol (1368)
-# define Qsetcdr builtin_lisp_symbol (1369)
-# define Qsetimm builtin_lisp_symbol (1370)
-# define Qsetq builtin_lisp_symbol (1371)
-# define Qsetting_constant builtin_lisp_symbol (1372)
-# define Qsha1 builtin_lisp_symbol (1373)
-# define Qsha224 builtin_lisp_symbol (1374)
-# define Qsha256 builtin_lisp_symbol (1375)
-# define Qsha384 builtin_lisp_symbol (1376)
-# define Qsha512 builtin_lisp_symbol (1377)
-# define Qshaded builtin_lisp_symbol (1378)
-# define Qshift_jis builtin_lisp_symbol (1379)
-# define Qshlwapi builtin_lisp_symbol (1380)
-# define Qsignal builtin_lisp_symbol (1381)
-# define Qsignal_process_functions builtin_lisp_symbol (1382)
-# define Qsigusr2 builtin_lisp_symbol (1383)
-# define Qsilently builtin_lisp_symbol (1384)
-# define Qsingularity_error builtin_lisp_symbol (1385)
-# define Qsize builtin_lisp_symbol (1386)
-# define Qsize_and_position builtin_lisp_symbol (1387)
-# define Qskip_taskbar builtin_lisp_symbol (1388)
-# define Qsleep_event builtin_lisp_symbol (1389)
-# define Qslice builtin_lisp_symbol (1390)
-# define Qsound builtin_lisp_symbol (1391)
-# define Qsource builtin_lisp_symbol (1392)
-# define Qspace builtin_lisp_symbol (1393)
-# define Qspace_width builtin_lisp_symbol (1394)
-# define Qspecial_form builtin_lisp_symbol (1395)
-# define Qspecial_lowercase builtin_lisp_symbol (1396)
-# define Qspecial_titlecase builtin_lisp_symbol (1397)
-# define Qspecial_uppercase builtin_lisp_symbol (1398)
-# define Qsqlite builtin_lisp_symbol (1399)
-# define Qsqlite3 builtin_lisp_symbol (1400)
-# define Qsqlite_error builtin_lisp_symbol (1401)
-# define Qsqlite_locked_error builtin_lisp_symbol (1402)
-# define Qsqlitep builtin_lisp_symbol (1403)
-# define Qstandard_input builtin_lisp_symbol (1404)
-# define Qstandard_output builtin_lisp_symbol (1405)
-# define Qstart builtin_lisp_symbol (1406)
-# define Qstart_process builtin_lisp_symbol (1407)
-# define Qstate builtin_lisp_symbol (1408)
-# define Qstatic_gray builtin_lisp_symbol (1409)
-# define Qstderr builtin_lisp_symbol (1410)
-# define Qstdin builtin_lisp_symbol (1411)
-# define Qstdout builtin_lisp_symbol (1412)
-# define Qsticky builtin_lisp_symbol (1413)
-# define Qstime builtin_lisp_symbol (1414)
-# define Qstop builtin_lisp_symbol (1415)
-# define Qstraight builtin_lisp_symbol (1416)
-# define Qstring builtin_lisp_symbol (1417)
-# define Qstring_bytes builtin_lisp_symbol (1418)
-# define Qstring_lessp builtin_lisp_symbol (1419)
-# define Qstring_replace builtin_lisp_symbol (1420)
-# define Qstringp builtin_lisp_symbol (1421)
-# define Qstrings builtin_lisp_symbol (1422)
-# define Qsub1 builtin_lisp_symbol (1423)
-# define Qsub_char_table builtin_lisp_symbol (1424)
-# define Qsubfeatures builtin_lisp_symbol (1425)
-# define Qsubr builtin_lisp_symbol (1426)
-# define Qsubr_native_elisp builtin_lisp_symbol (1427)
-# define Qsubrp builtin_lisp_symbol (1428)
-# define Qsubstitute_command_keys builtin_lisp_symbol (1429)
-# define Qsubstitute_env_in_file_name builtin_lisp_symbol (1430)
-# define Qsubstitute_in_file_name builtin_lisp_symbol (1431)
-# define Qsuper builtin_lisp_symbol (1432)
-# define Qsuppress_keymap builtin_lisp_symbol (1433)
-# define Qsuspend_hook builtin_lisp_symbol (1434)
-# define Qsuspend_resume_hook builtin_lisp_symbol (1435)
-# define Qsuspend_tty_functions builtin_lisp_symbol (1436)
-# define Qsvg builtin_lisp_symbol (1437)
-# define Qsw builtin_lisp_symbol (1438)
-# define Qswitch_frame builtin_lisp_symbol (1439)
-# define Qsymbol builtin_lisp_symbol (1440)
-# define Qsymbol_error builtin_lisp_symbol (1441)
-# define Qsymbol_with_pos builtin_lisp_symbol (1442)
-# define Qsymbol_with_pos_p builtin_lisp_symbol (1443)
-# define Qsymbolp builtin_lisp_symbol (1444)
-# define Qsymbols builtin_lisp_symbol (1445)
-# define Qsymbols_with_pos_enabled builtin_lisp_symbol (1446)
-# define Qsyntax_ppss builtin_lisp_symbol (1447)
-# define Qsyntax_ppss_flush_cache builtin_lisp_symbol (1448)
-# define Qsyntax_table builtin_lisp_symbol (1449)
-# define Qsyntax_table_p builtin_lisp_symbol (1450)
-# define Qtab_bar builtin_lisp_symbol (1451)
-# define Qtab_bar_lines builtin_lisp_symbol (1452)
-# define Qtab_bar_size builtin_lisp_symbol (1453)
-# define Qtab_line builtin_lisp_symbol (1454)
-# define Qtab_line_format builtin_lisp_symbol (1455)
-# define Qtarget_idx builtin_lisp_symbol (1456)
-# define Qtemp_buffer_setup_hook builtin_lisp_symbol (1457)
-# define Qtemp_buffer_show_hook builtin_lisp_symbol (1458)
-# define Qterminal builtin_lisp_symbol (1459)
-# define Qterminal_frame builtin_lisp_symbol (1460)
-# define Qterminal_live_p builtin_lisp_symbol (1461)
-# define Qtest builtin_lisp_symbol (1462)
-# define Qtext builtin_lisp_symbol (1463)
-# define Qtext_conversion builtin_lisp_symbol (1464)
-# define Qtext_image_horiz builtin_lisp_symbol (1465)
-# define Qtext_pixels builtin_lisp_symbol (1466)
-# define Qtext_property_default_nonsticky builtin_lisp_symbol (1467)
-# define Qtext_read_only builtin_lisp_symbol (1468)
-# define Qthcount builtin_lisp_symbol (1469)
-# define Qthin builtin_lisp_symbol (1470)
-# define Qthin_space builtin_lisp_symbol (1471)
-# define Qthread builtin_lisp_symbol (1472)
-# define Qthread_buffer_killed builtin_lisp_symbol (1473)
-# define Qthread_event builtin_lisp_symbol (1474)
-# define Qthreadp builtin_lisp_symbol (1475)
-# define Qtiff builtin_lisp_symbol (1476)
-# define Qtime builtin_lisp_symbol (1477)
-# define Qtimer_event_handler builtin_lisp_symbol (1478)
-# define Qtip_frame builtin_lisp_symbol (1479)
-# define Qtitle builtin_lisp_symbol (1480)
-# define Qtitle_bar_size builtin_lisp_symbol (1481)
-# define Qtitlecase builtin_lisp_symbol (1482)
-# define Qtool_bar builtin_lisp_symbol (1483)
-# define Qtool_bar_external builtin_lisp_symbol (1484)
-# define Qtool_bar_lines builtin_lisp_symbol (1485)
-# define Qtool_bar_position builtin_lisp_symbol (1486)
-# define Qtool_bar_size builtin_lisp_symbol (1487)
-# define Qtoolkit_theme_changed builtin_lisp_symbol (1488)
-# define Qtoolkit_theme_set_functions builtin_lisp_symbol (1489)
-# define Qtooltip builtin_lisp_symbol (1490)
-# define Qtop builtin_lisp_symbol (1491)
-# define Qtop_bottom builtin_lisp_symbol (1492)
-# define Qtop_edge builtin_lisp_symbol (1493)
-# define Qtop_left_corner builtin_lisp_symbol (1494)
-# define Qtop_level builtin_lisp_symbol (1495)
-# define Qtop_only builtin_lisp_symbol (1496)
-# define Qtop_right_corner builtin_lisp_symbol (1497)
-# define Qtouch_end builtin_lisp_symbol (1498)
-# define Qtouchscreen builtin_lisp_symbol (1499)
-# define Qtouchscreen_begin builtin_lisp_symbol (1500)
-# define Qtouchscreen_end builtin_lisp_symbol (1501)
-# define Qtouchscreen_update builtin_lisp_symbol (1502)
-# define Qtpgid builtin_lisp_symbol (1503)
-# define Qtrailing_whitespace builtin_lisp_symbol (1504)
-# define Qtranslation_table builtin_lisp_symbol (1505)
-# define Qtranslation_table_id builtin_lisp_symbol (1506)
-# define Qtrapping_constant builtin_lisp_symbol (1507)
-# define Qtree_sitter builtin_lisp_symbol (1508)
-# define Qtree_sitter__library_abi builtin_lisp_symbol (1509)
-# define Qtreesit_buffer_too_large builtin_lisp_symbol (1510)
-# define Qtreesit_compiled_query builtin_lisp_symbol (1511)
-# define Qtreesit_compiled_query_p builtin_lisp_symbol (1512)
-# define Qtreesit_error builtin_lisp_symbol (1513)
-# define Qtreesit_invalid_predicate builtin_lisp_symbol (1514)
-# define Qtreesit_language_remap_alist builtin_lisp_symbol (1515)
-# define Qtreesit_load_language_error builtin_lisp_symbol (1516)
-# define Qtreesit_node builtin_lisp_symbol (1517)
-# define Qtreesit_node_buffer_killed builtin_lisp_symbol (1518)
-# define Qtreesit_node_outdated builtin_lisp_symbol (1519)
-# define Qtreesit_node_p builtin_lisp_symbol (1520)
-# define Qtreesit_parse_error builtin_lisp_symbol (1521)
-# define Qtreesit_parser builtin_lisp_symbol (1522)
-# define Qtreesit_parser_deleted builtin_lisp_symbol (1523)
-# define Qtreesit_parser_p builtin_lisp_symbol (1524)
-# define Qtreesit_pattern_expand builtin_lisp_symbol (1525)
-# define Qtreesit_predicate_not_found builtin_lisp_symbol (1526)
-# define Qtreesit_query_error builtin_lisp_symbol (1527)
-# define Qtreesit_query_p builtin_lisp_symbol (1528)
-# define Qtreesit_range_invalid builtin_lisp_symbol (1529)
-# define Qtreesit_thing_symbol builtin_lisp_symbol (1530)
-# define Qtrue_color builtin_lisp_symbol (1531)
-# define Qtruncation builtin_lisp_symbol (1532)
-# define Qttname builtin_lisp_symbol (1533)
-# define Qtty builtin_lisp_symbol (1534)
-# define Qtty_color_alist builtin_lisp_symbol (1535)
-# define Qtty_color_by_index builtin_lisp_symbol (1536)
-# define Qtty_color_desc builtin_lisp_symbol (1537)
-# define Qtty_color_mode builtin_lisp_symbol (1538)
-# define Qtty_color_standard_values builtin_lisp_symbol (1539)
-# define Qtty_defined_color_alist builtin_lisp_symbol (1540)
-# define Qtty_menu_disabled_face builtin_lisp_symbol (1541)
-# define Qtty_menu_enabled_face builtin_lisp_symbol (1542)
-# define Qtty_menu_exit builtin_lisp_symbol (1543)
-# define Qtty_menu_ignore builtin_lisp_symbol (1544)
-# define Qtty_menu_mouse_movement builtin_lisp_symbol (1545)
-# define Qtty_menu_navigation_map builtin_lisp_symbol (1546)
-# define Qtty_menu_next_item builtin_lisp_symbol (1547)
-# define Qtty_menu_next_menu builtin_lisp_symbol (1548)
-# define Qtty_menu_open_use_tmm builtin_lisp_symbol (1549)
-# define Qtty_menu_prev_item builtin_lisp_symbol (1550)
-# define Qtty_menu_prev_menu builtin_lisp_symbol (1551)
-# define Qtty_menu_select builtin_lisp_symbol (1552)
-# define Qtty_mode_reset_strings builtin_lisp_symbol (1553)
-# define Qtty_mode_set_strings builtin_lisp_symbol (1554)
-# define Qtty_non_selected_cursor builtin_lisp_symbol (1555)
-# define Qtty_select_active_regions builtin_lisp_symbol (1556)
-# define Qtty_set_up_initial_frame_faces builtin_lisp_symbol (1557)
-# define Qtty_type builtin_lisp_symbol (1558)
-# define Qtype_mismatch builtin_lisp_symbol (1559)
-# define Qultra_bold builtin_lisp_symbol (1560)
-# define Qultra_heavy builtin_lisp_symbol (1561)
-# define Qultra_light builtin_lisp_symbol (1562)
-# define Qundecided builtin_lisp_symbol (1563)
-# define Qundecorated builtin_lisp_symbol (1564)
-# define Qundefined builtin_lisp_symbol (1565)
-# define Qundeleted builtin_lisp_symbol (1566)
-# define Qunderflow_error builtin_lisp_symbol (1567)
-# define Qunderline_minimum_offset builtin_lisp_symbol (1568)
-# define Qundo_auto__add_boundary builtin_lisp_symbol (1569)
-# define Qundo_auto__last_boundary_cause builtin_lisp_symbol (1570)
-# define Qundo_auto__this_command_amalgamating builtin_lisp_symbol (1571)
-# define Qundo_auto__undoable_change builtin_lisp_symbol (1572)
-# define Qundo_auto__undoably_changed_buffers builtin_lisp_symbol (1573)
-# define Qundo_auto_amalgamate builtin_lisp_symbol (1574)
-# define Qunevalled builtin_lisp_symbol (1575)
-# define Qunhandled_file_name_directory builtin_lisp_symbol (1576)
-# define Qunicode builtin_lisp_symbol (1577)
-# define Qunicode_bmp builtin_lisp_symbol (1578)
-# define Qunicode_string_p builtin_lisp_symbol (1579)
-# define Quniquify__rename_buffer_advice builtin_lisp_symbol (1580)
-# define Qunix builtin_lisp_symbol (1581)
-# define Qunlet builtin_lisp_symbol (1582)
-# define Qunlock_file builtin_lisp_symbol (1583)
-# define Qunreachable builtin_lisp_symbol (1584)
-# define Qunspecified builtin_lisp_symbol (1585)
-# define Qunsplittable builtin_lisp_symbol (1586)
-# define Qup builtin_lisp_symbol (1587)
-# define Quppercase builtin_lisp_symbol (1588)
-# define Qurl builtin_lisp_symbol (1589)
-# define Qus_ascii builtin_lisp_symbol (1590)
-# define Quse_frame_synchronization builtin_lisp_symbol (1591)
-# define Quse_region_p builtin_lisp_symbol (1592)
-# define Quser builtin_lisp_symbol (1593)
-# define Quser_emacs_directory builtin_lisp_symbol (1594)
-# define Quser_error builtin_lisp_symbol (1595)
-# define Quser_position builtin_lisp_symbol (1596)
-# define Quser_ptr builtin_lisp_symbol (1597)
-# define Quser_ptrp builtin_lisp_symbol (1598)
-# define Quser_search_failed builtin_lisp_symbol (1599)
-# define Quser_size builtin_lisp_symbol (1600)
-# define Quserlock__ask_user_about_supersession_threat builtin_lisp_symbol (1601)
-# define Quserlock__handle_unlock_error builtin_lisp_symbol (1602)
-# define Qutf_16 builtin_lisp_symbol (1603)
-# define Qutf_16le builtin_lisp_symbol (1604)
-# define Qutf_8 builtin_lisp_symbol (1605)
-# define Qutf_8_emacs builtin_lisp_symbol (1606)
-# define Qutf_8_string_p builtin_lisp_symbol (1607)
-# define Qutf_8_unix builtin_lisp_symbol (1608)
-# define Qutime builtin_lisp_symbol (1609)
-# define Qvalue builtin_lisp_symbol (1610)
-# define Qvaluelt builtin_lisp_symbol (1611)
-# define Qvariable_documentation builtin_lisp_symbol (1612)
-# define Qvdrag builtin_lisp_symbol (1613)
-# define Qvector builtin_lisp_symbol (1614)
-# define Qvector_or_char_table_p builtin_lisp_symbol (1615)
-# define Qvector_slots builtin_lisp_symbol (1616)
-# define Qvectorp builtin_lisp_symbol (1617)
-# define Qvectors builtin_lisp_symbol (1618)
-# define Qverify_visited_file_modtime builtin_lisp_symbol (1619)
-# define Qvertical_border builtin_lisp_symbol (1620)
-# define Qvertical_line builtin_lisp_symbol (1621)
-# define Qvertical_scroll_bar builtin_lisp_symbol (1622)
-# define Qvertical_scroll_bars builtin_lisp_symbol (1623)
-# define Qvisibility builtin_lisp_symbol (1624)
-# define Qvisible builtin_lisp_symbol (1625)
-# define Qvisual builtin_lisp_symbol (1626)
-# define Qvoid_function builtin_lisp_symbol (1627)
-# define Qvoid_variable builtin_lisp_symbol (1628)
-# define Qvsize builtin_lisp_symbol (1629)
-# define Qw32 builtin_lisp_symbol (1630)
-# define Qwait_for_wm builtin_lisp_symbol (1631)
-# define Qwall builtin_lisp_symbol (1632)
-# define Qwatchers builtin_lisp_symbol (1633)
-# define Qwave builtin_lisp_symbol (1634)
-# define Qweakness builtin_lisp_symbol (1635)
-# define Qwebp builtin_lisp_symbol (1636)
-# define Qwebpdemux builtin_lisp_symbol (1637)
-# define Qwhen builtin_lisp_symbol (1638)
-# define Qwholenump builtin_lisp_symbol (1639)
-# define Qwidget_type builtin_lisp_symbol (1640)
-# define Qwidth builtin_lisp_symbol (1641)
-# define Qwidth_only builtin_lisp_symbol (1642)
-# define Qwindow builtin_lisp_symbol (1643)
-# define Qwindow__pixel_to_total builtin_lisp_symbol (1644)
-# define Qwindow__resize_mini_frame builtin_lisp_symbol (1645)
-# define Qwindow__resize_root_window builtin_lisp_symbol (1646)
-# define Qwindow__resize_root_window_vertically builtin_lisp_symbol (1647)
-# define Qwindow_buffer_change_functions builtin_lisp_symbol (1648)
-# define Qwindow_configuration builtin_lisp_symbol (1649)
-# define Qwindow_configuration_change_hook builtin_lisp_symbol (1650)
-# define Qwindow_configuration_p builtin_lisp_symbol (1651)
-# define Qwindow_deletable_p builtin_lisp_symbol (1652)
-# define Qwindow_divider builtin_lisp_symbol (1653)
-# define Qwindow_divider_first_pixel builtin_lisp_symbol (1654)
-# define Qwindow_divider_last_pixel builtin_lisp_symbol (1655)
-# define Qwindow_edges builtin_lisp_symbol (1656)
-# define Qwindow_id builtin_lisp_symbol (1657)
-# define Qwindow_live_p builtin_lisp_symbol (1658)
-# define Qwindow_point_insertion_type builtin_lisp_symbol (1659)
-# define Qwindow_scroll_functions builtin_lisp_symbol (1660)
-# define Qwindow_selection_change_functions builtin_lisp_symbol (1661)
-# define Qwindow_size builtin_lisp_symbol (1662)
-# define Qwindow_size_change_functions builtin_lisp_symbol (1663)
-# define Qwindow_state_change_functions builtin_lisp_symbol (1664)
-# define Qwindow_state_change_hook builtin_lisp_symbol (1665)
-# define Qwindow_valid_p builtin_lisp_symbol (1666)
-# define Qwindowp builtin_lisp_symbol (1667)
-# define Qworkarea builtin_lisp_symbol (1668)
-# define Qwrap_prefix builtin_lisp_symbol (1669)
-# define Qwrite builtin_lisp_symbol (1670)
-# define Qwrite_region builtin_lisp_symbol (1671)
-# define Qwrite_region_annotate_functions builtin_lisp_symbol (1672)
-# define Qwrong_length_argument builtin_lisp_symbol (1673)
-# define Qwrong_number_of_arguments builtin_lisp_symbol (1674)
-# define Qwrong_register_subr_call builtin_lisp_symbol (1675)
-# define Qwrong_type_argument builtin_lisp_symbol (1676)
-# define Qx builtin_lisp_symbol (1677)
-# define Qx_create_frame_1 builtin_lisp_symbol (1678)
-# define Qx_create_frame_2 builtin_lisp_symbol (1679)
-# define Qx_frame_parameter builtin_lisp_symbol (1680)
-# define Qx_hide_tip builtin_lisp_symbol (1681)
-# define Qx_pre_popup_menu_hook builtin_lisp_symbol (1682)
-# define Qx_resource_name builtin_lisp_symbol (1683)
-# define Qx_set_menu_bar_lines builtin_lisp_symbol (1684)
-# define Qx_set_window_size_1 builtin_lisp_symbol (1685)
-# define Qx_underline_at_descent_line builtin_lisp_symbol (1686)
-# define Qx_use_underline_position_properties builtin_lisp_symbol (1687)
-# define Qxbm builtin_lisp_symbol (1688)
-# define Qxg_frame_set_char_size builtin_lisp_symbol (1689)
-# define Qxpm builtin_lisp_symbol (1690)
-# define Qxterm__set_selection builtin_lisp_symbol (1691)
-# define Qxwidget builtin_lisp_symbol (1692)
-# define Qxwidget_display_event builtin_lisp_symbol (1693)
-# define Qxwidget_event builtin_lisp_symbol (1694)
-# define Qxwidget_view builtin_lisp_symbol (1695)
-# define Qy_or_n_p builtin_lisp_symbol (1696)
-# define Qyes_or_no_p builtin_lisp_symbol (1697)
-# define Qyes_or_no_p_history builtin_lisp_symbol (1698)
-# define Qz_group builtin_lisp_symbol (1699)
-# define Qzero_width builtin_lisp_symbol (1700)
+# define QCcoalesced builtin_lisp_symbol (40)
+# define QCcoding builtin_lisp_symbol (41)
+# define QCcol builtin_lisp_symbol (42)
+# define QCcolor builtin_lisp_symbol (43)
+# define QCcolor_adjustment builtin_lisp_symbol (44)
+# define QCcolor_symbols builtin_lisp_symbol (45)
+# define QCcombining_capability builtin_lisp_symbol (46)
+# define QCcommand builtin_lisp_symbol (47)
+# define QCcomplete_negotiation builtin_lisp_symbol (48)
+# define QCcompression builtin_lisp_symbol (49)
+# define QCconnection_type builtin_lisp_symbol (50)
+# define QCconversion builtin_lisp_symbol (51)
+# define QCcrlfiles builtin_lisp_symbol (52)
+# define QCcrop builtin_lisp_symbol (53)
+# define QCcss builtin_lisp_symbol (54)
+# define QCdata builtin_lisp_symbol (55)
+# define QCdebug_on_exit builtin_lisp_symbol (56)
+# define QCdecode_translation_table builtin_lisp_symbol (57)
+# define QCdefault_char builtin_lisp_symbol (58)
+# define QCdeferred_for_input builtin_lisp_symbol (59)
+# define QCdestination builtin_lisp_symbol (60)
+# define QCdevice builtin_lisp_symbol (61)
+# define QCdiffie_hellman_prime_bits builtin_lisp_symbol (62)
+# define QCdigest_algorithm_id builtin_lisp_symbol (63)
+# define QCdigest_algorithm_length builtin_lisp_symbol (64)
+# define QCdistant_foreground builtin_lisp_symbol (65)
+# define QCdocumentation builtin_lisp_symbol (66)
+# define QCdpi builtin_lisp_symbol (67)
+# define QCemergency builtin_lisp_symbol (68)
+# define QCenable builtin_lisp_symbol (69)
+# define QCencode_translation_table builtin_lisp_symbol (70)
+# define QCencrypt_then_mac builtin_lisp_symbol (71)
+# define QCeq_q builtin_lisp_symbol (72)
+# define QCequal builtin_lisp_symbol (73)
+# define QCerror builtin_lisp_symbol (74)
+# define QCeval builtin_lisp_symbol (75)
+# define QCexpired builtin_lisp_symbol (76)
+# define QCextend builtin_lisp_symbol (77)
+# define QCfalse builtin_lisp_symbol (78)
+# define QCfalse_object builtin_lisp_symbol (79)
+# define QCfamily builtin_lisp_symbol (80)
+# define QCfile builtin_lisp_symbol (81)
+# define QCfile_handler builtin_lisp_symbol (82)
+# define QCfilter builtin_lisp_symbol (83)
+# define QCfiltered builtin_lisp_symbol (84)
+# define QCflags builtin_lisp_symbol (85)
+# define QCflip builtin_lisp_symbol (86)
+# define QCflowcontrol builtin_lisp_symbol (87)
+# define QCfont builtin_lisp_symbol (88)
+# define QCfont_entity builtin_lisp_symbol (89)
+# define QCfontset builtin_lisp_symbol (90)
+# define QCforeground builtin_lisp_symbol (91)
+# define QCformat builtin_lisp_symbol (92)
+# define QCfoundry builtin_lisp_symbol (93)
+# define QCframes builtin_lisp_symbol (94)
+# define QCfunction builtin_lisp_symbol (95)
+# define QCheight builtin_lisp_symbol (96)
+# define QChelp builtin_lisp_symbol (97)
+# define QCheuristic_mask builtin_lisp_symbol (98)
+# define QChost builtin_lisp_symbol (99)
+# define QChostname builtin_lisp_symbol (100)
+# define QCignore_defface builtin_lisp_symbol (101)
+# define QCimage builtin_lisp_symbol (102)
+# define QCin_place builtin_lisp_symbol (103)
+# define QCindex builtin_lisp_symbol (104)
+# define QCinherit builtin_lisp_symbol (105)
+# define QCinsecure builtin_lisp_symbol (106)
+# define QCinvalid builtin_lisp_symbol (107)
+# define QCinvalid_ocsp_status builtin_lisp_symbol (108)
+# define QCinverse_video builtin_lisp_symbol (109)
+# define QCissuer builtin_lisp_symbol (110)
+# define QCissuer_unique_id builtin_lisp_symbol (111)
+# define QCitalic builtin_lisp_symbol (112)
+# define QCkey builtin_lisp_symbol (113)
+# define QCkey_exchange builtin_lisp_symbol (114)
+# define QCkey_sequence builtin_lisp_symbol (115)
+# define QCkeylist builtin_lisp_symbol (116)
+# define QCkeys builtin_lisp_symbol (117)
+# define QClabel builtin_lisp_symbol (118)
+# define QClang builtin_lisp_symbol (119)
+# define QClessp builtin_lisp_symbol (120)
+# define QClientHello_Padding builtin_lisp_symbol (121)
+# define QCline builtin_lisp_symbol (122)
+# define QCline_width builtin_lisp_symbol (123)
+# define QCloader builtin_lisp_symbol (124)
+# define QClocal builtin_lisp_symbol (125)
+# define QClog builtin_lisp_symbol (126)
+# define QCloglevel builtin_lisp_symbol (127)
+# define QCmac builtin_lisp_symbol (128)
+# define QCmac_algorithm_id builtin_lisp_symbol (129)
+# define QCmac_algorithm_keysize builtin_lisp_symbol (130)
+# define QCmac_algorithm_length builtin_lisp_symbol (131)
+# define QCmac_algorithm_noncesize builtin_lisp_symbol (132)
+# define QCmap builtin_lisp_symbol (133)
+# define QCmargin builtin_lisp_symbol (134)
+# define QCmask builtin_lisp_symbol (135)
+# define QCmatch builtin_lisp_symbol (136)
+# define QCmatch_q builtin_lisp_symbol (137)
+# define QCmatrix builtin_lisp_symbol (138)
+# define QCmax_height builtin_lisp_symbol (139)
+# define QCmax_time builtin_lisp_symbol (140)
+# define QCmax_width builtin_lisp_symbol (141)
+# define QCmin_prime_bits builtin_lisp_symbol (142)
+# define QCminspace builtin_lisp_symbol (143)
+# define QCmissing_ocsp_status builtin_lisp_symbol (144)
+# define QCmnemonic builtin_lisp_symbol (145)
+# define QCmouse builtin_lisp_symbol (146)
+# define QCname builtin_lisp_symbol (147)
+# define QCno_host_match builtin_lisp_symbol (148)
+# define QCnoquery builtin_lisp_symbol (149)
+# define QCnot_activated builtin_lisp_symbol (150)
+# define QCnot_ca builtin_lisp_symbol (151)
+# define QCnowait builtin_lisp_symbol (152)
+# define QCnull builtin_lisp_symbol (153)
+# define QCnull_object builtin_lisp_symbol (154)
+# define QCobject_type builtin_lisp_symbol (155)
+# define QCordinary builtin_lisp_symbol (156)
+# define QCotf builtin_lisp_symbol (157)
+# define QCoverline builtin_lisp_symbol (158)
+# define QCparity builtin_lisp_symbol (159)
+# define QCpass builtin_lisp_symbol (160)
+# define QCpem builtin_lisp_symbol (161)
+# define QCplist builtin_lisp_symbol (162)
+# define QCplus builtin_lisp_symbol (163)
+# define QCpointer builtin_lisp_symbol (164)
+# define QCport builtin_lisp_symbol (165)
+# define QCpos builtin_lisp_symbol (166)
+# define QCposition builtin_lisp_symbol (167)
+# define QCpost_read_conversion builtin_lisp_symbol (168)
+# define QCpre_write_conversion builtin_lisp_symbol (169)
+# define QCpred builtin_lisp_symbol (170)
+# define QCpred_q builtin_lisp_symbol (171)
+# define QCpriority builtin_lisp_symbol (172)
+# define QCprocess builtin_lisp_symbol (173)
+# define QCpropertize builtin_lisp_symbol (174)
+# define QCprotocol builtin_lisp_symbol (175)
+# define QCpt_height builtin_lisp_symbol (176)
+# define QCpt_width builtin_lisp_symbol (177)
+# define QCpublic_key_algorithm builtin_lisp_symbol (178)
+# define QCpublic_key_id builtin_lisp_symbol (179)
+# define QCpublic_key_id_sha256 builtin_lisp_symbol (180)
+# define QCpurecopy builtin_lisp_symbol (181)
+# define QCpurpose_mismatch builtin_lisp_symbol (182)
+# define QCquestion builtin_lisp_symbol (183)
+# define QCradio builtin_lisp_symbol (184)
+# define QCregistry builtin_lisp_symbol (185)
+# define QCrehash_size builtin_lisp_symbol (186)
+# define QCrehash_threshold builtin_lisp_symbol (187)
+# define QCrelative_height builtin_lisp_symbol (188)
+# define QCrelative_width builtin_lisp_symbol (189)
+# define QCrelief builtin_lisp_symbol (190)
+# define QCremote builtin_lisp_symbol (191)
+# define QCreverse builtin_lisp_symbol (192)
+# define QCrevocation_data_issued_in_future builtin_lisp_symbol (193)
+# define QCrevocation_data_superseded builtin_lisp_symbol (194)
+# define QCrevoked builtin_lisp_symbol (195)
+# define QCrotation builtin_lisp_symbol (196)
+# define QCrtl builtin_lisp_symbol (197)
+# define QCsafe_renegotiation builtin_lisp_symbol (198)
+# define QCscalable builtin_lisp_symbol (199)
+# define QCscale builtin_lisp_symbol (200)
+# define QCscript builtin_lisp_symbol (201)
+# define QCself_signed builtin_lisp_symbol (202)
+# define QCsentinel builtin_lisp_symbol (203)
+# define QCserial_number builtin_lisp_symbol (204)
+# define QCserver builtin_lisp_symbol (205)
+# define QCservice builtin_lisp_symbol (206)
+# define QCsignature_algorithm builtin_lisp_symbol (207)
+# define QCsignature_failure builtin_lisp_symbol (208)
+# define QCsigner_constraints_failure builtin_lisp_symbol (209)
+# define QCsize builtin_lisp_symbol (210)
+# define QCslant builtin_lisp_symbol (211)
+# define QCspacing builtin_lisp_symbol (212)
+# define QCspeed builtin_lisp_symbol (213)
+# define QCstar builtin_lisp_symbol (214)
+# define QCstderr builtin_lisp_symbol (215)
+# define QCstipple builtin_lisp_symbol (216)
+# define QCstop builtin_lisp_symbol (217)
+# define QCstopbits builtin_lisp_symbol (218)
+# define QCstrike_through builtin_lisp_symbol (219)
+# define QCstyle builtin_lisp_symbol (220)
+# define QCsubject builtin_lisp_symbol (221)
+# define QCsubject_unique_id builtin_lisp_symbol (222)
+# define QCsuccess builtin_lisp_symbol (223)
+# define QCsummary builtin_lisp_symbol (224)
+# define QCtest builtin_lisp_symbol (225)
+# define QCtls_parameters builtin_lisp_symbol (226)
+# define QCtoggle builtin_lisp_symbol (227)
+# define QCtotal_time builtin_lisp_symbol (228)
+# define QCtransform_smoothing builtin_lisp_symbol (229)
+# define QCtrustfiles builtin_lisp_symbol (230)
+# define QCtype builtin_lisp_symbol (231)
+# define QCunderline builtin_lisp_symbol (232)
+# define QCunknown_ca builtin_lisp_symbol (233)
+# define QCuse_external_socket builtin_lisp_symbol (234)
+# define QCuser_spec builtin_lisp_symbol (235)
+# define QCvalid_from builtin_lisp_symbol (236)
+# define QCvalid_to builtin_lisp_symbol (237)
+# define QCverify_error builtin_lisp_symbol (238)
+# define QCverify_flags builtin_lisp_symbol (239)
+# define QCversion builtin_lisp_symbol (240)
+# define QCvert_only builtin_lisp_symbol (241)
+# define QCvisible builtin_lisp_symbol (242)
+# define QCvolume builtin_lisp_symbol (243)
+# define QCwarnings builtin_lisp_symbol (244)
+# define QCweakness builtin_lisp_symbol (245)
+# define QCweight builtin_lisp_symbol (246)
+# define QCwidth builtin_lisp_symbol (247)
+# define QCwindow builtin_lisp_symbol (248)
+# define QCwrap builtin_lisp_symbol (249)
+# define QDiscarded_Samples builtin_lisp_symbol (250)
+# define QFILE_NAME builtin_lisp_symbol (251)
+# define QL2R builtin_lisp_symbol (252)
+# define QPRIMARY builtin_lisp_symbol (253)
+# define QR2L builtin_lisp_symbol (254)
+# define QSECONDARY builtin_lisp_symbol (255)
+# define QTARGETS builtin_lisp_symbol (256)
+# define QTEXT builtin_lisp_symbol (257)
+# define QUTF8_STRING builtin_lisp_symbol (258)
+# define QUnknown_error builtin_lisp_symbol (259)
+# define QXdndActionCopy builtin_lisp_symbol (260)
+# define QXdndActionLink builtin_lisp_symbol (261)
+# define QXdndActionMove builtin_lisp_symbol (262)
+# define QXdndActionPrivate builtin_lisp_symbol (263)
+# define Qabove builtin_lisp_symbol (264)
+# define Qabove_handle builtin_lisp_symbol (265)
+# define Qabove_suspended builtin_lisp_symbol (266)
+# define Qaccess_file builtin_lisp_symbol (267)
+# define Qactivate builtin_lisp_symbol (268)
+# define Qactivate_front builtin_lisp_symbol (269)
+# define Qactivate_input_method builtin_lisp_symbol (270)
+# define Qactivate_mark_hook builtin_lisp_symbol (271)
+# define Qactivate_menubar_hook builtin_lisp_symbol (272)
+# define Qadd1 builtin_lisp_symbol (273)
+# define Qadd_name_to_file builtin_lisp_symbol (274)
+# define Qadd_to_history builtin_lisp_symbol (275)
+# define Qafter_change_functions builtin_lisp_symbol (276)
+# define Qafter_delete_frame_functions builtin_lisp_symbol (277)
+# define Qafter_handle builtin_lisp_symbol (278)
+# define Qafter_insert_file_set_buffer_file_coding_system builtin_lisp_symbol (279)
+# define Qafter_insert_file_set_coding builtin_lisp_symbol (280)
+# define Qafter_pdump_load_hook builtin_lisp_symbol (281)
+# define Qafter_string builtin_lisp_symbol (282)
+# define Qalist builtin_lisp_symbol (283)
+# define Qall builtin_lisp_symbol (284)
+# define Qalloc builtin_lisp_symbol (285)
+# define Qalpha builtin_lisp_symbol (286)
+# define Qalpha_background builtin_lisp_symbol (287)
+# define Qalt builtin_lisp_symbol (288)
+# define Qand builtin_lisp_symbol (289)
+# define Qand_optional builtin_lisp_symbol (290)
+# define Qand_rest builtin_lisp_symbol (291)
+# define Qandroid builtin_lisp_symbol (292)
+# define Qanonymous builtin_lisp_symbol (293)
+# define Qappend builtin_lisp_symbol (294)
+# define Qapply builtin_lisp_symbol (295)
+# define Qaref builtin_lisp_symbol (296)
+# define Qargs builtin_lisp_symbol (297)
+# define Qargs_out_of_range builtin_lisp_symbol (298)
+# define Qarith_error builtin_lisp_symbol (299)
+# define Qarray builtin_lisp_symbol (300)
+# define Qarrayp builtin_lisp_symbol (301)
+# define Qarrow builtin_lisp_symbol (302)
+# define Qascii builtin_lisp_symbol (303)
+# define Qascii_0 builtin_lisp_symbol (304)
+# define Qascii_character builtin_lisp_symbol (305)
+# define Qaset builtin_lisp_symbol (306)
+# define Qask_user_about_lock builtin_lisp_symbol (307)
+# define Qassq_delete_all builtin_lisp_symbol (308)
+# define Qassume builtin_lisp_symbol (309)
+# define Qattrib builtin_lisp_symbol (310)
+# define Qauto builtin_lisp_symbol (311)
+# define Qauto_composed builtin_lisp_symbol (312)
+# define Qauto_fill_chars builtin_lisp_symbol (313)
+# define Qauto_hscroll_mode builtin_lisp_symbol (314)
+# define Qauto_lower builtin_lisp_symbol (315)
+# define Qauto_raise builtin_lisp_symbol (316)
+# define Qauto_save builtin_lisp_symbol (317)
+# define Qauto_save_coding builtin_lisp_symbol (318)
+# define Qauto_save_hook builtin_lisp_symbol (319)
+# define Qautoload builtin_lisp_symbol (320)
+# define Qautosaved builtin_lisp_symbol (321)
+# define Qbackground_color builtin_lisp_symbol (322)
+# define Qbackground_mode builtin_lisp_symbol (323)
+# define Qbackquote builtin_lisp_symbol (324)
+# define Qbar builtin_lisp_symbol (325)
+# define Qbare_symbol_p builtin_lisp_symbol (326)
+# define Qbefore_change_functions builtin_lisp_symbol (327)
+# define Qbefore_handle builtin_lisp_symbol (328)
+# define Qbefore_string builtin_lisp_symbol (329)
+# define Qbeginning_of_buffer builtin_lisp_symbol (330)
+# define Qbelow builtin_lisp_symbol (331)
+# define Qbelow_handle builtin_lisp_symbol (332)
+# define Qbig builtin_lisp_symbol (333)
+# define Qbig5 builtin_lisp_symbol (334)
+# define Qbignum builtin_lisp_symbol (335)
+# define Qbinary builtin_lisp_symbol (336)
+# define Qbitmap_spec_p builtin_lisp_symbol (337)
+# define Qblack builtin_lisp_symbol (338)
+# define Qbmp builtin_lisp_symbol (339)
+# define Qbold builtin_lisp_symbol (340)
+# define Qbook builtin_lisp_symbol (341)
+# define Qbool_vector builtin_lisp_symbol (342)
+# define Qbool_vector_p builtin_lisp_symbol (343)
+# define Qboolean builtin_lisp_symbol (344)
+# define Qbooleanp builtin_lisp_symbol (345)
+# define Qborder builtin_lisp_symbol (346)
+# define Qborder_color builtin_lisp_symbol (347)
+# define Qborder_width builtin_lisp_symbol (348)
+# define Qborders_respect_alpha_background builtin_lisp_symbol (349)
+# define Qboth builtin_lisp_symbol (350)
+# define Qboth_horiz builtin_lisp_symbol (351)
+# define Qbottom builtin_lisp_symbol (352)
+# define Qbottom_divider builtin_lisp_symbol (353)
+# define Qbottom_divider_width builtin_lisp_symbol (354)
+# define Qbottom_edge builtin_lisp_symbol (355)
+# define Qbottom_left_corner builtin_lisp_symbol (356)
+# define Qbottom_right_corner builtin_lisp_symbol (357)
+# define Qboundary builtin_lisp_symbol (358)
+# define Qbounds builtin_lisp_symbol (359)
+# define Qbox builtin_lisp_symbol (360)
+# define Qbuffer builtin_lisp_symbol (361)
+# define Qbuffer_access_fontify_functions builtin_lisp_symbol (362)
+# define Qbuffer_file_coding_system builtin_lisp_symbol (363)
+# define Qbuffer_file_name builtin_lisp_symbol (364)
+# define Qbuffer_file_number builtin_lisp_symbol (365)
+# define Qbuffer_list builtin_lisp_symbol (366)
+# define Qbuffer_list_update_hook builtin_lisp_symbol (367)
+# define Qbuffer_name_history builtin_lisp_symbol (368)
+# define Qbuffer_or_string_p builtin_lisp_symbol (369)
+# define Qbuffer_position builtin_lisp_symbol (370)
+# define Qbuffer_predicate builtin_lisp_symbol (371)
+# define Qbuffer_read_only builtin_lisp_symbol (372)
+# define Qbuffer_save_without_query builtin_lisp_symbol (373)
+# define Qbuffer_stale_function builtin_lisp_symbol (374)
+# define Qbuffer_undo_list builtin_lisp_symbol (375)
+# define Qbuffered builtin_lisp_symbol (376)
+# define Qbufferp builtin_lisp_symbol (377)
+# define Qbuffers builtin_lisp_symbol (378)
+# define Qburied_buffer_list builtin_lisp_symbol (379)
+# define Qbyte_code_function builtin_lisp_symbol (380)
+# define Qbyte_code_function_p builtin_lisp_symbol (381)
+# define Qbyte_code_meter builtin_lisp_symbol (382)
+# define Qbyte_run_unescaped_character_literals_warning builtin_lisp_symbol (383)
+# define Qc builtin_lisp_symbol (384)
+# define Qcall builtin_lisp_symbol (385)
+# define Qcall_process builtin_lisp_symbol (386)
+# define Qcall_process_region builtin_lisp_symbol (387)
+# define Qcallref builtin_lisp_symbol (388)
+# define Qcancel_timer builtin_lisp_symbol (389)
+# define Qcanonical_combining_class builtin_lisp_symbol (390)
+# define Qcar builtin_lisp_symbol (391)
+# define Qcar_less_than_car builtin_lisp_symbol (392)
+# define Qcase_fold_search builtin_lisp_symbol (393)
+# define Qcase_symbols_as_words builtin_lisp_symbol (394)
+# define Qcase_table builtin_lisp_symbol (395)
+# define Qcase_table_p builtin_lisp_symbol (396)
+# define Qcatcher builtin_lisp_symbol (397)
+# define Qcategory builtin_lisp_symbol (398)
+# define Qcategory_table builtin_lisp_symbol (399)
+# define Qcategory_table_p builtin_lisp_symbol (400)
+# define Qcategoryp builtin_lisp_symbol (401)
+# define Qcategorysetp builtin_lisp_symbol (402)
+# define Qccl builtin_lisp_symbol (403)
+# define Qccl_program_idx builtin_lisp_symbol (404)
+# define Qcclp builtin_lisp_symbol (405)
+# define Qcdr builtin_lisp_symbol (406)
+# define Qceiling builtin_lisp_symbol (407)
+# define Qcenter builtin_lisp_symbol (408)
+# define Qch builtin_lisp_symbol (409)
+# define Qchange_frame_size builtin_lisp_symbol (410)
+# define Qchange_major_mode_hook builtin_lisp_symbol (411)
+# define Qchannel builtin_lisp_symbol (412)
+# define Qchannelp builtin_lisp_symbol (413)
+# define Qchar_code_property_table builtin_lisp_symbol (414)
+# define Qchar_from_name builtin_lisp_symbol (415)
+# define Qchar_or_string_p builtin_lisp_symbol (416)
+# define Qchar_script_table builtin_lisp_symbol (417)
+# define Qchar_table builtin_lisp_symbol (418)
+# define Qchar_table_extra_slots builtin_lisp_symbol (419)
+# define Qchar_table_p builtin_lisp_symbol (420)
+# define Qcharacterp builtin_lisp_symbol (421)
+# define Qcharset builtin_lisp_symbol (422)
+# define Qcharsetp builtin_lisp_symbol (423)
+# define Qchild_frame_border builtin_lisp_symbol (424)
+# define Qchild_frame_border_width builtin_lisp_symbol (425)
+# define Qchoice builtin_lisp_symbol (426)
+# define Qciphers builtin_lisp_symbol (427)
+# define Qcircle builtin_lisp_symbol (428)
+# define Qcircular_list builtin_lisp_symbol (429)
+# define Qclone_indirect_buffer_hook builtin_lisp_symbol (430)
+# define Qclone_of builtin_lisp_symbol (431)
+# define Qcloned_from builtin_lisp_symbol (432)
+# define Qclose_tab builtin_lisp_symbol (433)
+# define Qclosed builtin_lisp_symbol (434)
+# define Qcmajflt builtin_lisp_symbol (435)
+# define Qcminflt builtin_lisp_symbol (436)
+# define Qcocoa builtin_lisp_symbol (437)
+# define Qcode_conversion_map builtin_lisp_symbol (438)
+# define Qcode_conversion_map_id builtin_lisp_symbol (439)
+# define Qcodeset builtin_lisp_symbol (440)
+# define Qcoding builtin_lisp_symbol (441)
+# define Qcoding_system builtin_lisp_symbol (442)
+# define Qcoding_system_define_form builtin_lisp_symbol (443)
+# define Qcoding_system_error builtin_lisp_symbol (444)
+# define Qcoding_system_for_write builtin_lisp_symbol (445)
+# define Qcoding_system_history builtin_lisp_symbol (446)
+# define Qcoding_system_p builtin_lisp_symbol (447)
+# define Qcolor builtin_lisp_symbol (448)
+# define Qcolumns builtin_lisp_symbol (449)
+# define Qcomm builtin_lisp_symbol (450)
+# define Qcomma builtin_lisp_symbol (451)
+# define Qcomma_at builtin_lisp_symbol (452)
+# define Qcommand_debug_status builtin_lisp_symbol (453)
+# define Qcommand_error_default_function builtin_lisp_symbol (454)
+# define Qcommand_execute builtin_lisp_symbol (455)
+# define Qcommand_history builtin_lisp_symbol (456)
+# define Qcommand_line_processed builtin_lisp_symbol (457)
+# define Qcommand_modes builtin_lisp_symbol (458)
+# define Qcommandp builtin_lisp_symbol (459)
+# define Qcomment builtin_lisp_symbol (460)
+# define Qcomment_end_can_be_escaped builtin_lisp_symbol (461)
+# define Qcomp_libgccjit_reproducer builtin_lisp_symbol (462)
+# define Qcomp_maybe_gc_or_quit builtin_lisp_symbol (463)
+# define Qcomp_mvar builtin_lisp_symbol (464)
+# define Qcomp_sanitizer_error builtin_lisp_symbol (465)
+# define Qcomp_subr_trampoline_install builtin_lisp_symbol (466)
+# define Qcompleting_read_function builtin_lisp_symbol (467)
+# define Qcompletion_ignore_case builtin_lisp_symbol (468)
+# define Qcomposition builtin_lisp_symbol (469)
+# define Qconcat builtin_lisp_symbol (470)
+# define Qcond_jump builtin_lisp_symbol (471)
+# define Qcond_jump_narg_leq builtin_lisp_symbol (472)
+# define Qcondensed builtin_lisp_symbol (473)
+# define Qcondition_case builtin_lisp_symbol (474)
+# define Qcondition_variable builtin_lisp_symbol (475)
+# define Qcondition_variable_p builtin_lisp_symbol (476)
+# define Qconfig_changed_event builtin_lisp_symbol (477)
+# define Qconfiguration builtin_lisp_symbol (478)
+# define Qconnect builtin_lisp_symbol (479)
+# define Qcons builtin_lisp_symbol (480)
+# define Qconses builtin_lisp_symbol (481)
+# define Qconsp builtin_lisp_symbol (482)
+# define Qcontinuation builtin_lisp_symbol (483)
+# define Qcontrol builtin_lisp_symbol (484)
+# define Qcopy_directory builtin_lisp_symbol (485)
+# define Qcopy_file builtin_lisp_symbol (486)
+# define Qcount builtin_lisp_symbol (487)
+# define Qcreate builtin_lisp_symbol (488)
+# define Qcritical builtin_lisp_symbol (489)
+# define Qcrop builtin_lisp_symbol (490)
+# define Qcstime builtin_lisp_symbol (491)
+# define Qctime builtin_lisp_symbol (492)
+# define Qcurrent builtin_lisp_symbol (493)
+# define Qcurrent_input_method builtin_lisp_symbol (494)
+# define Qcurrent_key_remap_sequence builtin_lisp_symbol (495)
+# define Qcurrent_line builtin_lisp_symbol (496)
+# define Qcurrent_load_list builtin_lisp_symbol (497)
+# define Qcurrent_minibuffer_command builtin_lisp_symbol (498)
+# define Qcursor builtin_lisp_symbol (499)
+# define Qcursor_color builtin_lisp_symbol (500)
+# define Qcursor_in_echo_area builtin_lisp_symbol (501)
+# define Qcursor_type builtin_lisp_symbol (502)
+# define Qcurve builtin_lisp_symbol (503)
+# define Qcustom_delayed_init_variables builtin_lisp_symbol (504)
+# define Qcustom_variable_history builtin_lisp_symbol (505)
+# define Qcustom_variable_p builtin_lisp_symbol (506)
+# define Qcutime builtin_lisp_symbol (507)
+# define Qcw builtin_lisp_symbol (508)
+# define Qcycle_sort_function builtin_lisp_symbol (509)
+# define Qcyclic_function_indirection builtin_lisp_symbol (510)
+# define Qcyclic_variable_indirection builtin_lisp_symbol (511)
+# define Qd builtin_lisp_symbol (512)
+# define Qd_default builtin_lisp_symbol (513)
+# define Qd_ephemeral builtin_lisp_symbol (514)
+# define Qdark builtin_lisp_symbol (515)
+# define Qdashes builtin_lisp_symbol (516)
+# define Qdata builtin_lisp_symbol (517)
+# define Qdatagram builtin_lisp_symbol (518)
+# define Qdays builtin_lisp_symbol (519)
+# define Qdbus_event builtin_lisp_symbol (520)
+# define Qdeactivate_mark builtin_lisp_symbol (521)
+# define Qdebug builtin_lisp_symbol (522)
+# define Qdebug_early builtin_lisp_symbol (523)
+# define Qdebug_early__handler builtin_lisp_symbol (524)
+# define Qdebug_early__muted builtin_lisp_symbol (525)
+# define Qdebug_on_next_call builtin_lisp_symbol (526)
+# define Qdebugger builtin_lisp_symbol (527)
+# define Qdebugger_may_continue builtin_lisp_symbol (528)
+# define Qdecomposed_characters builtin_lisp_symbol (529)
+# define Qdedicated builtin_lisp_symbol (530)
+# define Qdefalias_fset_function builtin_lisp_symbol (531)
+# define Qdefault builtin_lisp_symbol (532)
+# define Qdefault_directory builtin_lisp_symbol (533)
+# define Qdefault_keyboard_coding_system builtin_lisp_symbol (534)
+# define Qdefault_terminal_coding_system builtin_lisp_symbol (535)
+# define Qdefine_charset_internal builtin_lisp_symbol (536)
+# define Qdefine_coding_system_internal builtin_lisp_symbol (537)
+# define Qdefun builtin_lisp_symbol (538)
+# define Qdefvaralias builtin_lisp_symbol (539)
+# define Qdelay builtin_lisp_symbol (540)
+# define Qdelayed_warnings_hook builtin_lisp_symbol (541)
+# define Qdelete builtin_lisp_symbol (542)
+# define Qdelete_auto_save_file_if_necessary builtin_lisp_symbol (543)
+# define Qdelete_before builtin_lisp_symbol (544)
+# define Qdelete_by_moving_to_trash builtin_lisp_symbol (545)
+# define Qdelete_directory builtin_lisp_symbol (546)
+# define Qdelete_file builtin_lisp_symbol (547)
+# define Qdelete_file_internal builtin_lisp_symbol (548)
+# define Qdelete_frame builtin_lisp_symbol (549)
+# define Qdelete_frame_functions builtin_lisp_symbol (550)
+# define Qdelete_terminal_functions builtin_lisp_symbol (551)
+# define Qdelete_window builtin_lisp_symbol (552)
+# define Qdigests builtin_lisp_symbol (553)
+# define Qdir_ok builtin_lisp_symbol (554)
+# define Qdirect_call builtin_lisp_symbol (555)
+# define Qdirect_callref builtin_lisp_symbol (556)
+# define Qdirect_color builtin_lisp_symbol (557)
+# define Qdirectory_file_name builtin_lisp_symbol (558)
+# define Qdirectory_files builtin_lisp_symbol (559)
+# define Qdirectory_files_and_attributes builtin_lisp_symbol (560)
+# define Qdisable_eval builtin_lisp_symbol (561)
+# define Qdisabled builtin_lisp_symbol (562)
+# define Qdisplay builtin_lisp_symbol (563)
+# define Qdisplay_buffer builtin_lisp_symbol (564)
+# define Qdisplay_fill_column_indicator builtin_lisp_symbol (565)
+# define Qdisplay_fill_column_indicator_character builtin_lisp_symbol (566)
+# define Qdisplay_fill_column_indicator_column builtin_lisp_symbol (567)
+# define Qdisplay_line_numbers builtin_lisp_symbol (568)
+# define Qdisplay_line_numbers_disable builtin_lisp_symbol (569)
+# define Qdisplay_line_numbers_offset builtin_lisp_symbol (570)
+# define Qdisplay_line_numbers_widen builtin_lisp_symbol (571)
+# define Qdisplay_line_numbers_width builtin_lisp_symbol (572)
+# define Qdisplay_monitors_changed_functions builtin_lisp_symbol (573)
+# define Qdisplay_table builtin_lisp_symbol (574)
+# define Qdisplay_type builtin_lisp_symbol (575)
+# define Qdisplay_warning builtin_lisp_symbol (576)
+# define Qdo_after_load_evaluation builtin_lisp_symbol (577)
+# define Qdomain_error builtin_lisp_symbol (578)
+# define Qdont_clear_message builtin_lisp_symbol (579)
+# define Qdos builtin_lisp_symbol (580)
+# define Qdots builtin_lisp_symbol (581)
+# define Qdouble_line builtin_lisp_symbol (582)
+# define Qdown builtin_lisp_symbol (583)
+# define Qdrag_internal_border builtin_lisp_symbol (584)
+# define Qdrag_n_drop builtin_lisp_symbol (585)
+# define Qdrag_source builtin_lisp_symbol (586)
+# define Qdrag_with_header_line builtin_lisp_symbol (587)
+# define Qdrag_with_mode_line builtin_lisp_symbol (588)
+# define Qdrag_with_tab_line builtin_lisp_symbol (589)
+# define Qdragging builtin_lisp_symbol (590)
+# define Qdropping builtin_lisp_symbol (591)
+# define Qdump_emacs_portable__sort_predicate builtin_lisp_symbol (592)
+# define Qdump_emacs_portable__sort_predicate_copied builtin_lisp_symbol (593)
+# define Qdump_file_name builtin_lisp_symbol (594)
+# define Qdumped_with_pdumper builtin_lisp_symbol (595)
+# define Qecho_area_clear_hook builtin_lisp_symbol (596)
+# define Qecho_keystrokes builtin_lisp_symbol (597)
+# define Qedge_detection builtin_lisp_symbol (598)
+# define Qegid builtin_lisp_symbol (599)
+# define Qeight_bit builtin_lisp_symbol (600)
+# define Qelt builtin_lisp_symbol (601)
+# define Qem builtin_lisp_symbol (602)
+# define Qemacs builtin_lisp_symbol (603)
+# define Qemacs_mule builtin_lisp_symbol (604)
+# define Qemboss builtin_lisp_symbol (605)
+# define Qemoji builtin_lisp_symbol (606)
+# define Qempty_box builtin_lisp_symbol (607)
+# define Qempty_line builtin_lisp_symbol (608)
+# define Qenable_recursive_minibuffers builtin_lisp_symbol (609)
+# define Qencode_time builtin_lisp_symbol (610)
+# define Qencoded builtin_lisp_symbol (611)
+# define Qend_of_buffer builtin_lisp_symbol (612)
+# define Qend_of_file builtin_lisp_symbol (613)
+# define Qend_scroll builtin_lisp_symbol (614)
+# define Qend_session builtin_lisp_symbol (615)
+# define Qentry builtin_lisp_symbol (616)
+# define Qeq builtin_lisp_symbol (617)
+# define Qeql builtin_lisp_symbol (618)
+# define Qequal builtin_lisp_symbol (619)
+# define Qerror_conditions builtin_lisp_symbol (620)
+# define Qerror_message builtin_lisp_symbol (621)
+# define Qescape_glyph builtin_lisp_symbol (622)
+# define Qetime builtin_lisp_symbol (623)
+# define Qeuid builtin_lisp_symbol (624)
+# define Qeval builtin_lisp_symbol (625)
+# define Qeval_buffer_list builtin_lisp_symbol (626)
+# define Qeval_minibuffer builtin_lisp_symbol (627)
+# define Qevaporate builtin_lisp_symbol (628)
+# define Qeven builtin_lisp_symbol (629)
+# define Qevent_kind builtin_lisp_symbol (630)
+# define Qevent_symbol_element_mask builtin_lisp_symbol (631)
+# define Qevent_symbol_elements builtin_lisp_symbol (632)
+# define Qexcessive_lisp_nesting builtin_lisp_symbol (633)
+# define Qexcessive_variable_binding builtin_lisp_symbol (634)
+# define Qexcl builtin_lisp_symbol (635)
+# define Qexit builtin_lisp_symbol (636)
+# define Qexpand_abbrev builtin_lisp_symbol (637)
+# define Qexpand_file_name builtin_lisp_symbol (638)
+# define Qexpanded builtin_lisp_symbol (639)
+# define Qexplicit builtin_lisp_symbol (640)
+# define Qexplicit_name builtin_lisp_symbol (641)
+# define Qexpose_hidden_buffer builtin_lisp_symbol (642)
+# define Qextend builtin_lisp_symbol (643)
+# define Qextension_data builtin_lisp_symbol (644)
+# define Qexternal_border_size builtin_lisp_symbol (645)
+# define Qexternal_debugging_output builtin_lisp_symbol (646)
+# define Qextra builtin_lisp_symbol (647)
+# define Qextra_bold builtin_lisp_symbol (648)
+# define Qextra_light builtin_lisp_symbol (649)
+# define Qf0 builtin_lisp_symbol (650)
+# define Qf10 builtin_lisp_symbol (651)
+# define Qface builtin_lisp_symbol (652)
+# define Qface_alias builtin_lisp_symbol (653)
+# define Qface_no_inherit builtin_lisp_symbol (654)
+# define Qface_remapping_alist builtin_lisp_symbol (655)
+# define Qface_set_after_frame_default builtin_lisp_symbol (656)
+# define Qfailed builtin_lisp_symbol (657)
+# define Qfalse builtin_lisp_symbol (658)
+# define Qfboundp builtin_lisp_symbol (659)
+# define Qfeatures builtin_lisp_symbol (660)
+# define Qfetch_handler builtin_lisp_symbol (661)
+# define Qfield builtin_lisp_symbol (662)
+# define Qfile builtin_lisp_symbol (663)
+# define Qfile_accessible_directory_p builtin_lisp_symbol (664)
+# define Qfile_acl builtin_lisp_symbol (665)
+# define Qfile_already_exists builtin_lisp_symbol (666)
+# define Qfile_attributes builtin_lisp_symbol (667)
+# define Qfile_attributes_lessp builtin_lisp_symbol (668)
+# define Qfile_date_error builtin_lisp_symbol (669)
+# define Qfile_directory_p builtin_lisp_symbol (670)
+# define Qfile_error builtin_lisp_symbol (671)
+# define Qfile_executable_p builtin_lisp_symbol (672)
+# define Qfile_exists_p builtin_lisp_symbol (673)
+# define Qfile_locked_p builtin_lisp_symbol (674)
+# define Qfile_missing builtin_lisp_symbol (675)
+# define Qfile_modes builtin_lisp_symbol (676)
+# define Qfile_name_all_completions builtin_lisp_symbol (677)
+# define Qfile_name_as_directory builtin_lisp_symbol (678)
+# define Qfile_name_case_insensitive_p builtin_lisp_symbol (679)
+# define Qfile_name_completion builtin_lisp_symbol (680)
+# define Qfile_name_directory builtin_lisp_symbol (681)
+# define Qfile_name_handler_alist builtin_lisp_symbol (682)
+# define Qfile_name_history builtin_lisp_symbol (683)
+# define Qfile_name_nondirectory builtin_lisp_symbol (684)
+# define Qfile_newer_than_file_p builtin_lisp_symbol (685)
+# define Qfile_notify builtin_lisp_symbol (686)
+# define Qfile_notify_error builtin_lisp_symbol (687)
+# define Qfile_offset builtin_lisp_symbol (688)
+# define Qfile_readable_p builtin_lisp_symbol (689)
+# define Qfile_regular_p builtin_lisp_symbol (690)
+# define Qfile_remote_p builtin_lisp_symbol (691)
+# define Qfile_selinux_context builtin_lisp_symbol (692)
+# define Qfile_symlink_p builtin_lisp_symbol (693)
+# define Qfile_system_info builtin_lisp_symbol (694)
+# define Qfile_truename builtin_lisp_symbol (695)
+# define Qfile_writable_p builtin_lisp_symbol (696)
+# define Qfilenamep builtin_lisp_symbol (697)
+# define Qfill_column_indicator builtin_lisp_symbol (698)
+# define Qfinalizer builtin_lisp_symbol (699)
+# define Qfirst_change_hook builtin_lisp_symbol (700)
+# define Qfixnum builtin_lisp_symbol (701)
+# define Qfixnum_or_symbol_with_pos_p builtin_lisp_symbol (702)
+# define Qfixnump builtin_lisp_symbol (703)
+# define Qflat_button builtin_lisp_symbol (704)
+# define Qfloat builtin_lisp_symbol (705)
+# define Qfloat_output_format builtin_lisp_symbol (706)
+# define Qfloatp builtin_lisp_symbol (707)
+# define Qfloats builtin_lisp_symbol (708)
+# define Qfloor builtin_lisp_symbol (709)
+# define Qfocus_in builtin_lisp_symbol (710)
+# define Qfocus_out builtin_lisp_symbol (711)
+# define Qfont builtin_lisp_symbol (712)
+# define Qfont_backend builtin_lisp_symbol (713)
+# define Qfont_driver_superseded_by builtin_lisp_symbol (714)
+# define Qfont_entity builtin_lisp_symbol (715)
+# define Qfont_extra_type builtin_lisp_symbol (716)
+# define Qfont_lock_face builtin_lisp_symbol (717)
+# define Qfont_object builtin_lisp_symbol (718)
+# define Qfont_parameter builtin_lisp_symbol (719)
+# define Qfont_spec builtin_lisp_symbol (720)
+# define Qfontification_functions builtin_lisp_symbol (721)
+# define Qfontified builtin_lisp_symbol (722)
+# define Qfontset builtin_lisp_symbol (723)
+# define Qfontset_info builtin_lisp_symbol (724)
+# define Qfontset_startup builtin_lisp_symbol (725)
+# define Qfontsize builtin_lisp_symbol (726)
+# define Qforce builtin_lisp_symbol (727)
+# define Qforeground_color builtin_lisp_symbol (728)
+# define Qformat_annotate_function builtin_lisp_symbol (729)
+# define Qformat_decode builtin_lisp_symbol (730)
+# define Qformat_prompt builtin_lisp_symbol (731)
+# define Qfraction builtin_lisp_symbol (732)
+# define Qframe builtin_lisp_symbol (733)
+# define Qframe__z_order_lessp builtin_lisp_symbol (734)
+# define Qframe_edges builtin_lisp_symbol (735)
+# define Qframe_id builtin_lisp_symbol (736)
+# define Qframe_live_p builtin_lisp_symbol (737)
+# define Qframe_monitor_attributes builtin_lisp_symbol (738)
+# define Qframe_set_background_mode builtin_lisp_symbol (739)
+# define Qframe_title_format builtin_lisp_symbol (740)
+# define Qframe_windows_min_size builtin_lisp_symbol (741)
+# define Qframep builtin_lisp_symbol (742)
+# define Qframes builtin_lisp_symbol (743)
+# define Qfringe builtin_lisp_symbol (744)
+# define Qfrom__tty_menu_p builtin_lisp_symbol (745)
+# define Qfront_sticky builtin_lisp_symbol (746)
+# define Qfull builtin_lisp_symbol (747)
+# define Qfullboth builtin_lisp_symbol (748)
+# define Qfullheight builtin_lisp_symbol (749)
+# define Qfullscreen builtin_lisp_symbol (750)
+# define Qfullwidth builtin_lisp_symbol (751)
+# define Qfuncall builtin_lisp_symbol (752)
+# define Qfuncall_interactively builtin_lisp_symbol (753)
+# define Qfunction builtin_lisp_symbol (754)
+# define Qfunction_documentation builtin_lisp_symbol (755)
+# define Qfunction_history builtin_lisp_symbol (756)
+# define Qfunction_key builtin_lisp_symbol (757)
+# define Qfunctionp builtin_lisp_symbol (758)
+# define Qfundamental_mode builtin_lisp_symbol (759)
+# define Qgc_cons_percentage builtin_lisp_symbol (760)
+# define Qgc_cons_threshold builtin_lisp_symbol (761)
+# define Qgccjit builtin_lisp_symbol (762)
+# define Qgdiplus builtin_lisp_symbol (763)
+# define Qgdk_pixbuf builtin_lisp_symbol (764)
+# define Qgeometry builtin_lisp_symbol (765)
+# define Qget_buffer_window_list builtin_lisp_symbol (766)
+# define Qget_emacs_mule_file_char builtin_lisp_symbol (767)
+# define Qget_file_buffer builtin_lisp_symbol (768)
+# define Qget_file_char builtin_lisp_symbol (769)
+# define Qget_mru_frame builtin_lisp_symbol (770)
+# define Qget_mru_window builtin_lisp_symbol (771)
+# define Qget_scratch_buffer_create builtin_lisp_symbol (772)
+# define Qgif builtin_lisp_symbol (773)
+# define Qgio builtin_lisp_symbol (774)
+# define Qglib builtin_lisp_symbol (775)
+# define Qglyphless_char builtin_lisp_symbol (776)
+# define Qglyphless_char_display builtin_lisp_symbol (777)
+# define Qgnustep builtin_lisp_symbol (778)
+# define Qgnutls builtin_lisp_symbol (779)
+# define Qgnutls3 builtin_lisp_symbol (780)
+# define Qgnutls_anon builtin_lisp_symbol (781)
+# define Qgnutls_code builtin_lisp_symbol (782)
+# define Qgnutls_e_again builtin_lisp_symbol (783)
+# define Qgnutls_e_interrupted builtin_lisp_symbol (784)
+# define Qgnutls_e_invalid_session builtin_lisp_symbol (785)
+# define Qgnutls_e_not_ready_for_handshake builtin_lisp_symbol (786)
+# define Qgnutls_pkcs_null_password builtin_lisp_symbol (787)
+# define Qgnutls_pkcs_pbes1_des_md5 builtin_lisp_symbol (788)
+# define Qgnutls_pkcs_pbes2_3des builtin_lisp_symbol (789)
+# define Qgnutls_pkcs_pbes2_aes_128 builtin_lisp_symbol (790)
+# define Qgnutls_pkcs_pbes2_aes_192 builtin_lisp_symbol (791)
+# define Qgnutls_pkcs_pbes2_aes_256 builtin_lisp_symbol (792)
+# define Qgnutls_pkcs_pbes2_des builtin_lisp_symbol (793)
+# define Qgnutls_pkcs_pbes2_gost_cpa builtin_lisp_symbol (794)
+# define Qgnutls_pkcs_pbes2_gost_cpb builtin_lisp_symbol (795)
+# define Qgnutls_pkcs_pbes2_gost_cpc builtin_lisp_symbol (796)
+# define Qgnutls_pkcs_pbes2_gost_cpd builtin_lisp_symbol (797)
+# define Qgnutls_pkcs_pbes2_gost_tc26z builtin_lisp_symbol (798)
+# define Qgnutls_pkcs_pkcs12_3des builtin_lisp_symbol (799)
+# define Qgnutls_pkcs_pkcs12_arcfour builtin_lisp_symbol (800)
+# define Qgnutls_pkcs_pkcs12_rc2_40 builtin_lisp_symbol (801)
+# define Qgnutls_pkcs_plain builtin_lisp_symbol (802)
+# define Qgnutls_type_cipher builtin_lisp_symbol (803)
+# define Qgnutls_type_digest_algorithm builtin_lisp_symbol (804)
+# define Qgnutls_type_mac_algorithm builtin_lisp_symbol (805)
+# define Qgnutls_x509pki builtin_lisp_symbol (806)
+# define Qgobject builtin_lisp_symbol (807)
+# define Qgrave builtin_lisp_symbol (808)
+# define Qgray_scale builtin_lisp_symbol (809)
+# define Qgroup builtin_lisp_symbol (810)
+# define Qgrow_only builtin_lisp_symbol (811)
+# define Qgs_load_image builtin_lisp_symbol (812)
+# define Qgui_figure_window_size builtin_lisp_symbol (813)
+# define Qgui_set_selection builtin_lisp_symbol (814)
+# define Qhaiku builtin_lisp_symbol (815)
+# define Qhand builtin_lisp_symbol (816)
+# define Qhandle builtin_lisp_symbol (817)
+# define Qhandle_select_window builtin_lisp_symbol (818)
+# define Qhandle_shift_selection builtin_lisp_symbol (819)
+# define Qhandle_switch_frame builtin_lisp_symbol (820)
+# define Qhas_error builtin_lisp_symbol (821)
+# define Qhash_table builtin_lisp_symbol (822)
+# define Qhash_table_p builtin_lisp_symbol (823)
+# define Qhash_table_test builtin_lisp_symbol (824)
+# define Qhbar builtin_lisp_symbol (825)
+# define Qhdrag builtin_lisp_symbol (826)
+# define Qheader_line builtin_lisp_symbol (827)
+# define Qheader_line_active builtin_lisp_symbol (828)
+# define Qheader_line_format builtin_lisp_symbol (829)
+# define Qheader_line_inactive builtin_lisp_symbol (830)
+# define Qheap builtin_lisp_symbol (831)
+# define Qheavy builtin_lisp_symbol (832)
+# define Qheic builtin_lisp_symbol (833)
+# define Qheight builtin_lisp_symbol (834)
+# define Qheight_only builtin_lisp_symbol (835)
+# define Qhelp__append_keystrokes_help builtin_lisp_symbol (836)
+# define Qhelp__describe_map_tree builtin_lisp_symbol (837)
+# define Qhelp_echo builtin_lisp_symbol (838)
+# define Qhelp_echo_inhibit_substitution builtin_lisp_symbol (839)
+# define Qhelp_form_show builtin_lisp_symbol (840)
+# define Qhelp_key_binding builtin_lisp_symbol (841)
+# define Qhelper_sanitizer_assert builtin_lisp_symbol (842)
+# define Qhelper_save_restriction builtin_lisp_symbol (843)
+# define Qhelper_unbind_n builtin_lisp_symbol (844)
+# define Qhelper_unwind_protect builtin_lisp_symbol (845)
+# define Qheuristic builtin_lisp_symbol (846)
+# define Qhex_code builtin_lisp_symbol (847)
+# define Qhide builtin_lisp_symbol (848)
+# define Qhollow builtin_lisp_symbol (849)
+# define Qhollow_small builtin_lisp_symbol (850)
+# define Qhorizontal_handle builtin_lisp_symbol (851)
+# define Qhorizontal_scroll_bar builtin_lisp_symbol (852)
+# define Qhorizontal_scroll_bars builtin_lisp_symbol (853)
+# define Qhourglass builtin_lisp_symbol (854)
+# define Qhw builtin_lisp_symbol (855)
+# define Qhyper builtin_lisp_symbol (856)
+# define Qicon builtin_lisp_symbol (857)
+# define Qicon_left builtin_lisp_symbol (858)
+# define Qicon_name builtin_lisp_symbol (859)
+# define Qicon_title_format builtin_lisp_symbol (860)
+# define Qicon_top builtin_lisp_symbol (861)
+# define Qicon_type builtin_lisp_symbol (862)
+# define Qiconify_frame builtin_lisp_symbol (863)
+# define Qiconify_top_level builtin_lisp_symbol (864)
+# define Qidentity builtin_lisp_symbol (865)
+# define Qif builtin_lisp_symbol (866)
+# define Qif_regular builtin_lisp_symbol (867)
+# define Qignore_self_insert builtin_lisp_symbol (868)
+# define Qignored builtin_lisp_symbol (869)
+# define Qimage builtin_lisp_symbol (870)
+# define Qimage_format_suffixes builtin_lisp_symbol (871)
+# define Qimagemagick builtin_lisp_symbol (872)
+# define Qinc_args builtin_lisp_symbol (873)
+# define Qinformational builtin_lisp_symbol (874)
+# define Qinhibit builtin_lisp_symbol (875)
+# define Qinhibit_changing_match_data builtin_lisp_symbol (876)
+# define Qinhibit_debugger builtin_lisp_symbol (877)
+# define Qinhibit_double_buffering builtin_lisp_symbol (878)
+# define Qinhibit_eval_during_redisplay builtin_lisp_symbol (879)
+# define Qinhibit_file_name_operation builtin_lisp_symbol (880)
+# define Qinhibit_free_realized_faces builtin_lisp_symbol (881)
+# define Qinhibit_menubar_update builtin_lisp_symbol (882)
+# define Qinhibit_modification_hooks builtin_lisp_symbol (883)
+# define Qinhibit_point_motion_hooks builtin_lisp_symbol (884)
+# define Qinhibit_quit builtin_lisp_symbol (885)
+# define Qinhibit_read_only builtin_lisp_symbol (886)
+# define Qinhibit_redisplay builtin_lisp_symbol (887)
+# define Qinhibited_interaction builtin_lisp_symbol (888)
+# define Qinitial_major_mode builtin_lisp_symbol (889)
+# define Qinner_edges builtin_lisp_symbol (890)
+# define Qinput_method_exit_on_first_char builtin_lisp_symbol (891)
+# define Qinput_method_use_echo_area builtin_lisp_symbol (892)
+# define Qinsert_behind_hooks builtin_lisp_symbol (893)
+# define Qinsert_file_contents builtin_lisp_symbol (894)
+# define Qinsert_in_front_hooks builtin_lisp_symbol (895)
+# define Qinserted_chars builtin_lisp_symbol (896)
+# define Qinsufficient_source builtin_lisp_symbol (897)
+# define Qintangible builtin_lisp_symbol (898)
+# define Qinteger builtin_lisp_symbol (899)
+# define Qinteger_or_marker_p builtin_lisp_symbol (900)
+# define Qintegerp builtin_lisp_symbol (901)
+# define Qinteractive builtin_lisp_symbol (902)
+# define Qinteractive_args builtin_lisp_symbol (903)
+# define Qinteractive_form builtin_lisp_symbol (904)
+# define Qinteractive_p builtin_lisp_symbol (905)
+# define Qinternal__syntax_propertize builtin_lisp_symbol (906)
+# define Qinternal_auto_fill builtin_lisp_symbol (907)
+# define Qinternal_border builtin_lisp_symbol (908)
+# define Qinternal_border_width builtin_lisp_symbol (909)
+# define Qinternal_complete_buffer builtin_lisp_symbol (910)
+# define Qinternal_default_interrupt_process builtin_lisp_symbol (911)
+# define Qinternal_default_process_filter builtin_lisp_symbol (912)
+# define Qinternal_default_process_sentinel builtin_lisp_symbol (913)
+# define Qinternal_default_signal_process builtin_lisp_symbol (914)
+# define Qinternal_echo_keystrokes_prefix builtin_lisp_symbol (915)
+# define Qinternal_interpreter_environment builtin_lisp_symbol (916)
+# define Qinternal_macroexpand_for_load builtin_lisp_symbol (917)
+# define Qinternal_timer_start_idle builtin_lisp_symbol (918)
+# define Qinternal_when_entered_debugger builtin_lisp_symbol (919)
+# define Qinterpreted_function builtin_lisp_symbol (920)
+# define Qinterrupt_process_functions builtin_lisp_symbol (921)
+# define Qinterrupted builtin_lisp_symbol (922)
+# define Qintervals builtin_lisp_symbol (923)
+# define Qinvalid_arity builtin_lisp_symbol (924)
+# define Qinvalid_function builtin_lisp_symbol (925)
+# define Qinvalid_read_syntax builtin_lisp_symbol (926)
+# define Qinvalid_regexp builtin_lisp_symbol (927)
+# define Qinvalid_source builtin_lisp_symbol (928)
+# define Qinvisible builtin_lisp_symbol (929)
+# define Qipv4 builtin_lisp_symbol (930)
+# define Qipv6 builtin_lisp_symbol (931)
+# define Qiso10646_1 builtin_lisp_symbol (932)
+# define Qiso8859_1 builtin_lisp_symbol (933)
+# define Qiso_2022 builtin_lisp_symbol (934)
+# define Qiso_8859_1 builtin_lisp_symbol (935)
+# define Qitalic builtin_lisp_symbol (936)
+# define Qiv_auto builtin_lisp_symbol (937)
+# define Qja builtin_lisp_symbol (938)
+# define Qjka_compr_load_suffixes builtin_lisp_symbol (939)
+# define Qjpeg builtin_lisp_symbol (940)
+# define Qjson_end_of_file builtin_lisp_symbol (941)
+# define Qjson_error builtin_lisp_symbol (942)
+# define Qjson_escape_sequence_error builtin_lisp_symbol (943)
+# define Qjson_invalid_surrogate_error builtin_lisp_symbol (944)
+# define Qjson_number_out_of_range builtin_lisp_symbol (945)
+# define Qjson_object_too_deep builtin_lisp_symbol (946)
+# define Qjson_out_of_memory builtin_lisp_symbol (947)
+# define Qjson_parse_error builtin_lisp_symbol (948)
+# define Qjson_trailing_content builtin_lisp_symbol (949)
+# define Qjson_utf8_decode_error builtin_lisp_symbol (950)
+# define Qjson_value_p builtin_lisp_symbol (951)
+# define Qjump builtin_lisp_symbol (952)
+# define Qkbd_macro_termination_hook builtin_lisp_symbol (953)
+# define Qkeep_ratio builtin_lisp_symbol (954)
+# define Qkey builtin_lisp_symbol (955)
+# define Qkey_and_value builtin_lisp_symbol (956)
+# define Qkey_or_value builtin_lisp_symbol (957)
+# define Qkey_parse builtin_lisp_symbol (958)
+# define Qkey_valid_p builtin_lisp_symbol (959)
+# define Qkeymap builtin_lisp_symbol (960)
+# define Qkeymap_canonicalize builtin_lisp_symbol (961)
+# define Qkeymapp builtin_lisp_symbol (962)
+# define Qkill_buffer__possibly_save builtin_lisp_symbol (963)
+# define Qkill_buffer_hook builtin_lisp_symbol (964)
+# define Qkill_buffer_query_functions builtin_lisp_symbol (965)
+# define Qkill_emacs builtin_lisp_symbol (966)
+# define Qkill_emacs_hook builtin_lisp_symbol (967)
+# define Qkill_forward_chars builtin_lisp_symbol (968)
+# define Qko builtin_lisp_symbol (969)
+# define Qlang_version_mismatch builtin_lisp_symbol (970)
+# define Qlanguage_change builtin_lisp_symbol (971)
+# define Qlaplace builtin_lisp_symbol (972)
+# define Qlast_arrow_position builtin_lisp_symbol (973)
+# define Qlast_arrow_string builtin_lisp_symbol (974)
+# define Qlast_nonmenu_event builtin_lisp_symbol (975)
+# define Qlate builtin_lisp_symbol (976)
+# define Qlatin builtin_lisp_symbol (977)
+# define Qleft builtin_lisp_symbol (978)
+# define Qleft_edge builtin_lisp_symbol (979)
+# define Qleft_fringe builtin_lisp_symbol (980)
+# define Qleft_fringe_help builtin_lisp_symbol (981)
+# define Qleft_margin builtin_lisp_symbol (982)
+# define Qleft_only builtin_lisp_symbol (983)
+# define Qleft_to_right builtin_lisp_symbol (984)
+# define Qleftmost builtin_lisp_symbol (985)
+# define Qlet builtin_lisp_symbol (986)
+# define Qletx builtin_lisp_symbol (987)
+# define Qlexical_binding builtin_lisp_symbol (988)
+# define Qlibgif_version builtin_lisp_symbol (989)
+# define Qlibjpeg_version builtin_lisp_symbol (990)
+# define Qlibpng_version builtin_lisp_symbol (991)
+# define Qlight builtin_lisp_symbol (992)
+# define Qline builtin_lisp_symbol (993)
+# define Qline_height builtin_lisp_symbol (994)
+# define Qline_number builtin_lisp_symbol (995)
+# define Qline_number_current_line builtin_lisp_symbol (996)
+# define Qline_number_major_tick builtin_lisp_symbol (997)
+# define Qline_number_minor_tick builtin_lisp_symbol (998)
+# define Qline_prefix builtin_lisp_symbol (999)
+# define Qline_spacing builtin_lisp_symbol (1000)
+# define Qlink builtin_lisp_symbol (1001)
+# define Qlisp_directory builtin_lisp_symbol (1002)
+# define Qlist builtin_lisp_symbol (1003)
+# define Qlist_or_vector_p builtin_lisp_symbol (1004)
+# define Qlist_system_processes builtin_lisp_symbol (1005)
+# define Qlisten builtin_lisp_symbol (1006)
+# define Qlistp builtin_lisp_symbol (1007)
+# define Qlittle builtin_lisp_symbol (1008)
+# define Qlive builtin_lisp_symbol (1009)
+# define Qload builtin_lisp_symbol (1010)
+# define Qload_file_name builtin_lisp_symbol (1011)
+# define Qload_force_doc_strings builtin_lisp_symbol (1012)
+# define Qload_in_progress builtin_lisp_symbol (1013)
+# define Qload_phases builtin_lisp_symbol (1014)
+# define Qload_threads builtin_lisp_symbol (1015)
+# define Qload_time builtin_lisp_symbol (1016)
+# define Qload_true_file_name builtin_lisp_symbol (1017)
+# define Qlocal builtin_lisp_symbol (1018)
+# define Qlocal_map builtin_lisp_symbol (1019)
+# define Qlock_file builtin_lisp_symbol (1020)
+# define Qlong builtin_lisp_symbol (1021)
+# define Qlong_line_optimizations_in_command_hooks builtin_lisp_symbol (1022)
+# define Qlong_line_optimizations_in_fontification_functions builtin_lisp_symbol (1023)
+# define Qlosing_value builtin_lisp_symbol (1024)
+# define Qlowercase builtin_lisp_symbol (1025)
+# define Qlread_unescaped_character_literals builtin_lisp_symbol (1026)
+# define Qm builtin_lisp_symbol (1027)
+# define Qmac builtin_lisp_symbol (1028)
+# define Qmac_ct builtin_lisp_symbol (1029)
+# define Qmacro builtin_lisp_symbol (1030)
+# define Qmacroexp__dynvars builtin_lisp_symbol (1031)
+# define Qmacs builtin_lisp_symbol (1032)
+# define Qmajflt builtin_lisp_symbol (1033)
+# define Qmake_cursor_line_fully_visible builtin_lisp_symbol (1034)
+# define Qmake_directory builtin_lisp_symbol (1035)
+# define Qmake_directory_internal builtin_lisp_symbol (1036)
+# define Qmake_frame_visible builtin_lisp_symbol (1037)
+# define Qmake_initial_minibuffer_frame builtin_lisp_symbol (1038)
+# define Qmake_invisible builtin_lisp_symbol (1039)
+# define Qmake_lock_file_name builtin_lisp_symbol (1040)
+# define Qmake_process builtin_lisp_symbol (1041)
+# define Qmake_symbolic_link builtin_lisp_symbol (1042)
+# define Qmake_window_start_visible builtin_lisp_symbol (1043)
+# define Qmakunbound builtin_lisp_symbol (1044)
+# define Qmalformed_keyword_arg_list builtin_lisp_symbol (1045)
+# define Qmany builtin_lisp_symbol (1046)
+# define Qmap_keymap_sorted builtin_lisp_symbol (1047)
+# define Qmargin builtin_lisp_symbol (1048)
+# define Qmark_for_redisplay builtin_lisp_symbol (1049)
+# define Qmark_inactive builtin_lisp_symbol (1050)
+# define Qmarker builtin_lisp_symbol (1051)
+# define Qmarkerp builtin_lisp_symbol (1052)
+# define Qmaximized builtin_lisp_symbol (1053)
+# define Qmd5 builtin_lisp_symbol (1054)
+# define Qmedium builtin_lisp_symbol (1055)
+# define Qmemory_buffer_too_small builtin_lisp_symbol (1056)
+# define Qmemory_info builtin_lisp_symbol (1057)
+# define Qmenu builtin_lisp_symbol (1058)
+# define Qmenu_bar builtin_lisp_symbol (1059)
+# define Qmenu_bar_external builtin_lisp_symbol (1060)
+# define Qmenu_bar_lines builtin_lisp_symbol (1061)
+# define Qmenu_bar_size builtin_lisp_symbol (1062)
+# define Qmenu_bar_update_hook builtin_lisp_symbol (1063)
+# define Qmenu_enable builtin_lisp_symbol (1064)
+# define Qmenu_item builtin_lisp_symbol (1065)
+# define Qmessage builtin_lisp_symbol (1066)
+# define Qmessages_buffer_mode builtin_lisp_symbol (1067)
+# define Qmeta builtin_lisp_symbol (1068)
+# define Qmetadata builtin_lisp_symbol (1069)
+# define Qmin_height builtin_lisp_symbol (1070)
+# define Qmin_width builtin_lisp_symbol (1071)
+# define Qminflt builtin_lisp_symbol (1072)
+# define Qminibuffer builtin_lisp_symbol (1073)
+# define Qminibuffer_completing_file_name builtin_lisp_symbol (1074)
+# define Qminibuffer_completion_table builtin_lisp_symbol (1075)
+# define Qminibuffer_default builtin_lisp_symbol (1076)
+# define Qminibuffer_exit builtin_lisp_symbol (1077)
+# define Qminibuffer_exit_hook builtin_lisp_symbol (1078)
+# define Qminibuffer_follows_selected_frame builtin_lisp_symbol (1079)
+# define Qminibuffer_history builtin_lisp_symbol (1080)
+# define Qminibuffer_inactive_mode builtin_lisp_symbol (1081)
+# define Qminibuffer_mode builtin_lisp_symbol (1082)
+# define Qminibuffer_prompt builtin_lisp_symbol (1083)
+# define Qminibuffer_quit builtin_lisp_symbol (1084)
+# define Qminibuffer_quit_recursive_edit builtin_lisp_symbol (1085)
+# define Qminibuffer_setup_hook builtin_lisp_symbol (1086)
+# define Qminus builtin_lisp_symbol (1087)
+# define Qmissing builtin_lisp_symbol (1088)
+# define Qmissing_module_init_function builtin_lisp_symbol (1089)
+# define Qmm_size builtin_lisp_symbol (1090)
+# define Qmode_class builtin_lisp_symbol (1091)
+# define Qmode_line builtin_lisp_symbol (1092)
+# define Qmode_line_active builtin_lisp_symbol (1093)
+# define Qmode_line_default_help_echo builtin_lisp_symbol (1094)
+# define Qmode_line_elt_no builtin_lisp_symbol (1095)
+# define Qmode_line_format builtin_lisp_symbol (1096)
+# define Qmode_line_inactive builtin_lisp_symbol (1097)
+# define Qmodeline builtin_lisp_symbol (1098)
+# define Qmodification_hooks builtin_lisp_symbol (1099)
+# define Qmodifier_cache builtin_lisp_symbol (1100)
+# define Qmodifier_value builtin_lisp_symbol (1101)
+# define Qmodule_function builtin_lisp_symbol (1102)
+# define Qmodule_function_p builtin_lisp_symbol (1103)
+# define Qmodule_init_failed builtin_lisp_symbol (1104)
+# define Qmodule_load_failed builtin_lisp_symbol (1105)
+# define Qmodule_not_gpl_compatible builtin_lisp_symbol (1106)
+# define Qmodule_open_failed builtin_lisp_symbol (1107)
+# define Qmodule_out_of_memory builtin_lisp_symbol (1108)
+# define Qmonitors_changed builtin_lisp_symbol (1109)
+# define Qmonths builtin_lisp_symbol (1110)
+# define Qmouse builtin_lisp_symbol (1111)
+# define Qmouse_click builtin_lisp_symbol (1112)
+# define Qmouse_color builtin_lisp_symbol (1113)
+# define Qmouse_face builtin_lisp_symbol (1114)
+# define Qmouse_fixup_help_message builtin_lisp_symbol (1115)
+# define Qmouse_leave_buffer_hook builtin_lisp_symbol (1116)
+# define Qmouse_movement builtin_lisp_symbol (1117)
+# define Qmouse_wheel_frame builtin_lisp_symbol (1118)
+# define Qmove_frame builtin_lisp_symbol (1119)
+# define Qmove_toolbar builtin_lisp_symbol (1120)
+# define Qmutex builtin_lisp_symbol (1121)
+# define Qmutexp builtin_lisp_symbol (1122)
+# define Qname builtin_lisp_symbol (1123)
+# define Qnamed builtin_lisp_symbol (1124)
+# define Qnative__compile_async builtin_lisp_symbol (1125)
+# define Qnative_comp_compiler_options builtin_lisp_symbol (1126)
+# define Qnative_comp_debug builtin_lisp_symbol (1127)
+# define Qnative_comp_driver_options builtin_lisp_symbol (1128)
+# define Qnative_comp_function builtin_lisp_symbol (1129)
+# define Qnative_comp_speed builtin_lisp_symbol (1130)
+# define Qnative_comp_unit builtin_lisp_symbol (1131)
+# define Qnative_comp_warning_on_missing_source builtin_lisp_symbol (1132)
+# define Qnative_compiler builtin_lisp_symbol (1133)
+# define Qnative_compiler_error builtin_lisp_symbol (1134)
+# define Qnative_edges builtin_lisp_symbol (1135)
+# define Qnative_ice builtin_lisp_symbol (1136)
+# define Qnative_image builtin_lisp_symbol (1137)
+# define Qnative_lisp_file_inconsistent builtin_lisp_symbol (1138)
+# define Qnative_lisp_load_failed builtin_lisp_symbol (1139)
+# define Qnative_lisp_wrong_reloc builtin_lisp_symbol (1140)
+# define Qnatnump builtin_lisp_symbol (1141)
+# define Qnegate builtin_lisp_symbol (1142)
+# define Qnetwork builtin_lisp_symbol (1143)
+# define Qnhdrag builtin_lisp_symbol (1144)
+# define Qnice builtin_lisp_symbol (1145)
+# define Qno_accept_focus builtin_lisp_symbol (1146)
+# define Qno_catch builtin_lisp_symbol (1147)
+# define Qno_conversion builtin_lisp_symbol (1148)
+# define Qno_focus_on_map builtin_lisp_symbol (1149)
+# define Qno_other_frame builtin_lisp_symbol (1150)
+# define Qno_other_window builtin_lisp_symbol (1151)
+# define Qno_record builtin_lisp_symbol (1152)
+# define Qno_self_insert builtin_lisp_symbol (1153)
+# define Qno_special_glyphs builtin_lisp_symbol (1154)
+# define Qnobreak_hyphen builtin_lisp_symbol (1155)
+# define Qnobreak_space builtin_lisp_symbol (1156)
+# define Qnoelisp builtin_lisp_symbol (1157)
+# define Qnon_ascii builtin_lisp_symbol (1158)
+# define Qnon_key_event builtin_lisp_symbol (1159)
+# define Qnon_retained builtin_lisp_symbol (1160)
+# define Qnone builtin_lisp_symbol (1161)
+# define Qnormal builtin_lisp_symbol (1162)
+# define Qnot builtin_lisp_symbol (1163)
+# define Qnot_found builtin_lisp_symbol (1164)
+# define Qnow builtin_lisp_symbol (1165)
+# define Qns builtin_lisp_symbol (1166)
+# define Qns_appearance builtin_lisp_symbol (1167)
+# define Qns_drag_operation_copy builtin_lisp_symbol (1168)
+# define Qns_drag_operation_generic builtin_lisp_symbol (1169)
+# define Qns_drag_operation_link builtin_lisp_symbol (1170)
+# define Qns_handle_drag_motion builtin_lisp_symbol (1171)
+# define Qns_in_echo_area builtin_lisp_symbol (1172)
+# define Qns_parse_geometry builtin_lisp_symbol (1173)
+# define Qns_put_working_text builtin_lisp_symbol (1174)
+# define Qns_transparent_titlebar builtin_lisp_symbol (1175)
+# define Qns_unput_working_text builtin_lisp_symbol (1176)
+# define Qnsm_verify_connection builtin_lisp_symbol (1177)
+# define Qnth builtin_lisp_symbol (1178)
+# define Qnull builtin_lisp_symbol (1179)
+# define Qnumber_or_marker_p builtin_lisp_symbol (1180)
+# define Qnumberp builtin_lisp_symbol (1181)
+# define Qnumeric builtin_lisp_symbol (1182)
+# define Qobarray builtin_lisp_symbol (1183)
+# define Qobarray_cache builtin_lisp_symbol (1184)
+# define Qobarrayp builtin_lisp_symbol (1185)
+# define Qobject builtin_lisp_symbol (1186)
+# define Qoblique builtin_lisp_symbol (1187)
+# define Qoclosure_interactive_form builtin_lisp_symbol (1188)
+# define Qodd builtin_lisp_symbol (1189)
+# define Qonly builtin_lisp_symbol (1190)
+# define Qopen builtin_lisp_symbol (1191)
+# define Qopen_network_stream builtin_lisp_symbol (1192)
+# define Qopentype builtin_lisp_symbol (1193)
+# define Qoperations builtin_lisp_symbol (1194)
+# define Qor builtin_lisp_symbol (1195)
+# define Qoutdated builtin_lisp_symbol (1196)
+# define Qouter_border_width builtin_lisp_symbol (1197)
+# define Qouter_edges builtin_lisp_symbol (1198)
+# define Qouter_position builtin_lisp_symbol (1199)
+# define Qouter_size builtin_lisp_symbol (1200)
+# define Qouter_window_id builtin_lisp_symbol (1201)
+# define Qoutermost_restriction builtin_lisp_symbol (1202)
+# define Qoverflow_error builtin_lisp_symbol (1203)
+# define Qoverlay builtin_lisp_symbol (1204)
+# define Qoverlay_arrow builtin_lisp_symbol (1205)
+# define Qoverlay_arrow_bitmap builtin_lisp_symbol (1206)
+# define Qoverlay_arrow_string builtin_lisp_symbol (1207)
+# define Qoverlayp builtin_lisp_symbol (1208)
+# define Qoverride_redirect builtin_lisp_symbol (1209)
+# define Qoverriding_local_map builtin_lisp_symbol (1210)
+# define Qoverriding_plist_environment builtin_lisp_symbol (1211)
+# define Qoverriding_terminal_local_map builtin_lisp_symbol (1212)
+# define Qoverwrite_mode builtin_lisp_symbol (1213)
+# define Qoverwrite_mode_binary builtin_lisp_symbol (1214)
+# define Qp builtin_lisp_symbol (1215)
+# define Qpaper builtin_lisp_symbol (1216)
+# define Qparent_frame builtin_lisp_symbol (1217)
+# define Qparent_id builtin_lisp_symbol (1218)
+# define Qpbm builtin_lisp_symbol (1219)
+# define Qpc builtin_lisp_symbol (1220)
+# define Qpcpu builtin_lisp_symbol (1221)
+# define Qpermanent_local builtin_lisp_symbol (1222)
+# define Qpermanent_local_hook builtin_lisp_symbol (1223)
+# define Qpermission_denied builtin_lisp_symbol (1224)
+# define Qpgrp builtin_lisp_symbol (1225)
+# define Qpgtk builtin_lisp_symbol (1226)
+# define Qphi builtin_lisp_symbol (1227)
+# define Qpinch builtin_lisp_symbol (1228)
+# define Qpipe builtin_lisp_symbol (1229)
+# define Qpipe_process_p builtin_lisp_symbol (1230)
+# define Qplay_sound_functions builtin_lisp_symbol (1231)
+# define Qplist builtin_lisp_symbol (1232)
+# define Qplistp builtin_lisp_symbol (1233)
+# define Qplus builtin_lisp_symbol (1234)
+# define Qpmem builtin_lisp_symbol (1235)
+# define Qpng builtin_lisp_symbol (1236)
+# define Qpoint_entered builtin_lisp_symbol (1237)
+# define Qpoint_left builtin_lisp_symbol (1238)
+# define Qpointer builtin_lisp_symbol (1239)
+# define Qpolling_period builtin_lisp_symbol (1240)
+# define Qpoly builtin_lisp_symbol (1241)
+# define Qpop_handler builtin_lisp_symbol (1242)
+# define Qposition builtin_lisp_symbol (1243)
+# define Qpost_command_hook builtin_lisp_symbol (1244)
+# define Qpost_gc_hook builtin_lisp_symbol (1245)
+# define Qpost_select_region_hook builtin_lisp_symbol (1246)
+# define Qpost_self_insert_hook builtin_lisp_symbol (1247)
+# define Qpost_wake builtin_lisp_symbol (1248)
+# define Qpostscript builtin_lisp_symbol (1249)
+# define Qppid builtin_lisp_symbol (1250)
+# define Qpre_command_hook builtin_lisp_symbol (1251)
+# define Qpre_sleep builtin_lisp_symbol (1252)
+# define Qpreedit_text builtin_lisp_symbol (1253)
+# define Qpressed_button builtin_lisp_symbol (1254)
+# define Qpri builtin_lisp_symbol (1255)
+# define Qprimitive_function builtin_lisp_symbol (1256)
+# define Qprinc builtin_lisp_symbol (1257)
+# define Qprint__unreadable_callback_buffer builtin_lisp_symbol (1258)
+# define Qprint_escape_multibyte builtin_lisp_symbol (1259)
+# define Qprint_escape_nonascii builtin_lisp_symbol (1260)
+# define Qprint_symbols_bare builtin_lisp_symbol (1261)
+# define Qprint_unreadable_function builtin_lisp_symbol (1262)
+# define Qpriority builtin_lisp_symbol (1263)
+# define Qprocess builtin_lisp_symbol (1264)
+# define Qprocess_attributes builtin_lisp_symbol (1265)
+# define Qprocessp builtin_lisp_symbol (1266)
+# define Qprogn builtin_lisp_symbol (1267)
+# define Qpropertize builtin_lisp_symbol (1268)
+# define Qprotected_field builtin_lisp_symbol (1269)
+# define Qprovide builtin_lisp_symbol (1270)
+# define Qpseudo_color builtin_lisp_symbol (1271)
+# define Qpty builtin_lisp_symbol (1272)
+# define Qpurecopy builtin_lisp_symbol (1273)
+# define Qpush_handler builtin_lisp_symbol (1274)
+# define Qpush_window_buffer_onto_prev builtin_lisp_symbol (1275)
+# define Qquit builtin_lisp_symbol (1276)
+# define Qquit_restore builtin_lisp_symbol (1277)
+# define Qquit_restore_prev builtin_lisp_symbol (1278)
+# define Qquote builtin_lisp_symbol (1279)
+# define Qraise builtin_lisp_symbol (1280)
+# define Qrange builtin_lisp_symbol (1281)
+# define Qrange_error builtin_lisp_symbol (1282)
+# define Qratio builtin_lisp_symbol (1283)
+# define Qraw_text builtin_lisp_symbol (1284)
+# define Qread builtin_lisp_symbol (1285)
+# define Qread_char builtin_lisp_symbol (1286)
+# define Qread_file_name builtin_lisp_symbol (1287)
+# define Qread_minibuffer builtin_lisp_symbol (1288)
+# define Qread_number builtin_lisp_symbol (1289)
+# define Qread_only builtin_lisp_symbol (1290)
+# define Qread_symbol_shorthands builtin_lisp_symbol (1291)
+# define Qreal builtin_lisp_symbol (1292)
+# define Qreal_this_command builtin_lisp_symbol (1293)
+# define Qrear_nonsticky builtin_lisp_symbol (1294)
+# define Qrecord builtin_lisp_symbol (1295)
+# define Qrecord_unwind_current_buffer builtin_lisp_symbol (1296)
+# define Qrecord_unwind_protect_excursion builtin_lisp_symbol (1297)
+# define Qrecord_window_buffer builtin_lisp_symbol (1298)
+# define Qrecordp builtin_lisp_symbol (1299)
+# define Qrect builtin_lisp_symbol (1300)
+# define Qrecursion_error builtin_lisp_symbol (1301)
+# define Qredisplay_internal_xC_functionx builtin_lisp_symbol (1302)
+# define Qrelative builtin_lisp_symbol (1303)
+# define Qreleased_button builtin_lisp_symbol (1304)
+# define Qremap builtin_lisp_symbol (1305)
+# define Qremote_file_error builtin_lisp_symbol (1306)
+# define Qrename builtin_lisp_symbol (1307)
+# define Qrename_auto_save_file builtin_lisp_symbol (1308)
+# define Qrename_file builtin_lisp_symbol (1309)
+# define Qreplace_buffer_in_windows builtin_lisp_symbol (1310)
+# define Qrequire builtin_lisp_symbol (1311)
+# define Qreset builtin_lisp_symbol (1312)
+# define Qresume_tty_functions builtin_lisp_symbol (1313)
+# define Qretained builtin_lisp_symbol (1314)
+# define Qreturn builtin_lisp_symbol (1315)
+# define Qreverse_italic builtin_lisp_symbol (1316)
+# define Qrevoke builtin_lisp_symbol (1317)
+# define Qright builtin_lisp_symbol (1318)
+# define Qright_divider builtin_lisp_symbol (1319)
+# define Qright_divider_width builtin_lisp_symbol (1320)
+# define Qright_edge builtin_lisp_symbol (1321)
+# define Qright_fringe builtin_lisp_symbol (1322)
+# define Qright_fringe_help builtin_lisp_symbol (1323)
+# define Qright_margin builtin_lisp_symbol (1324)
+# define Qright_to_left builtin_lisp_symbol (1325)
+# define Qrightmost builtin_lisp_symbol (1326)
+# define Qrisky_local_variable builtin_lisp_symbol (1327)
+# define Qrotate builtin_lisp_symbol (1328)
+# define Qrotate90 builtin_lisp_symbol (1329)
+# define Qrss builtin_lisp_symbol (1330)
+# define Qrun builtin_lisp_symbol (1331)
+# define Qrun_at_time builtin_lisp_symbol (1332)
+# define Qrun_hook_query_error_with_timeout builtin_lisp_symbol (1333)
+# define Qrun_hook_with_args builtin_lisp_symbol (1334)
+# define Qsafe builtin_lisp_symbol (1335)
+# define Qsafe_magic builtin_lisp_symbol (1336)
+# define Qsave_excursion builtin_lisp_symbol (1337)
+# define Qsave_session builtin_lisp_symbol (1338)
+# define Qscale builtin_lisp_symbol (1339)
+# define Qscale_factor builtin_lisp_symbol (1340)
+# define Qscan_error builtin_lisp_symbol (1341)
+# define Qscratch builtin_lisp_symbol (1342)
+# define Qscreen_gamma builtin_lisp_symbol (1343)
+# define Qscroll_bar builtin_lisp_symbol (1344)
+# define Qscroll_bar_background builtin_lisp_symbol (1345)
+# define Qscroll_bar_foreground builtin_lisp_symbol (1346)
+# define Qscroll_bar_height builtin_lisp_symbol (1347)
+# define Qscroll_bar_movement builtin_lisp_symbol (1348)
+# define Qscroll_bar_width builtin_lisp_symbol (1349)
+# define Qscroll_command builtin_lisp_symbol (1350)
+# define Qscroll_down builtin_lisp_symbol (1351)
+# define Qscroll_up builtin_lisp_symbol (1352)
+# define Qsearch_failed builtin_lisp_symbol (1353)
+# define Qselect_frame_set_input_focus builtin_lisp_symbol (1354)
+# define Qselect_window builtin_lisp_symbol (1355)
+# define Qselection_request builtin_lisp_symbol (1356)
+# define Qself_insert_command builtin_lisp_symbol (1357)
+# define Qsemi_bold builtin_lisp_symbol (1358)
+# define Qsemi_light builtin_lisp_symbol (1359)
+# define Qseqpacket builtin_lisp_symbol (1360)
+# define Qsequencep builtin_lisp_symbol (1361)
+# define Qserial builtin_lisp_symbol (1362)
+# define Qsess builtin_lisp_symbol (1363)
+# define Qset builtin_lisp_symbol (1364)
+# define Qset_args_to_local builtin_lisp_symbol (1365)
+# define Qset_buffer_multibyte builtin_lisp_symbol (1366)
+# define Qset_default builtin_lisp_symbol (1367)
+# define Qset_file_acl builtin_lisp_symbol (1368)
+# define Qset_file_modes builtin_lisp_symbol (1369)
+# define Qset_file_selinux_context builtin_lisp_symbol (1370)
+# define Qset_file_times builtin_lisp_symbol (1371)
+# define Qset_internal builtin_lisp_symbol (1372)
+# define Qset_par_to_local builtin_lisp_symbol (1373)
+# define Qset_rest_args_to_local builtin_lisp_symbol (1374)
+# define Qset_visited_file_modtime builtin_lisp_symbol (1375)
+# define Qset_window_configuration builtin_lisp_symbol (1376)
+# define Qsetcar builtin_lisp_symbol (1377)
+# define Qsetcdr builtin_lisp_symbol (1378)
+# define Qsetimm builtin_lisp_symbol (1379)
+# define Qsetq builtin_lisp_symbol (1380)
+# define Qsetting_constant builtin_lisp_symbol (1381)
+# define Qsha1 builtin_lisp_symbol (1382)
+# define Qsha224 builtin_lisp_symbol (1383)
+# define Qsha256 builtin_lisp_symbol (1384)
+# define Qsha384 builtin_lisp_symbol (1385)
+# define Qsha512 builtin_lisp_symbol (1386)
+# define Qshaded builtin_lisp_symbol (1387)
+# define Qshift_jis builtin_lisp_symbol (1388)
+# define Qshlwapi builtin_lisp_symbol (1389)
+# define Qsignal builtin_lisp_symbol (1390)
+# define Qsignal_process_functions builtin_lisp_symbol (1391)
+# define Qsigusr2 builtin_lisp_symbol (1392)
+# define Qsilently builtin_lisp_symbol (1393)
+# define Qsingularity_error builtin_lisp_symbol (1394)
+# define Qsize builtin_lisp_symbol (1395)
+# define Qsize_and_position builtin_lisp_symbol (1396)
+# define Qskip_taskbar builtin_lisp_symbol (1397)
+# define Qsleep_event builtin_lisp_symbol (1398)
+# define Qslice builtin_lisp_symbol (1399)
+# define Qsound builtin_lisp_symbol (1400)
+# define Qsource builtin_lisp_symbol (1401)
+# define Qspace builtin_lisp_symbol (1402)
+# define Qspace_width builtin_lisp_symbol (1403)
+# define Qspecial_form builtin_lisp_symbol (1404)
+# define Qspecial_lowercase builtin_lisp_symbol (1405)
+# define Qspecial_titlecase builtin_lisp_symbol (1406)
+# define Qspecial_uppercase builtin_lisp_symbol (1407)
+# define Qsqlite builtin_lisp_symbol (1408)
+# define Qsqlite3 builtin_lisp_symbol (1409)
+# define Qsqlite_error builtin_lisp_symbol (1410)
+# define Qsqlite_locked_error builtin_lisp_symbol (1411)
+# define Qsqlitep builtin_lisp_symbol (1412)
+# define Qstandard_input builtin_lisp_symbol (1413)
+# define Qstandard_output builtin_lisp_symbol (1414)
+# define Qstart builtin_lisp_symbol (1415)
+# define Qstart_process builtin_lisp_symbol (1416)
+# define Qstate builtin_lisp_symbol (1417)
+# define Qstatic_gray builtin_lisp_symbol (1418)
+# define Qstderr builtin_lisp_symbol (1419)
+# define Qstdin builtin_lisp_symbol (1420)
+# define Qstdout builtin_lisp_symbol (1421)
+# define Qsticky builtin_lisp_symbol (1422)
+# define Qstime builtin_lisp_symbol (1423)
+# define Qstop builtin_lisp_symbol (1424)
+# define Qstraight builtin_lisp_symbol (1425)
+# define Qstring builtin_lisp_symbol (1426)
+# define Qstring_bytes builtin_lisp_symbol (1427)
+# define Qstring_lessp builtin_lisp_symbol (1428)
+# define Qstring_replace builtin_lisp_symbol (1429)
+# define Qstringp builtin_lisp_symbol (1430)
+# define Qstrings builtin_lisp_symbol (1431)
+# define Qsub1 builtin_lisp_symbol (1432)
+# define Qsub_char_table builtin_lisp_symbol (1433)
+# define Qsubfeatures builtin_lisp_symbol (1434)
+# define Qsubr builtin_lisp_symbol (1435)
+# define Qsubr_native_elisp builtin_lisp_symbol (1436)
+# define Qsubrp builtin_lisp_symbol (1437)
+# define Qsubstitute_command_keys builtin_lisp_symbol (1438)
+# define Qsubstitute_env_in_file_name builtin_lisp_symbol (1439)
+# define Qsubstitute_in_file_name builtin_lisp_symbol (1440)
+# define Qsuper builtin_lisp_symbol (1441)
+# define Qsuppress_keymap builtin_lisp_symbol (1442)
+# define Qsuspend_hook builtin_lisp_symbol (1443)
+# define Qsuspend_resume_hook builtin_lisp_symbol (1444)
+# define Qsuspend_tty_functions builtin_lisp_symbol (1445)
+# define Qsvg builtin_lisp_symbol (1446)
+# define Qsw builtin_lisp_symbol (1447)
+# define Qswitch_frame builtin_lisp_symbol (1448)
+# define Qsymbol builtin_lisp_symbol (1449)
+# define Qsymbol_error builtin_lisp_symbol (1450)
+# define Qsymbol_with_pos builtin_lisp_symbol (1451)
+# define Qsymbol_with_pos_p builtin_lisp_symbol (1452)
+# define Qsymbolp builtin_lisp_symbol (1453)
+# define Qsymbols builtin_lisp_symbol (1454)
+# define Qsymbols_with_pos_enabled builtin_lisp_symbol (1455)
+# define Qsyntax_ppss builtin_lisp_symbol (1456)
+# define Qsyntax_ppss_flush_cache builtin_lisp_symbol (1457)
+# define Qsyntax_table builtin_lisp_symbol (1458)
+# define Qsyntax_table_p builtin_lisp_symbol (1459)
+# define Qtab_bar builtin_lisp_symbol (1460)
+# define Qtab_bar_lines builtin_lisp_symbol (1461)
+# define Qtab_bar_size builtin_lisp_symbol (1462)
+# define Qtab_line builtin_lisp_symbol (1463)
+# define Qtab_line_format builtin_lisp_symbol (1464)
+# define Qtarget_idx builtin_lisp_symbol (1465)
+# define Qtemp_buffer_setup_hook builtin_lisp_symbol (1466)
+# define Qtemp_buffer_show_hook builtin_lisp_symbol (1467)
+# define Qterminal builtin_lisp_symbol (1468)
+# define Qterminal_frame builtin_lisp_symbol (1469)
+# define Qterminal_live_p builtin_lisp_symbol (1470)
+# define Qtest builtin_lisp_symbol (1471)
+# define Qtext builtin_lisp_symbol (1472)
+# define Qtext_conversion builtin_lisp_symbol (1473)
+# define Qtext_image_horiz builtin_lisp_symbol (1474)
+# define Qtext_pixels builtin_lisp_symbol (1475)
+# define Qtext_property_default_nonsticky builtin_lisp_symbol (1476)
+# define Qtext_read_only builtin_lisp_symbol (1477)
+# define Qthcount builtin_lisp_symbol (1478)
+# define Qthin builtin_lisp_symbol (1479)
+# define Qthin_space builtin_lisp_symbol (1480)
+# define Qthread builtin_lisp_symbol (1481)
+# define Qthread_buffer_killed builtin_lisp_symbol (1482)
+# define Qthread_event builtin_lisp_symbol (1483)
+# define Qthreadp builtin_lisp_symbol (1484)
+# define Qtiff builtin_lisp_symbol (1485)
+# define Qtime builtin_lisp_symbol (1486)
+# define Qtimer_event_handler builtin_lisp_symbol (1487)
+# define Qtip_frame builtin_lisp_symbol (1488)
+# define Qtitle builtin_lisp_symbol (1489)
+# define Qtitle_bar_size builtin_lisp_symbol (1490)
+# define Qtitlecase builtin_lisp_symbol (1491)
+# define Qtool_bar builtin_lisp_symbol (1492)
+# define Qtool_bar_external builtin_lisp_symbol (1493)
+# define Qtool_bar_lines builtin_lisp_symbol (1494)
+# define Qtool_bar_position builtin_lisp_symbol (1495)
+# define Qtool_bar_size builtin_lisp_symbol (1496)
+# define Qtoolkit_theme_changed builtin_lisp_symbol (1497)
+# define Qtoolkit_theme_set_functions builtin_lisp_symbol (1498)
+# define Qtooltip builtin_lisp_symbol (1499)
+# define Qtop builtin_lisp_symbol (1500)
+# define Qtop_bottom builtin_lisp_symbol (1501)
+# define Qtop_edge builtin_lisp_symbol (1502)
+# define Qtop_left_corner builtin_lisp_symbol (1503)
+# define Qtop_level builtin_lisp_symbol (1504)
+# define Qtop_only builtin_lisp_symbol (1505)
+# define Qtop_right_corner builtin_lisp_symbol (1506)
+# define Qtouch_end builtin_lisp_symbol (1507)
+# define Qtouchscreen builtin_lisp_symbol (1508)
+# define Qtouchscreen_begin builtin_lisp_symbol (1509)
+# define Qtouchscreen_end builtin_lisp_symbol (1510)
+# define Qtouchscreen_update builtin_lisp_symbol (1511)
+# define Qtpgid builtin_lisp_symbol (1512)
+# define Qtrailing_whitespace builtin_lisp_symbol (1513)
+# define Qtranslation_table builtin_lisp_symbol (1514)
+# define Qtranslation_table_id builtin_lisp_symbol (1515)
+# define Qtrapping_constant builtin_lisp_symbol (1516)
+# define Qtree_sitter builtin_lisp_symbol (1517)
+# define Qtree_sitter__library_abi builtin_lisp_symbol (1518)
+# define Qtreesit_buffer_too_large builtin_lisp_symbol (1519)
+# define Qtreesit_compiled_query builtin_lisp_symbol (1520)
+# define Qtreesit_compiled_query_p builtin_lisp_symbol (1521)
+# define Qtreesit_error builtin_lisp_symbol (1522)
+# define Qtreesit_invalid_predicate builtin_lisp_symbol (1523)
+# define Qtreesit_language_remap_alist builtin_lisp_symbol (1524)
+# define Qtreesit_load_language_error builtin_lisp_symbol (1525)
+# define Qtreesit_node builtin_lisp_symbol (1526)
+# define Qtreesit_node_buffer_killed builtin_lisp_symbol (1527)
+# define Qtreesit_node_outdated builtin_lisp_symbol (1528)
+# define Qtreesit_node_p builtin_lisp_symbol (1529)
+# define Qtreesit_parse_error builtin_lisp_symbol (1530)
+# define Qtreesit_parser builtin_lisp_symbol (1531)
+# define Qtreesit_parser_deleted builtin_lisp_symbol (1532)
+# define Qtreesit_parser_p builtin_lisp_symbol (1533)
+# define Qtreesit_pattern_expand builtin_lisp_symbol (1534)
+# define Qtreesit_predicate_not_found builtin_lisp_symbol (1535)
+# define Qtreesit_query_error builtin_lisp_symbol (1536)
+# define Qtreesit_query_p builtin_lisp_symbol (1537)
+# define Qtreesit_range_invalid builtin_lisp_symbol (1538)
+# define Qtreesit_thing_symbol builtin_lisp_symbol (1539)
+# define Qtrue_color builtin_lisp_symbol (1540)
+# define Qtruncation builtin_lisp_symbol (1541)
+# define Qttname builtin_lisp_symbol (1542)
+# define Qtty builtin_lisp_symbol (1543)
+# define Qtty_color_alist builtin_lisp_symbol (1544)
+# define Qtty_color_by_index builtin_lisp_symbol (1545)
+# define Qtty_color_desc builtin_lisp_symbol (1546)
+# define Qtty_color_mode builtin_lisp_symbol (1547)
+# define Qtty_color_standard_values builtin_lisp_symbol (1548)
+# define Qtty_defined_color_alist builtin_lisp_symbol (1549)
+# define Qtty_menu_disabled_face builtin_lisp_symbol (1550)
+# define Qtty_menu_enabled_face builtin_lisp_symbol (1551)
+# define Qtty_menu_exit builtin_lisp_symbol (1552)
+# define Qtty_menu_ignore builtin_lisp_symbol (1553)
+# define Qtty_menu_mouse_movement builtin_lisp_symbol (1554)
+# define Qtty_menu_navigation_map builtin_lisp_symbol (1555)
+# define Qtty_menu_next_item builtin_lisp_symbol (1556)
+# define Qtty_menu_next_menu builtin_lisp_symbol (1557)
+# define Qtty_menu_open_use_tmm builtin_lisp_symbol (1558)
+# define Qtty_menu_prev_item builtin_lisp_symbol (1559)
+# define Qtty_menu_prev_menu builtin_lisp_symbol (1560)
+# define Qtty_menu_select builtin_lisp_symbol (1561)
+# define Qtty_mode_reset_strings builtin_lisp_symbol (1562)
+# define Qtty_mode_set_strings builtin_lisp_symbol (1563)
+# define Qtty_non_selected_cursor builtin_lisp_symbol (1564)
+# define Qtty_select_active_regions builtin_lisp_symbol (1565)
+# define Qtty_set_up_initial_frame_faces builtin_lisp_symbol (1566)
+# define Qtty_type builtin_lisp_symbol (1567)
+# define Qtype_mismatch builtin_lisp_symbol (1568)
+# define Qultra_bold builtin_lisp_symbol (1569)
+# define Qultra_heavy builtin_lisp_symbol (1570)
+# define Qultra_light builtin_lisp_symbol (1571)
+# define Qundecided builtin_lisp_symbol (1572)
+# define Qundecorated builtin_lisp_symbol (1573)
+# define Qundefined builtin_lisp_symbol (1574)
+# define Qundeleted builtin_lisp_symbol (1575)
+# define Qunderflow_error builtin_lisp_symbol (1576)
+# define Qunderline_minimum_offset builtin_lisp_symbol (1577)
+# define Qundo_auto__add_boundary builtin_lisp_symbol (1578)
+# define Qundo_auto__last_boundary_cause builtin_lisp_symbol (1579)
+# define Qundo_auto__this_command_amalgamating builtin_lisp_symbol (1580)
+# define Qundo_auto__undoable_change builtin_lisp_symbol (1581)
+# define Qundo_auto__undoably_changed_buffers builtin_lisp_symbol (1582)
+# define Qundo_auto_amalgamate builtin_lisp_symbol (1583)
+# define Qunevalled builtin_lisp_symbol (1584)
+# define Qunhandled_file_name_directory builtin_lisp_symbol (1585)
+# define Qunicode builtin_lisp_symbol (1586)
+# define Qunicode_bmp builtin_lisp_symbol (1587)
+# define Qunicode_string_p builtin_lisp_symbol (1588)
+# define Quniquify__rename_buffer_advice builtin_lisp_symbol (1589)
+# define Qunix builtin_lisp_symbol (1590)
+# define Qunlet builtin_lisp_symbol (1591)
+# define Qunlock_file builtin_lisp_symbol (1592)
+# define Qunreachable builtin_lisp_symbol (1593)
+# define Qunspecified builtin_lisp_symbol (1594)
+# define Qunsplittable builtin_lisp_symbol (1595)
+# define Qup builtin_lisp_symbol (1596)
+# define Quppercase builtin_lisp_symbol (1597)
+# define Qurl builtin_lisp_symbol (1598)
+# define Qus_ascii builtin_lisp_symbol (1599)
+# define Quse_frame_synchronization builtin_lisp_symbol (1600)
+# define Quse_region_p builtin_lisp_symbol (1601)
+# define Quser builtin_lisp_symbol (1602)
+# define Quser_emacs_directory builtin_lisp_symbol (1603)
+# define Quser_error builtin_lisp_symbol (1604)
+# define Quser_position builtin_lisp_symbol (1605)
+# define Quser_ptr builtin_lisp_symbol (1606)
+# define Quser_ptrp builtin_lisp_symbol (1607)
+# define Quser_search_failed builtin_lisp_symbol (1608)
+# define Quser_size builtin_lisp_symbol (1609)
+# define Quserlock__ask_user_about_supersession_threat builtin_lisp_symbol (1610)
+# define Quserlock__handle_unlock_error builtin_lisp_symbol (1611)
+# define Qutf_16 builtin_lisp_symbol (1612)
+# define Qutf_16le builtin_lisp_symbol (1613)
+# define Qutf_8 builtin_lisp_symbol (1614)
+# define Qutf_8_emacs builtin_lisp_symbol (1615)
+# define Qutf_8_string_p builtin_lisp_symbol (1616)
+# define Qutf_8_unix builtin_lisp_symbol (1617)
+# define Qutime builtin_lisp_symbol (1618)
+# define Qvalue builtin_lisp_symbol (1619)
+# define Qvaluelt builtin_lisp_symbol (1620)
+# define Qvariable_documentation builtin_lisp_symbol (1621)
+# define Qvdrag builtin_lisp_symbol (1622)
+# define Qvector builtin_lisp_symbol (1623)
+# define Qvector_or_char_table_p builtin_lisp_symbol (1624)
+# define Qvector_slots builtin_lisp_symbol (1625)
+# define Qvectorp builtin_lisp_symbol (1626)
+# define Qvectors builtin_lisp_symbol (1627)
+# define Qverify_visited_file_modtime builtin_lisp_symbol (1628)
+# define Qvertical_border builtin_lisp_symbol (1629)
+# define Qvertical_line builtin_lisp_symbol (1630)
+# define Qvertical_scroll_bar builtin_lisp_symbol (1631)
+# define Qvertical_scroll_bars builtin_lisp_symbol (1632)
+# define Qvisibility builtin_lisp_symbol (1633)
+# define Qvisible builtin_lisp_symbol (1634)
+# define Qvisual builtin_lisp_symbol (1635)
+# define Qvoid_function builtin_lisp_symbol (1636)
+# define Qvoid_variable builtin_lisp_symbol (1637)
+# define Qvsize builtin_lisp_symbol (1638)
+# define Qw32 builtin_lisp_symbol (1639)
+# define Qwait_for_wm builtin_lisp_symbol (1640)
+# define Qwall builtin_lisp_symbol (1641)
+# define Qwatchers builtin_lisp_symbol (1642)
+# define Qwave builtin_lisp_symbol (1643)
+# define Qweakness builtin_lisp_symbol (1644)
+# define Qwebp builtin_lisp_symbol (1645)
+# define Qwebpdemux builtin_lisp_symbol (1646)
+# define Qwhen builtin_lisp_symbol (1647)
+# define Qwholenump builtin_lisp_symbol (1648)
+# define Qwidget_type builtin_lisp_symbol (1649)
+# define Qwidth builtin_lisp_symbol (1650)
+# define Qwidth_only builtin_lisp_symbol (1651)
+# define Qwindow builtin_lisp_symbol (1652)
+# define Qwindow__pixel_to_total builtin_lisp_symbol (1653)
+# define Qwindow__resize_mini_frame builtin_lisp_symbol (1654)
+# define Qwindow__resize_root_window builtin_lisp_symbol (1655)
+# define Qwindow__resize_root_window_vertically builtin_lisp_symbol (1656)
+# define Qwindow_buffer_change_functions builtin_lisp_symbol (1657)
+# define Qwindow_configuration builtin_lisp_symbol (1658)
+# define Qwindow_configuration_change_hook builtin_lisp_symbol (1659)
+# define Qwindow_configuration_p builtin_lisp_symbol (1660)
+# define Qwindow_deletable_p builtin_lisp_symbol (1661)
+# define Qwindow_divider builtin_lisp_symbol (1662)
+# define Qwindow_divider_first_pixel builtin_lisp_symbol (1663)
+# define Qwindow_divider_last_pixel builtin_lisp_symbol (1664)
+# define Qwindow_edges builtin_lisp_symbol (1665)
+# define Qwindow_id builtin_lisp_symbol (1666)
+# define Qwindow_live_p builtin_lisp_symbol (1667)
+# define Qwindow_point_insertion_type builtin_lisp_symbol (1668)
+# define Qwindow_scroll_functions builtin_lisp_symbol (1669)
+# define Qwindow_selection_change_functions builtin_lisp_symbol (1670)
+# define Qwindow_size builtin_lisp_symbol (1671)
+# define Qwindow_size_change_functions builtin_lisp_symbol (1672)
+# define Qwindow_state_change_functions builtin_lisp_symbol (1673)
+# define Qwindow_state_change_hook builtin_lisp_symbol (1674)
+# define Qwindow_valid_p builtin_lisp_symbol (1675)
+# define Qwindowp builtin_lisp_symbol (1676)
+# define Qworkarea builtin_lisp_symbol (1677)
+# define Qwrap_prefix builtin_lisp_symbol (1678)
+# define Qwrite builtin_lisp_symbol (1679)
+# define Qwrite_region builtin_lisp_symbol (1680)
+# define Qwrite_region_annotate_functions builtin_lisp_symbol (1681)
+# define Qwrong_length_argument builtin_lisp_symbol (1682)
+# define Qwrong_number_of_arguments builtin_lisp_symbol (1683)
+# define Qwrong_register_subr_call builtin_lisp_symbol (1684)
+# define Qwrong_type_argument builtin_lisp_symbol (1685)
+# define Qx builtin_lisp_symbol (1686)
+# define Qx_create_frame_1 builtin_lisp_symbol (1687)
+# define Qx_create_frame_2 builtin_lisp_symbol (1688)
+# define Qx_frame_parameter builtin_lisp_symbol (1689)
+# define Qx_hide_tip builtin_lisp_symbol (1690)
+# define Qx_pre_popup_menu_hook builtin_lisp_symbol (1691)
+# define Qx_resource_name builtin_lisp_symbol (1692)
+# define Qx_set_menu_bar_lines builtin_lisp_symbol (1693)
+# define Qx_set_window_size_1 builtin_lisp_symbol (1694)
+# define Qx_underline_at_descent_line builtin_lisp_symbol (1695)
+# define Qx_use_underline_position_properties builtin_lisp_symbol (1696)
+# define Qxbm builtin_lisp_symbol (1697)
+# define Qxg_frame_set_char_size builtin_lisp_symbol (1698)
+# define Qxpm builtin_lisp_symbol (1699)
+# define Qxterm__set_selection builtin_lisp_symbol (1700)
+# define Qxwidget builtin_lisp_symbol (1701)
+# define Qxwidget_display_event builtin_lisp_symbol (1702)
+# define Qxwidget_event builtin_lisp_symbol (1703)
+# define Qxwidget_view builtin_lisp_symbol (1704)
+# define Qy_or_n_p builtin_lisp_symbol (1705)
+# define Qyes_or_no_p builtin_lisp_symbol (1706)
+# define Qyes_or_no_p_history builtin_lisp_symbol (1707)
+# define Qz_group builtin_lisp_symbol (1708)
+# define Qzero_width builtin_lisp_symbol (1709)
 #endif
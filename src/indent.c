@@ -50,6 +50,13 @@ ptrdiff_t last_known_column_point;
 
 static modiff_count last_known_column_modified;
 
+/* Distance between the column checkpoints of long lines.  */
+
+enum
+{
+    COLUMN_INDEX_INTERVAL = 2048
+};
+
 static ptrdiff_t current_column_1(void);
 static ptrdiff_t position_indentation(ptrdiff_t);
 
@@ -321,10 +328,11 @@ ptrdiff_t current_column(void) {
         !NILP(Vlong_line_threshold) &&
         PT - line_beg > XFIXNUM(Vlong_line_threshold))
         return PT - line_beg; /* this is an approximation! */
-    /* If the buffer has overlays, text properties,
-       or multibyte characters, use a more general algorithm.  */
+    /* If the buffer has overlays, text properties, or multibyte
+       characters, use a more general algorithm.  Use it for long lines
+       as well, since it remembers columns in them.  */
     if (buffer_intervals(current_buffer) || buffer_has_overlays() ||
-        Z != Z_BYTE)
+        Z != Z_BYTE || PT - line_beg > COLUMN_INDEX_INTERVAL)
         return current_column_1();
 
     /* Scan backwards from point to the previous newline,
@@ -549,6 +557,181 @@ static int check_display_width(Lisp_Object window, ptrdiff_t pos,
     return -1;
 }
 
+/* Column checkpoints for long lines.
+
+   When scan_for_column walks a long line, it records every
+   COLUMN_INDEX_INTERVAL characters the position it has reached and
+   the column there, so that later scans of the same line can start at
+   the last checkpoint before the position or column they are looking
+   for, instead of at the beginning of the line.  The checkpoints are
+   kept per buffer, sorted by position.  Changes of the text and of
+   its properties discard the checkpoints at or after the position
+   they affect; other changes that influence columns, like overlay
+   changes or a different tab width, discard all of them.  Display
+   tables and `char-width-table' are changed in place, so
+   char_table_changed discards the checkpoints of all buffers when one
+   of them is.  */
+
+struct column_checkpoint {
+    /* The beginning of the line, a position in it, and its column.  */
+    ptrdiff_t bol, charpos, bytepos, col;
+};
+
+struct column_index {
+    /* What the columns were computed with.  */
+    modiff_count overlay_modiff;
+    ptrdiff_t begv;
+    int tab_width;
+    bool ctl_arrow;
+    Lisp_Object dp, char_width_table;
+    Lisp_Object selective_display, multibyte;
+    struct window* w;
+
+    struct column_checkpoint* points;
+    ptrdiff_t npoints, size;
+};
+
+/* Free the column index of buffer B, if any.  */
+
+void free_column_index(struct buffer* b) {
+    if (b->column_index) {
+        xfree(b->column_index->points);
+        xfree(b->column_index);
+        b->column_index = NULL;
+    }
+}
+
+/* Free the column indexes of all buffers.  */
+
+void invalidate_column_indexes(void) {
+    Lisp_Object tail, buffer;
+    FOR_EACH_LIVE_BUFFER(tail, buffer) free_column_index(XBUFFER(buffer));
+}
+
+/* Mark the tables the column index of buffer B was computed with, so
+   that they are not freed and their addresses reused while B can
+   compare them with the current ones.  */
+
+void mark_column_index(struct buffer* b) {
+    if (b->column_index) {
+        mark_object(b->column_index->dp);
+        mark_object(b->column_index->char_width_table);
+    }
+}
+
+/* Discard the column checkpoints of buffer B at or after POS.  */
+
+void invalidate_column_index(struct buffer* b, ptrdiff_t pos) {
+    struct column_index* x = b->column_index;
+
+    if (x)
+        while (x->npoints > 0 && x->points[x->npoints - 1].charpos >= pos)
+            x->npoints--;
+}
+
+/* Return the column index to use for scanning the current buffer in
+   window W, discarding its checkpoints if they were computed with
+   different settings, or null if the buffer shouldn't have one.  */
+
+static struct column_index* column_index_for(struct window* w) {
+    struct buffer* b = current_buffer;
+    struct column_index* x = b->column_index;
+    int tab_width = SANE_TAB_WIDTH(b);
+    bool ctl_arrow = !NILP(BVAR(b, ctl_arrow));
+    struct Lisp_Char_Table* disptab = buffer_display_table();
+    Lisp_Object dp = disptab ? make_lisp_ptr(disptab, Lisp_Vectorlike) : Qnil;
+
+    /* Indirect buffers share the text, but not the overlays, with
+       their base buffer, and insdel.c only informs the latter about
+       changes.  A list as invisibility spec can change in place.  */
+    if (b->base_buffer || !EQ(BVAR(b, invisibility_spec), Qt))
+        return NULL;
+
+    if (x == NULL) {
+        x = b->column_index = xzalloc(sizeof *x);
+        x->dp = x->char_width_table = Qnil;
+        x->selective_display = x->multibyte = Qnil;
+    }
+    else if (x->overlay_modiff == OVERLAY_MODIFF && x->begv == BEGV &&
+             x->tab_width == tab_width && x->ctl_arrow == ctl_arrow &&
+             EQ(x->dp, dp) && EQ(x->char_width_table, Vchar_width_table) &&
+             EQ(x->selective_display, BVAR(b, selective_display)) &&
+             EQ(x->multibyte, BVAR(b, enable_multibyte_characters)) &&
+             x->w == w)
+        return x;
+
+    x->npoints = 0;
+    x->overlay_modiff = OVERLAY_MODIFF;
+    x->begv = BEGV;
+    x->tab_width = tab_width;
+    x->ctl_arrow = ctl_arrow;
+    x->dp = dp;
+    x->char_width_table = Vchar_width_table;
+    x->selective_display = BVAR(b, selective_display);
+    x->multibyte = BVAR(b, enable_multibyte_characters);
+    x->w = w;
+    return x;
+}
+
+/* Return the last checkpoint of index X in the line starting at BOL
+   that is before END and has a column less than GOAL, or null if
+   there is none.  */
+
+static struct column_checkpoint* column_index_lookup(struct column_index* x,
+                                                     ptrdiff_t bol,
+                                                     ptrdiff_t end,
+                                                     EMACS_INT goal) {
+    ptrdiff_t lo = 0, hi = x->npoints;
+
+    /* Find the first checkpoint after BOL.  */
+    while (lo < hi) {
+        ptrdiff_t mid = lo + (hi - lo) / 2;
+        if (x->points[mid].charpos <= bol)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    /* Columns increase along the line, so the checkpoints we can use
+       are a prefix of those that follow.  */
+    hi = x->npoints;
+    while (lo < hi) {
+        ptrdiff_t mid = lo + (hi - lo) / 2;
+        struct column_checkpoint* p = &x->points[mid];
+        if (p->bol == bol && p->charpos < end && p->col < goal)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (lo > 0 && x->points[lo - 1].bol == bol &&
+        x->points[lo - 1].charpos > bol)
+        return &x->points[lo - 1];
+    return NULL;
+}
+
+/* Record in index X that CHARPOS, BYTEPOS in the line starting at BOL
+   is at column COL.  */
+
+static void column_index_add(struct column_index* x, ptrdiff_t bol,
+                             ptrdiff_t charpos, ptrdiff_t bytepos,
+                             ptrdiff_t col) {
+    ptrdiff_t i = x->npoints;
+
+    while (i > 0 && x->points[i - 1].charpos >= charpos) {
+        if (x->points[i - 1].charpos == charpos)
+            return;
+        i--;
+    }
+
+    if (x->npoints == x->size)
+        x->points = xpalloc(x->points, &x->size, 1, -1, sizeof *x->points);
+    memmove(x->points + i + 1, x->points + i,
+            (x->npoints - i) * sizeof *x->points);
+    x->points[i] = (struct column_checkpoint){bol, charpos, bytepos, col};
+    x->npoints++;
+}
+
 /* Scanning from the beginning of the current line, stop at the buffer
    position ENDPOS or at the column GOALCOL or at the end of line, whichever
    comes first.
@@ -572,6 +755,8 @@ static void scan_for_column(ptrdiff_t* endpos, EMACS_INT* goalcol,
     EMACS_INT goal = goalcol ? *goalcol : MOST_POSITIVE_FIXNUM;
     ptrdiff_t end = endpos ? *endpos : PT;
     ptrdiff_t scan, scan_byte, next_boundary, prev_pos, prev_bpos;
+    ptrdiff_t bol, next_checkpoint;
+    struct column_index* index;
 
     scan = find_newline(PT, PT_BYTE, BEGV, BEGV_BYTE, -1, NULL, &scan_byte, 1);
 
@@ -616,6 +801,21 @@ static void scan_for_column(ptrdiff_t* endpos, EMACS_INT* goalcol,
             col = 0;
         }
     }
+
+    /* If we have been this way before, start at the last position we
+       know the column of.  */
+    bol = scan;
+    index = end - scan > COLUMN_INDEX_INTERVAL ? column_index_for(w) : NULL;
+    if (index) {
+        struct column_checkpoint* p = column_index_lookup(index, bol, end, goal);
+        if (p) {
+            scan = p->charpos;
+            scan_byte = p->bytepos;
+            col = prev_col = p->col;
+        }
+    }
+    next_checkpoint = scan + COLUMN_INDEX_INTERVAL;
+
     next_boundary = scan;
     prev_pos = scan;
     prev_bpos = scan_byte;
@@ -654,6 +854,14 @@ static void scan_for_column(ptrdiff_t* endpos, EMACS_INT* goalcol,
         prev_pos = scan;
         prev_bpos = scan_byte;
 
+        /* Remember the column here, unless we are inside a composition
+           or at its start, where the state of CMP_IT matters.  */
+        if (index && scan >= next_checkpoint && cmp_it.id < 0 &&
+            cmp_it.stop_pos > scan) {
+            column_index_add(index, bol, scan, scan_byte, col);
+            next_checkpoint = scan + COLUMN_INDEX_INTERVAL;
+        }
+
         { /* Check display property.  */
             ptrdiff_t endp;
             int width =
@@ -56,5 +56,7 @@ void recompute_width_table(struct buffer* buf, struct Lisp_Char_Table* disptab);
 extern ptrdiff_t current_column(void);
 extern void line_number_display_width(struct window*, int*, int*);
 extern void invalidate_current_column(void);
+extern void invalidate_column_index(struct buffer*, ptrdiff_t);
+extern void free_column_index(struct buffer*);
 extern bool indented_beyond_p(ptrdiff_t, ptrdiff_t, EMACS_INT);
 extern void syms_of_indent(void);
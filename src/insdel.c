@@ -26,6 +26,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include "buffer.h"
 #include "character.h"
 #include "composite.h"
+#include "indent.h"
 #include "intervals.h"
 #include "lisp.h"
 #include "pdumper.h"
@@ -1370,12 +1371,9 @@ void replace_range(ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
     }
     ptrdiff_t from_byte, to_byte;
     ptrdiff_t nbytes_del, nchars_del;
-    Lisp_Object deletion;
 
     check_markers();
 
-    deletion = Qnil;
-
     if (run_mod_hooks) {
         ptrdiff_t range_length = to - from;
         prepare_to_modify_buffer(from, to, &from);
@@ -1458,8 +1456,15 @@ void replace_range(ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
     if (to < GPT)
         gap_left(to, to_byte, 0);
 
-    if (!EQ(BVAR(current_buffer, undo_list), Qt))
-        deletion = make_buffer_string_both(from, from_byte, to, to_byte, 1);
+    /* Record the insertion first, so that when we undo,
+       the deletion will be undone first.  Thus, undo
+       will insert before deleting, and thus will keep
+       the markers before and after this text separate.
+       Do it now, while the text to delete is still there.  */
+    if (!EQ(BVAR(current_buffer, undo_list), Qt)) {
+        record_insert(from + nchars_del, inschars);
+        record_delete_region(from, from_byte, to, to_byte, false);
+    }
 
     GAP_SIZE += nbytes_del;
     ZV -= nchars_del;
@@ -1497,15 +1502,6 @@ void replace_range(ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
         emacs_abort();
 #endif
 
-    /* Record the insertion first, so that when we undo,
-       the deletion will be undone first.  Thus, undo
-       will insert before deleting, and thus will keep
-       the markers before and after this text separate.  */
-    if (!NILP(deletion)) {
-        record_insert(from + SCHARS(deletion), inschars);
-        record_delete(from, deletion, false);
-    }
-
     GAP_SIZE -= outgoing_insbytes;
     GPT += inschars;
     ZV += inschars;
@@ -1859,14 +1855,17 @@ Lisp_Object del_range_2(ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t to,
         emacs_abort();
 #endif
 
-    if (ret_string || !EQ(BVAR(current_buffer, undo_list), Qt))
+    if (ret_string)
         deletion = make_buffer_string_both(from, from_byte, to, to_byte, 1);
     else
         deletion = Qnil;
 
     /* Record marker adjustments, and text deletion into undo
        history.  */
-    record_delete(from, deletion, true);
+    if (STRINGP(deletion))
+        record_delete(from, deletion, true);
+    else
+        record_delete_region(from, from_byte, to, to_byte, true);
 
     /* Relocate all markers pointing into the new, larger gap to point
        at the end of the text before the gap.  */
@@ -2070,6 +2069,8 @@ void invalidate_buffer_caches(struct buffer* buf, ptrdiff_t start,
     if (buf->width_run_cache)
         invalidate_region_cache(buf, buf->width_run_cache, start - BUF_BEG(buf),
                                 BUF_Z(buf) - end);
+    invalidate_column_index(buf, start);
+    invalidate_syntax_checkpoints(buf, start);
 }
 
 /* These macros work with an argument named `preserve_ptr'
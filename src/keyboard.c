@@ -4513,11 +4513,15 @@ static struct timespec decode_timer(Lisp_Object timer)
 
    If a timer is ripe, we run it, with quitting turned off.
    In that case we return 0 to indicate that a new timer_check_2 call
-   should be done.  */
+   should be done.  *TIMERS and *IDLE_TIMERS are advanced past the
+   timers that were looked at, so the next call resumes where this
+   one left off instead of rescanning the timers that already ran.  */
 
-static struct timespec timer_check_2(Lisp_Object timers,
-                                     Lisp_Object idle_timers)
+static struct timespec timer_check_2(Lisp_Object* ptimers,
+                                     Lisp_Object* pidle_timers)
 {
+  Lisp_Object timers = *ptimers, idle_timers = *pidle_timers;
+
   /* First run the code that was delayed.  */
   while (CONSP(pending_funcalls))
   {
@@ -4636,6 +4640,8 @@ static struct timespec timer_check_2(Lisp_Object timers,
      return 0 to indicate that.  */
       }
 
+      *ptimers = timers;
+      *pidle_timers = idle_timers;
       return make_timespec(0, 0);
     }
     else
@@ -4652,6 +4658,51 @@ static struct timespec timer_check_2(Lisp_Object timers,
 }
 
 
+/* Return a copy of the leading part of the timer list TIMERS that
+   holds the timers which are ripe at time NOW, followed by the first
+   timer that is not ripe yet, if any.  Since TIMERS is sorted by time,
+   no later timer can be ripe, so the rest of the list is not copied.
+   Elements that are not proper timers, or that were already
+   triggered, are left out.  Set *TRUNCATED if some timers were not
+   copied.  */
+static Lisp_Object copy_ripe_timers(Lisp_Object timers, struct timespec now,
+                                    bool* truncated)
+{
+  Lisp_Object ripe = Qnil;
+
+  FOR_EACH_TAIL_SAFE(timers)
+  {
+    Lisp_Object timer = XCAR(timers);
+    struct timespec timer_time = decode_timer(timer);
+    if (!timespec_valid_p(timer_time))
+      continue;
+    ripe = Fcons(timer, ripe);
+    if (timespec_cmp(now, timer_time) < 0)
+    {
+      *truncated |= CONSP(XCDR(timers));
+      break;
+    }
+  }
+
+  return Fnreverse(ripe);
+}
+
+/* Return the time from NOW until the first proper timer in TIMERS is
+   ripe, zero if it is ripe already, or an invalid value if there is
+   no such timer.  */
+static struct timespec timer_list_delay(Lisp_Object timers,
+                                        struct timespec now)
+{
+  FOR_EACH_TAIL_SAFE(timers)
+  {
+    struct timespec timer_time = decode_timer(XCAR(timers));
+    if (timespec_valid_p(timer_time))
+      return (timespec_cmp(now, timer_time) < 0 ? timespec_sub(timer_time, now)
+                                                : make_timespec(0, 0));
+  }
+  return invalid_timespec();
+}
+
 /* Check whether a timer has fired.  To prevent larger problems we simply
    disregard elements that are not proper timers.  Do not make a circular
    timer list for the time being.
@@ -4673,13 +4724,19 @@ struct timespec timer_check(void)
 
   /* We use copies of the timers' lists to allow a timer to add itself
      again, without locking up Emacs if the newly added timer is
-     already ripe when added.  */
+     already ripe when added.  Only the ripe timers need copying, so
+     the cost does not grow with the number of pending timers.  */
+
+  struct timespec now = current_timespec();
+  bool truncated = false;
 
   /* Always consider the ordinary timers.  */
-  timers = Fcopy_sequence(Vtimer_list);
+  timers = copy_ripe_timers(Vtimer_list, now, &truncated);
   /* Consider the idle timers only if Emacs is idle.  */
   if (timespec_valid_p(timer_idleness_start_time))
-    idle_timers = Fcopy_sequence(Vtimer_idle_list);
+    idle_timers = copy_ripe_timers(
+        Vtimer_idle_list, timespec_sub(now, timer_idleness_start_time),
+        &truncated);
   else
     idle_timers = Qnil;
 
@@ -4689,10 +4746,28 @@ struct timespec timer_check(void)
 
   do
   {
-    nexttime = timer_check_2(timers, idle_timers);
+    nexttime = timer_check_2(&timers, &idle_timers);
   }
   while (nexttime.tv_sec == 0 && nexttime.tv_nsec == 0);
 
+  /* If even the first timer that was not ripe when we started has run
+     since, the copies are used up but the uncopied timers may still
+     be pending.  Tell the caller how long to wait for them.  */
+  if (!timespec_valid_p(nexttime) && truncated)
+  {
+    now = current_timespec();
+    nexttime = timer_list_delay(Vtimer_list, now);
+    if (timespec_valid_p(timer_idleness_start_time))
+    {
+      struct timespec idle_delay = timer_list_delay(
+          Vtimer_idle_list, timespec_sub(now, timer_idleness_start_time));
+      if (timespec_valid_p(idle_delay) &&
+          (!timespec_valid_p(nexttime) ||
+           timespec_cmp(idle_delay, nexttime) < 0))
+        nexttime = idle_delay;
+    }
+  }
+
   return nexttime;
 }
 
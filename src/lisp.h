@@ -638,6 +638,7 @@ extern Lisp_Object make_biguint(uintmax_t);
 extern uintmax_t check_uinteger_max(Lisp_Object, uintmax_t);
 
 /* Defined in chartab.c.  */
+extern void char_table_changed(Lisp_Object);
 extern Lisp_Object char_table_ref(Lisp_Object, int);
 extern void char_table_set(Lisp_Object, int, Lisp_Object);
 
@@ -815,8 +816,12 @@ struct Lisp_Symbol {
             /* The symbol's property list.  */
             Lisp_Object plist;
 
-            /* Next symbol in obarray bucket, if the symbol is interned.  */
-            struct Lisp_Symbol* next;
+            union {
+                /* Hash code of the name, if the symbol is interned.  */
+                EMACS_UINT hash;
+                /* Next symbol in the free list, if the symbol is free.  */
+                struct Lisp_Symbol* next;
+            };
         } s;
         GCALIGNED_UNION_MEMBER
     } u;
@@ -997,6 +1002,7 @@ enum pvec_type
     PVEC_THREAD,
     PVEC_MUTEX,
     PVEC_CONDVAR,
+    PVEC_CHANNEL,
     PVEC_MODULE_FUNCTION,
     PVEC_NATIVE_COMP_UNIT,
     PVEC_TS_PARSER,
@@ -1306,6 +1312,7 @@ INLINE Lisp_Object dead_object(void) {
 #define XSETTHREAD(a, b) XSETPSEUDOVECTOR(a, b, PVEC_THREAD)
 #define XSETMUTEX(a, b) XSETPSEUDOVECTOR(a, b, PVEC_MUTEX)
 #define XSETCONDVAR(a, b) XSETPSEUDOVECTOR(a, b, PVEC_CONDVAR)
+#define XSETCHANNEL(a, b) XSETPSEUDOVECTOR(a, b, PVEC_CHANNEL)
 #define XSETNATIVE_COMP_UNIT(a, b) XSETPSEUDOVECTOR(a, b, PVEC_NATIVE_COMP_UNIT)
 
 /* Efficiently convert a pointer to a Lisp object and back.  The
@@ -1421,6 +1428,10 @@ struct Lisp_String {
            size_byte, for C interoperability, but may also contain NULs
            itself.  */
             unsigned char* data;
+            /* The hash of the data that sxhash computed, or 0 if none was
+               computed since the data last changed.  Code that changes
+               the data of an existing string must use STRING_CLEAR_HASH.  */
+            EMACS_UINT hash;
         } s;
         struct Lisp_String* next;
         GCALIGNED_UNION_MEMBER
@@ -1495,8 +1506,12 @@ INLINE char* SSDATA(Lisp_Object string) {
 INLINE unsigned char SREF(Lisp_Object string, ptrdiff_t index) {
     return SDATA(string)[index];
 }
+INLINE void STRING_CLEAR_HASH(Lisp_Object string) {
+    XSTRING(string)->u.s.hash = 0;
+}
 INLINE void SSET(Lisp_Object string, ptrdiff_t index, unsigned char new) {
     SDATA(string)[index] = new;
+    STRING_CLEAR_HASH(string);
 }
 INLINE ptrdiff_t SCHARS(Lisp_Object string) {
     ptrdiff_t nchars = XSTRING(string)->u.s.size;
@@ -2104,12 +2119,27 @@ struct Lisp_Obarray {
     union vectorlike_header header;
 
     /* Array of 2**size_bits values, each being either a (bare) symbol or
-       the fixnum 0.  The symbols for each bucket are chained via
-       their s.next field.  */
+       the fixnum 0, followed by as many tag bytes (see obarray_tags).
+       A symbol is in the first bucket not taken by another symbol,
+       starting at the one its hash code selects and going up, wrapping
+       around at the end.  */
     Lisp_Object* buckets;
 
     unsigned size_bits; /* log2(size of buckets vector) */
     unsigned count; /* number of symbols in obarray */
+    unsigned deleted; /* number of buckets whose symbol was removed */
+};
+
+/* Tags of obarray buckets.  The tag of a bucket with a symbol has the
+   OBARRAY_TAG_SYMBOL bit set and the low bits of the symbol's hash
+   code, so that most buckets with other symbols can be skipped without
+   looking at them.  A bucket whose symbol was removed must not end a
+   search for a symbol after it.  */
+enum
+{
+    OBARRAY_TAG_EMPTY = 0,
+    OBARRAY_TAG_DELETED = 1,
+    OBARRAY_TAG_SYMBOL = 0x80
 };
 
 INLINE bool OBARRAYP(Lisp_Object a) { return PSEUDOVECTORP(a, PVEC_OBARRAY); }
@@ -2132,6 +2162,16 @@ INLINE ptrdiff_t obarray_size(const struct Lisp_Obarray* o) {
     return (ptrdiff_t)1 << o->size_bits;
 }
 
+/* The tags of the buckets of obarray O.  */
+INLINE unsigned char* obarray_tags(const struct Lisp_Obarray* o) {
+    return (unsigned char*)(o->buckets + obarray_size(o));
+}
+
+/* Number of bytes allocated for the buckets of obarray O.  */
+INLINE ptrdiff_t obarray_bytes(const struct Lisp_Obarray* o) {
+    return obarray_size(o) * (sizeof *o->buckets + 1);
+}
+
 Lisp_Object check_obarray_slow(Lisp_Object);
 
 /* Return an obarray object from OBARRAY or signal an error.  */
@@ -2144,8 +2184,8 @@ INLINE Lisp_Object check_obarray(Lisp_Object obarray) {
 typedef struct {
     struct Lisp_Obarray* o;
     ptrdiff_t idx; /* Current bucket index.  */
-    struct Lisp_Symbol* symbol; /* Current symbol, or NULL if at end
-                   of current bucket.  */
+    struct Lisp_Symbol* symbol; /* Current symbol, or NULL if not yet
+                   found or already visited.  */
 } obarray_iter_t;
 
 INLINE obarray_iter_t make_obarray_iter(struct Lisp_Obarray* oa) {
@@ -2169,9 +2209,7 @@ INLINE bool obarray_iter_at_end(obarray_iter_t* it) {
 }
 
 /* Advance IT to the next symbol if any.  */
-INLINE void obarray_iter_step(obarray_iter_t* it) {
-    it->symbol = it->symbol->u.s.next;
-}
+INLINE void obarray_iter_step(obarray_iter_t* it) { it->symbol = NULL; }
 
 /* The Lisp symbol at IT, if obarray_iter_at_end returned false.  */
 INLINE Lisp_Object obarray_iter_symbol(obarray_iter_t* it) {
@@ -2240,67 +2278,77 @@ typedef enum hash_table_weakness_t
    (hash) indices.  It's signed and a subtype of ptrdiff_t.  */
 typedef int32_t hash_idx_t;
 
+/* An entry of a hash table.  */
+struct hash_table_entry {
+    Lisp_Object key, value;
+
+    /* Hash code of KEY.  Undefined if the entry is unused.  */
+    hash_hash_t hash;
+
+    /* If the entry is free, the number of the next free entry, or -1 if
+       there is no such entry.  Undefined if the entry is in use.  */
+    hash_idx_t next;
+};
+
 struct Lisp_Hash_Table {
     union vectorlike_header header;
 
     /* Hash table internal structure:
 
-       Lisp key         index                  table
-           |            vector
-           | hash fn                  hash    key   value  next
-           v             +--+       +------+-------+------+----+
-       hash value        |-1|       | C351 |  cow  | moo  | -1 |<-
-           |             +--+       +------+-------+------+----+  |
-            ------------>| -------->| 07A8 |  cat  | meow | -1 |  |
-              range      +--+       +------+-------+------+----+  |
-            reduction    |-1|     ->| 91D2 |  dog  | woof |   ----
-                         +--+    |  +------+-------+------+----+
-                         | ------   |  ?   |unbound|  ?   | -1 |<-
-                         +--+       +------+-------+------+----+  |
-                         | -------->| F6B0 | duck  |quack | -1 |  |
-                         +--+       +------+-------+------+----+  |
-                         |-1|     ->|  ?   |unbound|  ?   |   ----
-                         +--+    |  +------+-------+------+----+
-                         :  :    |  :      :       :     :    :
-                                 |
-                             next_free
-
-       The table is physically split into three vectors (hash, next,
-       key_and_value) which may or may not be beneficial.  */
-
-    /* Bucket vector.  An entry of -1 indicates no item is present,
-       and a nonnegative entry is the index of the first item in
-       a collision chain.
-       This vector is 2**index_bits entries long.
-       If index_bits is 0 (and table_size is 0), then this is the
-       constant read-only vector {-1}, shared between all instances.
+       Lisp key          index             entries
+           |             slots  tags
+           | hash fn                key   value   hash   next
+           v             +--+--+  +-------+------+------+----+
+       hash value        |  |00|  |  cow  | moo  | C351 |  ? |
+           |             +--+--+  +-------+------+------+----+
+           |       ----->| --C7-->|  cat  | meow | 07A8 |  ? |
+           |      |      +--+--+  +-------+------+------+----+
+            ------       | --9A-->|  dog  | woof | 91D2 |  ? |
+           group of      +--+--+  +-------+------+------+----+
+           slots         |  |01|  |unbound|  ?   |  ?   | -1 |<-
+                         +--+--+  +-------+------+------+----+  |
+                         :  :  :  |unbound|  ?   |  ?   |   ----
+                                  +-------+------+------+----+
+                                  :       :      :      :    :
+                                                          |
+                                                      next_free
+
+       The index is open-addressed: an entry is in the first slot not
+       taken by another entry, searching groups of HASH_GROUP_WIDTH
+       slots from the one its hash code selects.  Each slot has a tag
+       byte (see hash_table_tags), and a search compares the tags of a
+       whole group with the tag of the key before it looks at any entry.
+
+       The entries themselves stay in insertion order in the table, so
+       iterating over them does not depend on the index.  Each entry
+       keeps its key, value, hash code and free-list link together, so
+       that a lookup reads one entry to check the hash code and compare
+       the key.  */
+
+    /* Index slots.  A slot whose tag has the HASH_TAG_FULL bit set holds
+       the number of an entry; other slots are unused.
+       This vector is 2**index_bits entries long and followed by the
+       slot tags.
+       If index_bits is 0 (and table_size is 0), then this is a constant
+       read-only vector with no entries, shared between all instances.
        Otherwise it is heap-allocated.  */
     hash_idx_t* index;
 
-    /* Vector of hash codes.  Unused entries have undefined values.
-       This vector is table_size entries long.  */
-    hash_hash_t* hash;
-
-    /* Vector of keys and values.  The key of item I is found at index
-       2 * I, the value is found at index 2 * I + 1.
-       If the key is HASH_UNUSED_ENTRY_KEY, then this slot is unused.
+    /* Vector of entries.  If the key of an entry is
+       HASH_UNUSED_ENTRY_KEY, then the entry is unused.
        This is gc_marked specially if the table is weak.
-       This vector is 2 * table_size entries long.  */
-    Lisp_Object* key_and_value;
+       This vector is table_size entries long.  */
+    struct hash_table_entry* entries;
 
     /* The comparison and hash functions.  */
     const struct hash_table_test* test;
 
-    /* Vector used to chain entries.  If entry I is free, next[I] is the
-       entry number of the next free item.  If entry I is non-free,
-       next[I] is the index of the next entry in the collision chain,
-       or -1 if there is no such entry.
-       This vector is table_size entries long.  */
-    hash_idx_t* next;
-
     /* Number of key/value entries in the table.  */
     hash_idx_t count;
 
+    /* Number of index slots whose entry was removed.  */
+    hash_idx_t index_deleted;
+
     /* Index of first free entry in free list, or -1 if none.  */
     hash_idx_t next_free;
 
@@ -2355,19 +2403,19 @@ INLINE Lisp_Object make_lisp_hash_table(struct Lisp_Hash_Table* h) {
 /* Value is the key part of entry IDX in hash table H.  */
 INLINE Lisp_Object HASH_KEY(const struct Lisp_Hash_Table* h, ptrdiff_t idx) {
     eassert(idx >= 0 && idx < h->table_size);
-    return h->key_and_value[2 * idx];
+    return h->entries[idx].key;
 }
 
 /* Value is the value part of entry IDX in hash table H.  */
 INLINE Lisp_Object HASH_VALUE(const struct Lisp_Hash_Table* h, ptrdiff_t idx) {
     eassert(idx >= 0 && idx < h->table_size);
-    return h->key_and_value[2 * idx + 1];
+    return h->entries[idx].value;
 }
 
 /* Value is the hash code computed for entry IDX in hash table H.  */
 INLINE hash_hash_t HASH_HASH(const struct Lisp_Hash_Table* h, ptrdiff_t idx) {
     eassert(idx >= 0 && idx < h->table_size);
-    return h->hash[idx];
+    return h->entries[idx].hash;
 }
 
 /* Value is the size of hash table H.  */
@@ -2380,26 +2428,60 @@ INLINE ptrdiff_t hash_table_index_size(const struct Lisp_Hash_Table* h) {
     return (ptrdiff_t)1 << h->index_bits;
 }
 
+/* Tags of hash table index slots.  The tag of a slot with an entry has
+   the HASH_TAG_FULL bit set and seven bits of the entry's hash code, so
+   that most slots with other entries can be skipped without looking at
+   them.  A slot whose entry was removed must not end a search for an
+   entry after it.  */
+enum
+{
+    HASH_TAG_EMPTY = 0,
+    HASH_TAG_DELETED = 1,
+    HASH_TAG_FULL = 0x80,
+    /* Number of slots whose tags are compared at once.  */
+    HASH_GROUP_WIDTH = 16
+};
+
+/* The tags of the index slots of hash table H.  There are at least
+   HASH_GROUP_WIDTH of them; those past the index size stay empty.  */
+INLINE unsigned char* hash_table_tags(const struct Lisp_Hash_Table* h) {
+    return (unsigned char*)(h->index + hash_table_index_size(h));
+}
+
+/* Number of bytes allocated for an index of 2**BITS slots and their
+   tags.  */
+INLINE ptrdiff_t hash_index_bytes(int bits) {
+    ptrdiff_t size = (ptrdiff_t)1 << bits;
+    return size * sizeof(hash_idx_t) + max(size, HASH_GROUP_WIDTH);
+}
+
 /* Hash value for KEY in hash table H.  */
 INLINE hash_hash_t hash_from_key(struct Lisp_Hash_Table* h, Lisp_Object key) {
     return h->test->hashfn(key, h);
 }
 
+/* The entry whose key is at KV, for DOHASH, which walks the entries
+   with a Lisp_Object pointer so that K and V can be declared alongside
+   it.  The key is the first member of an entry.  */
+#define DOHASH_ENTRY(kv) ((struct hash_table_entry*)(kv))
+
 /* Iterate K and V as key and value of valid entries in hash table H.
    The body may remove the current entry or alter its value slot, but not
    mutate TABLE in any other way.  */
 #define DOHASH(h, k, v)                                                        \
-    for (Lisp_Object* dohash_##k##_##v##_kv = (h)->key_and_value,              \
+    for (Lisp_Object* dohash_##k##_##v##_kv = (Lisp_Object*)(h)->entries,      \
                       *dohash_##k##_##v##_end =                                \
-                          dohash_##k##_##v##_kv + 2 * HASH_TABLE_SIZE(h),      \
+                          (Lisp_Object*)((h)->entries + HASH_TABLE_SIZE(h)),   \
                       *dohash_##k##_##v##_base = dohash_##k##_##v##_kv, k, v;  \
          dohash_##k##_##v##_kv < dohash_##k##_##v##_end &&                     \
-         (k = dohash_##k##_##v##_kv[0], v = dohash_##k##_##v##_kv[1],          \
+         (k = DOHASH_ENTRY(dohash_##k##_##v##_kv)->key,                        \
+         v = DOHASH_ENTRY(dohash_##k##_##v##_kv)->value,                       \
          /*maybe unused*/ (void)v, true);                                      \
-         eassert(dohash_##k##_##v##_base == (h)->key_and_value &&              \
+         eassert(dohash_##k##_##v##_base == (Lisp_Object*)(h)->entries &&      \
                  dohash_##k##_##v##_end ==                                     \
-                     dohash_##k##_##v##_base + 2 * HASH_TABLE_SIZE(h)),        \
-                      dohash_##k##_##v##_kv += 2)                              \
+                     (Lisp_Object*)((h)->entries + HASH_TABLE_SIZE(h))),       \
+         dohash_##k##_##v##_kv =                                               \
+             (Lisp_Object*)(DOHASH_ENTRY(dohash_##k##_##v##_kv) + 1))          \
         if (hash_unused_entry_key_p(k))                                        \
             ;                                                                  \
         else
@@ -2417,6 +2499,7 @@ INLINE hash_hash_t hash_from_key(struct Lisp_Hash_Table* h, Lisp_Object key) {
         else
 
 void hash_table_thaw(Lisp_Object hash_table);
+void hash_table_rehash_thawed(Lisp_Object hash_table);
 
 /* Default size for hash tables if not specified.  */
 
@@ -2781,6 +2864,13 @@ enum Lisp_Closure
     CLOSURE_INTERACTIVE = 5
 };
 
+/* True if the code and constants of the closure FUN have not been read
+   in yet.  Its code slot then holds an offset in the file named in its
+   constants slot; see fetch_closure_body.  */
+INLINE bool closure_body_pending_p(Lisp_Object fun) {
+    return FIXNUMP(AREF(fun, CLOSURE_CODE));
+}
+
 /* Flag bits in a character.  These also get used in termhooks.h.
    Emacs needs 22 bits for the character value itself, see MAX_CHAR,
    so we shouldn't use any bits lower than 0x0400000.  */
@@ -3442,14 +3532,13 @@ INLINE void vcopy(Lisp_Object v, ptrdiff_t offset, Lisp_Object const* args,
 INLINE void set_hash_key_slot(struct Lisp_Hash_Table* h, ptrdiff_t idx,
                               Lisp_Object val) {
     eassert(idx >= 0 && idx < h->table_size);
-    h->key_and_value[2 * idx] = val;
+    h->entries[idx].key = val;
 }
 
 INLINE void set_hash_value_slot(struct Lisp_Hash_Table* h, ptrdiff_t idx,
                                 Lisp_Object val) {
     eassert(idx >= 0 && idx < h->table_size);
-    h->key_and_value[2 * idx + 1] = val;
-    ;
+    h->entries[idx].value = val;
 }
 
 /* Use these functions to set Lisp_Object
@@ -3463,10 +3552,6 @@ INLINE void set_symbol_plist(Lisp_Object sym, Lisp_Object plist) {
     XSYMBOL(sym)->u.s.plist = plist;
 }
 
-INLINE void set_symbol_next(Lisp_Object sym, struct Lisp_Symbol* next) {
-    XSYMBOL(sym)->u.s.next = next;
-}
-
 INLINE void make_symbol_constant(Lisp_Object sym) {
     XSYMBOL(sym)->u.s.trapped_write = SYMBOL_NOWRITE;
 }
@@ -3670,6 +3755,10 @@ struct charset;
 /* Defined in syntax.c.  */
 extern void init_syntax_once(void);
 extern void syms_of_syntax(void);
+extern void invalidate_syntax_checkpoints(struct buffer*, ptrdiff_t);
+extern void free_syntax_checkpoints(struct buffer*);
+extern void mark_syntax_checkpoints(struct buffer*);
+extern void syntax_table_changed(Lisp_Object);
 
 /* Defined in fns.c.  */
 enum
@@ -3683,6 +3772,7 @@ extern bool sweep_weak_table(struct Lisp_Hash_Table*, bool);
 extern void hexbuf_digest(char*, void const*, int);
 extern char* extract_data_from_object(Lisp_Object, ptrdiff_t*, ptrdiff_t*);
 EMACS_UINT hash_char_array(char const*, ptrdiff_t);
+EMACS_UINT sxhash_string(Lisp_Object);
 EMACS_UINT sxhash(Lisp_Object);
 Lisp_Object make_hash_table(const struct hash_table_test*, EMACS_INT,
                             hash_table_weakness_t);
@@ -3835,9 +3925,11 @@ extern void reset_message_log_need_newline(void);
 extern void update_echo_area(void);
 extern void truncate_echo_area(ptrdiff_t);
 extern void redisplay(void);
+extern void invalidate_layout_caches(void);
 extern ptrdiff_t count_lines(ptrdiff_t start_byte, ptrdiff_t end_byte);
 extern ptrdiff_t display_count_lines(ptrdiff_t start_byte, ptrdiff_t limit_byte,
                                      ptrdiff_t count, ptrdiff_t* byte_pos_ptr);
+extern void free_stop_index(struct buffer*);
 
 void set_frame_cursor_types(struct frame*, Lisp_Object);
 extern void syms_of_xdisp(void);
@@ -4129,6 +4221,8 @@ extern Lisp_Object intern_c_multibyte(const char* str, ptrdiff_t nchars,
                                       ptrdiff_t nbytes);
 extern void init_symbol(Lisp_Object, Lisp_Object);
 extern Lisp_Object oblookup(Lisp_Object, const char*, ptrdiff_t, ptrdiff_t);
+extern void fetch_closure_body(Lisp_Object);
+extern void fetch_all_closure_bodies(void);
 INLINE void LOADHIST_ATTACH(Lisp_Object x) {
     if (initialized)
         Vcurrent_load_list = Fcons(x, Vcurrent_load_list);
@@ -4502,6 +4596,8 @@ extern void keys_of_keyboard(void);
 extern ptrdiff_t current_column(void);
 extern void line_number_display_width(struct window*, int*, int*);
 extern void invalidate_current_column(void);
+extern void invalidate_column_indexes(void);
+extern void mark_column_index(struct buffer*);
 extern bool indented_beyond_p(ptrdiff_t, ptrdiff_t, EMACS_INT);
 extern void syms_of_indent(void);
 
@@ -4634,9 +4730,16 @@ extern void init_macros(void);
 extern void syms_of_macros(void);
 
 /* Defined in undo.c.  */
+extern void free_undo_log(struct buffer*);
+extern void flush_undo_log(struct buffer*);
+extern void flush_undo_logs(void);
+extern void mark_undo_log(struct buffer*);
+extern void compact_undo_log(struct buffer*);
 extern void truncate_undo_list(struct buffer*);
 extern void record_insert(ptrdiff_t, ptrdiff_t);
 extern void record_delete(ptrdiff_t, Lisp_Object, bool);
+extern void record_delete_region(ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
+                                 bool);
 extern void record_first_change(void);
 extern void record_change(ptrdiff_t, ptrdiff_t);
 extern void record_property_change(ptrdiff_t, ptrdiff_t, Lisp_Object,
@@ -31,6 +31,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include <stat-time.h>
 #include <stdlib.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include "blockinput.h"
@@ -226,19 +227,39 @@ struct saved_string {
 /* The last two strings skipped with #@ (most recent first).  */
 static struct saved_string saved_strings[2];
 
+/* Free the saved_strings.  */
+static void free_saved_strings(void) {
+    for (int i = 0; i < ARRAYELTS(saved_strings); i++) {
+        xfree(saved_strings[i].string);
+        saved_strings[i].string = NULL;
+        saved_strings[i].size = 0;
+    }
+}
+
 /* A list of file names for files being loaded in Fload.  Used to
    check for recursive loads.  */
 
 static Lisp_Object Vloads_in_progress;
 
+/* The obarray Emacs starts with, the initial value of `obarray'.  */
+
+static Lisp_Object initial_obarray;
+
 static void readevalloop(Lisp_Object, struct infile*, Lisp_Object, bool,
                          Lisp_Object, Lisp_Object, Lisp_Object);
 
 static void build_load_history(Lisp_Object, bool);
 
+static bool load_elb_file(Lisp_Object, Lisp_Object);
+
+static Lisp_Object oblookup_hashed(Lisp_Object, const char*, ptrdiff_t,
+                                   ptrdiff_t, EMACS_UINT);
 static Lisp_Object oblookup_considering_shorthand(Lisp_Object, const char*,
                                                   ptrdiff_t, ptrdiff_t, char**,
-                                                  ptrdiff_t*, ptrdiff_t*);
+                                                  ptrdiff_t*, ptrdiff_t*,
+                                                  EMACS_UINT*);
+static Lisp_Object intern_hashed(Lisp_Object, Lisp_Object, Lisp_Object,
+                                 EMACS_UINT);
 
 
 /* When READCHARFUN is Qget_file_char or Qget_emacs_mule_file_char,
@@ -1385,9 +1406,11 @@ Return t if the file exists and loads successfully.  */)
         Fset(Qlexical_binding,
              get_lexical_binding(Qget_file_char, compiled ? Qnil : file));
 
-        if (!version || version >= 22)
-            readevalloop(Qget_file_char, &input, hist_file_name, 0, Qnil, Qnil,
-                         Qnil);
+        if (!version || version >= 22) {
+            if (!(compiled && load_elb_file(efound, hist_file_name)))
+                readevalloop(Qget_file_char, &input, hist_file_name, 0, Qnil,
+                             Qnil, Qnil);
+        }
         else {
             /* We can't handle a file which was compiled with
                byte-compile-dynamic by older version of Emacs.  */
@@ -1402,11 +1425,7 @@ Return t if the file exists and loads successfully.  */)
     if (!NILP(Ffboundp(Qdo_after_load_evaluation)))
         calln(Qdo_after_load_evaluation, hist_file_name);
 
-    for (int i = 0; i < ARRAYELTS(saved_strings); i++) {
-        xfree(saved_strings[i].string);
-        saved_strings[i].string = NULL;
-        saved_strings[i].size = 0;
-    }
+    free_saved_strings();
 
     /* The "...done" messages are shown only in interactive mode, because
        the echo-area can display only the last message, and we want to
@@ -1957,6 +1976,27 @@ static Lisp_Object readevalloop_eager_expand_eval(Lisp_Object val,
     return val;
 }
 
+/* Skip comments and whitespace in SOURCE, so we can detect eof.
+   Return the first character of the next form, left unread, or -1 at
+   the end of the input.  */
+static int skip_to_next_form(source_t* source) {
+    int c;
+read_next:
+    c = readchar(source);
+    if (c == ';') {
+        while ((c = readchar(source)) != '\n' && c != -1)
+            ;
+        goto read_next;
+    }
+    if (c < 0)
+        return c;
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r' ||
+        c == NO_BREAK_SPACE)
+        goto read_next;
+    unreadchar(source, c);
+    return c;
+}
+
 /* READFUN, if non-nil, is used instead of `read'.
 
    START, END specify region to read in current buffer (from eval-region).
@@ -2068,24 +2108,12 @@ static void readevalloop(Lisp_Object readcharfun, struct infile* infile0,
             whole_buffer = (BUF_PT(b) == BUF_BEG(b) && BUF_ZV(b) == BUF_Z(b));
 
         eassert(!infile0 || infile == infile0);
-    read_next:
-        c = readchar(&source);
-        if (c == ';') {
-            while ((c = readchar(&source)) != '\n' && c != -1)
-                ;
-            goto read_next;
-        }
+        c = skip_to_next_form(&source);
         if (c < 0) {
             unbind_to(count1, Qnil);
             break;
         }
 
-        /* Ignore whitespace here, so we can detect eof.  */
-        if (c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r' ||
-            c == NO_BREAK_SPACE)
-            goto read_next;
-        unreadchar(&source, c);
-
         if (!HASH_TABLE_P(read_objects_map) ||
             XHASH_TABLE(read_objects_map)->count)
             read_objects_map =
@@ -2150,6 +2178,1237 @@ static void readevalloop(Lisp_Object readcharfun, struct infile* infile0,
     unbind_to(count, Qnil);
 }
 
+/* Binary compiled files.
+
+   Next to FOO.elc, `write-elb-file' can leave FOO.elb: the top-level
+   forms of FOO.elc serialized so that `load' can rebuild them without
+   the reader.  The file starts with a struct elb_header, followed by
+   the names of the interned symbols the forms refer to, followed by
+   the forms, followed by the bodies of the byte-code functions in
+   them.  Each object starts with an elb_op byte; counts and integers
+   are LEB128-coded.  The header records the size and modification
+   time of FOO.elc, and `load' ignores an .elb file that no longer
+   matches it.
+
+   The bytecode and constants of a large function are stored among the
+   bodies, and `load' makes a closure whose code slot is the offset of
+   the body and whose constants slot says which file it is in;
+   fetch_closure_body reads the body in when the function is first
+   called.  Most functions loaded at startup are never called.  The
+   file stays mapped for the rest of the session, so that recompiling
+   or removing it doesn't lose the bodies not read yet.
+
+   Objects that occur more than once in a form are written once,
+   preceded by ELB_DEF, and later occurrences refer to them with
+   ELB_REF, much as #N= and #N# do in the printed representation.  */
+
+enum
+{
+    ELB_VERSION = 2,
+    /* Deepest nesting of cars, vectors and the like we write.  */
+    ELB_MAX_DEPTH = 2000,
+    /* Smallest bytecode worth loading lazily.  */
+    ELB_LAZY_MIN_CODE = 64
+};
+
+static char const elb_magic[4] = {'\0', 'E', 'L', 'B'};
+
+struct elb_header {
+    char magic[4];
+    uint32_t version;
+    int64_t elc_size;
+    int64_t elc_mtime_sec;
+    int64_t elc_mtime_nsec;
+    uint64_t nsymbols;
+    /* Offset of the function bodies.  */
+    uint64_t bodies;
+};
+
+enum elb_op
+{
+    ELB_INT, /* Zigzag-coded value.  */
+    ELB_BIGNUM, /* Decimal digits, NUL-terminated.  */
+    ELB_FLOAT, /* A double, in host byte order.  */
+    ELB_SYMBOL, /* Index into the symbol table.  */
+    ELB_UNINTERNED, /* Name.  */
+    ELB_STRING, /* Characters, bytes, multibyte flag, contents.  */
+    ELB_LIST, /* N, N cars, then the last cdr.  */
+    ELB_VECTOR, /* N, then N elements.  */
+    ELB_RECORD,
+    ELB_CLOSURE,
+    ELB_BOOL_VECTOR, /* Length in bits, then the bytes.  */
+    ELB_HASH_TABLE, /* Test, weakness, N, then N keys and values.  */
+    ELB_LOAD_FILE_NAME, /* What #$ reads as.  */
+    ELB_DEF, /* The next object gets the next label.  */
+    ELB_REF, /* Label of an object seen earlier in the form.  */
+    ELB_LAZY_CLOSURE, /* N, offset of the body, N - 2 other slots.  */
+    ELB_NAMED_SYMBOL /* Name of an interned symbol, in a body.  */
+};
+
+struct elb_buffer {
+    unsigned char* data;
+    ptrdiff_t len, size;
+};
+
+struct elb_writer {
+    struct elb_buffer body, table, bodies;
+
+    /* Where objects go: the body, or the bodies while writing one.  */
+    struct elb_buffer* out;
+
+    /* What `load-file-name' was bound to while reading.  */
+    Lisp_Object marker;
+
+    /* Interned symbols written so far, mapped to their index in the
+       symbol table.  */
+    Lisp_Object symbols;
+
+    /* Objects of the current form that could be shared, mapped to nil
+       if seen once, t if seen more than once, and their label once
+       that has been written.  */
+    Lisp_Object shared;
+    ptrdiff_t nlabels;
+};
+
+static void elb_put(struct elb_buffer* b, void const* p, ptrdiff_t n) {
+    if (b->size - b->len < n)
+        b->data = xpalloc(b->data, &b->size, n - (b->size - b->len), -1, 1);
+    memcpy(b->data + b->len, p, n);
+    b->len += n;
+}
+
+static void elb_put_byte(struct elb_buffer* b, int c) {
+    unsigned char byte = c;
+    elb_put(b, &byte, 1);
+}
+
+static void elb_put_uint(struct elb_buffer* b, uintmax_t n) {
+    unsigned char buf[(UINTMAX_WIDTH + 6) / 7];
+    int len = 0;
+    do {
+        buf[len] = n & 0x7f;
+        n >>= 7;
+        if (n)
+            buf[len] |= 0x80;
+        len++;
+    } while (n);
+    elb_put(b, buf, len);
+}
+
+static void elb_put_string(struct elb_buffer* b, Lisp_Object string) {
+    elb_put_uint(b, SCHARS(string));
+    elb_put_uint(b, SBYTES(string));
+    elb_put_byte(b, STRING_MULTIBYTE(string));
+    elb_put(b, SDATA(string), SBYTES(string));
+}
+
+static bool elb_shareable_p(struct elb_writer* w, Lisp_Object obj) {
+    return (CONSP(obj) || STRINGP(obj) || VECTORLIKEP(obj) ||
+            (BARE_SYMBOL_P(obj) && !BASE_EQ(obj, w->marker) &&
+             !SYMBOL_INTERNED_IN_INITIAL_OBARRAY_P(obj)));
+}
+
+/* Find the objects that occur more than once in OBJ, which is nested
+   DEPTH levels deep in the form.  Don't look deeper than
+   elb_put_object writes.  */
+static void elb_scan(struct elb_writer* w, Lisp_Object obj, int depth) {
+    if (depth > ELB_MAX_DEPTH)
+        return;
+    while (elb_shareable_p(w, obj)) {
+        if (!BASE_EQ(Fgethash(obj, w->shared, Qunbound), Qunbound)) {
+            Fputhash(obj, Qt, w->shared);
+            return;
+        }
+        Fputhash(obj, Qnil, w->shared);
+
+        if (CONSP(obj)) {
+            elb_scan(w, XCAR(obj), depth + 1);
+            obj = XCDR(obj);
+        }
+        else {
+            if (VECTORP(obj) || RECORDP(obj) || CLOSUREP(obj)) {
+                ptrdiff_t size = VECTORP(obj) ? ASIZE(obj) : PVSIZE(obj);
+                for (ptrdiff_t i = 0; i < size; i++)
+                    elb_scan(w, AREF(obj, i), depth + 1);
+            }
+            else if (HASH_TABLE_P(obj)) {
+                struct Lisp_Hash_Table* h = XHASH_TABLE(obj);
+                DOHASH(h, k, v) {
+                    elb_scan(w, k, depth + 1);
+                    elb_scan(w, v, depth + 1);
+                }
+            }
+            return;
+        }
+    }
+}
+
+/* Return true if OBJ can be read back on its own: if it occurs nowhere
+   else in the form, contains no object that does, and no #$.  */
+static bool elb_self_contained_p(struct elb_writer* w, Lisp_Object obj,
+                                 int depth) {
+    if (depth > ELB_MAX_DEPTH || BASE_EQ(obj, w->marker))
+        return false;
+    if (!elb_shareable_p(w, obj))
+        return true;
+    if (!NILP(Fgethash(obj, w->shared, Qnil)))
+        return false;
+    if (CONSP(obj)) {
+        FOR_EACH_TAIL_SAFE(obj) {
+            if (!elb_self_contained_p(w, XCAR(obj), depth + 1) ||
+                !NILP(Fgethash(XCDR(obj), w->shared, Qnil)))
+                return false;
+        }
+        return elb_self_contained_p(w, obj, depth + 1);
+    }
+    if (VECTORP(obj) || RECORDP(obj) || CLOSUREP(obj)) {
+        ptrdiff_t size = VECTORP(obj) ? ASIZE(obj) : PVSIZE(obj);
+        for (ptrdiff_t i = 0; i < size; i++)
+            if (!elb_self_contained_p(w, AREF(obj, i), depth + 1))
+                return false;
+    }
+    else if (HASH_TABLE_P(obj)) {
+        struct Lisp_Hash_Table* h = XHASH_TABLE(obj);
+        DOHASH(h, k, v) {
+            if (!elb_self_contained_p(w, k, depth + 1) ||
+                !elb_self_contained_p(w, v, depth + 1))
+                return false;
+        }
+    }
+    return true;
+}
+
+/* Return true if the byte-code function FUN should be loaded lazily.  */
+static bool elb_lazy_body_p(struct elb_writer* w, Lisp_Object fun) {
+    Lisp_Object code = AREF(fun, CLOSURE_CODE);
+    Lisp_Object constants = AREF(fun, CLOSURE_CONSTANTS);
+    return (STRINGP(code) && SBYTES(code) >= ELB_LAZY_MIN_CODE &&
+            VECTORP(constants) && elb_self_contained_p(w, code, 0) &&
+            elb_self_contained_p(w, constants, 0));
+}
+
+static bool elb_put_object(struct elb_writer*, Lisp_Object, int);
+
+/* Write the byte-code function FUN with its code and constants among
+   the bodies.  */
+static bool elb_put_lazy_closure(struct elb_writer* w, Lisp_Object fun,
+                                 int depth) {
+    ptrdiff_t size = PVSIZE(fun);
+    elb_put_byte(&w->body, ELB_LAZY_CLOSURE);
+    elb_put_uint(&w->body, size);
+    elb_put_uint(&w->body, w->bodies.len);
+    for (ptrdiff_t i = 0; i < size; i++)
+        if (i != CLOSURE_CODE && i != CLOSURE_CONSTANTS &&
+            !elb_put_object(w, AREF(fun, i), depth + 1))
+            return false;
+
+    w->out = &w->bodies;
+    bool ok = (elb_put_object(w, AREF(fun, CLOSURE_CODE), 0) &&
+               elb_put_object(w, AREF(fun, CLOSURE_CONSTANTS), 0));
+    w->out = &w->body;
+    return ok;
+}
+
+/* Write OBJ to W, nested DEPTH deep.  Return false if it contains
+   something the binary format cannot represent.  */
+static bool elb_put_object(struct elb_writer* w, Lisp_Object obj, int depth) {
+    struct elb_buffer* b = w->out;
+
+    if (depth > ELB_MAX_DEPTH)
+        return false;
+
+    if (elb_shareable_p(w, obj)) {
+        Lisp_Object seen = Fgethash(obj, w->shared, Qnil);
+        if (FIXNUMP(seen)) {
+            elb_put_byte(b, ELB_REF);
+            elb_put_uint(b, XFIXNUM(seen));
+            return true;
+        }
+        if (EQ(seen, Qt)) {
+            elb_put_byte(b, ELB_DEF);
+            Fputhash(obj, make_fixnum(w->nlabels++), w->shared);
+        }
+    }
+
+    if (FIXNUMP(obj)) {
+        EMACS_INT n = XFIXNUM(obj);
+        elb_put_byte(b, ELB_INT);
+        elb_put_uint(b, ((uintmax_t)n << 1) ^ (n < 0 ? UINTMAX_MAX : 0));
+    }
+    else if (BIGNUMP(obj)) {
+        Lisp_Object digits = bignum_to_string(obj, 10);
+        elb_put_byte(b, ELB_BIGNUM);
+        elb_put_uint(b, SBYTES(digits) + 1);
+        elb_put(b, SDATA(digits), SBYTES(digits) + 1);
+    }
+    else if (FLOATP(obj)) {
+        double d = XFLOAT_DATA(obj);
+        elb_put_byte(b, ELB_FLOAT);
+        elb_put(b, &d, sizeof d);
+    }
+    else if (BASE_EQ(obj, w->marker))
+        elb_put_byte(b, ELB_LOAD_FILE_NAME);
+    else if (BARE_SYMBOL_P(obj)) {
+        if (!SYMBOL_INTERNED_IN_INITIAL_OBARRAY_P(obj) || b == &w->bodies) {
+            elb_put_byte(b, (SYMBOL_INTERNED_IN_INITIAL_OBARRAY_P(obj)
+                                 ? ELB_NAMED_SYMBOL
+                                 : ELB_UNINTERNED));
+            elb_put_string(b, SYMBOL_NAME(obj));
+            return true;
+        }
+        Lisp_Object index = Fgethash(obj, w->symbols, Qnil);
+        if (NILP(index)) {
+            index = make_fixnum(XHASH_TABLE(w->symbols)->count);
+            Fputhash(obj, index, w->symbols);
+            elb_put_string(&w->table, SYMBOL_NAME(obj));
+        }
+        elb_put_byte(b, ELB_SYMBOL);
+        elb_put_uint(b, XFIXNUM(index));
+    }
+    else if (STRINGP(obj)) {
+        if (string_intervals(obj))
+            return false;
+        elb_put_byte(b, ELB_STRING);
+        elb_put_string(b, obj);
+    }
+    else if (CONSP(obj)) {
+        /* Write the cells up to the next one that is shared as a
+           single run, so that long lists don't recurse.  */
+        ptrdiff_t n = 1;
+        Lisp_Object tail = XCDR(obj);
+        for (; CONSP(tail) && NILP(Fgethash(tail, w->shared, Qnil));
+             tail = XCDR(tail))
+            n++;
+        elb_put_byte(b, ELB_LIST);
+        elb_put_uint(b, n);
+        for (Lisp_Object cell = obj; n > 0; n--, cell = XCDR(cell))
+            if (!elb_put_object(w, XCAR(cell), depth + 1))
+                return false;
+        return elb_put_object(w, tail, depth + 1);
+    }
+    else if (CLOSUREP(obj) && b == &w->body && elb_lazy_body_p(w, obj))
+        return elb_put_lazy_closure(w, obj, depth);
+    else if (VECTORP(obj) || RECORDP(obj) || CLOSUREP(obj)) {
+        ptrdiff_t size = VECTORP(obj) ? ASIZE(obj) : PVSIZE(obj);
+        elb_put_byte(b, VECTORP(obj)   ? ELB_VECTOR
+                        : RECORDP(obj) ? ELB_RECORD
+                                       : ELB_CLOSURE);
+        elb_put_uint(b, size);
+        for (ptrdiff_t i = 0; i < size; i++)
+            if (!elb_put_object(w, AREF(obj, i), depth + 1))
+                return false;
+    }
+    else if (BOOL_VECTOR_P(obj)) {
+        EMACS_INT nbits = bool_vector_size(obj);
+        elb_put_byte(b, ELB_BOOL_VECTOR);
+        elb_put_uint(b, nbits);
+        elb_put(b, bool_vector_uchar_data(obj), bool_vector_bytes(nbits));
+    }
+    else if (HASH_TABLE_P(obj)) {
+        struct Lisp_Hash_Table* h = XHASH_TABLE(obj);
+        /* The reader labels the table before it sees the test.  */
+        if (!SYMBOL_INTERNED_IN_INITIAL_OBARRAY_P(h->test->name))
+            return false;
+        elb_put_byte(b, ELB_HASH_TABLE);
+        if (!elb_put_object(w, h->test->name, depth + 1) ||
+            !elb_put_object(w, hash_table_weakness_symbol(h->weakness),
+                            depth + 1))
+            return false;
+        elb_put_uint(b, h->count);
+        DOHASH(h, k, v) {
+            if (!elb_put_object(w, k, depth + 1) ||
+                !elb_put_object(w, v, depth + 1))
+                return false;
+        }
+    }
+    else
+        return false;
+    return true;
+}
+
+static void elb_writer_free(void* arg) {
+    struct elb_writer* w = arg;
+    xfree(w->body.data);
+    xfree(w->table.data);
+    xfree(w->bodies.data);
+}
+
+DEFUN ("write-elb-file", Fwrite_elb_file, Swrite_elb_file, 1, 1, 0,
+       doc: /* Write the binary form of the compiled Lisp file FILE.
+FILE should end in `.elc'; the output goes to the file whose name is
+FILE with `.elb' in place of `.elc'.  As long as FILE is not changed,
+`load' reads that file instead of FILE, which is much faster.
+
+Return the name of the file written, or nil if FILE contains objects
+that the binary form cannot represent.  */)
+(Lisp_Object file) {
+    specpdl_ref count = SPECPDL_INDEX();
+
+    CHECK_STRING(file);
+    file = Fexpand_file_name(file, Qnil);
+    if (!suffix_p(file, ".elc"))
+        error("Not a compiled Lisp file: %s", SDATA(file));
+
+    int fd = emacs_open(SSDATA(ENCODE_FILE(file)), O_RDONLY, 0);
+    if (fd < 0)
+        report_file_error("Opening input file", file);
+    specpdl_ref fd_index = SPECPDL_INDEX();
+    record_unwind_protect_int(close_file_unwind, fd);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+        report_file_error("Input file status", file);
+    int version = safe_to_load_version(file, fd);
+    if (!version)
+        error("File `%s' was not compiled in Emacs", SDATA(file));
+    /* Files this old need the emacs-mule reader.  */
+    if (version < 22)
+        return unbind_to(count, Qnil);
+
+    file_stream stream = emacs_fdopen(fd, "r" FOPEN_BINARY);
+    if (!file_stream_valid_p(stream))
+        report_file_error("Opening stdio stream", file);
+    struct infile input;
+    set_unwind_protect_ptr(fd_index, close_infile_unwind, infile);
+    input.stream = stream;
+    input.lookahead = 0;
+    infile = &input;
+    unread_char = -1;
+
+    struct elb_writer w = {
+        .marker = Fmake_symbol(build_string("load-file-name")),
+        .symbols = make_hash_table(&hashtest_eq, DEFAULT_HASH_SIZE, Weak_None),
+    };
+    w.out = &w.body;
+    record_unwind_protect_ptr(elb_writer_free, &w);
+    record_unwind_protect_void(free_saved_strings);
+
+    /* Keep #$ recognizable in what we read, and don't expand
+       shorthands, which the compiler has already done.  */
+    specbind(Qload_file_name, w.marker);
+    specbind(Qread_symbol_shorthands, Qnil);
+
+    source_t source;
+    init_source(&source, Qget_file_char);
+    while (skip_to_next_form(&source) >= 0) {
+        Lisp_Object form =
+            read_internal_start(Qget_file_char, Qnil, Qnil, false);
+        w.shared = make_hash_table(&hashtest_eq, DEFAULT_HASH_SIZE, Weak_None);
+        w.nlabels = 0;
+        elb_scan(&w, form, 0);
+        if (!elb_put_object(&w, form, 0))
+            return unbind_to(count, Qnil);
+    }
+
+    struct timespec mtime = get_stat_mtime(&st);
+    /* Clear any padding too, as the whole structure is written.  */
+    struct elb_header header;
+    memset(&header, 0, sizeof header);
+    memcpy(header.magic, elb_magic, sizeof header.magic);
+    header.version = ELB_VERSION;
+    header.elc_size = st.st_size;
+    header.elc_mtime_sec = mtime.tv_sec;
+    header.elc_mtime_nsec = mtime.tv_nsec;
+    header.nsymbols = XHASH_TABLE(w.symbols)->count;
+    header.bodies = sizeof header + w.table.len + w.body.len;
+
+    /* Write to a temporary file first, so that another Emacs loading
+       the file never sees it half-written.  */
+    Lisp_Object elb = concat2(Fsubstring(file, make_fixnum(0), make_fixnum(-1)),
+                              build_string("b"));
+    Lisp_Object temp = concat2(elb, build_string(".tmp"));
+    Lisp_Object etemp = ENCODE_FILE(temp);
+    int out = emacs_open(SSDATA(etemp), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (out < 0)
+        report_file_error("Opening output file", temp);
+    bool ok =
+        (emacs_write_quit(out, &header, sizeof header) == sizeof header &&
+         emacs_write_quit(out, w.table.data, w.table.len) == w.table.len &&
+         emacs_write_quit(out, w.body.data, w.body.len) == w.body.len &&
+         emacs_write_quit(out, w.bodies.data, w.bodies.len) == w.bodies.len);
+    if (emacs_close(out) != 0)
+        ok = false;
+    if (!ok || rename(SSDATA(etemp), SSDATA(ENCODE_FILE(elb))) != 0) {
+        int err = errno;
+        unlink(SSDATA(etemp));
+        errno = err;
+        report_file_error("Writing binary compiled file", elb);
+    }
+
+    return unbind_to(count, elb);
+}
+
+struct elb_reader {
+    unsigned char const* p;
+    unsigned char const* end;
+
+    /* The .elb file, for error messages.  */
+    Lisp_Object file;
+
+    /* The symbol table, and the labeled objects of the current form.  */
+    Lisp_Object symbols;
+    Lisp_Object labels;
+    ptrdiff_t nlabels;
+
+    /* The start of the file, of its function bodies, and its end.  */
+    unsigned char const* base;
+    unsigned char const* bodies;
+    unsigned char const* limit;
+
+    /* What lazily loaded closures have in their constants slot, or nil
+       to read function bodies right away.  */
+    Lisp_Object lazy_source;
+
+    /* True if a closure was made with LAZY_SOURCE.  */
+    bool lazy_used;
+};
+
+static AVOID elb_invalid(struct elb_reader* r) {
+    error("Invalid binary compiled file %s", SDATA(r->file));
+}
+
+static int elb_read_byte(struct elb_reader* r) {
+    if (r->p == r->end)
+        elb_invalid(r);
+    return *r->p++;
+}
+
+/* Decode the number at *P, which must end before END, into *N and
+   advance *P past it.  Return false if it doesn't end in time.  This
+   touches no Lisp data, so the prefetch threads use it too.  */
+static bool elb_decode_uint(unsigned char const** p, unsigned char const* end,
+                            uintmax_t* n) {
+    uintmax_t val = 0;
+    for (int shift = 0; shift < UINTMAX_WIDTH && *p < end; shift += 7) {
+        int byte = *(*p)++;
+        val |= (uintmax_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *n = val;
+            return true;
+        }
+    }
+    return false;
+}
+
+static uintmax_t elb_read_uint(struct elb_reader* r) {
+    uintmax_t n;
+    if (!elb_decode_uint(&r->p, r->end, &n))
+        elb_invalid(r);
+    return n;
+}
+
+/* Read a count of things that take at least a byte each.  */
+static ptrdiff_t elb_read_count(struct elb_reader* r) {
+    uintmax_t n = elb_read_uint(r);
+    if (n > r->end - r->p)
+        elb_invalid(r);
+    return n;
+}
+
+static unsigned char const* elb_read_bytes(struct elb_reader* r,
+                                           ptrdiff_t n) {
+    unsigned char const* p = r->p;
+    if (n > r->end - p)
+        elb_invalid(r);
+    r->p += n;
+    return p;
+}
+
+/* Read the contents of a string.  Return its bytes, and store its
+   sizes and multibyteness in *NCHARS, *NBYTES and *MULTIBYTE.  */
+static char const* elb_read_string_data(struct elb_reader* r,
+                                        ptrdiff_t* nchars, ptrdiff_t* nbytes,
+                                        bool* multibyte) {
+    *nchars = elb_read_count(r);
+    *nbytes = elb_read_count(r);
+    *multibyte = elb_read_byte(r);
+    if (*nchars > *nbytes || (!*multibyte && *nchars != *nbytes))
+        elb_invalid(r);
+    return (char const*)elb_read_bytes(r, *nbytes);
+}
+
+static Lisp_Object elb_read_string(struct elb_reader* r) {
+    ptrdiff_t nchars, nbytes;
+    bool multibyte;
+    char const* data = elb_read_string_data(r, &nchars, &nbytes, &multibyte);
+    return make_specified_string(data, nchars, nbytes, multibyte);
+}
+
+/* Return the symbol in OBARRAY with the name at NAME, interning one
+   if needed.  HASH, if nonnull, points to the hash_char_array of the
+   name.  */
+static Lisp_Object elb_intern(Lisp_Object obarray, char const* name,
+                              ptrdiff_t nchars, ptrdiff_t nbytes,
+                              bool multibyte, EMACS_UINT const* hash) {
+    EMACS_UINT h = hash ? *hash : hash_char_array(name, nbytes);
+    Lisp_Object sym = oblookup_hashed(obarray, name, nchars, nbytes, h);
+    if (!BARE_SYMBOL_P(sym))
+        sym = intern_hashed(
+            make_specified_string(name, nchars, nbytes, multibyte), obarray,
+            sym, h);
+    return sym;
+}
+
+/* A weak hash table whose keys are the lazily loaded closures whose
+   bodies have not been read yet, or nil.  */
+static Lisp_Object elb_pending_closures;
+
+static Lisp_Object elb_read_object(struct elb_reader*, int);
+
+/* Read the code and constants of the byte-code function FUN.  */
+static void elb_read_body(struct elb_reader* r, Lisp_Object fun) {
+    Lisp_Object code = elb_read_object(r, 0);
+    Lisp_Object constants = elb_read_object(r, 0);
+    if (!STRINGP(code) || STRING_MULTIBYTE(code) || !VECTORP(constants))
+        elb_invalid(r);
+    pin_string(code);
+    ASET(fun, CLOSURE_CONSTANTS, constants);
+    ASET(fun, CLOSURE_CODE, code);
+}
+
+static void elb_add_label(struct elb_reader* r, Lisp_Object obj) {
+    if (r->nlabels == ASIZE(r->labels))
+        r->labels = larger_vector(r->labels, 1, -1);
+    ASET(r->labels, r->nlabels++, obj);
+}
+
+static Lisp_Object elb_read_object(struct elb_reader* r, int depth) {
+    if (depth > ELB_MAX_DEPTH)
+        elb_invalid(r);
+
+    int op = elb_read_byte(r);
+    bool label = op == ELB_DEF;
+    if (label)
+        op = elb_read_byte(r);
+
+    Lisp_Object obj;
+    switch (op) {
+    case ELB_INT: {
+        uintmax_t u = elb_read_uint(r);
+        intmax_t n = (intmax_t)(u >> 1) ^ -(intmax_t)(u & 1);
+        obj = make_int(n);
+        break;
+    }
+
+    case ELB_BIGNUM: {
+        ptrdiff_t n = elb_read_count(r);
+        char const* digits = (char const*)elb_read_bytes(r, n);
+        ptrdiff_t len;
+        if (n == 0 || digits[n - 1])
+            elb_invalid(r);
+        obj = string_to_number(digits, 10, &len);
+        if (NILP(obj) || len != n - 1)
+            elb_invalid(r);
+        break;
+    }
+
+    case ELB_FLOAT: {
+        double d;
+        memcpy(&d, elb_read_bytes(r, sizeof d), sizeof d);
+        obj = make_float(d);
+        break;
+    }
+
+    case ELB_SYMBOL: {
+        uintmax_t i = elb_read_uint(r);
+        if (i >= ASIZE(r->symbols))
+            elb_invalid(r);
+        obj = AREF(r->symbols, i);
+        break;
+    }
+
+    case ELB_UNINTERNED:
+        obj = Fmake_symbol(elb_read_string(r));
+        break;
+
+    case ELB_NAMED_SYMBOL: {
+        ptrdiff_t nchars, nbytes;
+        bool multibyte;
+        char const* name =
+            elb_read_string_data(r, &nchars, &nbytes, &multibyte);
+        /* The writer only names symbols of the initial obarray.  A
+           body can be read long after loading, under a different
+           `obarray', so don't look at that.  */
+        obj = elb_intern(initial_obarray, name, nchars, nbytes, multibyte,
+                         NULL);
+        break;
+    }
+
+    case ELB_STRING:
+        obj = elb_read_string(r);
+        break;
+
+    case ELB_LIST: {
+        /* Label the first cell before reading anything that might
+           refer to it.  */
+        ptrdiff_t n = elb_read_count(r);
+        if (n == 0)
+            elb_invalid(r);
+        obj = Fcons(Qnil, Qnil);
+        if (label)
+            elb_add_label(r, obj);
+        label = false;
+        Lisp_Object tail = obj;
+        while (true) {
+            XSETCAR(tail, elb_read_object(r, depth + 1));
+            if (--n == 0)
+                break;
+            Lisp_Object cell = Fcons(Qnil, Qnil);
+            XSETCDR(tail, cell);
+            tail = cell;
+        }
+        XSETCDR(tail, elb_read_object(r, depth + 1));
+        break;
+    }
+
+    case ELB_VECTOR:
+    case ELB_RECORD:
+    case ELB_CLOSURE: {
+        ptrdiff_t n = elb_read_count(r);
+        if (op != ELB_VECTOR &&
+            (n == 0 || n > PSEUDOVECTOR_SIZE_MASK ||
+             (op == ELB_CLOSURE && n <= CLOSURE_CONSTANTS)))
+            elb_invalid(r);
+        obj = make_nil_vector(n);
+        if (label)
+            elb_add_label(r, obj);
+        label = false;
+        for (ptrdiff_t i = 0; i < n; i++)
+            ASET(obj, i, elb_read_object(r, depth + 1));
+        if (op == ELB_RECORD)
+            XSETPVECTYPE(XVECTOR(obj), PVEC_RECORD);
+        else if (op == ELB_CLOSURE) {
+            /* As in bytecode_from_rev_list.  */
+            if (STRINGP(AREF(obj, CLOSURE_CODE)))
+                pin_string(AREF(obj, CLOSURE_CODE));
+            XSETPVECTYPE(XVECTOR(obj), PVEC_CLOSURE);
+        }
+        break;
+    }
+
+    case ELB_BOOL_VECTOR: {
+        uintmax_t nbits = elb_read_uint(r);
+        if (nbits > BOOL_VECTOR_LENGTH_MAX)
+            elb_invalid(r);
+        ptrdiff_t nbytes = bool_vector_bytes(nbits);
+        unsigned char const* bits = elb_read_bytes(r, nbytes);
+        obj = make_uninit_bool_vector(nbits);
+        memcpy(bool_vector_uchar_data(obj), bits, nbytes);
+        break;
+    }
+
+    case ELB_HASH_TABLE: {
+        Lisp_Object test = elb_read_object(r, depth + 1);
+        Lisp_Object weakness = elb_read_object(r, depth + 1);
+        ptrdiff_t n = elb_read_count(r);
+        obj = CALLN(Fmake_hash_table, QCtest, test, QCweakness, weakness,
+                    QCsize, make_fixnum(n));
+        if (label)
+            elb_add_label(r, obj);
+        label = false;
+        for (; n > 0; n--) {
+            Lisp_Object key = elb_read_object(r, depth + 1);
+            Fputhash(key, elb_read_object(r, depth + 1), obj);
+        }
+        break;
+    }
+
+    case ELB_LAZY_CLOSURE: {
+        ptrdiff_t n = elb_read_count(r);
+        uintmax_t offset = elb_read_uint(r);
+        if (n <= CLOSURE_CONSTANTS || n > PSEUDOVECTOR_SIZE_MASK ||
+            offset >= r->limit - r->bodies)
+            elb_invalid(r);
+        obj = make_nil_vector(n);
+        if (label)
+            elb_add_label(r, obj);
+        label = false;
+        for (ptrdiff_t i = 0; i < n; i++)
+            if (i != CLOSURE_CODE && i != CLOSURE_CONSTANTS)
+                ASET(obj, i, elb_read_object(r, depth + 1));
+        if (NILP(r->lazy_source)) {
+            struct elb_reader body = *r;
+            body.p = r->bodies + offset;
+            body.end = r->limit;
+            elb_read_body(&body, obj);
+        }
+        else {
+            ASET(obj, CLOSURE_CODE,
+                 make_fixnum(r->bodies + offset - r->base));
+            ASET(obj, CLOSURE_CONSTANTS, r->lazy_source);
+            r->lazy_used = true;
+            if (NILP(elb_pending_closures))
+                elb_pending_closures = make_hash_table(
+                    &hashtest_eq, DEFAULT_HASH_SIZE, Weak_Key);
+            Fputhash(obj, Qt, elb_pending_closures);
+        }
+        XSETPVECTYPE(XVECTOR(obj), PVEC_CLOSURE);
+        break;
+    }
+
+    case ELB_LOAD_FILE_NAME:
+        obj = Vload_file_name;
+        break;
+
+    case ELB_REF: {
+        uintmax_t i = elb_read_uint(r);
+        if (label || i >= r->nlabels)
+            elb_invalid(r);
+        obj = AREF(r->labels, i);
+        break;
+    }
+
+    default:
+        elb_invalid(r);
+    }
+
+    if (label)
+        elb_add_label(r, obj);
+    return obj;
+}
+
+struct elb_map {
+    void* addr;
+    size_t size;
+};
+
+static void elb_unmap(void* arg) {
+    struct elb_map* map = arg;
+    if (map->addr != MAP_FAILED)
+        munmap(map->addr, map->size);
+}
+
+/* The mapped .elb files that lazily loaded closures may refer to.  The
+   constants slot of such a closure is (FILE . INDEX), where INDEX is
+   the index of the mapping of FILE here.  */
+static struct elb_map* elb_sources;
+static ptrdiff_t elb_nsources, elb_sources_size;
+
+/* Map the regular file NAME, if it is not empty.  Return the mapping,
+   or one with address MAP_FAILED.  This touches no Lisp data.  */
+static struct elb_map elb_map_file(char const* name) {
+    struct elb_map map = {MAP_FAILED, 0};
+    struct stat st;
+    int fd = open(name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return map;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && 0 < st.st_size &&
+        st.st_size <= SIZE_MAX) {
+        map.size = st.st_size;
+        map.addr = mmap(NULL, map.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    return map;
+}
+
+/* Parallel loading.
+
+   `load-files' loads a list of files in order.  While the main thread
+   evaluates one of them, worker threads map the .elb files of the
+   next ones, fault their pages in and hash the names in their symbol
+   tables, so that the main thread finds them ready.  Files that have
+   no .elb file are read into the page cache instead.  The workers
+   touch no Lisp data; everything that allocates or interns stays on
+   the main thread.  */
+
+enum
+{
+    PREFETCH_MAX_WORKERS = 8,
+    /* How many files the workers may get ahead of the main thread.  */
+    PREFETCH_WINDOW = 32
+};
+
+struct prefetch_file {
+    /* The encoded name of the .elc file.  */
+    char* elc;
+
+    /* Set by the worker: the .elb file, mapped, and the hash codes of
+       the names in its symbol table; or MAP_FAILED and NULL.  */
+    struct elb_map map;
+    EMACS_UINT* hashes;
+    bool done;
+};
+
+struct prefetch {
+    sys_mutex_t mutex;
+    sys_cond_t cond;
+    struct prefetch_file* files;
+    ptrdiff_t nfiles;
+
+    /* The file the main thread is loading, and the next one for a
+       worker to take.  */
+    ptrdiff_t loading, next;
+
+    /* Number of workers that have not exited.  */
+    int nworkers;
+
+    /* True if the workers should exit.  */
+    bool stop;
+};
+
+/* The file `load-files' is about to load, if its .elb file was
+   prefetched.  */
+static struct prefetch_file* current_prefetch_file;
+
+/* If `load-files' prefetched the .elb file of EFOUND (encoded), return
+   its entry, passing the mapping to the caller.  */
+static struct prefetch_file* take_prefetched_file(Lisp_Object efound) {
+    struct prefetch_file* f = current_prefetch_file;
+    if (!f || f->map.addr == MAP_FAILED || strcmp(f->elc, SSDATA(efound)) != 0)
+        return NULL;
+    current_prefetch_file = NULL;
+    return f;
+}
+
+/* Return true if the SIZE bytes at ADDR are an .elb file written from
+   the .elc file with status ELC_ST.  */
+static bool elb_header_matches(void const* addr, size_t size,
+                               struct stat const* elc_st) {
+    struct elb_header header;
+    if (size < sizeof header)
+        return false;
+    memcpy(&header, addr, sizeof header);
+    struct timespec mtime = get_stat_mtime(elc_st);
+    return (memcmp(header.magic, elb_magic, sizeof header.magic) == 0 &&
+            header.version == ELB_VERSION &&
+            header.elc_size == elc_st->st_size &&
+            header.elc_mtime_sec == mtime.tv_sec &&
+            header.elc_mtime_nsec == mtime.tv_nsec);
+}
+
+/* If the compiled file EFOUND (encoded) has an up-to-date .elb file
+   next to it, evaluate the forms in that file as `readevalloop' would
+   evaluate those in EFOUND, and return true.  Otherwise do nothing and
+   return false.  SOURCENAME is as for `readevalloop'.  */
+static bool load_elb_file(Lisp_Object efound, Lisp_Object sourcename) {
+    if (!load_use_elb_files || !EQ(Vload_read_function, Qread) ||
+        !suffix_p(efound, ".elc"))
+        return false;
+
+    struct stat elc_st;
+    if (emacs_fstatat(AT_FDCWD, SSDATA(efound), &elc_st, 0) != 0)
+        return false;
+    Lisp_Object elb = Fcopy_sequence(efound);
+    SSET(elb, SBYTES(elb) - 1, 'b');
+
+    /* `load-files' may already have mapped the file.  */
+    struct elb_map map = {MAP_FAILED, 0};
+    EMACS_UINT const* hashes = NULL;
+    struct prefetch_file* pre = take_prefetched_file(efound);
+    if (pre) {
+        map = pre->map;
+        pre->map.addr = MAP_FAILED;
+        hashes = pre->hashes;
+    }
+    else {
+        map = elb_map_file(SSDATA(elb));
+        if (map.addr == MAP_FAILED)
+            return false;
+    }
+
+    specpdl_ref count = SPECPDL_INDEX();
+    record_unwind_protect_ptr(elb_unmap, &map);
+
+    if (!elb_header_matches(map.addr, map.size, &elc_st)) {
+        unbind_to(count, Qnil);
+        return false;
+    }
+
+    struct elb_header header;
+    memcpy(&header, map.addr, sizeof header);
+    struct elb_reader r = {
+        .p = (unsigned char const*)map.addr + sizeof header,
+        .file = elb,
+        .labels = make_nil_vector(16),
+        .base = map.addr,
+        .limit = (unsigned char const*)map.addr + map.size,
+        .lazy_source = Qnil,
+    };
+    if (header.bodies < sizeof header || header.bodies > map.size)
+        elb_invalid(&r);
+    r.bodies = r.base + header.bodies;
+    r.end = r.bodies;
+    if (header.nsymbols > r.end - r.p)
+        elb_invalid(&r);
+    r.symbols = make_nil_vector(header.nsymbols);
+    Lisp_Object obarray = check_obarray(Vobarray);
+    for (ptrdiff_t i = 0; i < header.nsymbols; i++) {
+        ptrdiff_t nchars, nbytes;
+        bool multibyte;
+        char const* name =
+            elb_read_string_data(&r, &nchars, &nbytes, &multibyte);
+        ASET(r.symbols, i,
+             elb_intern(obarray, name, nchars, nbytes, multibyte,
+                        hashes ? &hashes[i] : NULL));
+    }
+
+    /* Closures in a dump would refer to files in the build tree; the
+       dump is mapped and paged in on demand anyway.  Otherwise hand the
+       mapping over to elb_sources, as closures may refer to it.  */
+    ptrdiff_t source = -1;
+    if (!will_dump_p()) {
+        if (elb_nsources == elb_sources_size)
+            elb_sources = xpalloc(elb_sources, &elb_sources_size, 1, -1,
+                                  sizeof *elb_sources);
+        source = elb_nsources++;
+        elb_sources[source] = map;
+        map.addr = MAP_FAILED;
+        r.lazy_source = Fcons(elb, make_fixnum(source));
+    }
+
+    /* What follows mirrors readevalloop for an .elc file.  */
+    specbind(Qread_symbol_shorthands, Qnil);
+    Lisp_Object lex_bound = find_symbol_value(Qlexical_binding);
+    specbind(
+        Qinternal_interpreter_environment,
+        (NILP(lex_bound) || BASE_EQ(lex_bound, Qunbound) ? Qnil : list1(Qt)));
+    specbind(Qmacroexp__dynvars, Vmacroexp__dynvars);
+    if (!will_dump_p() && !NILP(sourcename) &&
+        !NILP(Ffile_name_absolute_p(sourcename)))
+        sourcename = Fexpand_file_name(sourcename, Qnil);
+    loadhist_initialize(sourcename);
+
+    while (r.p < r.end) {
+        r.nlabels = 0;
+        eval_sub(elb_read_object(&r, 0));
+    }
+
+    /* Unmap the file again if no closure refers to it, and no file
+       loaded meanwhile was mapped after it.  */
+    if (source >= 0 && !r.lazy_used && source == elb_nsources - 1) {
+        elb_nsources--;
+        elb_unmap(&elb_sources[source]);
+    }
+
+    build_load_history(sourcename, true);
+    unbind_to(count, Qnil);
+    return true;
+}
+
+/* Read in the code and constants of FUN, a closure loaded lazily from
+   an .elb file.  */
+void fetch_closure_body(Lisp_Object fun) {
+    Lisp_Object source = AREF(fun, CLOSURE_CONSTANTS);
+    EMACS_INT offset = XFIXNUM(AREF(fun, CLOSURE_CODE));
+
+    if (!(CONSP(source) && STRINGP(XCAR(source)) &&
+          RANGED_FIXNUMP(0, XCDR(source), elb_nsources - 1)))
+        error("Invalid byte-code function");
+    Lisp_Object file = XCAR(source);
+    struct elb_map map = elb_sources[XFIXNUM(XCDR(source))];
+
+    struct elb_header header;
+    memcpy(&header, map.addr, sizeof header);
+
+    struct elb_reader r = {
+        .p = (unsigned char const*)map.addr + offset,
+        .end = (unsigned char const*)map.addr + map.size,
+        .file = file,
+        .labels = make_nil_vector(1),
+        .base = map.addr,
+        .bodies = (unsigned char const*)map.addr + header.bodies,
+        .limit = (unsigned char const*)map.addr + map.size,
+    };
+    if (offset < header.bodies || offset >= map.size)
+        elb_invalid(&r);
+    elb_read_body(&r, fun);
+    if (!NILP(elb_pending_closures))
+        Fremhash(fun, elb_pending_closures);
+}
+
+/* Read in the bodies of all the closures loaded lazily, so that none
+   refers to a file any more.  */
+void fetch_all_closure_bodies(void) {
+    if (NILP(elb_pending_closures))
+        return;
+
+    Lisp_Object funs = Qnil;
+    DOHASH(XHASH_TABLE(elb_pending_closures), k, v) funs = Fcons(k, funs);
+    for (; CONSP(funs); funs = XCDR(funs))
+        if (closure_body_pending_p(XCAR(funs)))
+            fetch_closure_body(XCAR(funs));
+    elb_pending_closures = Qnil;
+}
+
+/* Fault in the pages of the SIZE bytes at ADDR.  */
+static void prefetch_pages(void* addr, size_t size) {
+    unsigned char const volatile* p = addr;
+    size_t page = getpagesize();
+    madvise(addr, size, MADV_WILLNEED);
+    for (size_t i = 0; i < size; i += page)
+        (void)p[i];
+}
+
+/* Map the file NAME and fault it in.  Return the mapping, or one with
+   address MAP_FAILED.  */
+static struct elb_map prefetch_map(char const* name) {
+    struct elb_map map = elb_map_file(name);
+    if (map.addr != MAP_FAILED)
+        prefetch_pages(map.addr, map.size);
+    return map;
+}
+
+/* Hash the names in the symbol table of the .elb file mapped at MAP.
+   Return the malloc'ed hash codes, or NULL.  */
+static EMACS_UINT* prefetch_hashes(struct elb_map map) {
+    struct elb_header header;
+    memcpy(&header, map.addr, sizeof header);
+    unsigned char const* p = (unsigned char const*)map.addr + sizeof header;
+    unsigned char const* end = (unsigned char const*)map.addr + map.size;
+    if (header.nsymbols > end - p)
+        return NULL;
+    EMACS_UINT* hashes = malloc(header.nsymbols * sizeof *hashes + 1);
+    if (!hashes)
+        return NULL;
+    for (ptrdiff_t i = 0; i < header.nsymbols; i++) {
+        uintmax_t nchars, nbytes;
+        if (!elb_decode_uint(&p, end, &nchars) ||
+            !elb_decode_uint(&p, end, &nbytes) || end - p <= nbytes) {
+            free(hashes);
+            return NULL;
+        }
+        p++; /* The multibyte flag.  */
+        hashes[i] = hash_char_array((char const*)p, nbytes);
+        p += nbytes;
+    }
+    return hashes;
+}
+
+static void prefetch_one(struct prefetch_file* f) {
+    struct stat elc_st;
+    if (stat(f->elc, &elc_st) != 0)
+        return;
+
+    size_t len = strlen(f->elc);
+    char* elb = malloc(len + 1);
+    if (elb) {
+        memcpy(elb, f->elc, len + 1);
+        elb[len - 1] = 'b';
+        f->map = prefetch_map(elb);
+        free(elb);
+    }
+    if (f->map.addr != MAP_FAILED &&
+        !elb_header_matches(f->map.addr, f->map.size, &elc_st)) {
+        munmap(f->map.addr, f->map.size);
+        f->map.addr = MAP_FAILED;
+    }
+
+    if (f->map.addr != MAP_FAILED)
+        f->hashes = prefetch_hashes(f->map);
+    else {
+        /* There is no binary form; read the text for the reader.  */
+        struct elb_map text = prefetch_map(f->elc);
+        if (text.addr != MAP_FAILED)
+            munmap(text.addr, text.size);
+    }
+}
+
+static void* prefetch_worker(void* arg) {
+    struct prefetch* pf = arg;
+    sys_thread_set_name("load-prefetch");
+    sys_mutex_lock(&pf->mutex);
+    while (!pf->stop && pf->next < pf->nfiles) {
+        if (pf->next - pf->loading >= PREFETCH_WINDOW) {
+            sys_cond_wait(&pf->cond, &pf->mutex);
+            continue;
+        }
+        struct prefetch_file* f = &pf->files[pf->next++];
+        sys_mutex_unlock(&pf->mutex);
+        prefetch_one(f);
+        sys_mutex_lock(&pf->mutex);
+        f->done = true;
+        sys_cond_broadcast(&pf->cond);
+    }
+    pf->nworkers--;
+    sys_cond_broadcast(&pf->cond);
+    sys_mutex_unlock(&pf->mutex);
+    return NULL;
+}
+
+static void prefetch_finish(void* arg) {
+    struct prefetch* pf = arg;
+    sys_mutex_lock(&pf->mutex);
+    pf->stop = true;
+    sys_cond_broadcast(&pf->cond);
+    while (pf->nworkers > 0)
+        sys_cond_wait(&pf->cond, &pf->mutex);
+    sys_mutex_unlock(&pf->mutex);
+    sys_cond_destroy(&pf->cond);
+
+    current_prefetch_file = NULL;
+    for (ptrdiff_t i = 0; i < pf->nfiles; i++) {
+        struct prefetch_file* f = &pf->files[i];
+        if (f->map.addr != MAP_FAILED)
+            munmap(f->map.addr, f->map.size);
+        free(f->hashes);
+        xfree(f->elc);
+    }
+    xfree(pf->files);
+}
+
+DEFUN ("load-files", Fload_files, Sload_files, 1, 2, 0,
+       doc: /* Load each of FILES in turn, as `load' would.
+FILES is a list of absolute file names, such as a manifest of the
+compiled files Emacs loads at startup.  While one file is evaluated,
+the following ones are read ahead on background threads, together
+with their binary forms (see `write-elb-file').  NOMESSAGE is as for
+`load'.  Return nil.  */)
+(Lisp_Object files, Lisp_Object nomessage) {
+    specpdl_ref count = SPECPDL_INDEX();
+    ptrdiff_t nfiles = list_length(files);
+    struct prefetch pf = {.nfiles = nfiles};
+
+    pf.files = xzalloc(nfiles * sizeof *pf.files);
+    for (ptrdiff_t i = 0; i < nfiles; i++)
+        pf.files[i].map.addr = MAP_FAILED;
+    sys_mutex_init(&pf.mutex);
+    sys_cond_init(&pf.cond);
+    record_unwind_protect_ptr(prefetch_finish, &pf);
+
+    Lisp_Object tail = files;
+    for (ptrdiff_t i = 0; i < nfiles; i++, tail = XCDR(tail)) {
+        Lisp_Object file = XCAR(tail);
+        CHECK_STRING(file);
+        Lisp_Object elc = Fexpand_file_name(file, Qnil);
+        if (!suffix_p(elc, ".elc"))
+            elc = concat2(elc, build_string(".elc"));
+        pf.files[i].elc = xstrdup(SSDATA(ENCODE_FILE(elc)));
+    }
+
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    ptrdiff_t nworkers = min(min(ncpus - 1, PREFETCH_MAX_WORKERS), nfiles);
+    for (ptrdiff_t i = 0; i < nworkers; i++) {
+        sys_thread_t thread;
+        sys_mutex_lock(&pf.mutex);
+        pf.nworkers++;
+        sys_mutex_unlock(&pf.mutex);
+        if (!sys_thread_create(&thread, prefetch_worker, &pf)) {
+            sys_mutex_lock(&pf.mutex);
+            pf.nworkers--;
+            sys_mutex_unlock(&pf.mutex);
+            break;
+        }
+    }
+
+    tail = files;
+    for (ptrdiff_t i = 0; i < nfiles && CONSP(tail); i++, tail = XCDR(tail)) {
+        struct prefetch_file* f = &pf.files[i];
+        sys_mutex_lock(&pf.mutex);
+        pf.loading = i;
+        sys_cond_broadcast(&pf.cond);
+        while (!f->done && pf.nworkers > 0)
+            sys_cond_wait(&pf.cond, &pf.mutex);
+        bool done = f->done;
+        sys_mutex_unlock(&pf.mutex);
+
+        current_prefetch_file = done ? f : NULL;
+        Fload(XCAR(tail), Qnil, nomessage, Qnil, Qnil);
+        current_prefetch_file = NULL;
+    }
+
+    return unbind_to(count, Qnil);
+}
+
 DEFUN ("eval-buffer", Feval_buffer, Seval_buffer, 0, 5, "",
        doc: /* Execute the accessible portion of current buffer as Lisp code.
 You can use \\[narrow-to-region] to limit the part of buffer to be evaluated.
@@ -3885,17 +5144,21 @@ read_obj:;
                 ptrdiff_t longhand_bytes = 0;
 
                 Lisp_Object found;
+                EMACS_UINT hash;
                 if (skip_shorthand
                     /* We exempt characters used in the "core" Emacs Lisp
                        symbols that are comprised entirely of characters
                        that have the 'symbol constituent' syntax from
                        transforming according to shorthands.  */
-                    || symbol_char_span(rb.start) >= nbytes)
-                    found = oblookup(obarray, rb.start, nchars, nbytes);
+                    || symbol_char_span(rb.start) >= nbytes) {
+                    hash = hash_char_array(rb.start, nbytes);
+                    found = oblookup_hashed(obarray, rb.start, nchars,
+                                            nbytes, hash);
+                }
                 else
                     found = oblookup_considering_shorthand(
                         obarray, rb.start, nchars, nbytes, &longhand,
-                        &longhand_chars, &longhand_bytes);
+                        &longhand_chars, &longhand_bytes, &hash);
 
                 if (BARE_SYMBOL_P(found))
                     result = found;
@@ -3904,12 +5167,12 @@ read_obj:;
                         longhand, longhand_chars, longhand_bytes,
                         source->multibyte);
                     xfree(longhand);
-                    result = intern_driver(name, obarray, found);
+                    result = intern_hashed(name, obarray, found, hash);
                 }
                 else {
                     Lisp_Object name = make_specified_string(
                         rb.start, nchars, nbytes, source->multibyte);
-                    result = intern_driver(name, obarray, found);
+                    result = intern_hashed(name, obarray, found, hash);
                 }
             }
             if (locate_syms && !NILP(result))
@@ -4277,8 +5540,6 @@ Lisp_Object string_to_number(char const* string, int base, ptrdiff_t* plen) {
 }
 
 
-static Lisp_Object initial_obarray;
-
 static Lisp_Object make_obarray(unsigned bits);
 
 /* Slow path obarray check: return the obarray to use or signal an error.  */
@@ -4305,8 +5566,16 @@ Lisp_Object check_obarray_slow(Lisp_Object obarray) {
 }
 
 static void grow_obarray(struct Lisp_Obarray* o);
+static ptrdiff_t obarray_index(struct Lisp_Obarray* oa, EMACS_UINT hash);
+
+/* Tag of an obarray bucket with a symbol whose name has hash code HASH.  */
+static unsigned char obarray_tag(EMACS_UINT hash) {
+    return OBARRAY_TAG_SYMBOL | (hash & (OBARRAY_TAG_SYMBOL - 1));
+}
 
-/* Intern symbol SYM in OBARRAY using bucket INDEX.  */
+/* Intern symbol SYM in OBARRAY using bucket INDEX, as returned by
+   oblookup for its name.  No symbol must have been added to OBARRAY
+   since.  */
 
 /* FIXME: retype arguments as pure C types */
 static Lisp_Object intern_sym(Lisp_Object sym, Lisp_Object obarray,
@@ -4327,11 +5596,18 @@ static Lisp_Object intern_sym(Lisp_Object sym, Lisp_Object obarray,
     }
 
     struct Lisp_Obarray* o = XOBARRAY(obarray);
-    Lisp_Object* ptr = o->buckets + XFIXNUM(index);
-    s->u.s.next = BARE_SYMBOL_P(*ptr) ? XBARE_SYMBOL(*ptr) : NULL;
-    *ptr = sym;
+    ptrdiff_t idx = XFIXNUM(index);
+    unsigned char* tags = obarray_tags(o);
+    eassert(!(tags[idx] & OBARRAY_TAG_SYMBOL));
+    s->u.s.hash = sxhash_string(s->u.s.name);
+    if (tags[idx] == OBARRAY_TAG_DELETED)
+        o->deleted--;
+    tags[idx] = obarray_tag(s->u.s.hash);
+    o->buckets[idx] = sym;
     o->count++;
-    if (o->count > obarray_size(o))
+    /* Keep a quarter of the buckets empty, so that searches for absent
+       symbols stop soon.  */
+    if ((o->count + o->deleted) > obarray_size(o) / 4 * 3)
         grow_obarray(o);
     return sym;
 }
@@ -4344,30 +5620,43 @@ Lisp_Object intern_driver(Lisp_Object string, Lisp_Object obarray,
     return intern_sym(Fmake_symbol(string), obarray, index);
 }
 
+/* Like intern_driver, where INDEX comes from an oblookup_hashed for
+   STRING's data with hash HASH.  Cache HASH in STRING so that
+   intern_sym need not compute it again.  */
+
+static Lisp_Object intern_hashed(Lisp_Object string, Lisp_Object obarray,
+                                 Lisp_Object index, EMACS_UINT hash) {
+    XSTRING(string)->u.s.hash = hash;
+    return intern_driver(string, obarray, index);
+}
+
 /* Intern the C string STR: return a symbol with that name,
    interned in the current obarray.  */
 
 Lisp_Object intern_1(const char* str, ptrdiff_t len) {
     Lisp_Object obarray = check_obarray(Vobarray);
-    Lisp_Object tem = oblookup(obarray, str, len, len);
+    EMACS_UINT hash = hash_char_array(str, len);
+    Lisp_Object tem = oblookup_hashed(obarray, str, len, len, hash);
 
     return (BARE_SYMBOL_P(tem)
                 ? tem
                 /* The above `oblookup' was done on the basis of nchars==nbytes,
                    so the string has to be unibyte.  */
-                : intern_driver(make_unibyte_string(str, len), obarray, tem));
+                : intern_hashed(make_unibyte_string(str, len), obarray, tem,
+                                hash));
 }
 
 Lisp_Object intern_c_string_1(const char* str, ptrdiff_t len) {
     Lisp_Object obarray = check_obarray(Vobarray);
-    Lisp_Object tem = oblookup(obarray, str, len, len);
+    EMACS_UINT hash = hash_char_array(str, len);
+    Lisp_Object tem = oblookup_hashed(obarray, str, len, len, hash);
 
     if (!BARE_SYMBOL_P(tem)) {
         Lisp_Object string;
 
         string = make_string(str, len);
 
-        tem = intern_driver(string, obarray, tem);
+        tem = intern_hashed(string, obarray, tem, hash);
     }
     return tem;
 }
@@ -4376,11 +5665,12 @@ Lisp_Object intern_c_string_1(const char* str, ptrdiff_t len) {
 Lisp_Object intern_c_multibyte(const char* str, ptrdiff_t nchars,
                                ptrdiff_t nbytes) {
     Lisp_Object obarray = check_obarray(Vobarray);
-    Lisp_Object sym = oblookup(obarray, str, nchars, nbytes);
+    EMACS_UINT hash = hash_char_array(str, nbytes);
+    Lisp_Object sym = oblookup_hashed(obarray, str, nchars, nbytes, hash);
     if (BARE_SYMBOL_P(sym))
         return sym;
-    return intern_driver(make_multibyte_string(str, nchars, nbytes), obarray,
-                         sym);
+    return intern_hashed(make_multibyte_string(str, nchars, nbytes), obarray,
+                         sym, hash);
 }
 
 static void define_symbol(Lisp_Object sym, char const* str) {
@@ -4391,7 +5681,10 @@ static void define_symbol(Lisp_Object sym, char const* str) {
     /* Qunbound is uninterned, so that it's not confused with any symbol
        'unbound' created by a Lisp program.  */
     if (!BASE_EQ(sym, Qunbound)) {
-        Lisp_Object bucket = oblookup(initial_obarray, str, len, len);
+        EMACS_UINT hash = hash_char_array(str, len);
+        Lisp_Object bucket =
+            oblookup_hashed(initial_obarray, str, len, len, hash);
+        XSTRING(string)->u.s.hash = hash;
         eassert(FIXNUMP(bucket));
         intern_sym(sym, initial_obarray, bucket);
     }
@@ -4412,19 +5705,20 @@ it defaults to the value of `obarray'.  */)
     char* longhand = NULL;
     ptrdiff_t longhand_chars = 0;
     ptrdiff_t longhand_bytes = 0;
+    EMACS_UINT hash;
     tem = oblookup_considering_shorthand(
         obarray, SSDATA(string), SCHARS(string), SBYTES(string), &longhand,
-        &longhand_chars, &longhand_bytes);
+        &longhand_chars, &longhand_bytes, &hash);
 
     if (!BARE_SYMBOL_P(tem)) {
         if (longhand) {
-            tem = intern_driver(
+            tem = intern_hashed(
                 make_multibyte_string(longhand, longhand_chars, longhand_bytes),
-                obarray, tem);
+                obarray, tem, hash);
             xfree(longhand);
         }
         else
-            tem = intern_driver(string, obarray, tem);
+            tem = intern_hashed(string, obarray, tem, hash);
     }
     return tem;
 }
@@ -4446,12 +5740,13 @@ it defaults to the value of `obarray'.  */)
         char* longhand = NULL;
         ptrdiff_t longhand_chars = 0;
         ptrdiff_t longhand_bytes = 0;
+        EMACS_UINT hash;
 
         CHECK_STRING(name);
         string = name;
         tem = oblookup_considering_shorthand(
             obarray, SSDATA(string), SCHARS(string), SBYTES(string), &longhand,
-            &longhand_chars, &longhand_bytes);
+            &longhand_chars, &longhand_bytes, &hash);
         if (longhand)
             xfree(longhand);
         return FIXNUMP(tem) ? Qnil : tem;
@@ -4466,10 +5761,8 @@ it defaults to the value of `obarray'.  */)
     }
 }
 
-/* Bucket index of the string STR of length SIZE_BYTE bytes in obarray OA.  */
-static ptrdiff_t obarray_index(struct Lisp_Obarray* oa, const char* str,
-                               ptrdiff_t size_byte) {
-    EMACS_UINT hash = hash_char_array(str, size_byte);
+/* First bucket to look at in obarray OA for a name with hash code HASH.  */
+static ptrdiff_t obarray_index(struct Lisp_Obarray* oa, EMACS_UINT hash) {
     return knuth_hash(reduce_emacs_uint_to_hash_hash(hash), oa->size_bits);
 }
 
@@ -4492,9 +5785,10 @@ OBARRAY, if nil, defaults to the value of the variable `obarray'.  */)
         char* longhand = NULL;
         ptrdiff_t longhand_chars = 0;
         ptrdiff_t longhand_bytes = 0;
+        EMACS_UINT hash;
         sym = oblookup_considering_shorthand(
             obarray, SSDATA(name), SCHARS(name), SBYTES(name), &longhand,
-            &longhand_chars, &longhand_bytes);
+            &longhand_chars, &longhand_bytes, &hash);
         xfree(longhand);
         if (FIXNUMP(sym))
             return Qnil;
@@ -4506,30 +5800,25 @@ OBARRAY, if nil, defaults to the value of the variable `obarray'.  */)
        unusable.  We don't try to prevent such mistakes here.  */
 
     struct Lisp_Obarray* o = XOBARRAY(obarray);
-    Lisp_Object symname = SYMBOL_NAME(sym);
-    ptrdiff_t idx = obarray_index(o, SSDATA(symname), SBYTES(symname));
-    Lisp_Object* loc = &o->buckets[idx];
-    if (BASE_EQ(*loc, make_fixnum(0)))
-        return Qnil;
+    EMACS_UINT hash = XBARE_SYMBOL(sym)->u.s.hash;
+    ptrdiff_t mask = obarray_size(o) - 1;
+    unsigned char* tags = obarray_tags(o);
+    ptrdiff_t idx;
+
+    for (idx = obarray_index(o, hash); !BASE_EQ(o->buckets[idx], sym);
+         idx = (idx + 1) & mask)
+        if (tags[idx] == OBARRAY_TAG_EMPTY)
+            return Qnil;
 
-    struct Lisp_Symbol* s = XBARE_SYMBOL(sym);
-    struct Lisp_Symbol* prev = XBARE_SYMBOL(*loc);
-    if (prev == s)
-        *loc = s->u.s.next ? make_lisp_symbol(s->u.s.next) : make_fixnum(0);
+    /* The bucket can be empty again if no search goes past it.  */
+    o->buckets[idx] = make_fixnum(0);
+    if (tags[(idx + 1) & mask] == OBARRAY_TAG_EMPTY)
+        tags[idx] = OBARRAY_TAG_EMPTY;
     else {
-        do {
-            struct Lisp_Symbol* next = prev->u.s.next;
-            if (next == s) {
-                prev->u.s.next = next->u.s.next;
-                goto removed;
-            }
-            prev = next;
-        } while (prev);
-        return Qnil;
+        tags[idx] = OBARRAY_TAG_DELETED;
+        o->deleted++;
     }
-
-removed:
-    s->u.s.interned = SYMBOL_UNINTERNED;
+    XBARE_SYMBOL(sym)->u.s.interned = SYMBOL_UNINTERNED;
     o->count--;
     return Qt;
 }
@@ -4542,24 +5831,35 @@ removed:
 
 Lisp_Object oblookup(Lisp_Object obarray, register const char* ptr,
                      ptrdiff_t size, ptrdiff_t size_byte) {
-    struct Lisp_Obarray* o = XOBARRAY(obarray);
-    ptrdiff_t idx = obarray_index(o, ptr, size_byte);
-    Lisp_Object bucket = o->buckets[idx];
+    return oblookup_hashed(obarray, ptr, size, size_byte,
+                           hash_char_array(ptr, size_byte));
+}
 
-    if (!BASE_EQ(bucket, make_fixnum(0))) {
-        Lisp_Object sym = bucket;
-        while (1) {
-            struct Lisp_Symbol* s = XBARE_SYMBOL(sym);
+/* Like oblookup, for a name whose hash_char_array is HASH.  */
+static Lisp_Object oblookup_hashed(Lisp_Object obarray, const char* ptr,
+                                   ptrdiff_t size, ptrdiff_t size_byte,
+                                   EMACS_UINT hash) {
+    struct Lisp_Obarray* o = XOBARRAY(obarray);
+    unsigned char tag = obarray_tag(hash);
+    unsigned char* tags = obarray_tags(o);
+    ptrdiff_t mask = obarray_size(o) - 1;
+    ptrdiff_t deleted = -1;
+
+    /* There is always an empty bucket to end the search.  */
+    for (ptrdiff_t idx = obarray_index(o, hash);; idx = (idx + 1) & mask) {
+        if (tags[idx] == tag) {
+            struct Lisp_Symbol* s = XBARE_SYMBOL(o->buckets[idx]);
             Lisp_Object name = s->u.s.name;
-            if (SBYTES(name) == size_byte && SCHARS(name) == size &&
+            if (s->u.s.hash == hash && SBYTES(name) == size_byte &&
+                SCHARS(name) == size &&
                 memcmp(SDATA(name), ptr, size_byte) == 0)
-                return sym;
-            if (s->u.s.next == NULL)
-                break;
-            sym = make_lisp_symbol(s->u.s.next);
+                return o->buckets[idx];
         }
+        else if (tags[idx] == OBARRAY_TAG_EMPTY)
+            return make_fixnum(deleted < 0 ? idx : deleted);
+        else if (tags[idx] == OBARRAY_TAG_DELETED && deleted < 0)
+            deleted = idx;
     }
-    return make_fixnum(idx);
 }
 
 /* Like 'oblookup', but considers 'Vread_symbol_shorthands',
@@ -4569,12 +5869,14 @@ Lisp_Object oblookup(Lisp_Object obarray, register const char* ptr,
    SIZE_OUT and SIZE_BYTE_OUT respectively hold the character and byte
    sizes of the transformed symbol name.  If IN is not recognized
    shorthand for any other symbol, OUT is set to point to NULL and
-   'oblookup' is called.  */
+   'oblookup' is called.  Either way, *HASH is set to the hash of the
+   name that was looked up.  */
 
 Lisp_Object oblookup_considering_shorthand(Lisp_Object obarray, const char* in,
                                            ptrdiff_t size, ptrdiff_t size_byte,
                                            char** out, ptrdiff_t* size_out,
-                                           ptrdiff_t* size_byte_out) {
+                                           ptrdiff_t* size_byte_out,
+                                           EMACS_UINT* hash) {
     Lisp_Object tail = Vread_symbol_shorthands;
 
     /* First, assume no transformation will take place.  */
@@ -4616,10 +5918,13 @@ Lisp_Object oblookup_considering_shorthand(Lisp_Object obarray, const char* in,
        lookup.  That function remains oblivious to whether a
        transformation happened here or not, but the caller of this
        function can tell by inspecting the OUT parameter.  */
-    if (*out)
-        return oblookup(obarray, *out, *size_out, *size_byte_out);
-    else
-        return oblookup(obarray, in, size, size_byte);
+    if (*out) {
+        *hash = hash_char_array(*out, *size_byte_out);
+        return oblookup_hashed(obarray, *out, *size_out, *size_byte_out,
+                               *hash);
+    }
+    *hash = hash_char_array(in, size_byte);
+    return oblookup_hashed(obarray, in, size, size_byte, *hash);
 }
 
 
@@ -4627,14 +5932,21 @@ static struct Lisp_Obarray* allocate_obarray(void) {
     return ALLOCATE_PLAIN_PSEUDOVECTOR(struct Lisp_Obarray, PVEC_OBARRAY);
 }
 
-static Lisp_Object make_obarray(unsigned bits) {
-    struct Lisp_Obarray* o = allocate_obarray();
-    o->count = 0;
+/* Allocate empty buckets for obarray O with 2**BITS buckets.  */
+static void alloc_obarray_buckets(struct Lisp_Obarray* o, unsigned bits) {
     o->size_bits = bits;
-    ptrdiff_t size = (ptrdiff_t)1 << bits;
-    o->buckets = hash_table_alloc_bytes(size * sizeof *o->buckets);
+    o->count = 0;
+    o->deleted = 0;
+    o->buckets = hash_table_alloc_bytes(obarray_bytes(o));
+    ptrdiff_t size = obarray_size(o);
     for (ptrdiff_t i = 0; i < size; i++)
         o->buckets[i] = make_fixnum(0);
+    memset(obarray_tags(o), OBARRAY_TAG_EMPTY, size);
+}
+
+static Lisp_Object make_obarray(unsigned bits) {
+    struct Lisp_Obarray* o = allocate_obarray();
+    alloc_obarray_buckets(o, bits);
     return make_lisp_obarray(o);
 }
 
@@ -4646,42 +5958,38 @@ enum
         min(8 * sizeof(int), 8 * sizeof(ptrdiff_t) - word_size_log2) - 1,
 };
 
+/* Make room in obarray O, either by doubling its size or, if many of
+   its buckets had symbols that were removed, by reinserting its symbols
+   into new buckets of the same size.  */
 static void grow_obarray(struct Lisp_Obarray* o) {
     ptrdiff_t old_size = obarray_size(o);
-    eassert(o->count > old_size);
+    ptrdiff_t old_bytes = obarray_bytes(o);
+    unsigned count = o->count;
     Lisp_Object* old_buckets = o->buckets;
 
-    int new_bits = o->size_bits + 1;
+    int new_bits = o->size_bits + (count > old_size / 2);
     if (new_bits > obarray_max_bits)
         error("Obarray too big");
-    ptrdiff_t new_size = (ptrdiff_t)1 << new_bits;
-    o->buckets = hash_table_alloc_bytes(new_size * sizeof *o->buckets);
-    for (ptrdiff_t i = 0; i < new_size; i++)
-        o->buckets[i] = make_fixnum(0);
-    o->size_bits = new_bits;
+    alloc_obarray_buckets(o, new_bits);
+    o->count = count;
 
-    /* Rehash symbols.
-       FIXME: this is expensive since we need to recompute the hash for every
-       symbol name.  Would it be reasonable to store it in the symbol?  */
+    /* Reinsert the symbols, using the hash codes of their names that
+       they remember.  */
+    ptrdiff_t mask = obarray_size(o) - 1;
+    unsigned char* tags = obarray_tags(o);
     for (ptrdiff_t i = 0; i < old_size; i++) {
         Lisp_Object obj = old_buckets[i];
         if (BARE_SYMBOL_P(obj)) {
-            struct Lisp_Symbol* s = XBARE_SYMBOL(obj);
-            while (1) {
-                Lisp_Object name = s->u.s.name;
-                ptrdiff_t idx = obarray_index(o, SSDATA(name), SBYTES(name));
-                Lisp_Object* loc = o->buckets + idx;
-                struct Lisp_Symbol* next = s->u.s.next;
-                s->u.s.next = BARE_SYMBOL_P(*loc) ? XBARE_SYMBOL(*loc) : NULL;
-                *loc = make_lisp_symbol(s);
-                if (next == NULL)
-                    break;
-                s = next;
-            }
+            EMACS_UINT hash = XBARE_SYMBOL(obj)->u.s.hash;
+            ptrdiff_t idx = obarray_index(o, hash);
+            while (tags[idx] != OBARRAY_TAG_EMPTY)
+                idx = (idx + 1) & mask;
+            tags[idx] = obarray_tag(hash);
+            o->buckets[idx] = obj;
         }
     }
 
-    hash_table_free_bytes(old_buckets, old_size * sizeof *old_buckets);
+    hash_table_free_bytes(old_buckets, old_bytes);
 }
 
 DEFUN ("obarray-make", Fobarray_make, Sobarray_make, 0, 1, 0,
@@ -4695,7 +6003,8 @@ given, is only a hint for the expected number.  */)
     else {
         CHECK_FIXNAT(size);
         EMACS_UINT n = XFIXNUM(size);
-        bits = elogb(n) + 1;
+        /* Leave room for N symbols without growing.  */
+        bits = elogb(n + n / 3) + 1;
         if (bits > obarray_max_bits)
             xsignal(Qargs_out_of_range, size);
     }
@@ -4714,18 +6023,10 @@ DEFUN("obarray-clear", Fobarray_clear, Sobarray_clear, 1, 1, 0,
 
     /* This function does not bother setting the status of its contained symbols
        to uninterned.  It doesn't matter very much.  */
-    int new_bits = obarray_default_bits;
-    int new_size = (ptrdiff_t)1 << new_bits;
-    Lisp_Object* new_buckets =
-        hash_table_alloc_bytes(new_size * sizeof *new_buckets);
-    for (ptrdiff_t i = 0; i < new_size; i++)
-        new_buckets[i] = make_fixnum(0);
-
-    int old_size = obarray_size(o);
-    hash_table_free_bytes(o->buckets, old_size * sizeof *o->buckets);
-    o->buckets = new_buckets;
-    o->size_bits = new_bits;
-    o->count = 0;
+    Lisp_Object* old_buckets = o->buckets;
+    ptrdiff_t old_bytes = obarray_bytes(o);
+    alloc_obarray_buckets(o, obarray_default_bits);
+    hash_table_free_bytes(old_buckets, old_bytes);
 
     return Qnil;
 }
@@ -4755,26 +6056,56 @@ OBARRAY defaults to the value of `obarray'.  */)
 
 DEFUN("internal--obarray-buckets", Finternal__obarray_buckets,
       Sinternal__obarray_buckets, 1, 1, 0,
-      doc:/* Symbols in each bucket of OBARRAY.  Internal use only.  */)
+      doc:/* Symbols of OBARRAY grouped by the bucket where a search for them starts.
+Internal use only.  */)
 (Lisp_Object obarray) {
     obarray = check_obarray(obarray);
-    ptrdiff_t size = obarray_size(XOBARRAY(obarray));
+    struct Lisp_Obarray* o = XOBARRAY(obarray);
+    ptrdiff_t size = obarray_size(o);
+    Lisp_Object groups = make_nil_vector(size);
 
+    for (ptrdiff_t i = size - 1; i >= 0; i--) {
+        Lisp_Object sym = o->buckets[i];
+        if (BARE_SYMBOL_P(sym)) {
+            ptrdiff_t idx = obarray_index(o, XBARE_SYMBOL(sym)->u.s.hash);
+            ASET(groups, idx, Fcons(sym, AREF(groups, idx)));
+        }
+    }
     Lisp_Object ret = Qnil;
+    for (ptrdiff_t i = size - 1; i >= 0; i--)
+        ret = Fcons(AREF(groups, i), ret);
+    return ret;
+}
+
+DEFUN("internal--obarray-stats", Finternal__obarray_stats,
+      Sinternal__obarray_stats, 1, 1, 0,
+      doc:/* Occupancy and probe lengths of OBARRAY.  Internal use only.
+The value is a list (COUNT SIZE DELETED HISTOGRAM).  COUNT is the
+number of symbols, SIZE the number of buckets and DELETED the number
+of buckets whose symbol was removed.  HISTOGRAM is an alist of
+elements (PROBES . N), where N is the number of symbols that are
+found after looking at PROBES buckets.  */)
+(Lisp_Object obarray) {
+    obarray = check_obarray(obarray);
+    struct Lisp_Obarray* o = XOBARRAY(obarray);
+    ptrdiff_t size = obarray_size(o);
+    ptrdiff_t* freq = xzalloc(size * sizeof *freq);
+
     for (ptrdiff_t i = 0; i < size; i++) {
-        Lisp_Object bucket = Qnil;
-        Lisp_Object sym = XOBARRAY(obarray)->buckets[i];
-        if (BARE_SYMBOL_P(sym))
-            while (1) {
-                bucket = Fcons(sym, bucket);
-                struct Lisp_Symbol* s = XBARE_SYMBOL(sym)->u.s.next;
-                if (!s)
-                    break;
-                sym = make_lisp_symbol(s);
-            }
-        ret = Fcons(Fnreverse(bucket), ret);
+        Lisp_Object sym = o->buckets[i];
+        if (BARE_SYMBOL_P(sym)) {
+            ptrdiff_t idx = obarray_index(o, XBARE_SYMBOL(sym)->u.s.hash);
+            freq[(i - idx) & (size - 1)]++;
+        }
     }
-    return Fnreverse(ret);
+    Lisp_Object histogram = Qnil;
+    for (ptrdiff_t i = size - 1; i >= 0; i--)
+        if (freq[i] > 0)
+            histogram =
+                Fcons(Fcons(make_int(i + 1), make_int(freq[i])), histogram);
+    xfree(freq);
+    return list4(make_int(o->count), make_int(size), make_int(o->deleted),
+                 histogram);
 }
 
 void init_obarray_once(void) {
@@ -5115,11 +6446,14 @@ void syms_of_lread(void) {
     defsubr(&Sunintern);
     defsubr(&Sget_load_suffixes);
     defsubr(&Sload);
+    defsubr(&Swrite_elb_file);
+    defsubr(&Sload_files);
     defsubr(&Seval_buffer);
     defsubr(&Seval_region);
     defsubr(&Smapatoms);
     defsubr(&Slocate_file_internal);
     defsubr(&Sinternal__obarray_buckets);
+    defsubr(&Sinternal__obarray_stats);
     defsubr(&Sobarray_make);
     defsubr(&Sobarrayp);
     defsubr(&Sobarray_clear);
@@ -5377,6 +6711,12 @@ Note that if you customize this, obviously it will not affect files
 that are loaded before your customizations are read!  */);
     load_prefer_newer = 0;
 
+    DEFVAR_BOOL ("load-use-elb-files", load_use_elb_files,
+               doc: /* Non-nil means `load' uses binary compiled files.
+When loading FOO.elc, if there is a file FOO.elb that `write-elb-file'
+wrote from the current FOO.elc, read the forms from it instead.  */);
+    load_use_elb_files = true;
+
     DEFVAR_BOOL ("load-no-native", load_no_native,
                doc: /* Non-nil means not to load native code unless explicitly requested.
 
@@ -5443,6 +6783,9 @@ will use instead of `load-path' to look for the file to load.  */);
     staticpro(&read_objects_completed);
     read_objects_completed = Qnil;
 
+    staticpro(&elb_pending_closures);
+    elb_pending_closures = Qnil;
+
     Vloads_in_progress = Qnil;
     staticpro(&Vloads_in_progress);
 
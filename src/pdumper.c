@@ -21,6 +21,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include <fcntl.h>
 #include <limits.h>
 #include <math.h>
+#include <signal.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -315,6 +316,20 @@ enum reloc_phase
     RELOC_NUM_PHASES
 };
 
+/* How the target of an early relocation of an address depends on
+   where the dump and the Emacs image are loaded.  */
+enum dump_reloc_class
+{
+    /* Raw pointers and Lisp_Objects that point into the dump.  */
+    RELOC_CLASS_DUMP,
+    /* Raw pointers and Lisp_Objects that point into Emacs.  */
+    RELOC_CLASS_EMACS,
+    /* Symbols in the dump.  A symbol's Lisp_Object is its offset from
+       lispsym, so these move with the dump and against Emacs.  */
+    RELOC_CLASS_DUMP_SYMBOL,
+    NUMBER_RELOC_CLASSES
+};
+
 /* Format of an Emacs dump file.  All offsets are relative to
    the beginning of the file.  An Emacs dump file is coupled
    to exactly the Emacs binary that produced it, so details of
@@ -328,7 +343,9 @@ enum reloc_phase
    The dump file can be loaded at arbitrary locations in memory, so it
    includes a table of relocations that let Emacs adjust the pointers
    embedded in the dump file to account for the location where it was
-   actually loaded.
+   actually loaded.  The pointers are stored as they are when the dump
+   is loaded at a preferred address, so that a dump loaded there needs
+   few of them or none, and its pages stay shared with the file.
 
    Dump files can contain pointers to other objects in the dump file
    or to parts of the Emacs binary.  */
@@ -340,9 +357,18 @@ struct dump_header {
     unsigned char fingerprint[sizeof fingerprint];
 
     /* Relocation table for the dump file; each entry is a
-       struct dump_reloc.  */
+       struct dump_reloc.  The early relocations of addresses are not
+       here but in ADDRESS_RELOCS.  */
     struct dump_table_locator dump_relocs[RELOC_NUM_PHASES];
 
+    /* The early relocations of addresses, by dump_reloc_class.  The
+       dump holds their targets as they are when the dump is loaded at
+       BASE and emacs_basis () is EMACS_BASIS, so the loader applies a
+       class only if its targets moved.  */
+    struct dump_table_locator address_relocs[NUMBER_RELOC_CLASSES];
+    uintptr_t base;
+    uintptr_t emacs_basis;
+
     /* "Relocation" table we abuse to hold information about the
        location and type of each lisp object in the dump.  We need for
        pdumper_object_type and ultimately for conservative GC
@@ -473,6 +499,11 @@ struct dump_context {
     Lisp_Object old_purify_flag;
     Lisp_Object old_post_gc_hook;
     Lisp_Object old_process_environment;
+    Lisp_Object old_buffer_alist;
+
+    /* True if dumping a snapshot of a session in use; see
+       dump_session_object_p.  */
+    bool snapshot;
 
 #ifdef REL_ALLOC
     bool blocked_ralloc;
@@ -526,6 +557,9 @@ struct dump_context {
     /* Relocations in the dump.  */
     Lisp_Object dump_relocs[RELOC_NUM_PHASES];
 
+    /* Early relocations of addresses in the dump, by class.  */
+    Lisp_Object address_relocs[NUMBER_RELOC_CLASSES];
+
     /* Object starts.  */
     Lisp_Object object_starts;
 
@@ -655,6 +689,17 @@ static AVOID error_unsupported_dump_object(struct dump_context* ctx,
 
 static uintptr_t emacs_basis(void) { return (uintptr_t)&Vpurify_flag; }
 
+/* Return the address at which we would like dumps to be loaded, or 0
+   if there is none.  It is far from where systems put executables,
+   heaps and stacks, so that it is usually free.  */
+static uintptr_t dump_preferred_base(void) {
+#if INTPTR_MAX <= INT32_MAX
+    return 0;
+#else
+    return (uintptr_t)1 << 45;
+#endif
+}
+
 static void* emacs_ptr_at(const ptrdiff_t offset) {
     /* TODO: assert somehow that the result is actually in the Emacs
        image.  */
@@ -681,6 +726,54 @@ static bool dump_builtin_symbol_p(Lisp_Object object) {
     return BARE_SYMBOL_P(object) && c_symbol_p(XSYMBOL(object));
 }
 
+/* Whether OBJECT belongs to the running session rather than to its
+   configuration, so that a snapshot leaves it out and has nil wherever
+   the session refers to it.  That is the buffers other than those that
+   came from the dump Emacs started with, overlays, frames and windows,
+   processes, threads, and other handles on the world outside.  */
+static bool dump_session_object_p(Lisp_Object object) {
+    if (!VECTORLIKEP(object))
+        return false;
+    const struct Lisp_Vector* v = XVECTOR(object);
+    switch (PSEUDOVECTOR_TYPE(v)) {
+    case PVEC_BUFFER:
+        return !(BUFFER_LIVE_P(XBUFFER(object)) &&
+                 pdumper_object_p(XBUFFER(object)));
+    case PVEC_FONT:
+        return ((v->header.size & PSEUDOVECTOR_SIZE_MASK) != FONT_SPEC_MAX &&
+                (v->header.size & PSEUDOVECTOR_SIZE_MASK) != FONT_ENTITY_MAX);
+    case PVEC_THREAD:
+        return !main_thread_p(v);
+    case PVEC_OVERLAY:
+    case PVEC_FRAME:
+    case PVEC_WINDOW:
+    case PVEC_PROCESS:
+    case PVEC_TERMINAL:
+    case PVEC_WINDOW_CONFIGURATION:
+    case PVEC_OTHER:
+    case PVEC_XWIDGET:
+    case PVEC_XWIDGET_VIEW:
+    case PVEC_MISC_PTR:
+    case PVEC_USER_PTR:
+    case PVEC_MUTEX:
+    case PVEC_CONDVAR:
+    case PVEC_CHANNEL:
+    case PVEC_SQLITE:
+    case PVEC_MODULE_FUNCTION:
+    case PVEC_TS_PARSER:
+    case PVEC_TS_NODE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* Whether OBJECT is left out of what CTX dumps.  */
+static bool dump_excluded_p(const struct dump_context* ctx,
+                            Lisp_Object object) {
+    return ctx->snapshot && dump_session_object_p(object);
+}
+
 /* Return whether OBJECT has the same bit pattern in all Emacs
    invocations --- i.e., is invariant across a dump.  Note that some
    self-representing objects still need to be dumped!
@@ -1393,6 +1486,8 @@ static void dump_emacs_reloc_to_dump_ptr_raw(struct dump_context* ctx,
 static void dump_emacs_reloc_to_lv(struct dump_context* ctx,
                                    Lisp_Object const* emacs_ptr,
                                    Lisp_Object value) {
+    if (dump_excluded_p(ctx, value))
+        value = Qnil;
     if (dump_object_self_representing_p(value))
         dump_emacs_reloc_immediate_lv(ctx, emacs_ptr, value);
     else {
@@ -1563,6 +1658,8 @@ dump_field_lv_or_rawptr(struct dump_context* ctx, void* out,
 
     if (!is_ptr_raw) {
         memcpy(&value, in_field, sizeof(value));
+        if (dump_excluded_p(ctx, value))
+            value = Qnil;
         if (dump_object_self_representing_p(value)) {
             memcpy(out_field, &value, sizeof(value));
             return;
@@ -1586,6 +1683,8 @@ dump_field_lv_or_rawptr(struct dump_context* ctx, void* out,
         default:
             emacs_abort();
         }
+        if (dump_excluded_p(ctx, value))
+            return; /* Leave the pointer null.  */
     }
 
     /* Now value is the Lisp_Object to which we want to point whether or
@@ -1814,6 +1913,7 @@ static dump_off dump_string(struct dump_context* ctx,
     dump_object_start(ctx, &out, sizeof(out));
     DUMP_FIELD_COPY(&out, string, u.s.size);
     DUMP_FIELD_COPY(&out, string, u.s.size_byte);
+    DUMP_FIELD_COPY(&out, string, u.s.hash);
     if (string->u.s.intervals)
         dump_field_fixup_later(ctx, &out, string, &string->u.s.intervals);
 
@@ -1845,7 +1945,8 @@ static dump_off dump_marker(struct dump_context* ctx,
     dump_pseudovector_lisp_fields(ctx, &out->header, &marker->header);
     DUMP_FIELD_COPY(out, marker, need_adjustment);
     DUMP_FIELD_COPY(out, marker, insertion_type);
-    if (marker->buffer) {
+    if (marker->buffer &&
+        !dump_excluded_p(ctx, make_lisp_ptr(marker->buffer, Lisp_Vectorlike))) {
         dump_field_lv_rawptr(ctx, out, marker, &marker->buffer, Lisp_Vectorlike,
                              WEIGHT_NORMAL);
         dump_field_lv_rawptr(ctx, out, marker, &marker->next, Lisp_Vectorlike,
@@ -2145,8 +2246,7 @@ static dump_off dump_symbol(struct dump_context* ctx, Lisp_Object object,
     }
     dump_field_lv(ctx, &out, symbol, &symbol->u.s.function, WEIGHT_NORMAL);
     dump_field_lv(ctx, &out, symbol, &symbol->u.s.plist, WEIGHT_NORMAL);
-    dump_field_lv_rawptr(ctx, &out, symbol, &symbol->u.s.next, Lisp_Symbol,
-                         WEIGHT_STRONG);
+    DUMP_FIELD_COPY(&out, symbol, u.s.hash);
 
     offset = dump_object_finish(ctx, &out, sizeof(out));
     switch (symbol->u.s.redirect) {
@@ -2251,20 +2351,61 @@ static dump_off dump_vectorlike_generic(struct dump_context* ctx,
     return offset;
 }
 
-/* Return a vector of KEY, VALUE pairs in the given hash table H.
-   No room for growth is included.  */
-static Lisp_Object* hash_table_contents(struct Lisp_Hash_Table* h) {
+/* Whether OBJECT, a key of an `equal' hash table, contains an object
+   left out of the dump at DEPTH or deeper.  The dump would have nil in
+   its place, which could make the key equal to another one.  Keys too
+   deep to look through are assumed to.  */
+static bool dump_key_excludes_p(const struct dump_context* ctx,
+                                Lisp_Object object, int depth) {
+    if (depth > 100)
+        return true;
+    if (dump_excluded_p(ctx, object))
+        return true;
+    if (CONSP(object)) {
+        Lisp_Object tail = object;
+        FOR_EACH_TAIL_SAFE(tail) {
+            if (dump_key_excludes_p(ctx, XCAR(tail), depth + 1))
+                return true;
+        }
+        return !NILP(tail) && dump_key_excludes_p(ctx, tail, depth + 1);
+    }
+    if (MARKERP(object))
+        return (XMARKER(object)->buffer &&
+                dump_excluded_p(ctx, make_lisp_ptr(XMARKER(object)->buffer,
+                                                   Lisp_Vectorlike)));
+    if (VECTORP(object) || RECORDP(object) || CLOSUREP(object)) {
+        ptrdiff_t size = VECTORP(object) ? ASIZE(object) : PVSIZE(object);
+        for (ptrdiff_t i = 0; i < size; i++)
+            if (dump_key_excludes_p(ctx, AREF(object, i), depth + 1))
+                return true;
+    }
+    return false;
+}
+
+/* Return a vector of the entries in the given hash table H, and set
+   H's count to their number.  Only the keys and values are filled in,
+   and no room for growth is included.  Entries that refer to objects
+   left out of the dump are dropped, and so are those of an `equal'
+   table whose key contains one.  */
+static struct hash_table_entry*
+hash_table_contents(struct dump_context* ctx, struct Lisp_Hash_Table* h) {
     ptrdiff_t size = h->count;
-    Lisp_Object* key_and_value =
-        hash_table_alloc_bytes(2 * size * sizeof *key_and_value);
+    struct hash_table_entry* entries =
+        hash_table_alloc_bytes(size * sizeof *entries);
     ptrdiff_t n = 0;
+    bool deep = ctx->snapshot && BASE_EQ(h->test->name, Qequal);
 
     DOHASH(h, k, v) {
-        key_and_value[n++] = k;
-        key_and_value[n++] = v;
+        if (dump_excluded_p(ctx, k) || dump_excluded_p(ctx, v) ||
+            (deep && dump_key_excludes_p(ctx, k, 0)))
+            continue;
+        entries[n].key = k;
+        entries[n].value = v;
+        n++;
     }
+    h->count = n;
 
-    return key_and_value;
+    return entries;
 }
 
 static void dump_hash_table_list(struct dump_context* ctx) {
@@ -2287,13 +2428,13 @@ hash_table_std_test(const struct hash_table_test* t) {
    preparing it for dumping.
    See `hash_table_thaw' for the code that restores the object to a usable
    state. */
-static void hash_table_freeze(struct Lisp_Hash_Table* h) {
-    h->key_and_value = hash_table_contents(h);
-    h->next = NULL;
-    h->hash = NULL;
+static void hash_table_freeze(struct dump_context* ctx,
+                              struct Lisp_Hash_Table* h) {
+    h->entries = hash_table_contents(ctx, h);
     h->index = NULL;
     h->table_size = 0;
     h->index_bits = 0;
+    h->index_deleted = 0;
     h->frozen_test = hash_table_std_test(h->test);
     h->test = NULL;
 }
@@ -2302,16 +2443,20 @@ static dump_off dump_hash_table_contents(struct dump_context* ctx,
                                          struct Lisp_Hash_Table* h) {
     dump_align_output(ctx, DUMP_ALIGNMENT);
     dump_off start_offset = ctx->offset;
-    ptrdiff_t n = 2 * h->count;
+    ptrdiff_t n = h->count;
 
     struct dump_flags old_flags = ctx->flags;
     ctx->flags.pack_objects = true;
 
+    /* The hash codes and free-list links are dumped as zero;
+       hash_table_rehash_thawed recomputes the hash codes, and a thawed
+       table has no free entries.  */
     for (ptrdiff_t i = 0; i < n; i++) {
-        Lisp_Object out;
-        const Lisp_Object* slot = &h->key_and_value[i];
+        struct hash_table_entry out;
+        const struct hash_table_entry* entry = &h->entries[i];
         dump_object_start(ctx, &out, sizeof out);
-        dump_field_lv(ctx, &out, slot, slot, WEIGHT_STRONG);
+        dump_field_lv(ctx, &out, entry, &entry->key, WEIGHT_STRONG);
+        dump_field_lv(ctx, &out, entry, &entry->value, WEIGHT_STRONG);
         dump_object_finish(ctx, &out, sizeof out);
     }
 
@@ -2327,7 +2472,7 @@ static dump_off dump_hash_table(struct dump_context* ctx, Lisp_Object object) {
     struct Lisp_Hash_Table hash_munged = *hash_in;
     struct Lisp_Hash_Table* hash = &hash_munged;
 
-    hash_table_freeze(hash);
+    hash_table_freeze(ctx, hash);
     dump_push(&ctx->hash_tables, object);
 
     START_DUMP_PVEC(ctx, &hash->header, struct Lisp_Hash_Table, out);
@@ -2336,13 +2481,13 @@ static dump_off dump_hash_table(struct dump_context* ctx, Lisp_Object object) {
     DUMP_FIELD_COPY(out, hash, weakness);
     DUMP_FIELD_COPY(out, hash, mutable);
     DUMP_FIELD_COPY(out, hash, frozen_test);
-    if (hash->key_and_value)
-        dump_field_fixup_later(ctx, out, hash, &hash->key_and_value);
+    if (hash->entries)
+        dump_field_fixup_later(ctx, out, hash, &hash->entries);
     eassert(hash->next_weak == NULL);
     dump_off offset = finish_dump_pvec(ctx, &out->header);
-    if (hash->key_and_value)
+    if (hash->entries)
         dump_remember_fixup_ptr_raw(
-            ctx, offset + dump_offsetof(struct Lisp_Hash_Table, key_and_value),
+            ctx, offset + dump_offsetof(struct Lisp_Hash_Table, entries),
             dump_hash_table_contents(ctx, hash));
     return offset;
 }
@@ -2363,6 +2508,7 @@ static dump_off dump_obarray_buckets(struct dump_context* ctx,
         dump_field_lv(ctx, &out, slot, slot, WEIGHT_STRONG);
         dump_object_finish(ctx, &out, sizeof out);
     }
+    dump_write(ctx, obarray_tags(o), n);
 
     ctx->flags = old_flags;
     return start_offset;
@@ -2379,6 +2525,7 @@ static dump_off dump_obarray(struct dump_context* ctx, Lisp_Object object) {
     dump_pseudovector_lisp_fields(ctx, &out->header, &oa->header);
     DUMP_FIELD_COPY(out, oa, count);
     DUMP_FIELD_COPY(out, oa, size_bits);
+    DUMP_FIELD_COPY(out, oa, deleted);
     dump_field_fixup_later(ctx, out, oa, &oa->buckets);
     dump_off offset = finish_dump_pvec(ctx, &out->header);
     dump_remember_fixup_ptr_raw(
@@ -2491,17 +2638,25 @@ static dump_off dump_buffer(struct dump_context* ctx,
     out->newline_cache = NULL;
     out->width_run_cache = NULL;
     out->bidi_paragraph_cache = NULL;
+    out->stop_index = NULL;
+    out->column_index = NULL;
+    out->syntax_checkpoints = NULL;
+    /* Flushed by dump_emacs before anything was dumped.  */
+    eassert(!buffer->undo_log);
+    out->undo_log = NULL;
 
     DUMP_FIELD_COPY(out, buffer, prevent_redisplay_optimizations_p);
     DUMP_FIELD_COPY(out, buffer, clip_changed);
     DUMP_FIELD_COPY(out, buffer, inhibit_buffer_hooks);
     DUMP_FIELD_COPY(out, buffer, long_line_optimizations_p);
 
-    if (!itree_empty_p(buffer->overlays)) {
+    if (!itree_empty_p(buffer->overlays) && !ctx->snapshot) {
         /* We haven't implemented the code to dump overlays.  */
         error("dumping overlays is not yet implemented");
     }
     else
+        /* A snapshot leaves the overlays out; see
+           dump_session_object_p.  */
         out->overlays = NULL;
 
     dump_field_lv(ctx, out, buffer, &buffer->undo_list_, WEIGHT_STRONG);
@@ -2690,6 +2845,7 @@ static dump_off dump_vectorlike(struct dump_context* ctx, Lisp_Object lv,
     case PVEC_USER_PTR:
     case PVEC_MUTEX:
     case PVEC_CONDVAR:
+    case PVEC_CHANNEL:
     case PVEC_SQLITE:
     case PVEC_MODULE_FUNCTION:
     case PVEC_SYMBOL_WITH_POS:
@@ -3229,6 +3385,7 @@ static void dump_unwind_cleanup(void* data) {
     Vpurify_flag = ctx->old_purify_flag;
     Vpost_gc_hook = ctx->old_post_gc_hook;
     Vprocess_environment = ctx->old_process_environment;
+    Vbuffer_alist = ctx->old_buffer_alist;
 }
 
 /* Check that DUMP_OFFSET is within the heap.  */
@@ -3265,6 +3422,81 @@ static void dump_emit_dump_reloc(struct dump_context* ctx, Lisp_Object lreloc) {
         ctx->number_discardable_relocations += 1;
 }
 
+/* Return the class of early relocations of type TYPE, or -1 if they
+   are not relocations of addresses.  */
+static int dump_reloc_class(enum dump_reloc_type type) {
+    switch (type) {
+    case RELOC_DUMP_TO_EMACS_PTR_RAW:
+        return RELOC_CLASS_EMACS;
+    case RELOC_DUMP_TO_DUMP_PTR_RAW:
+        return RELOC_CLASS_DUMP;
+    case RELOC_NATIVE_COMP_UNIT:
+    case RELOC_NATIVE_SUBR:
+    case RELOC_BIGNUM:
+        return -1;
+    default:
+        if (type == RELOC_DUMP_TO_DUMP_LV + Lisp_Symbol)
+            return RELOC_CLASS_DUMP_SYMBOL;
+        return type < RELOC_DUMP_TO_EMACS_LV ? RELOC_CLASS_DUMP
+                                             : RELOC_CLASS_EMACS;
+    }
+}
+
+/* Replace the offset the dump holds at the place of relocation LRELOC
+   by the target as it is when the dump is loaded at the preferred
+   base recorded in the header.  */
+static void dump_apply_address_reloc(struct dump_context* ctx,
+                                     Lisp_Object lreloc) {
+    struct dump_reloc reloc = dump_decode_dump_reloc(lreloc);
+    char* place = (char*)ctx->buf + dump_reloc_get_offset(reloc);
+    uintptr_t value;
+    memcpy(&value, place, sizeof(value));
+
+    if (reloc.type == RELOC_DUMP_TO_EMACS_PTR_RAW ||
+        reloc.type == RELOC_DUMP_TO_DUMP_PTR_RAW) {
+        value += reloc.type == RELOC_DUMP_TO_DUMP_PTR_RAW
+            ? ctx->header.base
+            : ctx->header.emacs_basis;
+        memcpy(place, &value, sizeof(value));
+        return;
+    }
+
+    enum Lisp_Type lisp_type;
+    if (reloc.type < RELOC_DUMP_TO_EMACS_LV) {
+        lisp_type = reloc.type - RELOC_DUMP_TO_DUMP_LV;
+        value += ctx->header.base;
+    }
+    else {
+        lisp_type = reloc.type - RELOC_DUMP_TO_EMACS_LV;
+        value += ctx->header.emacs_basis;
+    }
+
+    Lisp_Object lv = lisp_type == Lisp_Symbol
+        ? make_lisp_symbol((void*)value)
+        : make_lisp_ptr((void*)value, lisp_type);
+    memcpy(place, &lv, sizeof(lv));
+}
+
+/* Move the early relocations of addresses to ctx->address_relocs,
+   applying them for the preferred base.  */
+static void dump_apply_address_relocs(struct dump_context* ctx) {
+    ctx->header.base = dump_preferred_base();
+    ctx->header.emacs_basis = emacs_basis();
+
+    Lisp_Object relocs = ctx->dump_relocs[EARLY_RELOCS];
+    ctx->dump_relocs[EARLY_RELOCS] = Qnil;
+    while (!NILP(relocs)) {
+        Lisp_Object lreloc = dump_pop(&relocs);
+        int class = dump_reloc_class(XFIXNUM(XCAR(lreloc)));
+        if (class < 0)
+            dump_push(&ctx->dump_relocs[EARLY_RELOCS], lreloc);
+        else {
+            dump_apply_address_reloc(ctx, lreloc);
+            dump_push(&ctx->address_relocs[class], lreloc);
+        }
+    }
+}
+
 #ifdef ENABLE_CHECKING
 static Lisp_Object dump_check_overlap_dump_reloc(Lisp_Object lreloc_a,
                                                  Lisp_Object lreloc_b) {
@@ -3569,17 +3801,66 @@ static void dump_drain_deferred_symbols(struct dump_context* ctx) {
     ctx->flags = old_flags;
 }
 
-DEFUN("dump-emacs-portable", Fdump_emacs_portable, Sdump_emacs_portable, 1, 2,
-      0, doc:
-          /* Dump current state of Emacs into dump file FILENAME.
-If TRACK-REFERRERS is non-nil, keep additional debugging information
-that can help track down the provenance of unsupported object
-types.  */)
-(Lisp_Object filename, Lisp_Object track_referrers) {
+/* Whether OBJECT is of a kind that dump_hot_objects may dump out of
+   the usual order.  Objects of other kinds, such as buffers, are left
+   to the queue, which knows how to reach them.  */
+static bool dump_hot_object_p(Lisp_Object object) {
+    if (dump_object_self_representing_p(object))
+        return false;
+    return (STRINGP(object) || CONSP(object) || SYMBOLP(object) ||
+            VECTORP(object) || CLOSUREP(object) || RECORDP(object));
+}
+
+/* Dump the objects in the list HOT right away, in order, so that
+   objects used together end up together.  The objects they refer to
+   are queued as usual.  */
+static void dump_hot_objects(struct dump_context* ctx, Lisp_Object hot) {
+    for (; CONSP(hot); hot = XCDR(hot)) {
+        Lisp_Object object = XCAR(hot);
+        if (dump_hot_object_p(object))
+            dump_object(ctx, object);
+        if (SYMBOLP(object) &&
+            dump_hot_object_p(XSYMBOL(object)->u.s.function))
+            dump_object(ctx, XSYMBOL(object)->u.s.function);
+    }
+}
+
+static void dump_unswap_session_binding(Lisp_Object symbol, Lisp_Object arg) {
+    struct Lisp_Symbol* sym = XSYMBOL(symbol);
+    if (sym->u.s.redirect == SYMBOL_LOCALIZED &&
+        dump_session_object_p(SYMBOL_BLV(sym)->where))
+        swap_in_global_binding(sym);
+}
+
+/* Get the session out of the way of a snapshot: make a buffer from the
+   dump current, and have the variables whose bindings are those of a
+   buffer the snapshot leaves out show their global values.  */
+static void dump_prepare_snapshot(void) {
+    if (dump_session_object_p(Fcurrent_buffer())) {
+        Lisp_Object tail, buffer;
+        FOR_EACH_LIVE_BUFFER(tail, buffer) {
+            if (!dump_session_object_p(buffer))
+                break;
+        }
+        if (NILP(tail))
+            error("No buffer from the dump Emacs started with is live");
+        record_unwind_current_buffer();
+        set_buffer_internal(XBUFFER(buffer));
+    }
+    map_obarray(Vobarray, dump_unswap_session_binding, Qnil);
+}
+
+/* Dump the state of Emacs into FILENAME, as dump-emacs-portable does,
+   or if SNAPSHOT, as dump-emacs-snapshot does.  */
+static Lisp_Object dump_emacs(Lisp_Object filename, Lisp_Object track_referrers,
+                              Lisp_Object hot_objects, bool snapshot) {
     eassert(initialized);
 
+    if (snapshot && !dumped_with_pdumper_p())
+        error("Only a session started from a dump can be snapshotted");
+
 #ifndef HAVE_ANDROID
-    if (!noninteractive)
+    if (!noninteractive && !snapshot)
         error("Dumping Emacs currently works only in batch mode.  "
               "If you'd like it to work interactively, please consider "
               "contributing a patch to Emacs.");
@@ -3596,6 +3877,10 @@ types.  */)
     calln(intern_c_string("load--fixup-all-elns"));
 #endif
 
+    /* The files lazily loaded closures refer to are not part of the
+       dump.  */
+    fetch_all_closure_bodies();
+
     /* Clear out any detritus in memory.  */
     do {
         number_finalizers_run = 0;
@@ -3610,13 +3895,23 @@ types.  */)
     Lisp_Object symbol = Qcommand_line_processed;
     specbind(symbol, Qnil);
 
+    if (snapshot)
+        dump_prepare_snapshot();
+
+    /* The undo logs are not dumped; put what they hold into the undo
+       lists.  This comes after everything that can run Lisp, which
+       could record more changes.  */
+    flush_undo_logs();
+
     CHECK_STRING(filename);
+    CHECK_LIST(hot_objects);
     filename = Fexpand_file_name(filename, Qnil);
     filename = ENCODE_FILE(filename);
 
     struct dump_context ctx_buf = {0};
     struct dump_context* ctx = &ctx_buf;
     ctx->fd = -1;
+    ctx->snapshot = snapshot;
 
     ctx->objects_dumped = make_eq_hash_table();
     dump_queue_init(&ctx->dump_queue);
@@ -3630,6 +3925,8 @@ types.  */)
     ctx->cold_queue = Qnil;
     for (int i = 0; i < RELOC_NUM_PHASES; ++i)
         ctx->dump_relocs[i] = Qnil;
+    for (int i = 0; i < NUMBER_RELOC_CLASSES; ++i)
+        ctx->address_relocs[i] = Qnil;
     ctx->object_starts = Qnil;
     ctx->emacs_relocs = Qnil;
     ctx->bignum_data = make_eq_hash_table();
@@ -3677,6 +3974,17 @@ types.  */)
     ctx->old_process_environment = Vprocess_environment;
     Vprocess_environment = Qnil;
 
+    /* Keep the buffers a snapshot leaves out off the buffer list.  */
+    ctx->old_buffer_alist = Vbuffer_alist;
+    if (snapshot) {
+        Lisp_Object kept = Qnil, tail, buffer;
+        FOR_EACH_LIVE_BUFFER(tail, buffer) {
+            if (!dump_session_object_p(buffer))
+                kept = Fcons(XCAR(tail), kept);
+        }
+        Vbuffer_alist = Fnreverse(kept);
+    }
+
     {
         USE_SAFE_ALLOCA;
 
@@ -3727,6 +4035,8 @@ types.  */)
         dump_emacs_reloc_to_emacs_ptr_raw(ctx, &staticvec[i], staticvec[i]);
     dump_emacs_reloc_immediate_int(ctx, &staticidx, staticidx);
 
+    dump_hot_objects(ctx, hot_objects);
+
     /* Dump while we keep finding objects to dump.  We add new
        objects to the queue by side effect during dumping.
        We accumulate some types of objects in special lists to get more
@@ -3804,6 +4114,11 @@ types.  */)
     /* Emit instructions for Emacs to execute when loading the dump.
        Note that this relocation information ends up in the cold section
        of the dump.  */
+    dump_apply_address_relocs(ctx);
+    for (int i = 0; i < NUMBER_RELOC_CLASSES; ++i)
+        drain_reloc_list(ctx, dump_emit_dump_reloc, emacs_reloc_merger,
+                         &ctx->address_relocs[i],
+                         &ctx->header.address_relocs[i]);
     for (int i = 0; i < RELOC_NUM_PHASES; ++i)
         drain_reloc_list(ctx, dump_emit_dump_reloc, emacs_reloc_merger,
                          &ctx->dump_relocs[i], &ctx->header.dump_relocs[i]);
@@ -3827,6 +4142,8 @@ types.  */)
     eassert(NILP(ctx->fixups));
     for (int i = 0; i < RELOC_NUM_PHASES; ++i)
         eassert(NILP(ctx->dump_relocs[i]));
+    for (int i = 0; i < NUMBER_RELOC_CLASSES; ++i)
+        eassert(NILP(ctx->address_relocs[i]));
     eassert(NILP(ctx->emacs_relocs));
 
     /* Dump is complete.  Go back to the header and write the magic
@@ -3859,6 +4176,40 @@ types.  */)
     return unbind_to(count, Qnil);
 }
 
+DEFUN("dump-emacs-portable", Fdump_emacs_portable, Sdump_emacs_portable, 1, 3,
+      0, doc:
+          /* Dump current state of Emacs into dump file FILENAME.
+If TRACK-REFERRERS is non-nil, keep additional debugging information
+that can help track down the provenance of unsupported object
+types.
+HOT-OBJECTS, if non-nil, is a list of objects that are used together,
+such as the one `pdumper-page-trace' returns.  They are dumped first,
+in that order, so that they share pages; a symbol brings its function
+definition along.  */)
+(Lisp_Object filename, Lisp_Object track_referrers, Lisp_Object hot_objects) {
+    return dump_emacs(filename, track_referrers, hot_objects, false);
+}
+
+DEFUN("dump-emacs-snapshot", Fdump_emacs_snapshot, Sdump_emacs_snapshot, 1, 2,
+      "FDump snapshot to file: ", doc:
+          /* Dump the state of this session, as configured, into FILENAME.
+Unlike `dump-emacs-portable', this works in an interactive session,
+which must have been started from a dump.  The snapshot holds the
+session's configuration: the packages it loaded, the variables and
+hash tables they set up, and so on.  It leaves out what belongs to the
+running session: buffers other than those that came from the dump
+Emacs started with, frames, windows, processes, threads and the like.
+Overlays are left out too.  Wherever the session refers to one of
+those, the snapshot has nil, and hash table entries that refer to one
+are dropped.
+
+Starting Emacs with --dump-file=FILENAME restores the configuration
+without loading the init files again, so also pass -q.
+HOT-OBJECTS is as for `dump-emacs-portable'.  */)
+(Lisp_Object filename, Lisp_Object hot_objects) {
+    return dump_emacs(filename, Qnil, hot_objects, true);
+}
+
 DEFUN("dump-emacs-portable--sort-predicate",
       Fdump_emacs_portable__sort_predicate,
       Sdump_emacs_portable__sort_predicate, 2, 2, 0,
@@ -4321,8 +4672,26 @@ static bool needs_mmap_retry_p(void) {
 #endif /* !CYGWIN && VM_SUPPORTED != VM_MS_WINDOWS && !_AIX */
 }
 
+/* Reserve SIZE bytes of address space, at HINT if that is free.  */
+static void* dump_reserve_address_space(void* hint, size_t size) {
+    if (hint) {
+#if VM_SUPPORTED == VM_POSIX
+        void* resv = mmap(hint, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS,
+                          -1, 0);
+        if (resv != MAP_FAILED)
+            return resv;
+#elif VM_SUPPORTED == VM_MS_WINDOWS
+        void* resv =
+            dump_anonymous_allocate(hint, size, DUMP_MEMORY_ACCESS_NONE);
+        if (resv)
+            return resv;
+#endif
+    }
+    return dump_anonymous_allocate(NULL, size, DUMP_MEMORY_ACCESS_NONE);
+}
+
 static bool dump_mmap_contiguous_vm(struct dump_memory_map* maps, int nr_maps,
-                                    size_t total_size) {
+                                    size_t total_size, void* hint) {
     int save_errno;
     bool ret = false;
     void* resv = NULL;
@@ -4338,8 +4707,7 @@ static bool dump_mmap_contiguous_vm(struct dump_memory_map* maps, int nr_maps,
         }
 
         eassert(resv == NULL);
-        resv =
-            dump_anonymous_allocate(NULL, total_size, DUMP_MEMORY_ACCESS_NONE);
+        resv = dump_reserve_address_space(hint, total_size);
         if (!resv)
             goto out;
 
@@ -4412,8 +4780,11 @@ out:
    Each mapping SIZE must be a multiple of the system page size except
    for the last mapping.
 
+   Put the memory at HINT if possible and HINT is not null.
+
    Return true on success or false on failure with errno set.  */
-static bool dump_mmap_contiguous(struct dump_memory_map* maps, int nr_maps) {
+static bool dump_mmap_contiguous(struct dump_memory_map* maps, int nr_maps,
+                                 void* hint) {
     if (!nr_maps)
         return true;
 
@@ -4430,7 +4801,7 @@ static bool dump_mmap_contiguous(struct dump_memory_map* maps, int nr_maps) {
     }
 
     if (VM_SUPPORTED)
-        return dump_mmap_contiguous_vm(maps, nr_maps, total_size);
+        return dump_mmap_contiguous_vm(maps, nr_maps, total_size, hint);
     else
         return dump_mmap_contiguous_heap(maps, nr_maps, total_size);
 }
@@ -4494,6 +4865,27 @@ static void dump_bitset_clear(struct dump_bitset* bitset) {
         memset(bitset->bits, 0, bitset->number_words * sizeof bitset->bits[0]);
 }
 
+/* The phases of loading a dump, timed separately for pdumper-stats.  */
+enum dump_load_phase
+{
+    DUMP_LOAD_MAP,
+    DUMP_LOAD_RELOCATE,
+    DUMP_LOAD_EMACS_RELOCATE,
+    DUMP_LOAD_THAW,
+    DUMP_LOAD_HOOKS,
+    DUMP_LOAD_LATE,
+    NUMBER_DUMP_LOAD_PHASES,
+};
+
+static char const* const dump_load_phase_names[NUMBER_DUMP_LOAD_PHASES] = {
+    [DUMP_LOAD_MAP] = "map",
+    [DUMP_LOAD_RELOCATE] = "relocate",
+    [DUMP_LOAD_EMACS_RELOCATE] = "emacs-relocate",
+    [DUMP_LOAD_THAW] = "thaw",
+    [DUMP_LOAD_HOOKS] = "hooks",
+    [DUMP_LOAD_LATE] = "late",
+};
+
 struct pdumper_loaded_dump_private {
     /* Copy of the header we read from the dump.  */
     struct dump_header header;
@@ -4501,6 +4893,10 @@ struct pdumper_loaded_dump_private {
     struct dump_bitset mark_bits, last_mark_bits;
     /* Time taken to load the dump.  */
     double load_time;
+    /* Time taken by each phase of loading; they add up to LOAD_TIME.  */
+    double phase_time[NUMBER_DUMP_LOAD_PHASES];
+    /* Most worker threads that loading ran at once.  */
+    int load_threads;
     /* Dump file name.  */
     char* dump_filename;
 };
@@ -4668,36 +5064,6 @@ static int dump_reloc_size(const struct dump_reloc reloc) {
     return sizeof(Lisp_Object);
 }
 
-static Lisp_Object dump_make_lv_from_reloc(const uintptr_t dump_base,
-                                           const struct dump_reloc reloc) {
-    const dump_off reloc_offset = dump_reloc_get_offset(reloc);
-    uintptr_t value = dump_read_word_from_dump(dump_base, reloc_offset);
-    enum Lisp_Type lisp_type;
-
-    if (RELOC_DUMP_TO_DUMP_LV <= reloc.type &&
-        reloc.type < RELOC_DUMP_TO_EMACS_LV) {
-        lisp_type = reloc.type - RELOC_DUMP_TO_DUMP_LV;
-        value += dump_base;
-        eassert(pdumper_object_p((void*)value));
-    }
-    else {
-        eassert(RELOC_DUMP_TO_EMACS_LV <= reloc.type);
-        eassert(reloc.type < RELOC_DUMP_TO_EMACS_LV + 8);
-        lisp_type = reloc.type - RELOC_DUMP_TO_EMACS_LV;
-        value += emacs_basis();
-    }
-
-    eassert(lisp_type != Lisp_Int0 && lisp_type != Lisp_Int1);
-
-    Lisp_Object lv;
-    if (lisp_type == Lisp_Symbol)
-        lv = make_lisp_symbol((void*)value);
-    else
-        lv = make_lisp_ptr((void*)value, lisp_type);
-
-    return lv;
-}
-
 /* Actually apply a dump relocation.  */
 static inline void dump_do_dump_relocation(const uintptr_t dump_base,
                                            const struct dump_reloc reloc) {
@@ -4707,22 +5073,6 @@ static inline void dump_do_dump_relocation(const uintptr_t dump_base,
     eassert(reloc_offset < dump_private.header.cold_start);
 
     switch (reloc.type) {
-    case RELOC_DUMP_TO_EMACS_PTR_RAW:
-        {
-            uintptr_t value = dump_read_word_from_dump(dump_base, reloc_offset);
-            eassert(dump_reloc_size(reloc) == sizeof(value));
-            value += emacs_basis();
-            dump_write_word_to_dump(dump_base, reloc_offset, value);
-            break;
-        }
-    case RELOC_DUMP_TO_DUMP_PTR_RAW:
-        {
-            uintptr_t value = dump_read_word_from_dump(dump_base, reloc_offset);
-            eassert(dump_reloc_size(reloc) == sizeof(value));
-            value += dump_base;
-            dump_write_word_to_dump(dump_base, reloc_offset, value);
-            break;
-        }
 #ifdef HAVE_NATIVE_COMP
     case RELOC_NATIVE_COMP_UNIT:
         {
@@ -4840,16 +5190,38 @@ static inline void dump_do_dump_relocation(const uintptr_t dump_base,
             mpz_roinit_n(bignum->value, limbs, reload_info.nlimbs);
             break;
         }
-    default: /* Lisp_Object in the dump; precise type in reloc.type */
-        {
-            Lisp_Object lv = dump_make_lv_from_reloc(dump_base, reloc);
-            eassert(dump_reloc_size(reloc) == sizeof(lv));
-            dump_write_lv_to_dump(dump_base, reloc_offset, lv);
-            break;
-        }
+    default:
+        fatal("unrecognized dump relocation type %d", (int)reloc.type);
     }
 }
 
+/* Loading spreads the address relocations and the rehashing of the
+   dumped hash tables over worker threads.  Each worker gets at least
+   DUMP_PARALLEL_MIN items of work, since starting a thread costs more
+   than doing fewer than that; workers claim chunks of the work until
+   none is left.  */
+enum
+{
+    DUMP_PARALLEL_MIN = 16 * 1024,
+    DUMP_MAX_WORKERS = 7
+};
+
+/* Return how many worker threads to use for WORK items.  */
+static int dump_parallel_workers(ptrdiff_t work) {
+    static long ncpus;
+    if (!ncpus)
+        ncpus = max(1, sysconf(_SC_NPROCESSORS_ONLN));
+    return min(min(ncpus - 1, DUMP_MAX_WORKERS), work / DUMP_PARALLEL_MIN);
+}
+
+/* Call FN (ARG, START, END) for items 0..N, CHUNK at a time, on this
+   thread and up to NWORKERS workers; see sys_parallel.  */
+static void dump_parallel(sys_parallel_function* fn, void* arg, ptrdiff_t n,
+                          ptrdiff_t chunk, int nworkers) {
+    int started = sys_parallel("pdumper-load", fn, arg, n, chunk, nworkers);
+    dump_private.load_threads = max(dump_private.load_threads, started);
+}
+
 static void
 dump_do_all_dump_reloc_for_phase(const struct dump_header* const header,
                                  const uintptr_t dump_base,
@@ -4861,6 +5233,94 @@ dump_do_all_dump_reloc_for_phase(const struct dump_header* const header,
         dump_do_dump_relocation(dump_base, r[i]);
 }
 
+/* The address relocations of all classes, as one run of items.  */
+struct dump_address_relocs {
+    uintptr_t dump_base;
+    /* The relocations of each class, and how far their targets have
+       moved since the dump was written.  */
+    struct dump_reloc* relocs[NUMBER_RELOC_CLASSES];
+    dump_off nr_entries[NUMBER_RELOC_CLASSES];
+    intptr_t delta[NUMBER_RELOC_CLASSES];
+};
+
+static void dump_do_address_reloc(uintptr_t dump_base, struct dump_reloc reloc,
+                                  intptr_t delta) {
+    const dump_off reloc_offset = dump_reloc_get_offset(reloc);
+    if (dump_reloc_size(reloc) == sizeof(uintptr_t)) {
+        uintptr_t value = dump_read_word_from_dump(dump_base, reloc_offset);
+        dump_write_word_to_dump(dump_base, reloc_offset, value + delta);
+    }
+    else {
+        Lisp_Object lv;
+        memcpy(&lv, dump_ptr(dump_base, reloc_offset), sizeof(lv));
+        dump_write_lv_to_dump(dump_base, reloc_offset, XIL(XLI(lv) + delta));
+    }
+}
+
+/* Apply the address relocations numbered START..END in the run that
+   ARG, a struct dump_address_relocs, describes.  */
+static void dump_do_address_reloc_range(void* arg, ptrdiff_t start,
+                                        ptrdiff_t end) {
+    const struct dump_address_relocs* a = arg;
+    for (int class = 0; class < NUMBER_RELOC_CLASSES && start < end; class++) {
+        dump_off n = a->nr_entries[class];
+        if (start < n) {
+            dump_off stop = min(end, n);
+            for (dump_off i = start; i < stop; i++)
+                dump_do_address_reloc(a->dump_base, a->relocs[class][i],
+                                      a->delta[class]);
+        }
+        start = max(0, start - n);
+        end -= n;
+    }
+}
+
+/* Apply the address relocations of every class, given DELTA, how far
+   the targets of each class have moved since the dump was written.
+   Classes whose targets have not moved are skipped; the rest are
+   spread over worker threads when there are enough of them.  */
+static void dump_do_address_relocs(const struct dump_header* const header,
+                                   const uintptr_t dump_base,
+                                   const intptr_t delta[NUMBER_RELOC_CLASSES]) {
+    struct dump_address_relocs a = {.dump_base = dump_base};
+    ptrdiff_t total = 0;
+    for (int class = 0; class < NUMBER_RELOC_CLASSES; class++) {
+        a.delta[class] = delta[class];
+        if (delta[class] == 0)
+            continue;
+        a.relocs[class] =
+            dump_ptr(dump_base, header->address_relocs[class].offset);
+        a.nr_entries[class] = header->address_relocs[class].nr_entries;
+        total += a.nr_entries[class];
+    }
+    dump_parallel(dump_do_address_reloc_range, &a, total, DUMP_PARALLEL_MIN / 4,
+                  dump_parallel_workers(total));
+}
+
+/* Return where to try to map the dump with HEADER, given that Emacs
+   moved by EMACS_DELTA since the dump was written, or 0 to let the
+   system choose.  At the preferred base, the pointers to dump objects
+   are right as they are.  At the same distance from Emacs as when the
+   dump was written, the symbols are.  Pick the place that leaves fewer
+   relocations to do.  */
+static uintptr_t dump_preferred_address(const struct dump_header* header,
+                                        intptr_t emacs_delta,
+                                        intptr_t dump_size) {
+    uintptr_t address = header->base;
+    if (!address)
+        return 0;
+    if (header->address_relocs[RELOC_CLASS_DUMP_SYMBOL].nr_entries >
+        header->address_relocs[RELOC_CLASS_DUMP].nr_entries)
+        address += emacs_delta;
+#if !USE_LSB_TAG
+    if ((address + dump_size) & ~VALMASK)
+        return 0;
+#else
+    (void)dump_size;
+#endif
+    return address;
+}
+
 static void dump_do_emacs_relocation(const uintptr_t dump_base,
                                      const struct emacs_reloc reloc) {
     ptrdiff_t pval;
@@ -4953,6 +5413,112 @@ enum dump_section
     NUMBER_DUMP_SECTIONS,
 };
 
+#if VM_SUPPORTED == VM_POSIX
+
+/* Tracing which pages of the hot section of the dump are touched, for
+   pdumper-page-trace.  The pages start out inaccessible; the first
+   fault on each is noted, and the page is then made accessible.  */
+struct dump_page_trace {
+    /* The traced pages, or NULL if there is no trace.  */
+    char* start;
+    dump_off npages;
+    int page_size;
+    /* For each page, whether it has been touched.  */
+    unsigned char* touched;
+    /* The numbers of the pages touched, in the order they were first
+       touched, and how many there are.  */
+    dump_off* order;
+    dump_off ntouched;
+    /* The handlers of the faults that are not on traced pages.  */
+    struct sigaction old_segv, old_bus;
+};
+
+static struct dump_page_trace page_trace;
+
+/* If ADDR is on a traced page, note that the page was touched, make it
+   accessible and return true.  This runs in a signal handler.  */
+static bool dump_page_trace_fault(void* addr) {
+    char* start = page_trace.start;
+    if (!start)
+        return false;
+    ptrdiff_t offset = (char*)addr - start;
+    if (offset < 0 ||
+        offset >= (ptrdiff_t)page_trace.npages * page_trace.page_size)
+        return false;
+    dump_off page = offset / page_trace.page_size;
+    if (!__atomic_exchange_n(&page_trace.touched[page], 1, __ATOMIC_RELAXED))
+        page_trace.order[__atomic_fetch_add(&page_trace.ntouched, 1,
+                                            __ATOMIC_RELAXED)] = page;
+    return mprotect(start + (ptrdiff_t)page * page_trace.page_size,
+                    page_trace.page_size, PROT_READ | PROT_WRITE) == 0;
+}
+
+static void dump_page_trace_handler(int sig, siginfo_t* siginfo, void* arg) {
+    if (dump_page_trace_fault(siginfo->si_addr))
+        return;
+    /* Not ours: pass the fault on to whoever else handles it.  */
+    struct sigaction* old =
+        sig == SIGSEGV ? &page_trace.old_segv : &page_trace.old_bus;
+    if (old->sa_flags & SA_SIGINFO)
+        old->sa_sigaction(sig, siginfo, arg);
+    else if (old->sa_handler != SIG_DFL && old->sa_handler != SIG_IGN)
+        old->sa_handler(sig);
+    else
+        /* Returning makes the fault happen again, this time fatally.  */
+        sigaction(sig, old, NULL);
+}
+
+/* Catch the faults on the traced pages ahead of the handlers already
+   installed for them.  */
+static void dump_page_trace_install(void) {
+    struct sigaction sa;
+    sigfillset(&sa.sa_mask);
+    sa.sa_sigaction = dump_page_trace_handler;
+    sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+    sigaction(SIGSEGV, &sa, &page_trace.old_segv);
+    sigaction(SIGBUS, &sa, &page_trace.old_bus);
+}
+
+/* Start tracing the pages of the SIZE bytes at START.  */
+static void dump_page_trace_start(uintptr_t start, dump_off size) {
+    int page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0 || start % page_size != 0)
+        return;
+    dump_off npages = size / page_size;
+    page_trace.touched = calloc(npages, 1);
+    page_trace.order = malloc(npages * sizeof *page_trace.order);
+    if (!page_trace.touched || !page_trace.order) {
+        free(page_trace.touched);
+        free(page_trace.order);
+        return;
+    }
+    page_trace.npages = npages;
+    page_trace.page_size = page_size;
+    page_trace.start = (char*)start;
+    dump_page_trace_install();
+    if (mprotect(page_trace.start, (ptrdiff_t)npages * page_size, PROT_NONE))
+        page_trace.start = NULL;
+}
+
+#endif /* VM_SUPPORTED == VM_POSIX */
+
+/* init_signals has just installed the handlers of faults; put those of
+   the page trace, if there is one, in front of them again.  */
+void pdumper_init_signals_impl(void) {
+#if VM_SUPPORTED == VM_POSIX
+    if (page_trace.start)
+        dump_page_trace_install();
+#endif
+}
+
+/* Return the time in seconds since *SINCE, and set *SINCE to now.  */
+static double dump_lap(struct timespec* since) {
+    struct timespec now = current_timespec();
+    double elapsed = timespectod(timespec_sub(now, *since));
+    *since = now;
+    return elapsed;
+}
+
 /* Pointer to a stack variable to avoid having to staticpro it.  */
 static Lisp_Object* pdumper_hashes = &zero_vector;
 
@@ -4975,6 +5541,7 @@ int pdumper_load(const char* dump_filename, char* argv0) {
     struct dump_memory_map sections[NUMBER_DUMP_SECTIONS] = {0};
 
     const struct timespec start_time = current_timespec();
+    struct timespec lap = start_time;
     char* dump_filename_copy;
 
     /* Overwriting an initialized Lisp universe will not go well.  */
@@ -5066,7 +5633,9 @@ int pdumper_load(const char* dump_filename, char* argv0) {
         .protection = DUMP_MEMORY_ACCESS_READWRITE,
     };
 
-    if (!dump_mmap_contiguous(sections, ARRAYELTS(sections)))
+    const intptr_t emacs_delta = emacs_basis() - header->emacs_basis;
+    void* hint = (void*)dump_preferred_address(header, emacs_delta, dump_size);
+    if (!dump_mmap_contiguous(sections, ARRAYELTS(sections), hint))
         goto out;
 
     err = PDUMPER_LOAD_ERROR;
@@ -5096,8 +5665,22 @@ int pdumper_load(const char* dump_filename, char* argv0) {
     dump_public.start = dump_base;
     dump_public.end = dump_public.start + dump_size;
 
+    dump_private.phase_time[DUMP_LOAD_MAP] = dump_lap(&lap);
+
+    const intptr_t dump_delta = dump_base - header->base;
+    const intptr_t delta[NUMBER_RELOC_CLASSES] = {
+        [RELOC_CLASS_DUMP] = dump_delta,
+        [RELOC_CLASS_EMACS] = emacs_delta,
+        [RELOC_CLASS_DUMP_SYMBOL] = dump_delta - emacs_delta,
+    };
+    dump_do_address_relocs(header, dump_base, delta);
     dump_do_all_dump_reloc_for_phase(header, dump_base, EARLY_RELOCS);
+    dump_private.phase_time[DUMP_LOAD_RELOCATE] = dump_lap(&lap);
+
+    /* These stay on this thread: a copy from the dump can cover a place
+       that a later relocation patches.  */
     dump_do_all_emacs_relocations(header, dump_base);
+    dump_private.phase_time[DUMP_LOAD_EMACS_RELOCATE] = dump_lap(&lap);
 
     dump_mmap_discard_contents(&sections[DS_DISCARDABLE]);
     for (int i = 0; i < ARRAYELTS(sections); ++i)
@@ -5115,6 +5698,8 @@ int pdumper_load(const char* dump_filename, char* argv0) {
        initialization.  */
     for (int i = 0; i < nr_dump_hooks; ++i)
         dump_hooks[i]();
+    dump_private.phase_time[DUMP_LOAD_HOOKS] =
+        dump_lap(&lap) - dump_private.phase_time[DUMP_LOAD_THAW];
 
 #ifdef HAVE_NATIVE_COMP
     pdumper_set_emacs_execdir(argv0);
@@ -5132,6 +5717,19 @@ int pdumper_load(const char* dump_filename, char* argv0) {
 
     initialized = true;
 
+#if VM_SUPPORTED == VM_POSIX
+    /* Only the hot section is traced.  The kernel doesn't fault on a
+       page it cannot access but fails the system call with EFAULT, so
+       the trace must not cover what Emacs hands to system calls.  The
+       string data, buffer text and bignum digits that do get passed
+       there are in the cold section; see dump_drain_cold_data.
+       Anything else in the hot section given to a system call while
+       the trace runs makes that call fail.  */
+    if (getenv("EMACS_PDUMP_TRACE"))
+        dump_page_trace_start(dump_base, adj_discardable_start);
+#endif
+
+    dump_private.phase_time[DUMP_LOAD_LATE] = dump_lap(&lap);
     struct timespec load_timespec =
         timespec_sub(current_timespec(), start_time);
     dump_private.load_time = timespectod(load_timespec);
@@ -5162,10 +5760,15 @@ DEFUN ("pdumper-stats", Fpdumper_stats, Spdumper_stats, 0, 0, 0,
 If this Emacs session was started from a dump file,
 the return value is an alist of the form:
 
-  ((dumped-with-pdumper . t) (load-time . TIME) (dump-file-name . FILE))
+  ((dumped-with-pdumper . t) (load-time . TIME) (dump-file-name . FILE)
+   (load-phases . PHASES) (load-threads . THREADS))
 
 where TIME is the time in seconds it took to restore Emacs state
-from the dump file, and FILE is the name of the dump file.
+from the dump file, and FILE is the name of the dump file.  PHASES is
+an alist that splits TIME between the phases of loading: `map',
+`relocate', `emacs-relocate', `thaw' (rebuilding the dumped hash
+tables), `hooks' and `late'.  THREADS is the most worker threads that
+loading used at once besides the main one.
 Value is nil if this session was not started using a dump file.*/)
 (void) {
     if (!dumped_with_pdumper_p())
@@ -5184,15 +5787,105 @@ Value is nil if this session was not started using a dump file.*/)
 
     dump_fn = Fexpand_file_name(dump_fn, Qnil);
 
-    return list3(Fcons(Qdumped_with_pdumper, Qt),
+    Lisp_Object phases = Qnil;
+    for (int i = NUMBER_DUMP_LOAD_PHASES - 1; i >= 0; i--)
+        phases = Fcons(Fcons(intern_c_string(dump_load_phase_names[i]),
+                             make_float(dump_private.phase_time[i])),
+                       phases);
+
+    return list5(Fcons(Qdumped_with_pdumper, Qt),
                  Fcons(Qload_time, make_float(dump_private.load_time)),
-                 Fcons(Qdump_file_name, dump_fn));
+                 Fcons(Qdump_file_name, dump_fn), Fcons(Qload_phases, phases),
+                 Fcons(Qload_threads, make_fixnum(dump_private.load_threads)));
+}
+
+DEFUN ("pdumper-page-trace", Fpdumper_page_trace, Spdumper_page_trace, 0, 0,
+       0,
+       doc: /* Stop tracing the pages of the dump, and return what was touched.
+If Emacs was started with the environment variable EMACS_PDUMP_TRACE
+set, it notes each page of the hot section of the dump file that is
+touched after the dump is loaded.  This function stops that, and
+returns a list of the live objects on the pages that were touched, in
+the order the pages were first touched.  Value is nil if the pages
+are not being traced.  While they are, a system call that reads or
+writes the hot section itself fails; string data and buffer text are
+not in it.
+
+Passing the list as HOT-OBJECTS to `dump-emacs-portable' puts those
+objects together near the start of the dump, so that a session like
+the traced one touches fewer pages.  Symbols keep their identity
+across sessions, so the symbols in the list can be saved as a profile
+for a later build.  A garbage collection touches every live object;
+bind `gc-cons-threshold' high during the traced session to avoid
+one.  */)
+(void) {
+#if VM_SUPPORTED == VM_POSIX
+    if (!page_trace.start)
+        return Qnil;
+
+    mprotect(page_trace.start,
+             (ptrdiff_t)page_trace.npages * page_trace.page_size,
+             PROT_READ | PROT_WRITE);
+    dump_off ntouched =
+        __atomic_load_n(&page_trace.ntouched, __ATOMIC_RELAXED);
+    page_trace.start = NULL;
+
+    /* Find out which objects are live.  */
+    garbage_collect();
+
+    const struct dump_table_locator* starts =
+        &dump_private.header.object_starts;
+    const struct dump_reloc* end =
+        (struct dump_reloc*)dump_ptr(dump_public.start, starts->offset) +
+        starts->nr_entries;
+    Lisp_Object objects = Qnil;
+    for (dump_off i = 0; i < ntouched; i++) {
+        dump_off page_start = page_trace.order[i] * page_trace.page_size;
+        dump_off page_end = page_start + page_trace.page_size;
+        const struct dump_reloc* r = dump_find_relocation(starts, page_start);
+        for (; r && r < end && dump_reloc_get_offset(*r) < page_end; r++) {
+            dump_off offset = dump_reloc_get_offset(*r);
+            if (offset >= dump_private.header.discardable_start ||
+                !dump_bitset_bit_set_p(&dump_private.last_mark_bits,
+                                       offset / DUMP_ALIGNMENT))
+                continue;
+            void* obj = dump_ptr(dump_public.start, offset);
+            int type = r->type;
+            objects = Fcons(type == Lisp_Symbol ? make_lisp_symbol(obj)
+                                                : make_lisp_ptr(obj, type),
+                            objects);
+        }
+    }
+
+    free(page_trace.touched);
+    free(page_trace.order);
+    page_trace.touched = NULL;
+    page_trace.order = NULL;
+    return Fnreverse(objects);
+#else
+    return Qnil;
+#endif
 }
 
+static void rehash_thawed_tables(void* arg, ptrdiff_t start, ptrdiff_t end) {
+    Lisp_Object hash_tables = *(Lisp_Object*)arg;
+    for (ptrdiff_t i = start; i < end; i++)
+        hash_table_rehash_thawed(AREF(hash_tables, i));
+}
+
+/* Rebuild the dumped hash tables.  Their vectors are allocated here,
+   and then the tables are rehashed on worker threads.  */
 static void thaw_hash_tables(void) {
+    struct timespec start = current_timespec();
     Lisp_Object hash_tables = *pdumper_hashes;
-    for (ptrdiff_t i = 0; i < ASIZE(hash_tables); i++)
+    ptrdiff_t entries = 0;
+    for (ptrdiff_t i = 0; i < ASIZE(hash_tables); i++) {
         hash_table_thaw(AREF(hash_tables, i));
+        entries += XHASH_TABLE(AREF(hash_tables, i))->count;
+    }
+    dump_parallel(rehash_thawed_tables, &hash_tables, ASIZE(hash_tables), 64,
+                  dump_parallel_workers(entries));
+    dump_private.phase_time[DUMP_LOAD_THAW] = dump_lap(&start);
 }
 
 #endif /* HAVE_PDUMPER */
@@ -5211,6 +5904,7 @@ void syms_of_pdumper(void) {
     char hexbuf[2 * sizeof fingerprint];
 
     defsubr(&Sdump_emacs_portable);
+    defsubr(&Sdump_emacs_snapshot);
     defsubr(&Sdump_emacs_portable__sort_predicate);
     defsubr(&Sdump_emacs_portable__sort_predicate_copied);
     DEFSYM(Qdump_emacs_portable__sort_predicate,
@@ -5220,8 +5914,11 @@ void syms_of_pdumper(void) {
     DEFSYM(Qdumped_with_pdumper, "dumped-with-pdumper");
     DEFSYM(Qload_time, "load-time");
     DEFSYM(Qdump_file_name, "dump-file-name");
+    DEFSYM(Qload_phases, "load-phases");
+    DEFSYM(Qload_threads, "load-threads");
     DEFSYM(Qafter_pdump_load_hook, "after-pdump-load-hook");
     defsubr(&Spdumper_stats);
+    defsubr(&Spdumper_page_trace);
 
     for (i = 0; i < sizeof fingerprint; i++)
         desired[i] = fingerprint[i];
@@ -246,6 +246,16 @@ INLINE void pdumper_clear_marks(void) {
 #endif
 }
 
+extern void pdumper_init_signals_impl(void);
+
+/* Let the dump catch the faults it expects, after init_signals has
+   installed the handlers of faults.  */
+INLINE void pdumper_init_signals(void) {
+#ifdef HAVE_PDUMPER
+    pdumper_init_signals_impl();
+#endif
+}
+
 /* Record the Emacs startup directory, relative to which the pdump
    file was loaded.  */
 extern void pdumper_record_wd(const char*);
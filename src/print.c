@@ -1352,8 +1352,10 @@ static void print_preprocess(Lisp_Object obj) {
                             /* The values pushed here may include
                                HASH_UNUSED_ENTRY_KEY; see top of this function.
                              */
-                            pp_stack_push_values(h->key_and_value,
-                                                 2 * h->table_size);
+                            for (ptrdiff_t i = 0; i < h->table_size; i++) {
+                                pp_stack_push_value(h->entries[i].key);
+                                pp_stack_push_value(h->entries[i].value);
+                            }
                         }
                         break;
                     }
@@ -1809,6 +1811,18 @@ static void print_vectorlike_unreadable(Lisp_Object obj,
         printchar('>', printcharfun);
         return;
 
+    case PVEC_CHANNEL:
+        print_c_string("#<channel ", printcharfun);
+        if (STRINGP(XCHANNEL(obj)->name))
+            print_string(XCHANNEL(obj)->name, printcharfun);
+        else {
+            void* p = XCHANNEL(obj);
+            int len = sprintf(buf, "%p", p);
+            strout(buf, len, len, printcharfun);
+        }
+        printchar('>', printcharfun);
+        return;
+
     case PVEC_MODULE_FUNCTION:
 #ifdef HAVE_MODULES
         {
@@ -2362,6 +2376,8 @@ print_obj:
                                     printcharfun);
             goto next_obj;
         case PVEC_CLOSURE:
+            if (closure_body_pending_p(obj))
+                fetch_closure_body(obj);
             print_stack_push_vector("#[", "]", obj, 0, PVSIZE(obj),
                                     printcharfun);
             goto next_obj;
@@ -5188,6 +5188,11 @@ int wait_reading_process_output(intmax_t time_limit, int nsecs, int read_kbd,
         if (0 <= child_fd)
             FD_SET(child_fd, &Available);
 
+        /* Show subprocess output whose redisplay was put off by
+           redisplay_for_output, now that it is due.  */
+        if (do_display)
+            redisplay_deferred_output(12);
+
         /* If frame size has changed or the window is newly mapped,
        redisplay now, before we start to wait.  There is a race
        condition here; if a SIGIO arrives between now and the select
@@ -5279,6 +5284,14 @@ int wait_reading_process_output(intmax_t time_limit, int nsecs, int read_kbd,
             else
                 got_output_end_time = invalid_timespec();
 
+            /* Wake up in time to perform a deferred redisplay.  */
+            if (do_display) {
+                struct timespec redisplay_delay = output_redisplay_delay();
+                if (timespec_valid_p(redisplay_delay) &&
+                    timespec_cmp(redisplay_delay, timeout) < 0)
+                    timeout = redisplay_delay;
+            }
+
 #if defined HAVE_GETADDRINFO_A || defined HAVE_GNUTLS
             if (retry_for_async &&
                 (timeout.tv_sec > 0 || timeout.tv_nsec > ASYNC_RETRY_NSEC)) {
@@ -5554,7 +5567,7 @@ int wait_reading_process_output(intmax_t time_limit, int nsecs, int read_kbd,
                     last_read_channel = channel;
 
                     if (do_display)
-                        redisplay_preserve_echo_area(12);
+                        redisplay_for_output(12);
                 }
                 else if (nread == -1 && would_block(errno))
                     ;
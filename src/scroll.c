@@ -729,9 +729,229 @@ static void do_direct_scrolling(struct frame* frame,
 }
 
 
+/* Scrolling large windows.
+
+   The cost matrices above need time and space quadratic in the number
+   of lines considered, which becomes noticeable on tall terminals.
+   For windows of at least DIFF_SCROLLING_LINES lines, old and new
+   lines are instead matched by computing a shortest edit script of
+   their hash codes with diffseq.h, and the insertions and deletions
+   of the script are done if they cost less than redrawing the lines
+   they save.  */
+
+enum
+{
+    DIFF_SCROLLING_LINES = 32
+};
+
+/* Set up necessary definitions for diffseq.h; see comments in
+   diffseq.h for explanation.  */
+
+#define ELEMENT unsigned
+#define EQUAL(x, y) ((x) == (y))
+#define OFFSET int
+#define USE_HEURISTIC
+
+#define EXTRA_CONTEXT_FIELDS                                                   \
+    /* Vectors recording for each old line whether it is deleted, and          \
+       for each new line whether it is inserted.  */                           \
+    char* deleted;                                                             \
+    char* inserted;
+
+#define NOTE_DELETE(ctx, xoff) ((ctx)->deleted[xoff] = 1)
+#define NOTE_INSERT(ctx, yoff) ((ctx)->inserted[yoff] = 1)
+
+#include <sys/param.h>
+#include "diffseq.h"
+
+/* A run of lines in the edit script: NDELETED old lines starting at
+   OLD_POS are replaced by NINSERTED new lines starting at NEW_POS.
+   Positions are relative to the window being scrolled.  */
+
+struct line_hunk {
+    int old_pos, new_pos;
+    int ndeleted, ninserted;
+};
+
+/* Update the WINDOW_SIZE lines starting at UNCHANGED_AT_TOP using the
+   shortest edit script between OLD_HASH and NEW_HASH.  The arguments
+   are as for scrolling_1, except that vectors are origin 0 here.
+   Value is false if scrolling was found not to be worth it, in which
+   case nothing has been done.  */
+
+static bool diff_scrolling(struct frame* frame, int window_size,
+                           int unchanged_at_top, int lines_below,
+                           int* draw_cost, unsigned* old_hash,
+                           unsigned* new_hash) {
+    int frame_total_lines = FRAME_TOTAL_LINES(frame);
+    int diags = 2 * window_size + 3;
+    USE_SAFE_ALLOCA;
+    int* fdiag;
+    SAFE_NALLOCA(fdiag, 2, diags);
+    char* deleted = SAFE_ALLOCA(2 * window_size);
+    char* inserted = deleted + window_size;
+    memset(deleted, 0, 2 * window_size);
+
+    int too_expensive = 1;
+    for (int d = diags; d != 0; d >>= 2)
+        too_expensive <<= 1;
+
+    struct context ctx = {
+        .xvec = old_hash,
+        .yvec = new_hash,
+        .deleted = deleted,
+        .inserted = inserted,
+        .fdiag = fdiag + window_size + 1,
+        .bdiag = fdiag + diags + window_size + 1,
+        .heuristic = true,
+        .too_expensive = max(4096, too_expensive),
+    };
+    compareseq(0, window_size, 0, window_size, false, &ctx);
+
+    /* Collect the hunks of the edit script, and compare the cost of
+       drawing the lines that do not match after scrolling, plus the
+       cost of scrolling, with the cost of drawing the lines that
+       differ in place.  */
+    struct line_hunk* hunks;
+    SAFE_NALLOCA(hunks, 1, window_size + 1);
+    int nhunks = 0;
+    int lines_moved =
+        window_size + (FRAME_SCROLL_REGION_OK(frame) ? 0 : lines_below);
+    int* first_insert_cost =
+        &FRAME_INSERT_COST(frame)[frame_total_lines - lines_moved];
+    int* first_delete_cost =
+        &FRAME_DELETE_COST(frame)[frame_total_lines - lines_moved];
+    int* next_insert_cost =
+        &FRAME_INSERTN_COST(frame)[frame_total_lines - lines_moved];
+    int* next_delete_cost =
+        &FRAME_DELETEN_COST(frame)[frame_total_lines - lines_moved];
+    int extra_cost = clip_to_bounds(1, baud_rate / (10 * 4) / frame_total_lines,
+                                    INT_MAX / 2);
+    intmax_t scroll_cost = 0, write_cost = 0;
+
+    for (int i = 0; i < window_size; i++)
+        if (old_hash[i] != new_hash[i])
+            write_cost += draw_cost[i];
+
+    for (int i = 0, j = 0; i < window_size || j < window_size;) {
+        if (i < window_size && j < window_size && !deleted[i] &&
+            !inserted[j]) {
+            i++, j++;
+            continue;
+        }
+
+        struct line_hunk* h = &hunks[nhunks++];
+        h->old_pos = i;
+        h->new_pos = j;
+        while (i < window_size && deleted[i])
+            i++;
+        while (j < window_size && inserted[j])
+            j++;
+        h->ndeleted = i - h->old_pos;
+        h->ninserted = j - h->new_pos;
+
+        /* The new lines of the hunk must all be drawn.  A line that
+           cannot be drawn must not be scrolled away.  */
+        for (int k = h->new_pos; k < j; k++)
+            scroll_cost += draw_cost[k];
+
+        int n = h->ninserted - h->ndeleted;
+        int pos = min(h->new_pos + min(h->ndeleted, h->ninserted),
+                      window_size - 1);
+        if (n > 0)
+            scroll_cost += (first_insert_cost[pos] +
+                            (n - 1) * (intmax_t)next_insert_cost[pos] +
+                            n * (intmax_t)extra_cost);
+        else if (n < 0)
+            scroll_cost += (first_delete_cost[pos] +
+                            (-n - 1) * (intmax_t)next_delete_cost[pos]);
+    }
+
+    if (scroll_cost >= write_cost) {
+        SAFE_FREE();
+        return false;
+    }
+
+    /* Do all deletions first, top-down, so that the lines pushed out of
+       the window by the insertions below are the blank lines the
+       deletions opened up at its end.  The first lines of a hunk are
+       kept to be overwritten with its new lines.  */
+    set_terminal_window(frame, window_size + unchanged_at_top);
+    int shift = 0;
+    for (int k = 0; k < nhunks; k++) {
+        struct line_hunk* h = &hunks[k];
+        if (h->ndeleted > h->ninserted) {
+            ins_del_lines(frame,
+                          unchanged_at_top + h->old_pos - shift + h->ninserted,
+                          h->ninserted - h->ndeleted);
+            shift += h->ndeleted - h->ninserted;
+        }
+    }
+
+    /* Everything above a hunk is now in its final place, so insert at
+       the new positions.  */
+    for (int k = 0; k < nhunks; k++) {
+        struct line_hunk* h = &hunks[k];
+        if (h->ninserted > h->ndeleted)
+            ins_del_lines(frame,
+                          unchanged_at_top + h->new_pos + h->ndeleted,
+                          h->ninserted - h->ndeleted);
+    }
+    set_terminal_window(frame, 0);
+
+    /* Record in COPY_FROM which old line is now displayed at each new
+       position, and in RETAINED_P which old lines are still visible.
+       The new lines opened up by insertions are blank; give them the
+       rows of the old lines that were deleted.  */
+    int* copy_from;
+    SAFE_NALLOCA(copy_from, 1, window_size);
+    char* retained_p = deleted;
+    memset(retained_p, 0, window_size);
+    for (int j = 0; j < window_size; j++)
+        copy_from[j] = -1;
+
+    for (int i = 0, j = 0, k = 0; j < window_size;) {
+        if (k < nhunks && hunks[k].new_pos == j) {
+            struct line_hunk* h = &hunks[k++];
+            int kept = min(h->ndeleted, h->ninserted);
+            for (int n = 0; n < kept; n++) {
+                copy_from[j + n] = i + n;
+                retained_p[i + n] = 1;
+            }
+            i += h->ndeleted;
+            j += h->ninserted;
+        }
+        else {
+            copy_from[j] = i;
+            retained_p[i] = 1;
+            i++, j++;
+        }
+    }
+
+    for (int j = 0, next = -1; j < window_size; j++)
+        if (copy_from[j] < 0) {
+            while (retained_p[++next])
+                ;
+            copy_from[j] = next;
+        }
+
+    mirrored_line_dance(frame, unchanged_at_top, window_size, copy_from,
+                        retained_p);
+    SAFE_FREE();
+    return true;
+}
+
+
 void scrolling_1(struct frame* frame, int window_size, int unchanged_at_top,
                  int unchanged_at_bottom, int* draw_cost, int* old_draw_cost,
                  unsigned* old_hash, unsigned* new_hash, int free_at_end) {
+    if (window_size >= DIFF_SCROLLING_LINES) {
+        diff_scrolling(frame, window_size, unchanged_at_top,
+                       unchanged_at_bottom, draw_cost + 1, old_hash + 1,
+                       new_hash + 1);
+        return;
+    }
+
     USE_SAFE_ALLOCA;
     struct matrix_elt* matrix;
     SAFE_NALLOCA(matrix, window_size + 1, window_size + 1);
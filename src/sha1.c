@@ -194,11 +194,73 @@ void sha1_process_bytes(const void* buffer, size_t len, struct sha1_ctx* ctx) {
 #define F3(B, C, D) ((B & C) | (D & (B | C)))
 #define F4(B, C, D) (B ^ C ^ D)
 
+#if defined __ARM_FEATURE_SHA2 || defined __ARM_FEATURE_CRYPTO
+#include <arm_neon.h>
+#define SHA1_ARM_CRYPTO 1
+
+/* Like sha1_process_block, but use the ARMv8 SHA-1 instructions.  Every
+   processor the compiler targets when it defines __ARM_FEATURE_SHA2 has
+   them, so there is nothing to check at run time.  */
+
+static void sha1_process_block_arm(const void* buffer, size_t len,
+                                   struct sha1_ctx* ctx) {
+    static const uint32_t k[4] = {K1, K2, K3, K4};
+    const uint8_t* p = buffer;
+    const uint8_t* endp = p + len;
+    uint32x4_t abcd = {ctx->A, ctx->B, ctx->C, ctx->D};
+    uint32_t e = ctx->E;
+    uint32_t lolen = len;
+
+    ctx->total[0] += lolen;
+    ctx->total[1] += (len >> 31 >> 1) + (ctx->total[0] < lolen);
+
+    for (; p < endp; p += 64) {
+        uint32x4_t abcd0 = abcd;
+        uint32_t e0 = e;
+        uint32x4_t msg[4];
+        for (int i = 0; i < 4; i++)
+            msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 16 * i)));
+
+        /* Twenty steps of four rounds each.  */
+        for (int i = 0; i < 20; i++) {
+            uint32x4_t wk = vaddq_u32(msg[i & 3], vdupq_n_u32(k[i / 5]));
+            uint32_t e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+            if (i < 5)
+                abcd = vsha1cq_u32(abcd, e, wk);
+            else if (i < 10 || i >= 15)
+                abcd = vsha1pq_u32(abcd, e, wk);
+            else
+                abcd = vsha1mq_u32(abcd, e, wk);
+            e = e1;
+            /* Expand the message words for step I + 4.  */
+            if (i < 16)
+                msg[i & 3] = vsha1su1q_u32(vsha1su0q_u32(msg[i & 3],
+                                                         msg[(i + 1) & 3],
+                                                         msg[(i + 2) & 3]),
+                                           msg[(i + 3) & 3]);
+        }
+
+        abcd = vaddq_u32(abcd, abcd0);
+        e += e0;
+    }
+
+    ctx->A = vgetq_lane_u32(abcd, 0);
+    ctx->B = vgetq_lane_u32(abcd, 1);
+    ctx->C = vgetq_lane_u32(abcd, 2);
+    ctx->D = vgetq_lane_u32(abcd, 3);
+    ctx->E = e;
+}
+#endif
+
 /* Process LEN bytes of BUFFER, accumulating context into CTX.
    It is assumed that LEN % 64 == 0.
    Most of this code comes from GnuPG's cipher/sha1.c.  */
 
 void sha1_process_block(const void* buffer, size_t len, struct sha1_ctx* ctx) {
+#ifdef SHA1_ARM_CRYPTO
+    sha1_process_block_arm(buffer, len, ctx);
+    return;
+#endif
     const uint32_t* words = buffer;
     size_t nwords = len / sizeof(uint32_t);
     const uint32_t* endp = words + nwords;
@@ -254,12 +254,64 @@ static const uint32_t sha256_round_constants[64] = {
 #define F2(A, B, C) ((A & B) | (C & (A | B)))
 #define F1(E, F, G) (G ^ (E & (F ^ G)))
 
+#if defined __ARM_FEATURE_SHA2 || defined __ARM_FEATURE_CRYPTO
+#include <arm_neon.h>
+#define SHA256_ARM_CRYPTO 1
+
+/* Like sha256_process_block, but use the ARMv8 SHA-256 instructions,
+   which the #if above guarantees.  */
+
+static void sha256_process_block_arm(const void* buffer, size_t len,
+                                     struct sha256_ctx* ctx) {
+    const uint8_t* p = buffer;
+    const uint8_t* endp = p + len;
+    uint32x4_t abcd = vld1q_u32(&ctx->state[0]);
+    uint32x4_t efgh = vld1q_u32(&ctx->state[4]);
+    uint32_t lolen = len;
+
+    ctx->total[0] += lolen;
+    ctx->total[1] += (len >> 31 >> 1) + (ctx->total[0] < lolen);
+
+    for (; p < endp; p += 64) {
+        uint32x4_t abcd0 = abcd, efgh0 = efgh;
+        uint32x4_t msg[4];
+        for (int i = 0; i < 4; i++)
+            msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 16 * i)));
+
+        /* Sixteen steps of four rounds each.  */
+        for (int i = 0; i < 16; i++) {
+            uint32x4_t k = vld1q_u32(&sha256_round_constants[4 * i]);
+            uint32x4_t wk = vaddq_u32(msg[i & 3], k);
+            /* Expand the message words for step I + 4.  */
+            if (i < 12)
+                msg[i & 3] = vsha256su1q_u32(vsha256su0q_u32(msg[i & 3],
+                                                             msg[(i + 1) & 3]),
+                                             msg[(i + 2) & 3],
+                                             msg[(i + 3) & 3]);
+            uint32x4_t abcd1 = abcd;
+            abcd = vsha256hq_u32(abcd, efgh, wk);
+            efgh = vsha256h2q_u32(efgh, abcd1, wk);
+        }
+
+        abcd = vaddq_u32(abcd, abcd0);
+        efgh = vaddq_u32(efgh, efgh0);
+    }
+
+    vst1q_u32(&ctx->state[0], abcd);
+    vst1q_u32(&ctx->state[4], efgh);
+}
+#endif
+
 /* Process LEN bytes of BUFFER, accumulating context into CTX.
    It is assumed that LEN % 64 == 0.
    Most of this code comes from GnuPG's cipher/sha1.c.  */
 
 void sha256_process_block(const void* buffer, size_t len,
                           struct sha256_ctx* ctx) {
+#ifdef SHA256_ARM_CRYPTO
+    sha256_process_block_arm(buffer, len, ctx);
+    return;
+#endif
     const uint32_t* words = buffer;
     size_t nwords = len / sizeof(uint32_t);
     const uint32_t* endp = words + nwords;
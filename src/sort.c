@@ -31,6 +31,8 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 
 
 #include <config.h>
+#include <math.h>
+#include <unistd.h>
 #include "lisp.h"
 
 
@@ -185,6 +187,23 @@ static bool order_pred_valuelt(merge_state* ms, Lisp_Object a, Lisp_Object b) {
     return !NILP(Fvaluelt(a, b));
 }
 
+/* value< for keys that are all fixnums, all floats other than NaNs, or
+   all strings whose characters are their bytes.  */
+
+static bool order_pred_fixnum(merge_state* ms, Lisp_Object a, Lisp_Object b) {
+    return XFIXNUM(a) < XFIXNUM(b);
+}
+
+static bool order_pred_float(merge_state* ms, Lisp_Object a, Lisp_Object b) {
+    return XFLOAT_DATA(a) < XFLOAT_DATA(b);
+}
+
+static bool order_pred_bytes(merge_state* ms, Lisp_Object a, Lisp_Object b) {
+    ptrdiff_t na = SBYTES(a), nb = SBYTES(b);
+    int d = memcmp(SDATA(a), SDATA(b), min(na, nb));
+    return d < 0 || (d == 0 && na < nb);
+}
+
 /* Return true iff A < B according to the order predicate.  */
 static inline bool inorder(merge_state* ms, Lisp_Object a, Lisp_Object b) {
     return ms->pred_fun(ms, a, b);
@@ -957,6 +976,283 @@ static void reverse_sortslice(sortslice* s, const ptrdiff_t n) {
         reverse_slice(s->values, &s->values[n]);
 }
 
+/* Sort the LENGTH elements at LO, which MS was initialized for: march
+   over them once, left to right, finding natural runs and extending
+   short natural runs to minrun elements, and merge the runs.  */
+static void merge_sort_slice(merge_state* ms, sortslice lo,
+                             const ptrdiff_t length) {
+    const ptrdiff_t minrun = merge_compute_minrun(length);
+    ptrdiff_t nremaining = length;
+    do {
+        bool descending;
+
+        /* Identify the next run.  */
+        ptrdiff_t n = count_run(ms, lo.keys, lo.keys + nremaining, &descending);
+        if (descending)
+            reverse_sortslice(&lo, n);
+        /* If the run is short, extend it to min(minrun, nremaining).  */
+        if (n < minrun) {
+            const ptrdiff_t force = min(nremaining, minrun);
+            binarysort(ms, lo, lo.keys + force, lo.keys + n);
+            n = force;
+        }
+        eassume(ms->n == 0 ||
+                (ms->pending[ms->n - 1].base.keys +
+                     ms->pending[ms->n - 1].len ==
+                 lo.keys));
+        found_new_run(ms, n);
+        /* Push the new run on to the stack.  */
+        eassume(ms->n < MAX_MERGE_PENDING);
+        ms->pending[ms->n].base = lo;
+        ms->pending[ms->n].len = n;
+        ++ms->n;
+        /* Advance to find the next run.  */
+        sortslice_advance(&lo, n);
+        nremaining -= n;
+    } while (nremaining);
+
+    merge_force_collapse(ms);
+    eassume(ms->n == 1);
+    eassume(ms->pending[0].len == length);
+}
+
+
+/* What the keys of a sort ordered by value< all are.  value< orders
+   any of these but SORT_KEYS_ANY without signaling, allocating or
+   looking at global state, so they can be compared on any thread.  */
+
+enum sort_keys
+{
+    SORT_KEYS_ANY,
+    /* Numbers or strings of different representations.  */
+    SORT_KEYS_NUMBER,
+    SORT_KEYS_STRING,
+    /* Fixnums, floats other than NaNs, and strings whose characters are
+       their bytes, which the specialized order predicates handle.  */
+    SORT_KEYS_FIXNUM,
+    SORT_KEYS_FLOAT,
+    SORT_KEYS_BYTES
+};
+
+static enum sort_keys sort_keys_kind(const Lisp_Object* keys, ptrdiff_t n) {
+    bool fixnums = true, floats = true, bytes = true;
+    bool numbers = true, strings = true;
+    for (ptrdiff_t i = 0; i < n; i++) {
+        Lisp_Object key = keys[i];
+        if (FIXNUMP(key))
+            floats = strings = false;
+        else if (FLOATP(key)) {
+            fixnums = strings = false;
+            if (isnan(XFLOAT_DATA(key)))
+                floats = false;
+        }
+        else if (STRINGP(key)) {
+            fixnums = floats = numbers = false;
+            if (STRING_MULTIBYTE(key) && SCHARS(key) != SBYTES(key))
+                bytes = false;
+        }
+        else if (BIGNUMP(key))
+            fixnums = floats = strings = false;
+        else
+            return SORT_KEYS_ANY;
+        if (!numbers && !strings)
+            return SORT_KEYS_ANY;
+    }
+    return (fixnums  ? SORT_KEYS_FIXNUM
+            : floats ? SORT_KEYS_FLOAT
+            : numbers ? SORT_KEYS_NUMBER
+            : bytes   ? SORT_KEYS_BYTES
+                      : SORT_KEYS_STRING);
+}
+
+
+/* Sorts of at least SORT_RADIX_MIN fixnum or float keys are radix
+   sorts, which never compare keys: an LSD radix sort on the bits of
+   the keys, one byte at a time.  */
+
+enum
+{
+    SORT_RADIX_MIN = 1024
+};
+
+struct radix_item {
+    uint64_t bits;
+    ptrdiff_t index;
+};
+
+/* Return bits that are ordered as unsigned integers like KEY, a fixnum
+   or a float other than a NaN, is by value<.  */
+static uint64_t radix_bits(Lisp_Object key) {
+    if (FIXNUMP(key))
+        return (uint64_t)XFIXNUM(key) ^ ((uint64_t)1 << 63);
+
+    /* -0.0 and 0.0 are equal; make them look the same.  */
+    double d = XFLOAT_DATA(key) + 0.0;
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof bits);
+    return bits >> 63 ? ~bits : bits | ((uint64_t)1 << 63);
+}
+
+/* Stably sort the LENGTH elements at LO, whose keys are all fixnums or
+   all floats other than NaNs.  */
+static void radix_sort(sortslice lo, const ptrdiff_t length) {
+    /* Two arrays of items, between which the passes go back and forth,
+       and room for a copy of the keys or values.  */
+    struct radix_item* block =
+        xnmalloc(length, 2 * sizeof *block + word_size);
+    struct radix_item* items = block;
+    struct radix_item* spare = block + length;
+    Lisp_Object* copy = (Lisp_Object*)(block + 2 * length);
+
+    /* Count the values of every byte of the keys in a single pass.  */
+    ptrdiff_t counts[8][256] = {0};
+    for (ptrdiff_t i = 0; i < length; i++) {
+        uint64_t bits = radix_bits(lo.keys[i]);
+        items[i] = (struct radix_item){bits, i};
+        for (int d = 0; d < 8; d++)
+            counts[d][(bits >> (8 * d)) & 0xff]++;
+    }
+
+    for (int d = 0; d < 8; d++) {
+        /* Skip a byte that is the same in all keys.  */
+        ptrdiff_t* count = counts[d];
+        if (count[(items[0].bits >> (8 * d)) & 0xff] == length)
+            continue;
+        ptrdiff_t pos = 0;
+        for (int b = 0; b < 256; b++) {
+            ptrdiff_t c = count[b];
+            count[b] = pos;
+            pos += c;
+        }
+        for (ptrdiff_t i = 0; i < length; i++)
+            spare[count[(items[i].bits >> (8 * d)) & 0xff]++] = items[i];
+        struct radix_item* t = items;
+        items = spare;
+        spare = t;
+    }
+
+    memcpy(copy, lo.keys, length * word_size);
+    for (ptrdiff_t i = 0; i < length; i++)
+        lo.keys[i] = copy[items[i].index];
+    if (lo.values != NULL) {
+        memcpy(copy, lo.values, length * word_size);
+        for (ptrdiff_t i = 0; i < length; i++)
+            lo.values[i] = copy[items[i].index];
+    }
+
+    xfree(block);
+}
+
+
+/* A sort of at least SORT_PARALLEL_MIN elements ordered by value< is
+   done in parallel if its keys allow: the elements are cut into up to
+   SORT_MAX_SLICES slices, which are sorted by as many threads, and then
+   merged pairwise, half as many at a time.  */
+
+enum
+{
+    SORT_PARALLEL_MIN = 1 << 16,
+    SORT_MAX_SLICES = 16
+};
+
+/* Sort the LEN elements at LO or, if LEN2 is positive, merge them with
+   the LEN2 sorted elements that follow them.  MS has its own temporary
+   storage, large enough that it allocates none.  */
+struct sort_task {
+    merge_state ms;
+    sortslice lo;
+    ptrdiff_t len, len2;
+};
+
+/* Set up TASK to work on the LEN elements at LO, and LEN2 more if
+   LEN2 is positive, in the order of MAIN_MS, with the storage at TMP as
+   its temporary array.  */
+static void sort_task_init(struct sort_task* task, merge_state* main_ms,
+                           sortslice lo, ptrdiff_t len, ptrdiff_t len2,
+                           sortslice tmp) {
+    merge_state* ms = &task->ms;
+    ms->a = tmp;
+    ms->alloced = len + len2;
+    ms->n = 0;
+    ms->min_gallop = GALLOP_WIN_MIN;
+    ms->listlen = len + len2;
+    ms->basekeys = lo.keys;
+    ms->allocated_keys = NULL;
+    ms->pred_fun = main_ms->pred_fun;
+    ms->predicate = Qnil;
+    ms->reloc = (struct reloc){NULL, NULL, NULL, 0};
+    ms->count = make_invalid_specpdl_ref();
+    task->lo = lo;
+    task->len = len;
+    task->len2 = len2;
+}
+
+static void sort_task_run(struct sort_task* task) {
+    merge_state* ms = &task->ms;
+    if (task->len2 == 0)
+        merge_sort_slice(ms, task->lo, task->len);
+    else {
+        sortslice lo2 = task->lo;
+        sortslice_advance(&lo2, task->len);
+        ms->pending[0] = (struct stretch){task->lo, task->len, 0};
+        ms->pending[1] = (struct stretch){lo2, task->len2, 0};
+        ms->n = 2;
+        merge_at(ms, 0);
+    }
+}
+
+/* Run the tasks from START to END of the array of tasks at ARG.  */
+static void sort_tasks_run(void* arg, ptrdiff_t start, ptrdiff_t end) {
+    struct sort_task* tasks = arg;
+    for (ptrdiff_t i = start; i < end; i++)
+        sort_task_run(&tasks[i]);
+}
+
+/* Sort the LENGTH elements at LO, which MS was initialized for, by
+   value< on several threads, and return true; or return false, doing
+   nothing, if there is only one processor.  The keys must not be of
+   kind SORT_KEYS_ANY.  Nothing here signals or runs Lisp, so no GC can
+   happen while the elements are partly in the temporary storage.  */
+static bool parallel_sort(merge_state* ms, sortslice lo,
+                          const ptrdiff_t length) {
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int nslices = 1;
+    while (nslices * 2 <= min(ncpus, SORT_MAX_SLICES))
+        nslices *= 2;
+    if (nslices < 2)
+        return false;
+
+    bool values = lo.values != NULL;
+    sortslice tmp;
+    tmp.keys = xmalloc((length * word_size) << (values ? 1 : 0));
+    tmp.values = values ? tmp.keys + length : NULL;
+
+    struct sort_task tasks[SORT_MAX_SLICES];
+
+    /* Slice I holds the elements from BOUNDS[I] to BOUNDS[I + 1].  */
+    ptrdiff_t bounds[SORT_MAX_SLICES + 1];
+    for (int i = 0; i <= nslices; i++)
+        bounds[i] = length / nslices * i + min(i, length % nslices);
+
+    for (int step = 1; step < nslices * 2; step *= 2) {
+        int ntasks = 0;
+        for (int i = 0; i < nslices; i += step) {
+            ptrdiff_t beg = bounds[i];
+            ptrdiff_t mid = step == 1 ? bounds[i + 1] : bounds[i + step / 2];
+            ptrdiff_t end = bounds[min(i + step, nslices)];
+            sortslice base = lo, t = tmp;
+            sortslice_advance(&base, beg);
+            sortslice_advance(&t, beg);
+            sort_task_init(&tasks[ntasks++], ms, base, mid - beg, end - mid,
+                           t);
+        }
+        sys_parallel("sort", sort_tasks_run, tasks, ntasks, 1, ntasks - 1);
+    }
+
+    xfree(tmp.keys);
+    return true;
+}
+
 static Lisp_Object resolve_fun(Lisp_Object fun) {
     if (SYMBOLP(fun)) {
         /* Attempt to resolve the function as far as possible ahead of time,
@@ -1021,46 +1317,24 @@ void tim_sort(Lisp_Object predicate, Lisp_Object keyfunc, Lisp_Object* seq,
         for (ptrdiff_t i = 0; i < length; i++)
             keys[i] = calln(keyfunc, seq[i]);
 
-    /* FIXME: This is where we would check the keys for interesting
-       properties for more optimized comparison (such as all being fixnums
-       etc).  */
-
-    /* March over the array once, left to right, finding natural runs,
-       and extending short natural runs to minrun elements.  */
-    const ptrdiff_t minrun = merge_compute_minrun(length);
-    ptrdiff_t nremaining = length;
-    do {
-        bool descending;
-
-        /* Identify the next run.  */
-        ptrdiff_t n =
-            count_run(&ms, lo.keys, lo.keys + nremaining, &descending);
-        if (descending)
-            reverse_sortslice(&lo, n);
-        /* If the run is short, extend it to min(minrun, nremaining).  */
-        if (n < minrun) {
-            const ptrdiff_t force = min(nremaining, minrun);
-            binarysort(&ms, lo, lo.keys + force, lo.keys + n);
-            n = force;
-        }
-        eassume(ms.n == 0 ||
-                (ms.pending[ms.n - 1].base.keys + ms.pending[ms.n - 1].len ==
-                 lo.keys));
-        found_new_run(&ms, n);
-        /* Push the new run on to the stack.  */
-        eassume(ms.n < MAX_MERGE_PENDING);
-        ms.pending[ms.n].base = lo;
-        ms.pending[ms.n].len = n;
-        ++ms.n;
-        /* Advance to find the next run.  */
-        sortslice_advance(&lo, n);
-        nremaining -= n;
-    } while (nremaining);
+    /* Look at the keys for a faster way to order them by value<.  */
+    enum sort_keys kind = SORT_KEYS_ANY;
+    if (NILP(predicate)) {
+        kind = sort_keys_kind(lo.keys, length);
+        if (kind == SORT_KEYS_FIXNUM)
+            ms.pred_fun = order_pred_fixnum;
+        else if (kind == SORT_KEYS_FLOAT)
+            ms.pred_fun = order_pred_float;
+        else if (kind == SORT_KEYS_BYTES)
+            ms.pred_fun = order_pred_bytes;
+    }
 
-    merge_force_collapse(&ms);
-    eassume(ms.n == 1);
-    eassume(ms.pending[0].len == length);
-    lo = ms.pending[0].base;
+    if ((kind == SORT_KEYS_FIXNUM || kind == SORT_KEYS_FLOAT) &&
+        length >= SORT_RADIX_MIN)
+        radix_sort(lo, length);
+    else if (!(kind != SORT_KEYS_ANY && length >= SORT_PARALLEL_MIN &&
+               parallel_sort(&ms, lo, length)))
+        merge_sort_slice(&ms, lo, length);
 
     if (reverse)
         reverse_slice(seq, seq + length);
@@ -107,9 +107,16 @@ struct lisp_parse_state {
     EMACS_INT incomment; /* -1 if in unnestable comment else comment nesting */
     int comstyle; /* comment style a=0, or b=1, or ST_COMMENT_STYLE.  */
     bool quoted; /* True if just after an escape char at end of parsing.  */
+    /* True if parsing stopped inside a symbol.  Used only when resuming
+       from a syntax checkpoint.  */
+    bool insymbol;
     EMACS_INT mindepth; /* Minimum depth seen while scanning.  */
     /* Char number of most recent start-of-expression at current level */
     ptrdiff_t thislevelstart;
+    /* Char number of start of the expression being scanned at current
+       level, or -1.  This and THISLEVELSTART are used to initialize a
+       parse only when resuming from a syntax checkpoint.  */
+    ptrdiff_t thislevellast;
     /* Char number of start of containing expression */
     ptrdiff_t prevlevelstart;
     ptrdiff_t location; /* Char number at which parsing stopped.  */
@@ -145,6 +152,7 @@ static Lisp_Object scan_lists(EMACS_INT, EMACS_INT, EMACS_INT, bool);
 static void scan_sexps_forward(struct lisp_parse_state*, ptrdiff_t, ptrdiff_t,
                                ptrdiff_t, EMACS_INT, bool, int);
 static void internalize_parse_state(Lisp_Object, struct lisp_parse_state*);
+static void scan_from_begv(struct lisp_parse_state*, ptrdiff_t);
 static bool in_classes(int c, int num_classes, const unsigned char* classes);
 static void parse_sexp_propertize(ptrdiff_t charpos);
 
@@ -166,6 +174,11 @@ enum
 }; /* 1 + max-number of intervals
 to scan to property-change.  */
 
+enum
+{
+    SYNTAX_CHECKPOINT_INTERVAL = 8192
+}; /* Distance between syntax checkpoints.  */
+
 /* Set the syntax entry VAL for char C in table TABLE.  */
 
 static void SET_RAW_SYNTAX_ENTRY(Lisp_Object table, int c, Lisp_Object val) {
@@ -810,9 +823,13 @@ static bool back_comment(ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t stop,
             adjusted = (defun_start > BEGV);
         }
         do {
-            internalize_parse_state(Qnil, &state);
-            scan_sexps_forward(&state, defun_start, defun_start_byte,
-                               comment_end, TYPE_MINIMUM(EMACS_INT), 0, 0);
+            if (defun_start == BEGV)
+                scan_from_begv(&state, comment_end);
+            else {
+                internalize_parse_state(Qnil, &state);
+                scan_sexps_forward(&state, defun_start, defun_start_byte,
+                                   comment_end, TYPE_MINIMUM(EMACS_INT), 0, 0);
+            }
             defun_start = comment_end;
             if (!adjusted) {
                 adjusted = true;
@@ -1151,6 +1168,7 @@ usage: (modify-syntax-entry CHAR NEWENTRY &optional SYNTAX-TABLE)  */)
         SET_RAW_SYNTAX_ENTRY_RANGE(syntax_table, c, newentry);
     else
         SET_RAW_SYNTAX_ENTRY(syntax_table, XFIXNUM(c), newentry);
+    syntax_table_changed(syntax_table);
 
     /* We clear the regexp cache, since character classes can now have
        different values from those in the compiled regexps.*/
@@ -1506,18 +1524,103 @@ This function returns either zero or a negative number, and the absolute value
 of this is the distance traveled.  */)
 (Lisp_Object syntax, Lisp_Object lim) { return skip_syntaxes(0, syntax, lim); }
 
-static Lisp_Object skip_chars(bool forwardp, Lisp_Object string,
-                              Lisp_Object lim) {
-    int c;
+/* A STRING argument of skip-chars-forward or skip-chars-backward,
+   compiled for scanning multibyte or unibyte text.  */
+
+struct skip_set {
+    /* What this was compiled from.  */
+    unsigned char* string;
+    ptrdiff_t size_byte;
+    bool string_multibyte, multibyte;
+
+    /* True if ^ was the first character.  */
+    bool negate;
+    /* Nonzero for the bytes, or the leading codes of the characters,
+       that may be skipped.  */
     char fastmap[0400];
+    /* The ranges of non-ASCII characters.  */
+    int* char_ranges;
+    int n_char_ranges;
+    /* The character classes.  */
+    unsigned char classes[RECC_NUM_CLASSES];
+    int nclasses;
+
+    /* Nonzero for the ASCII characters that are skipped, considering
+       all classes except the DYNAMIC ones, which depend on the syntax
+       or case table of the buffer and so must be checked as we go.  */
+    char ascii[0200];
+    unsigned char dynamic[RECC_NUM_CLASSES];
+    int ndynamic;
+};
+
+/* Compiled skip sets, looked up by a hash of the string.  */
+
+enum
+{
+    SKIP_SET_CACHE_SIZE = 32
+};
+
+static struct skip_set skip_set_cache[SKIP_SET_CACHE_SIZE];
+
+/* Return true if the ASCII character C is skipped by S.  */
+
+static bool skip_set_ascii_p(struct skip_set const* s, int c) {
+    bool skip = s->ascii[c];
+
+    /* A character in a class is skipped unless S is negated, whatever
+       the fastmap says.  */
+    if (s->ndynamic && skip == s->negate &&
+        in_classes(c, s->ndynamic, s->dynamic))
+        skip = !skip;
+    return skip;
+}
+
+/* Return the number of ASCII characters skipped by S from P forward,
+   not going past STOP.  */
+
+static ptrdiff_t skip_ascii_forward(struct skip_set const* s,
+                                    unsigned char const* p,
+                                    unsigned char const* stop) {
+    unsigned char const* q = p;
+
+    if (s->ndynamic == 0)
+        while (q < stop && ASCII_CHAR_P(*q) && s->ascii[*q])
+            q++;
+    else
+        while (q < stop && ASCII_CHAR_P(*q) && skip_set_ascii_p(s, *q))
+            q++;
+    return q - p;
+}
+
+/* Return the number of ASCII characters skipped by S from P backward,
+   not going past STOP.  */
+
+static ptrdiff_t skip_ascii_backward(struct skip_set const* s,
+                                     unsigned char const* p,
+                                     unsigned char const* stop) {
+    unsigned char const* q = p;
+
+    if (s->ndynamic == 0)
+        while (q > stop && ASCII_CHAR_P(q[-1]) && s->ascii[q[-1]])
+            q--;
+    else
+        while (q > stop && ASCII_CHAR_P(q[-1]) && skip_set_ascii_p(s, q[-1]))
+            q--;
+    return p - q;
+}
+
+/* Compile STRING into S for scanning text that is MULTIBYTE, that is,
+   multibyte and containing non-ASCII characters.  */
+
+static void compile_skip_set(Lisp_Object string, bool multibyte,
+                             struct skip_set* s) {
+    int c;
+    char* fastmap = s->fastmap;
     /* Store the ranges of non-ASCII characters.  */
     int* char_ranges UNINIT;
     int n_char_ranges = 0;
     bool negate = 0;
     ptrdiff_t i, i_byte;
-    /* True if the current buffer is multibyte and the region contains
-       non-ASCII chars.  */
-    bool multibyte;
     /* True if STRING is multibyte and it contains non-ASCII chars.  */
     bool string_multibyte;
     ptrdiff_t size_byte;
@@ -1525,24 +1628,9 @@ static Lisp_Object skip_chars(bool forwardp, Lisp_Object string,
     int len;
     USE_SAFE_ALLOCA;
 
-    CHECK_STRING(string);
-
-    if (NILP(lim))
-        XSETINT(lim, forwardp ? ZV : BEGV);
-    else
-        CHECK_FIXNUM_COERCE_MARKER(lim);
-
-    /* In any case, don't allow scan outside bounds of buffer.  */
-    if (XFIXNUM(lim) > ZV)
-        XSETFASTINT(lim, ZV);
-    if (XFIXNUM(lim) < BEGV)
-        XSETFASTINT(lim, BEGV);
-
-    multibyte = (!NILP(BVAR(current_buffer, enable_multibyte_characters)) &&
-                 (XFIXNUM(lim) - PT != CHAR_TO_BYTE(XFIXNUM(lim)) - PT_BYTE));
     string_multibyte = SBYTES(string) > SCHARS(string);
 
-    memset(fastmap, 0, sizeof fastmap);
+    memset(fastmap, 0, sizeof s->fastmap);
 
     str = SDATA(string);
     size_byte = SBYTES(string);
@@ -1560,7 +1648,7 @@ static Lisp_Object skip_chars(bool forwardp, Lisp_Object string,
        them and use fastmap only for their leading codes.  */
 
     int nclasses = 0;
-    unsigned char classes[RECC_NUM_CLASSES];
+    unsigned char* classes = s->classes;
     if (!string_multibyte) {
         bool string_has_eight_bit = 0;
 
@@ -1740,22 +1828,108 @@ static Lisp_Object skip_chars(bool forwardp, Lisp_Object string,
     /* If ^ was the first character, complement the fastmap.  */
     if (negate) {
         if (!multibyte)
-            for (i = 0; i < sizeof fastmap; i++)
+            for (i = 0; i < sizeof s->fastmap; i++)
                 fastmap[i] ^= 1;
         else {
             for (i = 0; i < 0200; i++)
                 fastmap[i] ^= 1;
             /* All non-ASCII chars possibly match.  */
-            for (; i < sizeof fastmap; i++)
+            for (; i < sizeof s->fastmap; i++)
                 fastmap[i] = 1;
         }
     }
 
+    s->string_multibyte = string_multibyte;
+    s->multibyte = multibyte;
+    s->negate = negate;
+    s->n_char_ranges = n_char_ranges;
+    s->char_ranges = (n_char_ranges
+                          ? xnmalloc(n_char_ranges, sizeof *s->char_ranges)
+                          : NULL);
+    if (n_char_ranges)
+        memcpy(s->char_ranges, char_ranges,
+               n_char_ranges * sizeof *s->char_ranges);
+    s->nclasses = nclasses;
+
+    /* Whether an ASCII character is in a class depends on the buffer
+       only for these classes.  */
+    s->ndynamic = 0;
+    for (i = 0; i < nclasses; i++)
+        if (classes[i] == RECC_WORD || classes[i] == RECC_SPACE ||
+            classes[i] == RECC_UPPER || classes[i] == RECC_LOWER)
+            s->dynamic[s->ndynamic++] = classes[i];
+    for (c = 0; c < 0200; c++) {
+        bool in_class = false;
+        for (i = 0; i < nclasses && !in_class; i++)
+            in_class = (!memchr(s->dynamic, classes[i], s->ndynamic) &&
+                        re_iswctype(c, classes[i]));
+        s->ascii[c] = in_class ? !negate : fastmap[c];
+    }
+
+    SAFE_FREE();
+}
+
+/* Return STRING compiled for scanning text that is MULTIBYTE, from the
+   cache if it was compiled before.  */
+
+static struct skip_set* get_skip_set(Lisp_Object string, bool multibyte) {
+    ptrdiff_t size_byte = SBYTES(string);
+    EMACS_UINT hash = hash_char_array(SSDATA(string), size_byte);
+    struct skip_set* s = &skip_set_cache[(hash ^ multibyte) %
+                                         SKIP_SET_CACHE_SIZE];
+    struct skip_set new;
+
+    if (s->string && s->multibyte == multibyte &&
+        s->string_multibyte == (size_byte > SCHARS(string)) &&
+        s->size_byte == size_byte &&
+        memcmp(s->string, SDATA(string), size_byte) == 0)
+        return s;
+
+    /* Compile into a fresh set first, since an invalid class signals
+       an error.  */
+    compile_skip_set(string, multibyte, &new);
+    xfree(s->string);
+    xfree(s->char_ranges);
+    *s = new;
+    s->string = xmalloc(size_byte + 1);
+    memcpy(s->string, SDATA(string), size_byte);
+    s->size_byte = size_byte;
+    return s;
+}
+
+static Lisp_Object skip_chars(bool forwardp, Lisp_Object string,
+                              Lisp_Object lim) {
+    int c;
+    struct skip_set* s;
+    ptrdiff_t i;
+    /* True if the current buffer is multibyte and the region contains
+       non-ASCII chars.  */
+    bool multibyte;
+
+    CHECK_STRING(string);
+
+    if (NILP(lim))
+        XSETINT(lim, forwardp ? ZV : BEGV);
+    else
+        CHECK_FIXNUM_COERCE_MARKER(lim);
+
+    /* In any case, don't allow scan outside bounds of buffer.  */
+    if (XFIXNUM(lim) > ZV)
+        XSETFASTINT(lim, ZV);
+    if (XFIXNUM(lim) < BEGV)
+        XSETFASTINT(lim, BEGV);
+
+    multibyte = (!NILP(BVAR(current_buffer, enable_multibyte_characters)) &&
+                 (XFIXNUM(lim) - PT != CHAR_TO_BYTE(XFIXNUM(lim)) - PT_BYTE));
+
+    s = get_skip_set(string, multibyte);
+
     {
         ptrdiff_t start_point = PT;
         ptrdiff_t pos = PT;
         ptrdiff_t pos_byte = PT_BYTE;
         unsigned char *p = PT_ADDR, *endp, *stop;
+        unsigned short int quit_count = 0;
 
         if (forwardp) {
             endp =
@@ -1774,141 +1948,143 @@ static Lisp_Object skip_chars(bool forwardp, Lisp_Object string,
            what we've done in the past.  */
         SETUP_BUFFER_SYNTAX_TABLE();
         if (forwardp) {
-            if (multibyte)
-                while (1) {
-                    int nbytes;
+            while (true) {
+                int nbytes;
 
-                    if (p >= stop) {
-                        if (p >= endp)
-                            break;
-                        p = GAP_END_ADDR;
-                        stop = endp;
-                    }
-                    c = string_char_and_length(p, &nbytes);
-                    if (nclasses && in_classes(c, nclasses, classes)) {
-                        if (negate)
-                            break;
-                        else
-                            goto fwd_ok;
-                    }
+                if (p >= stop) {
+                    if (p >= endp)
+                        break;
+                    p = GAP_END_ADDR;
+                    stop = endp;
+                }
 
-                    if (!fastmap[*p])
+                /* Skip a run of ASCII characters at once.  */
+                if (ASCII_CHAR_P(*p)) {
+                    ptrdiff_t n = skip_ascii_forward(s, p, stop);
+                    if (n == 0)
                         break;
-                    if (!ASCII_CHAR_P(c)) {
-                        /* As we are looking at a multibyte character, we
-                           must look up the character in the table
-                           CHAR_RANGES.  If there's no data in the table,
-                           that character is not what we want to skip.  */
-
-                        /* The following code do the right thing even if
-                           n_char_ranges is zero (i.e. no data in
-                           CHAR_RANGES).  */
-                        for (i = 0; i < n_char_ranges; i += 2)
-                            if (c >= char_ranges[i] && c <= char_ranges[i + 1])
-                                break;
-                        if (!(negate ^ (i < n_char_ranges)))
-                            break;
-                    }
-                fwd_ok:
-                    p += nbytes, pos++, pos_byte += nbytes;
-                    rarely_quit(pos);
+                    p += n, pos += n, pos_byte += n;
+                    rarely_quit(++quit_count);
+                    continue;
                 }
-            else
-                while (true) {
-                    if (p >= stop) {
-                        if (p >= endp)
-                            break;
-                        p = GAP_END_ADDR;
-                        stop = endp;
-                    }
 
-                    if (nclasses && in_classes(*p, nclasses, classes)) {
-                        if (negate)
-                            break;
-                        else
-                            goto fwd_unibyte_ok;
-                    }
+                if (multibyte)
+                    c = string_char_and_length(p, &nbytes);
+                else
+                    c = *p, nbytes = 1;
+                if (s->nclasses && in_classes(c, s->nclasses, s->classes)) {
+                    if (s->negate)
+                        break;
+                    else
+                        goto fwd_ok;
+                }
 
-                    if (!fastmap[*p])
+                if (!s->fastmap[*p])
+                    break;
+                if (multibyte) {
+                    /* As we are looking at a multibyte character, we
+                       must look up the character in the table
+                       CHAR_RANGES.  If there's no data in the table,
+                       that character is not what we want to skip.  */
+
+                    /* The following code do the right thing even if
+                       n_char_ranges is zero (i.e. no data in
+                       CHAR_RANGES).  */
+                    for (i = 0; i < s->n_char_ranges; i += 2)
+                        if (c >= s->char_ranges[i] &&
+                            c <= s->char_ranges[i + 1])
+                            break;
+                    if (!(s->negate ^ (i < s->n_char_ranges)))
                         break;
-                fwd_unibyte_ok:
-                    p++, pos++, pos_byte++;
-                    rarely_quit(pos);
                 }
+            fwd_ok:
+                p += nbytes, pos++, pos_byte += nbytes;
+                rarely_quit(pos);
+            }
         }
         else {
-            if (multibyte)
-                while (true) {
-                    if (p <= stop) {
-                        if (p <= endp)
-                            break;
-                        p = GPT_ADDR;
-                        stop = endp;
-                    }
-                    unsigned char* prev_p = p;
+            while (true) {
+                if (p <= stop) {
+                    if (p <= endp)
+                        break;
+                    p = GPT_ADDR;
+                    stop = endp;
+                }
+
+                /* Skip a run of ASCII characters at once.  */
+                if (ASCII_CHAR_P(p[-1])) {
+                    ptrdiff_t n = skip_ascii_backward(s, p, stop);
+                    if (n == 0)
+                        break;
+                    p -= n, pos -= n, pos_byte -= n;
+                    rarely_quit(++quit_count);
+                    continue;
+                }
+
+                unsigned char* prev_p = p;
+                if (multibyte) {
                     do
                         p--;
                     while (stop <= p && !CHAR_HEAD_P(*p));
-
                     c = STRING_CHAR(p);
+                }
+                else
+                    c = *--p;
 
-                    if (nclasses && in_classes(c, nclasses, classes)) {
-                        if (negate)
-                            break;
-                        else
-                            goto back_ok;
-                    }
-
-                    if (!fastmap[*p])
+                if (s->nclasses && in_classes(c, s->nclasses, s->classes)) {
+                    if (s->negate)
                         break;
-                    if (!ASCII_CHAR_P(c)) {
-                        /* See the comment in the previous similar code.  */
-                        for (i = 0; i < n_char_ranges; i += 2)
-                            if (c >= char_ranges[i] && c <= char_ranges[i + 1])
-                                break;
-                        if (!(negate ^ (i < n_char_ranges)))
-                            break;
-                    }
-                back_ok:
-                    pos--, pos_byte -= prev_p - p;
-                    rarely_quit(pos);
+                    else
+                        goto back_ok;
                 }
-            else
-                while (true) {
-                    if (p <= stop) {
-                        if (p <= endp)
-                            break;
-                        p = GPT_ADDR;
-                        stop = endp;
-                    }
 
-                    if (nclasses && in_classes(p[-1], nclasses, classes)) {
-                        if (negate)
+                if (!s->fastmap[*p])
+                    break;
+                if (multibyte) {
+                    /* See the comment in the previous similar code.  */
+                    for (i = 0; i < s->n_char_ranges; i += 2)
+                        if (c >= s->char_ranges[i] &&
+                            c <= s->char_ranges[i + 1])
                             break;
-                        else
-                            goto back_unibyte_ok;
-                    }
-
-                    if (!fastmap[p[-1]])
+                    if (!(s->negate ^ (i < s->n_char_ranges)))
                         break;
-                back_unibyte_ok:
-                    p--, pos--, pos_byte--;
-                    rarely_quit(pos);
                 }
+            back_ok:
+                pos--, pos_byte -= prev_p - p;
+                rarely_quit(pos);
+            }
         }
 
         SET_PT_BOTH(pos, pos_byte);
 
-        SAFE_FREE();
         return make_fixnum(PT - start_point);
     }
 }
 
 
+/* Return whether the syntax of character C is in FASTMAP.  MEMO, if
+   not null, remembers the answers for characters less than 0400; it
+   must be null if the syntax of a character can change while
+   skip_syntaxes looks at the buffer, as it does when syntax-table
+   properties are obeyed.  */
+
+static bool syntax_in_fastmap(unsigned char const* fastmap, signed char* memo,
+                              int c) {
+    if (c >= 0400 || !memo)
+        return fastmap[SYNTAX(c)];
+    if (memo[c] < 0)
+        memo[c] = fastmap[SYNTAX(c)];
+    return memo[c];
+}
+
 static Lisp_Object skip_syntaxes(bool forwardp, Lisp_Object string,
                                  Lisp_Object lim) {
     int c;
     unsigned char fastmap[0400];
+    /* Whether characters less than 0400 have a syntax in FASTMAP, or -1
+       if not known yet.  */
+    signed char memo_table[0400];
+    signed char* memo;
     bool negate = 0;
     ptrdiff_t i, i_byte;
     bool multibyte;
@@ -1935,6 +2111,7 @@ static Lisp_Object skip_syntaxes(bool forwardp, Lisp_Object string,
                  (XFIXNUM(lim) - PT != CHAR_TO_BYTE(XFIXNUM(lim)) - PT_BYTE));
 
     memset(fastmap, 0, sizeof fastmap);
+    memset(memo_table, -1, sizeof memo_table);
 
     if (SBYTES(string) > SCHARS(string))
         /* As this is very rare case (syntax spec is ASCII only), don't
@@ -1969,6 +2146,9 @@ static Lisp_Object skip_syntaxes(bool forwardp, Lisp_Object string,
         unsigned char *p, *endp, *stop;
 
         SETUP_SYNTAX_TABLE(pos, forwardp ? 1 : -1);
+        /* Decide after SETUP_SYNTAX_TABLE, which can run syntax-propertize
+           and so set parse-sexp-lookup-properties.  */
+        memo = parse_sexp_lookup_properties ? NULL : memo_table;
 
         if (forwardp) {
             while (true) {
@@ -1990,7 +2170,7 @@ static Lisp_Object skip_syntaxes(bool forwardp, Lisp_Object string,
                         c = string_char_and_length(p, &nbytes);
                     else
                         c = *p, nbytes = 1;
-                    if (!fastmap[SYNTAX(c)])
+                    if (!syntax_in_fastmap(fastmap, memo, c))
                         goto done;
                     p += nbytes, pos++, pos_byte += nbytes;
                     rarely_quit(pos);
@@ -2021,7 +2201,7 @@ static Lisp_Object skip_syntaxes(bool forwardp, Lisp_Object string,
                     while (stop <= p && !CHAR_HEAD_P(*p));
 
                     c = STRING_CHAR(p);
-                    if (!fastmap[SYNTAX(c)])
+                    if (!syntax_in_fastmap(fastmap, memo, c))
                         break;
                     pos--, pos_byte -= prev_p - p;
                     rarely_quit(pos);
@@ -2036,7 +2216,7 @@ static Lisp_Object skip_syntaxes(bool forwardp, Lisp_Object string,
                         stop = endp;
                     }
                     UPDATE_SYNTAX_TABLE_BACKWARD(pos - 1);
-                    if (!fastmap[SYNTAX(p[-1])])
+                    if (!syntax_in_fastmap(fastmap, memo, p[-1]))
                         break;
                     p--, pos--, pos_byte--;
                     rarely_quit(pos);
@@ -2925,6 +3105,7 @@ static void scan_sexps_forward(struct lisp_parse_state* state, ptrdiff_t from,
             when the depth becomes negative.  */
     EMACS_INT mindepth; /* Lowest DEPTH value seen.  */
     bool start_quoted = 0; /* True means starting after a char quote.  */
+    bool start_insymbol; /* True means starting inside a symbol.  */
     Lisp_Object tem;
     ptrdiff_t prev_from; /* Keep one character before FROM.  */
     ptrdiff_t prev_from_byte;
@@ -2959,6 +3140,7 @@ static void scan_sexps_forward(struct lisp_parse_state* state, ptrdiff_t from,
 
     depth = state->depth;
     start_quoted = state->quoted;
+    start_insymbol = state->insymbol;
     prev_prev_from_syntax = Smax;
     prev_from_syntax = state->prev_syntax;
 
@@ -2974,10 +3156,11 @@ static void scan_sexps_forward(struct lisp_parse_state* state, ptrdiff_t from,
         curlevel->last = -1;
         tem = Fcdr(tem);
     }
-    curlevel->prev = -1;
-    curlevel->last = -1;
+    curlevel->prev = state->thislevelstart;
+    curlevel->last = state->thislevellast;
 
     state->quoted = 0;
+    state->insymbol = false;
     mindepth = depth;
 
     SETUP_SYNTAX_TABLE(from, 1);
@@ -2994,6 +3177,8 @@ static void scan_sexps_forward(struct lisp_parse_state* state, ptrdiff_t from,
     }
     else if (start_quoted)
         goto startquoted;
+    else if (start_insymbol)
+        goto symstarted;
     else if ((from < end) &&
              (in_2char_comment_start(state, prev_from_syntax, prev_from,
                                      from_byte))) {
@@ -3063,6 +3248,8 @@ static void scan_sexps_forward(struct lisp_parse_state* state, ptrdiff_t from,
                 INC_FROM;
                 rarely_quit(++quit_count);
             }
+            /* Stopped at END before the symbol ended.  */
+            state->insymbol = true;
         symdone:
             curlevel->prev = curlevel->last;
             break;
@@ -3219,6 +3406,7 @@ done:
     state->depth = depth;
     state->mindepth = mindepth;
     state->thislevelstart = curlevel->prev;
+    state->thislevellast = curlevel->last;
     state->prevlevelstart =
         (curlevel == levelstart) ? -1 : (curlevel - 1)->last;
     state->location = from;
@@ -3246,6 +3434,9 @@ static void internalize_parse_state(Lisp_Object external,
                                     struct lisp_parse_state* state) {
     Lisp_Object tem;
 
+    state->thislevelstart = -1;
+    state->thislevellast = -1;
+    state->insymbol = false;
     if (NILP(external)) {
         state->depth = 0;
         state->instring = -1;
@@ -3302,6 +3493,266 @@ static void internalize_parse_state(Lisp_Object external,
     }
 }
 
+/* Syntax checkpoints.
+
+   Parsing from the start of the accessible portion of the buffer, as
+   back_comment does when it cannot tell where a comment starts and
+   parse-partial-sexp does when called from there without an old
+   state, takes time proportional to the distance parsed.  scan_from_begv
+   records the parse state every SYNTAX_CHECKPOINT_INTERVAL characters
+   of such parses, and starts the next one at the last checkpoint before
+   its end.  The checkpoints are kept per buffer, sorted by position.
+   Changes of the text and of its properties discard the checkpoints at
+   or after the position they affect; a different syntax table, a
+   change of the syntax table or of a table it inherits from, a
+   different accessible portion or different values of the variables
+   that control parsing discard all of them.  */
+
+struct syntax_checkpoint {
+    /* The parse state at LOCATION.  */
+    EMACS_INT depth, incomment, mindepth;
+    int instring, comstyle, prev_syntax;
+    bool quoted, insymbol;
+    ptrdiff_t thislevelstart, thislevellast, comstr_start;
+    ptrdiff_t location, location_byte;
+
+    /* The starts of the enclosing expressions, outermost first, are the
+       NLEVELS elements of the LEVELS array of the syntax_checkpoints
+       at index LEVELS.  */
+    ptrdiff_t levels, nlevels;
+};
+
+struct syntax_checkpoints {
+    /* What the states were computed with.  */
+    Lisp_Object syntax_table;
+    ptrdiff_t begv;
+    bool multibyte, lookup_properties, escaped_comment_end;
+
+    struct syntax_checkpoint* points;
+    ptrdiff_t npoints, size;
+    ptrdiff_t* levels;
+    ptrdiff_t nlevels, levels_size;
+};
+
+/* Number of buffers that have syntax checkpoints.  */
+static ptrdiff_t syntax_checkpoints_count;
+
+/* Free the syntax checkpoints of buffer B, if any.  */
+
+void free_syntax_checkpoints(struct buffer* b) {
+    if (b->syntax_checkpoints) {
+        syntax_checkpoints_count--;
+        xfree(b->syntax_checkpoints->points);
+        xfree(b->syntax_checkpoints->levels);
+        xfree(b->syntax_checkpoints);
+        b->syntax_checkpoints = NULL;
+    }
+}
+
+/* Mark the syntax table the checkpoints of buffer B were computed
+   with, which syntax_table_changed looks at.  */
+
+void mark_syntax_checkpoints(struct buffer* b) {
+    if (b->syntax_checkpoints)
+        mark_object(b->syntax_checkpoints->syntax_table);
+}
+
+/* Discard the syntax checkpoints of buffer B at or after POS.  */
+
+void invalidate_syntax_checkpoints(struct buffer* b, ptrdiff_t pos) {
+    struct syntax_checkpoints* x = b->syntax_checkpoints;
+
+    if (x && x->npoints > 0 && x->points[x->npoints - 1].location >= pos) {
+        while (x->npoints > 0 && x->points[x->npoints - 1].location >= pos)
+            x->npoints--;
+        x->nlevels = (x->npoints > 0 ? x->points[x->npoints - 1].levels +
+                                           x->points[x->npoints - 1].nlevels
+                                     : 0);
+    }
+}
+
+/* Discard the syntax checkpoints computed with syntax table TABLE, or
+   with a table that inherits from it, since TABLE was modified.  */
+
+void syntax_table_changed(Lisp_Object table) {
+    Lisp_Object tail, buf;
+
+    if (syntax_checkpoints_count == 0)
+        return;
+
+    FOR_EACH_LIVE_BUFFER(tail, buf) {
+        struct buffer* b = XBUFFER(buf);
+        Lisp_Object t;
+
+        if (!b->syntax_checkpoints)
+            continue;
+        for (t = b->syntax_checkpoints->syntax_table; CHAR_TABLE_P(t);
+             t = XCHAR_TABLE(t)->parent)
+            if (EQ(t, table)) {
+                free_syntax_checkpoints(b);
+                break;
+            }
+    }
+}
+
+/* Return the syntax checkpoints of the current buffer, discarding them
+   if they were computed with different settings, or null if the buffer
+   shouldn't have any.  */
+
+static struct syntax_checkpoints* syntax_checkpoints_for(void) {
+    struct buffer* b = current_buffer;
+    struct syntax_checkpoints* x = b->syntax_checkpoints;
+    bool multibyte = !NILP(BVAR(b, enable_multibyte_characters));
+
+    /* insdel.c only informs the base buffer about changes of the text
+       an indirect buffer shares with it.  */
+    if (b->base_buffer)
+        return NULL;
+
+    if (x == NULL) {
+        x = b->syntax_checkpoints = xzalloc(sizeof *x);
+        syntax_checkpoints_count++;
+    }
+    else if (EQ(x->syntax_table, BVAR(b, syntax_table)) &&
+             x->begv == BEGV &&
+             x->multibyte == multibyte &&
+             x->lookup_properties == parse_sexp_lookup_properties &&
+             x->escaped_comment_end == comment_end_can_be_escaped)
+        return x;
+
+    x->npoints = 0;
+    x->nlevels = 0;
+    x->syntax_table = BVAR(b, syntax_table);
+    x->begv = BEGV;
+    x->multibyte = multibyte;
+    x->lookup_properties = parse_sexp_lookup_properties;
+    x->escaped_comment_end = comment_end_can_be_escaped;
+    return x;
+}
+
+/* Append to X a checkpoint for STATE, whose minimum depth since BEGV
+   is MINDEPTH.  */
+
+static void syntax_checkpoint_add(struct syntax_checkpoints* x,
+                                  struct lisp_parse_state* state,
+                                  EMACS_INT mindepth) {
+    struct syntax_checkpoint* p;
+    Lisp_Object tem;
+
+    if (x->npoints == x->size)
+        x->points = xpalloc(x->points, &x->size, 1, -1, sizeof *x->points);
+    p = &x->points[x->npoints++];
+    *p = (struct syntax_checkpoint){
+        .depth = state->depth,
+        .incomment = state->incomment,
+        .mindepth = mindepth,
+        .instring = state->instring,
+        .comstyle = state->comstyle,
+        .prev_syntax = state->prev_syntax,
+        .quoted = state->quoted,
+        .insymbol = state->insymbol,
+        .thislevelstart = state->thislevelstart,
+        .thislevellast = state->thislevellast,
+        .comstr_start = state->comstr_start,
+        .location = state->location,
+        .location_byte = state->location_byte,
+        .levels = x->nlevels,
+    };
+
+    for (tem = state->levelstarts; CONSP(tem); tem = XCDR(tem)) {
+        if (x->nlevels == x->levels_size)
+            x->levels =
+                xpalloc(x->levels, &x->levels_size, 1, -1, sizeof *x->levels);
+        x->levels[x->nlevels++] = XFIXNUM(XCAR(tem));
+    }
+    p->nlevels = x->nlevels - p->levels;
+}
+
+/* Set STATE to the state of checkpoint P of X.  */
+
+static void syntax_checkpoint_restore(struct syntax_checkpoints* x,
+                                      struct syntax_checkpoint* p,
+                                      struct lisp_parse_state* state) {
+    ptrdiff_t i;
+
+    state->depth = p->depth;
+    state->incomment = p->incomment;
+    state->mindepth = p->mindepth;
+    state->instring = p->instring;
+    state->comstyle = p->comstyle;
+    state->prev_syntax = p->prev_syntax;
+    state->quoted = p->quoted;
+    state->insymbol = p->insymbol;
+    state->thislevelstart = p->thislevelstart;
+    state->thislevellast = p->thislevellast;
+    state->comstr_start = p->comstr_start;
+    state->location = p->location;
+    state->location_byte = p->location_byte;
+    state->levelstarts = Qnil;
+    for (i = p->levels + p->nlevels; i > p->levels; i--)
+        state->levelstarts =
+            Fcons(make_fixnum(x->levels[i - 1]), state->levelstarts);
+}
+
+/* Parse forward from BEGV to END, assuming that BEGV is the beginning
+   of a function, and return the state of the parse at END in STATE.
+   This is scan_sexps_forward without stop conditions, but starts at the
+   last syntax checkpoint before END and records new ones.  */
+
+static void scan_from_begv(struct lisp_parse_state* state, ptrdiff_t end) {
+    struct syntax_checkpoints* x = syntax_checkpoints_for();
+    ptrdiff_t from = BEGV, from_byte = BEGV_BYTE;
+    ptrdiff_t n = 0;
+    EMACS_INT mindepth = 0;
+
+    internalize_parse_state(Qnil, state);
+    if (x) {
+        ptrdiff_t lo = 0, hi = x->npoints;
+
+        while (lo < hi) {
+            ptrdiff_t mid = lo + (hi - lo) / 2;
+            if (x->points[mid].location <= end)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        n = lo;
+        if (n > 0) {
+            syntax_checkpoint_restore(x, &x->points[n - 1], state);
+            mindepth = state->mindepth;
+            from = state->location;
+            from_byte = state->location_byte;
+        }
+        /* The checkpoints after END are already there.  */
+        if (n < x->npoints)
+            x = NULL;
+    }
+
+    while (true) {
+        ptrdiff_t to = (x && end - from > SYNTAX_CHECKPOINT_INTERVAL
+                            ? from + SYNTAX_CHECKPOINT_INTERVAL
+                            : end);
+
+        scan_sexps_forward(state, from, from_byte, to,
+                           TYPE_MINIMUM(EMACS_INT), 0, 0);
+        mindepth = min(mindepth, state->mindepth);
+        if (to == end)
+            break;
+        from = state->location;
+        from_byte = state->location_byte;
+
+        /* syntax-propertize, run while parsing, can change the text
+           properties before FROM and so discard checkpoints.  */
+        if (x == current_buffer->syntax_checkpoints && x->npoints == n) {
+            syntax_checkpoint_add(x, state, mindepth);
+            n++;
+        }
+        else
+            x = NULL;
+    }
+    state->mindepth = mindepth;
+}
+
 DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
        doc: /* Parse Lisp syntax starting at FROM until TO; return status of parse at TO.
 Parsing stops at TO or when certain criteria are met;
@@ -3357,11 +3808,17 @@ Sixth arg COMMENTSTOP non-nil means stop after the start of a comment.
         error("End position is smaller than start position");
 
     validate_region(&from, &to);
-    internalize_parse_state(oldstate, &state);
-    scan_sexps_forward(
-        &state, XFIXNUM(from), CHAR_TO_BYTE(XFIXNUM(from)), XFIXNUM(to), target,
-        !NILP(stopbefore),
-        (NILP(commentstop) ? 0 : (EQ(commentstop, Qsyntax_table) ? -1 : 1)));
+    if (XFIXNUM(from) == BEGV && NILP(oldstate) && NILP(targetdepth) &&
+        NILP(stopbefore) && NILP(commentstop))
+        scan_from_begv(&state, XFIXNUM(to));
+    else {
+        internalize_parse_state(oldstate, &state);
+        scan_sexps_forward(
+            &state, XFIXNUM(from), CHAR_TO_BYTE(XFIXNUM(from)), XFIXNUM(to),
+            target, !NILP(stopbefore),
+            (NILP(commentstop) ? 0
+                               : (EQ(commentstop, Qsyntax_table) ? -1 : 1)));
+    }
 
     SET_PT_BOTH(state.location, state.location_byte);
 
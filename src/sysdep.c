@@ -35,6 +35,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 
 #include "blockinput.h"
 #include "lisp.h"
+#include "pdumper.h"
 #include "sysselect.h"
 
 #ifdef HAVE_LINUX_FS_H
@@ -1405,6 +1406,8 @@ void reset_sys_modes(struct tty_display_info* tty_out) {
     if (!tty_out->output)
         return; /* The tty is suspended. */
 
+    tty_flush_composed(tty_out);
+
     /* Go to and clear the last line of the terminal. */
 
     cmgoto(tty_out, FrameRows(tty_out) - 1, 0);
@@ -1963,6 +1966,7 @@ void init_signals(void) {
 #endif
     if (!init_sigsegv())
         sigaction(SIGSEGV, &thread_fatal_action, 0);
+    pdumper_init_signals();
 #ifdef SIGSYS
     sigaction(SIGSYS, &thread_fatal_action, 0);
 #endif
@@ -439,3 +439,84 @@ void sys_thread_yield(void) { Sleep(0); }
 #error port me
 
 #endif
+
+/* A job that sys_parallel splits over threads.  */
+struct sys_parallel_job {
+    char const* name;
+    sys_parallel_function* fn;
+    void* arg;
+    /* The work is items 0..N, handed out CHUNK at a time.  */
+    ptrdiff_t n, chunk;
+    /* The first item not handed out yet.  */
+    ptrdiff_t next;
+    /* Number of workers still running.  */
+    int nworkers;
+    sys_mutex_t mutex;
+    sys_cond_t cond;
+};
+
+/* Do the next chunk of JOB.  Return false if there was none left.  */
+static bool sys_parallel_step(struct sys_parallel_job* job) {
+    sys_mutex_lock(&job->mutex);
+    ptrdiff_t start = job->next;
+    ptrdiff_t end = start + min(job->chunk, job->n - start);
+    job->next = end;
+    sys_mutex_unlock(&job->mutex);
+    if (start == end)
+        return false;
+    job->fn(job->arg, start, end);
+    return true;
+}
+
+static void* sys_parallel_worker(void* arg) {
+    struct sys_parallel_job* job = arg;
+    sys_thread_set_name(job->name);
+    while (sys_parallel_step(job))
+        continue;
+    sys_mutex_lock(&job->mutex);
+    job->nworkers--;
+    sys_cond_broadcast(&job->cond);
+    sys_mutex_unlock(&job->mutex);
+    return NULL;
+}
+
+/* Call FN (ARG, START, END) for consecutive ranges covering items 0..N,
+   CHUNK items at most at a time, on this thread and on up to NWORKERS
+   worker threads called NAME.  FN must not use Lisp or allocate Lisp
+   objects, and the ranges must not share data that FN writes.  Return
+   when all are done, with the number of workers that were started.  */
+int sys_parallel(char const* name, sys_parallel_function* fn, void* arg,
+                 ptrdiff_t n, ptrdiff_t chunk, int nworkers) {
+    if (nworkers <= 0) {
+        if (n > 0)
+            fn(arg, 0, n);
+        return 0;
+    }
+
+    struct sys_parallel_job job = {
+        .name = name, .fn = fn, .arg = arg, .n = n, .chunk = chunk};
+    sys_mutex_init(&job.mutex);
+    sys_cond_init(&job.cond);
+    int started = 0;
+    for (; started < nworkers; started++) {
+        sys_thread_t thread;
+        sys_mutex_lock(&job.mutex);
+        job.nworkers++;
+        sys_mutex_unlock(&job.mutex);
+        if (!sys_thread_create(&thread, sys_parallel_worker, &job)) {
+            sys_mutex_lock(&job.mutex);
+            job.nworkers--;
+            sys_mutex_unlock(&job.mutex);
+            break;
+        }
+    }
+
+    while (sys_parallel_step(&job))
+        continue;
+    sys_mutex_lock(&job.mutex);
+    while (job.nworkers > 0)
+        sys_cond_wait(&job.cond, &job.mutex);
+    sys_mutex_unlock(&job.mutex);
+    sys_cond_destroy(&job.cond);
+    return started;
+}
@@ -161,4 +161,12 @@ NODISCARD extern bool sys_thread_create(sys_thread_t*,
 extern void sys_thread_yield(void);
 extern void sys_thread_set_name(const char*);
 
+/* A function that does items START to END of a job split over
+   threads.  */
+typedef void(sys_parallel_function)(void* arg, ptrdiff_t start,
+                                    ptrdiff_t end);
+
+extern int sys_parallel(char const*, sys_parallel_function*, void*,
+                        ptrdiff_t, ptrdiff_t, int);
+
 #endif /* SYSTHREAD_H */
@@ -67,8 +67,10 @@ static int been_here = -1;
 #ifndef HAVE_ANDROID
 
 static void tty_set_scroll_region(struct frame* f, int start, int stop);
-static void turn_on_face(struct frame* f, struct face* face);
-static void turn_off_face(struct frame* f, struct face* face);
+static void turn_on_face(struct tty_display_info* tty, struct face* face);
+static void turn_off_face(struct tty_display_info* tty, struct face* face);
+static void tty_use_face(struct tty_display_info* tty, struct face* face);
+static void tty_release_face(struct tty_display_info* tty);
 static void tty_turn_off_highlight(struct tty_display_info*);
 static void tty_background_highlight(struct tty_display_info* tty);
 static void clear_tty_hooks(struct terminal* terminal);
@@ -223,6 +225,7 @@ static void tty_reset_terminal_modes(struct terminal* terminal) {
 
     if (tty->output) {
         tty_send_additional_strings(terminal, Qtty_mode_reset_strings);
+        tty_release_face(tty);
         tty_turn_off_highlight(tty);
         tty_turn_off_insert(tty);
         OUTPUT_IF(tty, tty->TS_end_keypad_mode);
@@ -248,6 +251,68 @@ static void tty_update_end(struct frame* f) {
     fflush(tty->output);
 }
 
+/* Sequences starting and ending a synchronized update (DEC private
+   mode 2026).  Terminals that support it display nothing of the update
+   until it ends; others ignore them.  */
+#define SYNCHRONIZED_UPDATE_BEGIN "\033[?2026h"
+#define SYNCHRONIZED_UPDATE_END "\033[?2026l"
+
+/* Start collecting the output to TTY in memory instead of sending it
+   piecemeal through the stdio buffer, so that all of a frame update
+   reaches the terminal in a single write.  The output is sent by
+   tty_flush_composed.  */
+
+void tty_begin_composing(struct tty_display_info* tty) {
+    if (!tty->output)
+        return;
+
+    /* Output of an update that was never flushed goes out first.  */
+    tty_flush_composed(tty);
+
+    if (!tty->compose_stream) {
+        tty->compose_stream =
+            open_memstream(&tty->compose_buffer, &tty->compose_size);
+        if (!tty->compose_stream)
+            return;
+    }
+    rewind(tty->compose_stream);
+    tty->composed_output = tty->output;
+    tty->output = tty->compose_stream;
+
+    tty->compose_synchronized = tty_synchronized_update;
+    if (tty->compose_synchronized)
+        fputs(SYNCHRONIZED_UPDATE_BEGIN, tty->output);
+}
+
+/* Send the output to TTY composed since tty_begin_composing to the
+   terminal, and let further output go to the terminal directly.  */
+
+void tty_flush_composed(struct tty_display_info* tty) {
+    FILE* out = tty->composed_output;
+    if (!out)
+        return;
+
+    tty_release_face(tty);
+    if (tty->compose_synchronized)
+        fputs(SYNCHRONIZED_UPDATE_END, tty->output);
+    tty->output = out;
+    tty->composed_output = NULL;
+
+    fflush(tty->compose_stream);
+    off_t size = ftello(tty->compose_stream);
+    off_t empty = (tty->compose_synchronized
+                       ? (sizeof SYNCHRONIZED_UPDATE_BEGIN - 1 +
+                          sizeof SYNCHRONIZED_UPDATE_END - 1)
+                       : 0);
+    if (size > empty) {
+        /* Whatever was written before composing started precedes it.  */
+        fflush(out);
+        block_input();
+        emacs_write(fileno(out), tty->compose_buffer, size);
+        unblock_input();
+    }
+}
+
 /* The implementation of set_terminal_window for termcap frames. */
 
 static void tty_set_terminal_window(struct frame* f, int size) {
@@ -343,6 +408,7 @@ void tty_show_cursor(struct tty_display_info* tty) {
    depends on the user option inverse-video.  */
 
 static void tty_background_highlight(struct tty_display_info* tty) {
+    tty_release_face(tty);
     if (inverse_video)
         tty_turn_on_highlight(tty);
     else
@@ -698,10 +764,9 @@ static void tty_write_glyphs_1(struct frame* f, struct glyph* string, int len) {
                 string[n].frame != face_id_frame)
                 break;
 
-        /* Turn appearance modes of the face of the run on.  */
-        tty_highlight_if_desired(tty);
-        struct face* face = FACE_FROM_ID(face_id_frame, face_id);
-        turn_on_face(f, face);
+        /* Turn appearance modes of the face of the run on.  They are
+           left on for the next run.  */
+        tty_use_face(tty, FACE_FROM_ID(face_id_frame, face_id));
 
         if (n == stringlen)
             /* This is the last run.  */
@@ -716,12 +781,10 @@ static void tty_write_glyphs_1(struct frame* f, struct glyph* string, int len) {
                 fwrite(conversion_buffer, 1, coding->produced, tty->termscript);
             unblock_input();
         }
-
-        /* Turn appearance modes off.  */
-        turn_off_face(f, face);
-        tty_turn_off_highlight(tty);
     }
 
+    if (curX(tty) == FrameCols(tty))
+        tty_release_face(tty);
     cmcheckmagic(tty);
 }
 
@@ -760,8 +823,7 @@ static void tty_write_glyphs_with_face(struct frame* f, struct glyph* string,
     coding->mode &= ~CODING_MODE_LAST_BLOCK;
 
     /* Turn appearance modes of the face.  */
-    tty_highlight_if_desired(tty);
-    turn_on_face(f, face);
+    tty_use_face(tty, face);
 
     coding->mode |= CODING_MODE_LAST_BLOCK;
     conversion_buffer = encode_terminal_code(string, len, coding);
@@ -774,10 +836,8 @@ static void tty_write_glyphs_with_face(struct frame* f, struct glyph* string,
         unblock_input();
     }
 
-    /* Turn appearance modes off.  */
-    turn_off_face(f, face);
-    tty_turn_off_highlight(tty);
-
+    if (curX(tty) == FrameCols(tty))
+        tty_release_face(tty);
     cmcheckmagic(tty);
 }
 
@@ -794,6 +854,7 @@ static void tty_insert_glyphs(struct frame* f, struct glyph* start, int len) {
 
     struct tty_display_info* tty = FRAME_TTY(f);
 
+    tty_release_face(tty);
     if (tty->TS_ins_multi_chars) {
         // buf = tparam(tty->TS_ins_multi_chars, 0, 0, len, 0, 0, 0);
         // OUTPUT1(tty, buf);
@@ -833,7 +894,7 @@ static void tty_insert_glyphs(struct frame* f, struct glyph* start, int len) {
             int face_id = start->face_id;
             struct frame* face_id_frame = start->frame;
             face = FACE_FROM_ID(face_id_frame, face_id);
-            turn_on_face(f, face);
+            turn_on_face(tty, face);
             glyph = start;
             ++start;
             /* We must open sufficient space for a character which
@@ -861,7 +922,7 @@ static void tty_insert_glyphs(struct frame* f, struct glyph* start, int len) {
 
         OUTPUT1_IF(tty, tty->TS_pad_inserted_char);
         if (face) {
-            turn_off_face(f, face);
+            turn_off_face(tty, face);
             tty_turn_off_highlight(tty);
         }
     }
@@ -879,6 +940,7 @@ static void tty_write_glyphs(struct frame* f, struct glyph* string, int len) {
      that we can shift that one glyph into the last column.  FIXME:
      Assuming a display width of 1 looks questionable, but that's
      done everywhere else involving auto-wrap.  */
+        tty_release_face(tty);
         if (len == 1) {
             cmgoto(tty, curY(tty), curX(tty) - 1);
             --string;
@@ -905,6 +967,7 @@ static void tty_delete_glyphs(struct frame* f, int n) {
 
     struct tty_display_info* tty = FRAME_TTY(f);
 
+    tty_release_face(tty);
     if (tty->delete_in_insert_mode) {
         tty_turn_on_insert(tty);
     }
@@ -1811,13 +1874,11 @@ static void produce_glyphless_glyph(struct it* it, Lisp_Object acronym) {
 #define MAY_USE_WITH_COLORS_P(tty, ATTR)                                       \
     (tty->TN_max_colors > 0 ? (tty->TN_no_color_video & (ATTR)) == 0 : 1)
 
-/* Turn appearances of face FACE_ID on tty frame F on.
-   FACE_ID is a realized face ID number, in the face cache.  */
+/* Turn appearances of FACE on TTY on.  */
 
-static void turn_on_face(struct frame* f, struct face* face) {
+static void turn_on_face(struct tty_display_info* tty, struct face* face) {
     unsigned long fg = face->foreground;
     unsigned long bg = face->background;
-    struct tty_display_info* tty = FRAME_TTY(f);
 
     if (MAY_USE_WITH_COLORS_P(tty, NC_REVERSE) &&
         (inverse_video ? fg == FACE_TTY_DEFAULT_FG_COLOR ||
@@ -1868,11 +1929,9 @@ static void turn_on_face(struct frame* f, struct face* face) {
 }
 
 
-/* Turn off appearances of face FACE_ID on tty frame F.  */
-
-static void turn_off_face(struct frame* f, struct face* face) {
-    struct tty_display_info* tty = FRAME_TTY(f);
+/* Turn off appearances of FACE on TTY.  */
 
+static void turn_off_face(struct tty_display_info* tty, struct face* face) {
     if (tty->TS_exit_attribute_mode) {
         /* Capability "me" will turn off appearance modes double-bright,
      half-bright, reverse-video, standout, underline.  It may or
@@ -1901,6 +1960,44 @@ static void turn_off_face(struct frame* f, struct face* face) {
         OUTPUT1_IF(tty, tty->TS_orig_pair);
 }
 
+/* Return true if turning on faces A and B sends the same sequences to
+   the terminal.  */
+
+static bool tty_same_appearance_p(struct face* a, struct face* b) {
+    return (a->foreground == b->foreground &&
+            a->background == b->background && a->underline == b->underline &&
+            a->underline_color == b->underline_color &&
+            a->tty_bold_p == b->tty_bold_p &&
+            a->tty_italic_p == b->tty_italic_p &&
+            a->tty_reverse_p == b->tty_reverse_p &&
+            a->tty_strike_through_p == b->tty_strike_through_p);
+}
+
+/* Make the terminal display text in the appearance of FACE.  Nothing
+   is sent if the appearance already active is the same.  */
+
+static void tty_use_face(struct tty_display_info* tty, struct face* face) {
+    if (tty->face_active && tty_same_appearance_p(&tty->active_face, face))
+        return;
+    tty_release_face(tty);
+    tty_highlight_if_desired(tty);
+    turn_on_face(tty, face);
+    tty->active_face = *face;
+    tty->face_active = true;
+}
+
+/* Turn off the appearance left on by the last glyphs written, if any.
+   Everything that clears, scrolls or otherwise depends on the
+   terminal's default appearance must call this first.  */
+
+static void tty_release_face(struct tty_display_info* tty) {
+    if (tty->face_active) {
+        tty->face_active = false;
+        turn_off_face(tty, &tty->active_face);
+        tty_turn_off_highlight(tty);
+    }
+}
+
 #endif /* !HAVE_ANDROID */
 
 /* Return true if the terminal on frame F supports all of the
@@ -2400,6 +2497,7 @@ void tty_draw_row_with_mouse_face(struct window* w,
     }
 
     /* Restore cursor where it was before.  */
+    tty_release_face(tty);
     cursor_to(f, save_y, save_x);
 }
 
@@ -3008,6 +3106,7 @@ static void restore_desired_matrix(struct frame* f,
             to->hash = row_hash(to);
         else
             to->hash = from->hash;
+        to->line_hash_p = false;
     }
 }
 
@@ -4450,6 +4549,12 @@ static void delete_tty(struct terminal* terminal) {
 
     delete_terminal(terminal);
 
+    tty_flush_composed(tty);
+    if (tty->compose_stream) {
+        fclose(tty->compose_stream);
+        free(tty->compose_buffer);
+    }
+
     xfree(tty->name);
     xfree(tty->type);
 
@@ -4680,6 +4785,14 @@ functioning of some software, such as screen readers.  Set this to
 non-nil to enable this optimization.  */);
     tty_cursor_movement_use_TAB_BS = 0;
 
+    DEFVAR_BOOL ("tty-synchronized-update", tty_synchronized_update,
+    doc: /* Non-nil means to wrap each display update in a synchronized update.
+Terminals that support synchronized updates (DEC private mode 2026)
+then show the result of an update at once, instead of painting it
+piece by piece, which avoids flicker, especially over slow connections.
+Terminals that don't support them ignore the sequences.  */);
+    tty_synchronized_update = 0;
+
     defsubr(&Stty_display_color_p);
     defsubr(&Stty_display_color_cells);
     defsubr(&Stty_no_underline);
@@ -62,6 +62,28 @@ struct tty_display_info {
     FILE* termscript; /* If nonzero, send all terminal output
                          characters to this stream also.  */
 
+    /* While the output of a frame update is being composed, OUTPUT is
+       a memory stream collecting it, and COMPOSED_OUTPUT is the stream
+       to the terminal that receives all of it in a single write when
+       the frame is flushed.  NULL if no output is being composed.  */
+    FILE* composed_output;
+
+    /* The memory stream used for composing, kept between updates, and
+       the buffer it writes to.  The buffer is owned by the stream.  */
+    FILE* compose_stream;
+    char* compose_buffer;
+    size_t compose_size;
+
+    /* A copy of the face whose appearance is turned on in the terminal,
+       if FACE_ACTIVE.  Writing glyphs leaves the appearance of the last
+       run on, so that a following run with the same appearance needs no
+       escape sequences at all.  */
+    struct face active_face;
+    bool_bf face_active : 1;
+
+    /* True if the composed output is wrapped in a synchronized update.  */
+    bool_bf compose_synchronized : 1;
+
     struct emacs_tty* old_tty; /* The initial tty mode bits */
 
     bool_bf term_initted : 1; /* True if we have been through
@@ -20,6 +20,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include <config.h>
 
 #include "buffer.h"
+#include "indent.h"
 #include "intervals.h"
 #include "lisp.h"
 #include "window.h"
@@ -80,6 +81,9 @@ static void modify_text_properties(Lisp_Object buffer, Lisp_Object start,
     set_buffer_internal(buf);
 
     prepare_to_modify_buffer_1(b, e, NULL);
+    invalidate_column_index(buf->base_buffer ? buf->base_buffer : buf, b);
+    invalidate_syntax_checkpoints(buf->base_buffer ? buf->base_buffer : buf,
+                                  b);
 
     BUF_COMPUTE_UNCHANGED(buf, b - 1, e);
     if (MODIFF <= SAVE_MODIFF)
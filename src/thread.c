@@ -530,6 +530,169 @@ void finalize_one_condvar(struct Lisp_CondVar* condvar) {
 }
 
 
+DEFUN ("make-channel", Fmake_channel, Smake_channel, 1, 2, 0,
+       doc: /* Create a channel that can hold up to CAPACITY values.
+A channel passes values between threads in first-in, first-out order.
+Sending to a full channel blocks until a value is received, and
+receiving from an empty channel blocks until a value is sent.  Any
+number of threads can send to and receive from the same channel.
+
+CAPACITY must be a positive integer.
+NAME, if given, is used as the name of the channel.  The name is
+informational only.  */)
+(Lisp_Object capacity, Lisp_Object name) {
+    CHECK_FIXNAT(capacity);
+    if (XFIXNAT(capacity) == 0)
+        args_out_of_range(capacity, Qnil);
+    if (!NILP(name))
+        CHECK_STRING(name);
+
+    struct Lisp_Channel* channel =
+        ALLOCATE_ZEROED_PSEUDOVECTOR(struct Lisp_Channel, ring, PVEC_CHANNEL);
+    channel->name = name;
+    channel->ring = make_vector(XFIXNAT(capacity), Qnil);
+    sys_cond_init(&channel->not_empty);
+    sys_cond_init(&channel->not_full);
+
+    Lisp_Object result;
+    XSETCHANNEL(result, channel);
+    return result;
+}
+
+static bool channel_full_p(struct Lisp_Channel* channel) {
+    return channel->count == ASIZE(channel->ring);
+}
+
+static bool channel_empty_p(struct Lisp_Channel* channel) {
+    return channel->count == 0;
+}
+
+/* Used to communicate arguments to channel_wait_callback.  */
+struct channel_wait_args {
+    struct Lisp_Channel* channel;
+    /* The condition to wait on, and the predicate it waits out.  */
+    sys_cond_t* cond;
+    bool (*blocked)(struct Lisp_Channel*);
+};
+
+static void channel_wait_callback(void* arg) {
+    struct channel_wait_args* cw = arg;
+    struct thread_state* self = current_thread;
+    Lisp_Object channel;
+
+    XSETCHANNEL(channel, cw->channel);
+    self->event_object = channel;
+    self->wait_condvar = cw->cond;
+    while (cw->blocked(cw->channel) && NILP(self->error_symbol))
+        sys_cond_wait(cw->cond, &global_lock);
+    self->wait_condvar = NULL;
+    self->event_object = Qnil;
+
+    /* If we were signaled after being chosen to take the wakeup, hand
+       it on to another waiter instead of losing it.  */
+    if (!cw->blocked(cw->channel))
+        sys_cond_signal(cw->cond);
+
+    /* Calling sys_cond_wait might yield to other threads, so we need
+       to announce us as the current thread by calling
+       post_acquire_global_lock.  */
+    post_acquire_global_lock(self);
+}
+
+/* Block the current thread while BLOCKED is true of CHANNEL, waiting
+   on COND.  Signals an error if the thread is signaled meanwhile.  */
+static void channel_wait(struct Lisp_Channel* channel, sys_cond_t* cond,
+                         bool (*blocked)(struct Lisp_Channel*)) {
+    struct channel_wait_args cw = {channel, cond, blocked};
+
+    while (blocked(channel))
+        flush_stack_call_func(channel_wait_callback, &cw);
+}
+
+/* Remove and return the oldest value queued in the non-empty CHANNEL,
+   waking up a thread blocked in `channel-send'.  */
+static Lisp_Object channel_dequeue(struct Lisp_Channel* channel) {
+    Lisp_Object value = AREF(channel->ring, channel->head);
+
+    /* Don't keep a reference to the value around for the GC.  */
+    ASET(channel->ring, channel->head, Qnil);
+    channel->head = (channel->head + 1) % ASIZE(channel->ring);
+    channel->count--;
+    sys_cond_signal(&channel->not_full);
+    return value;
+}
+
+DEFUN ("channel-send", Fchannel_send, Schannel_send, 2, 2, 0,
+       doc: /* Send VALUE to CHANNEL.
+If CHANNEL is full, block until another thread receives a value from
+it, or until the current thread is signaled using `thread-signal'.
+Return VALUE.  */)
+(Lisp_Object channel, Lisp_Object value) {
+    struct Lisp_Channel* lchannel;
+
+    CHECK_CHANNEL(channel);
+    lchannel = XCHANNEL(channel);
+
+    channel_wait(lchannel, &lchannel->not_full, channel_full_p);
+
+    ptrdiff_t tail = (lchannel->head + lchannel->count) % ASIZE(lchannel->ring);
+    ASET(lchannel->ring, tail, value);
+    lchannel->count++;
+    sys_cond_signal(&lchannel->not_empty);
+    return value;
+}
+
+DEFUN ("channel-receive", Fchannel_receive, Schannel_receive, 1, 1, 0,
+       doc: /* Receive a value from CHANNEL and return it.
+If CHANNEL is empty, block until another thread sends a value to it,
+or until the current thread is signaled using `thread-signal'.  */)
+(Lisp_Object channel) {
+    struct Lisp_Channel* lchannel;
+
+    CHECK_CHANNEL(channel);
+    lchannel = XCHANNEL(channel);
+
+    channel_wait(lchannel, &lchannel->not_empty, channel_empty_p);
+    return channel_dequeue(lchannel);
+}
+
+DEFUN ("channel-try-receive", Fchannel_try_receive, Schannel_try_receive,
+       1, 2, 0,
+       doc: /* Receive a value from CHANNEL without blocking.
+Return the oldest value queued in CHANNEL, or DEFAULT if CHANNEL is
+empty.  */)
+(Lisp_Object channel, Lisp_Object dflt) {
+    struct Lisp_Channel* lchannel;
+
+    CHECK_CHANNEL(channel);
+    lchannel = XCHANNEL(channel);
+
+    if (channel_empty_p(lchannel))
+        return dflt;
+    return channel_dequeue(lchannel);
+}
+
+DEFUN ("channel-length", Fchannel_length, Schannel_length, 1, 1, 0,
+       doc: /* Return the number of values queued in CHANNEL.  */)
+(Lisp_Object channel) {
+    CHECK_CHANNEL(channel);
+    return make_fixnum(XCHANNEL(channel)->count);
+}
+
+DEFUN ("channel-name", Fchannel_name, Schannel_name, 1, 1, 0,
+       doc: /* Return the name of CHANNEL.
+If no name was given when CHANNEL was created, return nil.  */)
+(Lisp_Object channel) {
+    CHECK_CHANNEL(channel);
+    return XCHANNEL(channel)->name;
+}
+
+void finalize_one_channel(struct Lisp_Channel* channel) {
+    sys_cond_destroy(&channel->not_empty);
+    sys_cond_destroy(&channel->not_full);
+}
+
+
 struct select_args {
     select_func* func;
     int max_fds;
@@ -879,7 +1042,7 @@ DEFUN ("thread-signal", Fthread_signal, Sthread_signal, 3, 3, 0,
 This acts like `signal', but arranges for the signal to be raised
 in THREAD.  If THREAD is the current thread, acts just like `signal'.
 This will interrupt a blocked call to `mutex-lock', `condition-wait',
-or `thread-join' in the target thread.
+`channel-send', `channel-receive' or `thread-join' in the target thread.
 If THREAD is the main thread, just the error message is shown.  */)
 (Lisp_Object thread, Lisp_Object error_symbol, Lisp_Object data) {
     struct thread_state* tstate;
@@ -965,6 +1128,8 @@ If THREAD is blocked in `thread-join' on a second thread, return that
 thread.
 If THREAD is blocked in `mutex-lock', return the mutex.
 If THREAD is blocked in `condition-wait', return the condition variable.
+If THREAD is blocked in `channel-send' or `channel-receive', return the
+channel.
 Otherwise, if THREAD is not blocked, return nil.  */)
 (Lisp_Object thread) {
     struct thread_state* tstate;
@@ -1136,6 +1301,12 @@ void syms_of_threads(void) {
         defsubr(&Scondition_notify);
         defsubr(&Scondition_mutex);
         defsubr(&Scondition_name);
+        defsubr(&Smake_channel);
+        defsubr(&Schannel_send);
+        defsubr(&Schannel_receive);
+        defsubr(&Schannel_try_receive);
+        defsubr(&Schannel_length);
+        defsubr(&Schannel_name);
         defsubr(&Sthread_last_error);
         defsubr(&Sthread_buffer_disposition);
         defsubr(&Sthread_set_buffer_disposition);
@@ -1149,6 +1320,7 @@ void syms_of_threads(void) {
     DEFSYM(Qthreadp, "threadp");
     DEFSYM(Qmutexp, "mutexp");
     DEFSYM(Qcondition_variable_p, "condition-variable-p");
+    DEFSYM(Qchannelp, "channelp");
 
     DEFSYM(Qthread_buffer_killed, "thread-buffer-killed");
     Fput(Qthread_buffer_killed, Qerror_conditions,
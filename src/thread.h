@@ -287,12 +287,52 @@ INLINE struct Lisp_CondVar* XCONDVAR(Lisp_Object a) {
     return XUNTAG(a, Lisp_Vectorlike, struct Lisp_CondVar);
 }
 
+/* A bounded channel as a lisp object.  Values are queued in a ring
+   buffer that is only touched while holding the global lock, so no
+   further locking is needed to send or receive.  A thread that must
+   block waits on one of the channel's condition variables, which
+   releases the global lock and lets other threads run.  */
+struct Lisp_Channel {
+    union vectorlike_header header;
+
+    /* The name of the channel, or nil.  */
+    Lisp_Object name;
+
+    /* The ring buffer, a vector whose length is the capacity.  */
+    Lisp_Object ring;
+    /* ring must be the last Lisp field.  */
+
+    /* Index in ring of the oldest queued value.  */
+    ptrdiff_t head;
+
+    /* Number of values currently queued.  */
+    ptrdiff_t count;
+
+    /* Signaled, waking up one waiting thread, when a value is queued,
+       and when one is dequeued.  A woken thread that finds nothing to
+       do hands the wakeup on to the next waiter.  */
+    sys_cond_t not_empty;
+    sys_cond_t not_full;
+} GCALIGNED_STRUCT;
+
+INLINE bool CHANNELP(Lisp_Object a) { return PSEUDOVECTORP(a, PVEC_CHANNEL); }
+
+INLINE void CHECK_CHANNEL(Lisp_Object x) {
+    CHECK_TYPE(CHANNELP(x), Qchannelp, x);
+}
+
+INLINE struct Lisp_Channel* XCHANNEL(Lisp_Object a) {
+    eassert(CHANNELP(a));
+    return XUNTAG(a, Lisp_Vectorlike, struct Lisp_Channel);
+}
+
 extern struct thread_state* current_thread;
 extern struct thread_state* all_threads;
 
 extern void finalize_one_thread(struct thread_state* state);
 extern void finalize_one_mutex(struct Lisp_Mutex*);
 extern void finalize_one_condvar(struct Lisp_CondVar*);
+extern void finalize_one_channel(struct Lisp_Channel*);
 extern void maybe_reacquire_global_lock(void);
 
 extern void init_threads(void);
@@ -20,22 +20,372 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 
 #include <config.h>
 
+#include <flexmember.h>
+
 #include "buffer.h"
+#include "intervals.h"
 #include "keyboard.h"
 #include "lisp.h"
 
-/* The first time a command records something for undo.
-   it also allocates the undo-boundary object
-   which will be added to the list at the end of the command.
-   This ensures we can't run out of space while trying to make
-   an undo-boundary.  */
-static Lisp_Object pending_boundary;
-
-/* Prepare the undo info for recording a change. */
-static void prepare_record(void) {
-    /* Allocate a cons cell to be the undo boundary after this command.  */
-    if (NILP(pending_boundary))
-        pending_boundary = Fcons(Qnil, Qnil);
+/* Changes are recorded in a per-buffer undo log, a list of chunks of
+   compact records appended in the order they happen.  The log holds
+   the changes newer than the head of the buffer's undo list, so the
+   list Lisp sees is the records of the log, newest first, consed onto
+   BVAR (b, undo_list).  The log is folded into the list only when
+   something looks at the list; see flush_undo_log.  Until then, large
+   edits record their deleted text without making Lisp strings or
+   conses, and truncate_undo_list drops whole chunks.  */
+
+/* The kinds of records in an undo log.  Each record is a byte holding
+   its kind, followed by its fields as unaligned ptrdiff_t values.  */
+enum undo_record
+{
+    /* An undo boundary: nil.  */
+    UNDO_BOUNDARY,
+    /* POS: point before the command, as a fixnum.  */
+    UNDO_POINT,
+    /* BEG, END: an insertion, (BEG . END).  */
+    UNDO_INSERT,
+    /* POS, NCHARS, NBYTES, MULTIBYTE, then NBYTES bytes of text: a
+       deletion, (TEXT . POS).  MULTIBYTE is a single byte.  */
+    UNDO_DELETE_TEXT,
+    /* POS, OBJ: a deletion of the string OBJ, (OBJ . POS).  */
+    UNDO_DELETE_STRING,
+    /* OBJ: the first change since the buffer was saved, (t . OBJ).  */
+    UNDO_FIRST_CHANGE,
+    /* BEG, END, PROP, VALUE: a text property change,
+       (nil PROP VALUE BEG . END).  */
+    UNDO_PROPERTY,
+    /* OBJ, ADJUSTMENT: a marker adjustment, (OBJ . ADJUSTMENT).  The
+       log does not keep OBJ alive; see compact_undo_log.  */
+    UNDO_MARKER_ADJUSTMENT
+};
+
+enum
+{
+    UNDO_CHUNK_MIN = 1024,
+    UNDO_CHUNK_MAX = 64 * 1024
+};
+
+/* A chunk of an undo log.  */
+struct undo_chunk {
+    /* The next newer chunk, or NULL.  */
+    struct undo_chunk* next;
+
+    /* Log offset of DATA[0].  Offsets into a log grow from its
+       creation and are not reused when records are dropped.  */
+    ptrdiff_t base;
+
+    ptrdiff_t used, size;
+    unsigned char data[FLEXIBLE_ARRAY_MEMBER];
+};
+
+/* An undo boundary in a log, for truncate_undo_list.  */
+struct undo_boundary {
+    /* Log offset of the record.  */
+    ptrdiff_t offset;
+
+    /* Total size, as truncate_undo_list counts it, of the records
+       appended before this one.  */
+    intmax_t size;
+
+    /* Number of objects added for the records before this one.  */
+    ptrdiff_t nobjects;
+};
+
+struct undo_log {
+    /* The oldest and newest chunks.  */
+    struct undo_chunk *first, *last;
+
+    /* Log offset of the oldest record.  */
+    ptrdiff_t start;
+
+    /* The newest record, or NULL if there is none, and the one before
+       it, or NULL if that is not known.  PREV_OFFSET is the log offset
+       of PREV_RECORD, which is gone if it is less than START.  */
+    unsigned char *last_record, *prev_record;
+    ptrdiff_t last_offset, prev_offset;
+
+    /* Total size of the records appended and of those dropped by
+       truncate_undo_list.  */
+    intmax_t size, dropped;
+
+    /* The boundaries in the log, oldest first.  */
+    struct undo_boundary* boundaries;
+    ptrdiff_t nboundaries, boundaries_size;
+
+    /* A vector of the Lisp objects the records refer to.  Records hold
+       object numbers; object N is in slot N - OBJECTS_BASE.  NOBJECTS
+       is the number of objects added so far.  */
+    Lisp_Object objects;
+    ptrdiff_t objects_base, nobjects;
+};
+
+/* Free the undo log of B, forgetting the changes it holds.  */
+void free_undo_log(struct buffer* b) {
+    struct undo_log* log = b->undo_log;
+    if (log) {
+        struct undo_chunk* next;
+        for (struct undo_chunk* c = log->first; c; c = next) {
+            next = c->next;
+            xfree(c);
+        }
+        xfree(log->boundaries);
+        xfree(log);
+        b->undo_log = NULL;
+    }
+}
+
+/* Return the undo log of the current buffer, making one if needed.  */
+static struct undo_log* current_undo_log(void) {
+    struct undo_log* log = current_buffer->undo_log;
+    if (!log) {
+        log = current_buffer->undo_log = xzalloc(sizeof *log);
+        log->objects = Qnil;
+    }
+    return log;
+}
+
+/* Append a record of KIND, with NBYTES bytes of fields, to LOG.
+   SIZE is what truncate_undo_list counts for it.  Return a pointer to
+   where the fields go.  */
+static unsigned char* undo_log_append(struct undo_log* log,
+                                      enum undo_record kind, ptrdiff_t nbytes,
+                                      intmax_t size) {
+    struct undo_chunk* c = log->last;
+    ptrdiff_t need = 1 + nbytes;
+
+    if (!c || c->size - c->used < need) {
+        ptrdiff_t chunk_size =
+            c ? min(2 * c->size, UNDO_CHUNK_MAX) : UNDO_CHUNK_MIN;
+        chunk_size = max(chunk_size, need);
+        struct undo_chunk* nc =
+            xmalloc(FLEXSIZEOF(struct undo_chunk, data, chunk_size));
+        nc->next = NULL;
+        nc->base = c ? c->base + c->used : log->start;
+        nc->used = 0;
+        nc->size = chunk_size;
+        if (c)
+            c->next = nc;
+        else
+            log->first = nc;
+        log->last = c = nc;
+    }
+
+    if (kind == UNDO_BOUNDARY) {
+        if (log->nboundaries == log->boundaries_size)
+            log->boundaries =
+                xpalloc(log->boundaries, &log->boundaries_size, 1, -1,
+                        sizeof *log->boundaries);
+        struct undo_boundary* ub = &log->boundaries[log->nboundaries++];
+        ub->offset = c->base + c->used;
+        ub->size = log->size;
+        ub->nobjects = log->nobjects;
+    }
+
+    unsigned char* p = c->data + c->used;
+    log->prev_record = log->last_record;
+    log->prev_offset = log->last_offset;
+    log->last_record = p;
+    log->last_offset = c->base + c->used;
+    c->used += need;
+    log->size += size;
+    *p = kind;
+    return p + 1;
+}
+
+static unsigned char* undo_put(unsigned char* p, ptrdiff_t v) {
+    memcpy(p, &v, sizeof v);
+    return p + sizeof v;
+}
+
+static unsigned char* undo_get(unsigned char* p, ptrdiff_t* v) {
+    memcpy(v, p, sizeof *v);
+    return p + sizeof *v;
+}
+
+/* Add OBJ to the objects of LOG and return its number.  */
+static ptrdiff_t undo_log_add_object(struct undo_log* log, Lisp_Object obj) {
+    ptrdiff_t i = log->nobjects - log->objects_base;
+    if (NILP(log->objects))
+        log->objects = make_nil_vector(16);
+    else if (i == ASIZE(log->objects))
+        log->objects = larger_vector(log->objects, 1, -1);
+    ASET(log->objects, i, obj);
+    return log->nobjects++;
+}
+
+static Lisp_Object undo_log_object(struct undo_log* log, ptrdiff_t n) {
+    return AREF(log->objects, n - log->objects_base);
+}
+
+/* Return the kind of the newest record of the current buffer's undo
+   log, or -1 if the log is empty.  */
+static int last_undo_record(void) {
+    struct undo_log* log = current_buffer->undo_log;
+    return log && log->last_record ? *log->last_record : -1;
+}
+
+/* If the newest record of the current buffer's undo log is an undo
+   boundary, remove it and return true.  Return false if it is another
+   record, or if the log is empty.  */
+static bool pop_undo_log_boundary(void) {
+    struct undo_log* log = current_buffer->undo_log;
+    if (!log || !log->last_record || *log->last_record != UNDO_BOUNDARY)
+        return false;
+
+    if (!log->prev_record || log->prev_offset < log->start) {
+        /* The boundary is the only record in the log.  */
+        free_undo_log(current_buffer);
+        return true;
+    }
+
+    eassert(log->last_offset == log->last->base + log->last->used - 1);
+    log->last->used--;
+    log->size -= sizeof(struct Lisp_Cons);
+    log->nboundaries--;
+    log->last_record = log->prev_record;
+    log->last_offset = log->prev_offset;
+    log->prev_record = NULL;
+    return true;
+}
+
+/* Fold the undo log of B into its undo list, so that BVAR (b,
+   undo_list) holds all the changes recorded in B.  */
+void flush_undo_log(struct buffer* b) {
+    struct undo_log* log = b->undo_log;
+    if (!log)
+        return;
+
+    Lisp_Object list = BVAR(b, undo_list);
+    for (struct undo_chunk* c = log->first; c; c = c->next) {
+        unsigned char* p = c->data;
+        unsigned char* end = c->data + c->used;
+        if (c == log->first)
+            p += log->start - c->base;
+        while (p < end) {
+            enum undo_record kind = *p++;
+            ptrdiff_t x, y, n, m;
+            Lisp_Object elt;
+
+            switch (kind) {
+            case UNDO_BOUNDARY:
+                elt = Qnil;
+                break;
+            case UNDO_POINT:
+                p = undo_get(p, &x);
+                elt = make_fixnum(x);
+                break;
+            case UNDO_INSERT:
+                p = undo_get(undo_get(p, &x), &y);
+                elt = Fcons(make_fixnum(x), make_fixnum(y));
+                break;
+            case UNDO_DELETE_TEXT: {
+                p = undo_get(undo_get(undo_get(p, &x), &n), &m);
+                Lisp_Object string = *p++ ? make_uninit_multibyte_string(n, m)
+                                          : make_uninit_string(n);
+                memcpy(SDATA(string), p, m);
+                p += m;
+                elt = Fcons(string, make_fixnum(x));
+                break;
+            }
+            case UNDO_DELETE_STRING:
+                p = undo_get(undo_get(p, &x), &n);
+                elt = Fcons(undo_log_object(log, n), make_fixnum(x));
+                break;
+            case UNDO_FIRST_CHANGE:
+                p = undo_get(p, &n);
+                elt = Fcons(Qt, undo_log_object(log, n));
+                break;
+            case UNDO_PROPERTY:
+                p = undo_get(undo_get(undo_get(undo_get(p, &x), &y), &n), &m);
+                elt = Fcons(Qnil,
+                            Fcons(undo_log_object(log, n),
+                                  Fcons(undo_log_object(log, m),
+                                        Fcons(make_fixnum(x), make_fixnum(y)))));
+                break;
+            case UNDO_MARKER_ADJUSTMENT:
+                p = undo_get(undo_get(p, &n), &x);
+                elt = undo_log_object(log, n);
+                /* Drop the adjustment if GC found the marker unused.  */
+                if (NILP(elt))
+                    continue;
+                elt = Fcons(elt, make_fixnum(x));
+                break;
+            default:
+                emacs_abort();
+            }
+            list = Fcons(elt, list);
+        }
+    }
+
+    free_undo_log(b);
+    bset_undo_list(b, list);
+}
+
+/* Flush the undo logs of all buffers.  */
+void flush_undo_logs(void) {
+    Lisp_Object tail, buffer;
+    FOR_EACH_LIVE_BUFFER(tail, buffer) flush_undo_log(XBUFFER(buffer));
+}
+
+/* Mark the objects referred to by the undo log of B.  Like the undo
+   list, the log of a live buffer is marked later by compact_undo_log,
+   so that its markers do not survive because of it.  */
+void mark_undo_log(struct buffer* b) {
+    if (b->undo_log && !BUFFER_LIVE_P(b))
+        mark_object(b->undo_log->objects);
+}
+
+/* Forget the markers of the undo log of B that nothing else refers
+   to, as compact_undo_list does for the undo list, and mark the rest
+   of the objects the log refers to.  */
+void compact_undo_log(struct buffer* b) {
+    struct undo_log* log = b->undo_log;
+    if (!log || NILP(log->objects))
+        return;
+
+    Lisp_Object* v = XVECTOR(log->objects)->contents;
+    for (ptrdiff_t i = 0; i < log->nobjects - log->objects_base; i++)
+        if (MARKERP(v[i]) && !survives_gc_p(v[i]))
+            v[i] = Qnil;
+    mark_object(log->objects);
+}
+
+/* Drop the records of the undo log of B up to and including its
+   boundary number N.  */
+static void drop_undo_records(struct buffer* b, ptrdiff_t n) {
+    struct undo_log* log = b->undo_log;
+    struct undo_boundary* ub = &log->boundaries[n];
+
+    log->start = ub->offset + 1;
+    log->dropped = ub->size + sizeof(struct Lisp_Cons);
+    while (log->first &&
+           log->first->base + log->first->used <= log->start) {
+        struct undo_chunk* c = log->first;
+        log->first = c->next;
+        xfree(c);
+    }
+    if (!log->first) {
+        free_undo_log(b);
+        return;
+    }
+
+    /* Forget the objects only the dropped records referred to.  */
+    ptrdiff_t nobjects = ub->nobjects;
+    if (nobjects > log->objects_base) {
+        ptrdiff_t gone = nobjects - log->objects_base;
+        ptrdiff_t left = log->nobjects - nobjects;
+        Lisp_Object* v = XVECTOR(log->objects)->contents;
+        memmove(v, v + gone, left * word_size);
+        for (ptrdiff_t i = left; i < left + gone; i++)
+            v[i] = Qnil;
+        log->objects_base = nobjects;
+    }
+
+    log->nboundaries -= n + 1;
+    memmove(log->boundaries, log->boundaries + n + 1,
+            log->nboundaries * sizeof *log->boundaries);
 }
 
 /* Record point, if necessary, as it was at beginning of this command.
@@ -53,8 +403,12 @@ static void record_point(ptrdiff_t beg) {
     first change. FIXME: This check is currently dependent on being
     called before record_first_change, but could be made not to by
     ignoring timestamp undo entries */
-    at_boundary = !CONSP(BVAR(current_buffer, undo_list)) ||
-        NILP(XCAR(BVAR(current_buffer, undo_list)));
+    int last = last_undo_record();
+    if (last >= 0)
+        at_boundary = last == UNDO_BOUNDARY;
+    else
+        at_boundary = !CONSP(BVAR(current_buffer, undo_list)) ||
+            NILP(XCAR(BVAR(current_buffer, undo_list)));
 
     /* If this is the first change since save, then record this.*/
     if (MODIFF <= SAVE_MODIFF)
@@ -68,9 +422,9 @@ static void record_point(ptrdiff_t beg) {
        value of point that we have will be for that buffer, not this.*/
     if (at_boundary && point_before_last_command_or_undo != beg &&
         buffer_before_last_command_or_undo == current_buffer)
-        bset_undo_list(current_buffer,
-                       Fcons(make_fixnum(point_before_last_command_or_undo),
-                             BVAR(current_buffer, undo_list)));
+        undo_put(undo_log_append(current_undo_log(), UNDO_POINT,
+                                 sizeof(ptrdiff_t), sizeof(struct Lisp_Cons)),
+                 point_before_last_command_or_undo);
 }
 
 /* Record an insertion that just happened or is about to happen,
@@ -79,18 +433,26 @@ static void record_point(ptrdiff_t beg) {
    because we don't need to record the contents.)  */
 
 void record_insert(ptrdiff_t beg, ptrdiff_t length) {
-    Lisp_Object lbeg, lend;
-
     if (EQ(BVAR(current_buffer, undo_list), Qt))
         return;
 
-    prepare_record();
-
     record_point(beg);
 
     /* If this is following another insertion and consecutive with it
        in the buffer, combine the two.  */
-    if (CONSP(BVAR(current_buffer, undo_list))) {
+    struct undo_log* log = current_buffer->undo_log;
+    if (log && log->last_record) {
+        if (*log->last_record == UNDO_INSERT) {
+            ptrdiff_t end;
+            unsigned char* p = log->last_record + 1 + sizeof(ptrdiff_t);
+            undo_get(p, &end);
+            if (end == beg) {
+                undo_put(p, beg + length);
+                return;
+            }
+        }
+    }
+    else if (CONSP(BVAR(current_buffer, undo_list))) {
         Lisp_Object elt;
         elt = XCAR(BVAR(current_buffer, undo_list));
         if (CONSP(elt) && FIXNUMP(XCAR(elt)) && FIXNUMP(XCDR(elt)) &&
@@ -100,10 +462,11 @@ void record_insert(ptrdiff_t beg, ptrdiff_t length) {
         }
     }
 
-    XSETFASTINT(lbeg, beg);
-    XSETINT(lend, beg + length);
-    bset_undo_list(current_buffer,
-                   Fcons(Fcons(lbeg, lend), BVAR(current_buffer, undo_list)));
+    undo_put(undo_put(undo_log_append(current_undo_log(), UNDO_INSERT,
+                                      2 * sizeof(ptrdiff_t),
+                                      2 * sizeof(struct Lisp_Cons)),
+                      beg),
+             beg + length);
 }
 
 /* Record the fact that markers in the region of FROM, TO are about to
@@ -113,8 +476,6 @@ void record_insert(ptrdiff_t beg, ptrdiff_t length) {
    buffer modification.  */
 
 static void record_marker_adjustments(ptrdiff_t from, ptrdiff_t to) {
-    prepare_record();
-
     for (struct Lisp_Marker* m = BUF_MARKERS(current_buffer); m; m = m->next) {
         ptrdiff_t charpos = m->charpos;
         eassert(charpos <= Z);
@@ -130,34 +491,40 @@ static void record_marker_adjustments(ptrdiff_t from, ptrdiff_t to) {
             ptrdiff_t adjustment = (m->insertion_type ? to : from) - charpos;
 
             if (adjustment) {
+                struct undo_log* log = current_undo_log();
                 Lisp_Object marker = make_lisp_ptr(m, Lisp_Vectorlike);
-                bset_undo_list(current_buffer,
-                               Fcons(Fcons(marker, make_fixnum(adjustment)),
-                                     BVAR(current_buffer, undo_list)));
+                ptrdiff_t n = undo_log_add_object(log, marker);
+                undo_put(undo_put(undo_log_append(log, UNDO_MARKER_ADJUSTMENT,
+                                                  2 * sizeof(ptrdiff_t),
+                                                  2 * sizeof(struct Lisp_Cons)),
+                                  n),
+                         adjustment);
             }
         }
     }
 }
 
+/* The size truncate_undo_list counts for the deletion of NCHARS.  */
+static intmax_t deletion_size(ptrdiff_t nchars) {
+    return 2 * sizeof(struct Lisp_Cons) + sizeof(struct Lisp_String) - 1 +
+        nchars;
+}
+
 /* Record that a deletion is about to take place, of the characters in
    STRING, at location BEG.  Optionally record adjustments for markers
    in the region STRING occupies in the current buffer.  */
 void record_delete(ptrdiff_t beg, Lisp_Object string, bool record_markers) {
-    Lisp_Object sbeg;
+    ptrdiff_t sbeg;
 
     if (EQ(BVAR(current_buffer, undo_list), Qt))
         return;
 
-    prepare_record();
-
     record_point(beg);
 
-    if (PT == beg + SCHARS(string)) {
-        XSETINT(sbeg, -beg);
-    }
-    else {
-        XSETFASTINT(sbeg, beg);
-    }
+    if (PT == beg + SCHARS(string))
+        sbeg = -beg;
+    else
+        sbeg = beg;
 
     /* primitive-undo assumes marker adjustments are recorded
        immediately before the deletion is recorded.  See bug 16818
@@ -165,8 +532,71 @@ void record_delete(ptrdiff_t beg, Lisp_Object string, bool record_markers) {
     if (record_markers)
         record_marker_adjustments(beg, beg + SCHARS(string));
 
-    bset_undo_list(current_buffer,
-                   Fcons(Fcons(string, sbeg), BVAR(current_buffer, undo_list)));
+    struct undo_log* log = current_undo_log();
+    ptrdiff_t n = undo_log_add_object(log, string);
+    undo_put(undo_put(undo_log_append(log, UNDO_DELETE_STRING,
+                                      2 * sizeof(ptrdiff_t),
+                                      deletion_size(SCHARS(string))),
+                      sbeg),
+             n);
+}
+
+/* Return true if some text between FROM and TO in the current buffer
+   has text properties.  */
+static bool text_properties_between(ptrdiff_t from, ptrdiff_t to) {
+    INTERVAL i = buffer_intervals(current_buffer);
+    if (!i)
+        return false;
+    for (i = find_interval(i, from); i && i->position < to;
+         i = next_interval(i))
+        if (!NILP(i->plist))
+            return true;
+    return false;
+}
+
+/* Record that the text between FROM and TO in the current buffer is
+   about to be deleted, like record_delete.  Unless the text has
+   properties, it is copied into the undo log without making a
+   string.  */
+void record_delete_region(ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t to,
+                          ptrdiff_t to_byte, bool record_markers) {
+    if (EQ(BVAR(current_buffer, undo_list), Qt))
+        return;
+
+    /* make_buffer_string_both runs buffer-access-fontify-functions
+       before copying the properties, so let it.  */
+    if (!NILP(Vbuffer_access_fontify_functions) ||
+        text_properties_between(from, to)) {
+        record_delete(from,
+                      make_buffer_string_both(from, from_byte, to, to_byte,
+                                              true),
+                      record_markers);
+        return;
+    }
+
+    record_point(from);
+
+    ptrdiff_t sbeg = PT == to ? -from : from;
+
+    if (record_markers)
+        record_marker_adjustments(from, to);
+
+    ptrdiff_t nbytes = to_byte - from_byte;
+    unsigned char* p =
+        undo_log_append(current_undo_log(), UNDO_DELETE_TEXT,
+                        3 * sizeof(ptrdiff_t) + 1 + nbytes,
+                        deletion_size(to - from));
+    p = undo_put(undo_put(undo_put(p, sbeg), to - from), nbytes);
+    *p++ = !NILP(BVAR(current_buffer, enable_multibyte_characters));
+
+    /* Copy the text, which may straddle the gap.  */
+    if (from_byte < GPT_BYTE && GPT_BYTE < to_byte) {
+        ptrdiff_t before = GPT_BYTE - from_byte;
+        memcpy(p, BYTE_POS_ADDR(from_byte), before);
+        memcpy(p + before, GAP_END_ADDR, to_byte - GPT_BYTE);
+    }
+    else
+        memcpy(p, BYTE_POS_ADDR(from_byte), nbytes);
 }
 
 /* Record that a replacement is about to take place,
@@ -174,7 +604,8 @@ void record_delete(ptrdiff_t beg, Lisp_Object string, bool record_markers) {
    The replacement must not change the number of characters.  */
 
 void record_change(ptrdiff_t beg, ptrdiff_t length) {
-    record_delete(beg, make_buffer_string(beg, beg + length, true), false);
+    record_delete_region(beg, CHAR_TO_BYTE(beg), beg + length,
+                         CHAR_TO_BYTE(beg + length), false);
     record_insert(beg, length);
 }
 
@@ -191,9 +622,12 @@ void record_first_change(void) {
     if (base_buffer->base_buffer)
         base_buffer = base_buffer->base_buffer;
 
-    bset_undo_list(current_buffer,
-                   Fcons(Fcons(Qt, buffer_visited_file_modtime(base_buffer)),
-                         BVAR(current_buffer, undo_list)));
+    struct undo_log* log = current_undo_log();
+    ptrdiff_t n =
+        undo_log_add_object(log, buffer_visited_file_modtime(base_buffer));
+    undo_put(undo_log_append(log, UNDO_FIRST_CHANGE, sizeof(ptrdiff_t),
+                             2 * sizeof(struct Lisp_Cons)),
+             n);
 }
 
 /* Record a change in property PROP (whose old value was VAL)
@@ -201,22 +635,22 @@ void record_first_change(void) {
 
 void record_property_change(ptrdiff_t beg, ptrdiff_t length, Lisp_Object prop,
                             Lisp_Object value, Lisp_Object buffer) {
-    Lisp_Object lbeg, lend, entry;
     struct buffer* buf = XBUFFER(buffer);
 
     if (EQ(BVAR(buf, undo_list), Qt))
         return;
 
-    prepare_record();
-
     if (MODIFF <= SAVE_MODIFF)
         record_first_change();
 
-    XSETINT(lbeg, beg);
-    XSETINT(lend, beg + length);
-    entry = Fcons(Qnil, Fcons(prop, Fcons(value, Fcons(lbeg, lend))));
-    bset_undo_list(current_buffer,
-                   Fcons(entry, BVAR(current_buffer, undo_list)));
+    struct undo_log* log = current_undo_log();
+    ptrdiff_t nprop = undo_log_add_object(log, prop);
+    ptrdiff_t nvalue = undo_log_add_object(log, value);
+    unsigned char* p =
+        undo_log_append(log, UNDO_PROPERTY, 4 * sizeof(ptrdiff_t),
+                        2 * sizeof(struct Lisp_Cons));
+    undo_put(undo_put(undo_put(undo_put(p, beg), beg + length), nprop),
+             nvalue);
 }
 
 DEFUN ("undo-boundary", Fundo_boundary, Sundo_boundary, 0, 0, 0,
@@ -224,23 +658,13 @@ DEFUN ("undo-boundary", Fundo_boundary, Sundo_boundary, 0, 0, 0,
 An undo command will stop at this point,
 but another undo command will undo to the previous boundary.  */)
 (void) {
-    Lisp_Object tem;
     if (EQ(BVAR(current_buffer, undo_list), Qt))
         return Qnil;
-    tem = Fcar(BVAR(current_buffer, undo_list));
-    if (!NILP(tem)) {
-        /* One way or another, cons nil onto the front of the undo list.  */
-        if (!NILP(pending_boundary)) {
-            /* If we have preallocated the cons cell to use here,
-               use that one.  */
-            XSETCDR(pending_boundary, BVAR(current_buffer, undo_list));
-            bset_undo_list(current_buffer, pending_boundary);
-            pending_boundary = Qnil;
-        }
-        else
-            bset_undo_list(current_buffer,
-                           Fcons(Qnil, BVAR(current_buffer, undo_list)));
-    }
+    int last = last_undo_record();
+    if (last >= 0 ? last != UNDO_BOUNDARY
+                  : !NILP(Fcar(BVAR(current_buffer, undo_list))))
+        undo_log_append(current_undo_log(), UNDO_BOUNDARY, 0,
+                        sizeof(struct Lisp_Cons));
 
     Fset(Qundo_auto__last_boundary_cause, Qexplicit);
     point_before_last_command_or_undo = PT;
@@ -249,15 +673,80 @@ but another undo command will undo to the previous boundary.  */)
     return Qnil;
 }
 
+DEFUN ("undo--needs-boundary-p", Fundo__needs_boundary_p,
+       Sundo__needs_boundary_p, 0, 0, 0,
+       doc: /* Return non-nil if `buffer-undo-list' starts with a change.
+That is, if the list needs a boundary at the start.  Unlike looking at
+the list, this does not convert the changes recorded since the last
+boundary into list elements.  */)
+(void) {
+    int last = last_undo_record();
+    if (last >= 0)
+        return last == UNDO_BOUNDARY ? Qnil : Qt;
+    return NILP(Fcar_safe(BVAR(current_buffer, undo_list))) ? Qnil : Qt;
+}
+
+DEFUN ("undo--pop-boundary", Fundo__pop_boundary, Sundo__pop_boundary, 0, 0,
+       0,
+       doc: /* Remove the boundary at the start of `buffer-undo-list', if any.
+Return non-nil if there was one.  Unlike setting the list to its cdr,
+this does not convert the changes recorded since the last boundary
+into list elements.  */)
+(void) {
+    if (pop_undo_log_boundary())
+        return Qt;
+    if (last_undo_record() >= 0)
+        return Qnil;
+
+    Lisp_Object list = BVAR(current_buffer, undo_list);
+    if (!CONSP(list) || !NILP(XCAR(list)))
+        return Qnil;
+    bset_undo_list(current_buffer, XCDR(list));
+    return Qt;
+}
+
+/* Where truncate_undo_list decided to truncate: just before an undo
+   boundary, which goes together with everything older than it.  */
+struct undo_cut {
+    enum
+    {
+        CUT_NOWHERE,
+        CUT_LOG,
+        CUT_LIST
+    } where;
+
+    /* For CUT_LOG, the number of the boundary in the log.  */
+    ptrdiff_t boundary;
+
+    /* For CUT_LIST, the cons before the boundary, or nil if the
+       boundary is the first element of the list.  */
+    Lisp_Object prev;
+};
+
+/* Return the space occupied by undo list element ELT and
+   its chain link.  */
+static intmax_t undo_element_size(Lisp_Object elt) {
+    intmax_t size = sizeof(struct Lisp_Cons);
+    if (CONSP(elt)) {
+        size += sizeof(struct Lisp_Cons);
+        if (STRINGP(XCAR(elt)))
+            size += (sizeof(struct Lisp_String) - 1 + SCHARS(XCAR(elt)));
+    }
+    return size;
+}
+
 /* At garbage collection time, make an undo list shorter at the end,
    returning the truncated list.  How this is done depends on the
    variables undo-limit, undo-strong-limit and undo-outer-limit.
-   In some cases this works by calling undo-outer-limit-function.  */
+   In some cases this works by calling undo-outer-limit-function.
+
+   The records of the buffer's undo log come first, and are walked by
+   their boundaries rather than one by one.  */
 
 void truncate_undo_list(struct buffer* b) {
-    Lisp_Object list;
-    Lisp_Object prev, next, last_boundary;
+    Lisp_Object prev, next;
     intmax_t size_so_far = 0;
+    struct undo_cut cut = {.where = CUT_NOWHERE, .prev = Qnil};
 
     /* Make sure that calling undo-outer-limit-function
        won't cause another GC.  */
@@ -269,44 +758,52 @@ void truncate_undo_list(struct buffer* b) {
     record_unwind_current_buffer();
     set_buffer_internal(b);
 
-    list = BVAR(b, undo_list);
+    struct undo_log* log;
+    ptrdiff_t i;
+    bool in_log;
 
-    prev = Qnil;
-    next = list;
-    last_boundary = Qnil;
+retry:
+    log = b->undo_log;
+    i = log ? log->nboundaries : 0;
+    in_log = false;
+    size_so_far = 0;
 
-    /* If the first element is an undo boundary, skip past it.  */
-    if (CONSP(next) && NILP(XCAR(next))) {
-        /* Add in the space occupied by this element and its chain link.  */
+    prev = Qnil;
+    next = BVAR(b, undo_list);
+
+    if (log && log->last_record) {
+        /* If the first element is an undo boundary, skip past it.  */
+        if (*log->last_record == UNDO_BOUNDARY)
+            i--;
+
+        /* Always preserve at least the most recent undo record
+           unless it is really horribly big.  It ends at the next
+           boundary in the log, if there is one.  */
+        if (i > 0) {
+            in_log = true;
+            i--;
+            size_so_far = log->size - log->boundaries[i].size -
+                sizeof(struct Lisp_Cons);
+        }
+        else
+            size_so_far = log->size - log->dropped;
+    }
+    else if (CONSP(next) && NILP(XCAR(next))) {
+        /* If the first element is an undo boundary, skip past it.  */
         size_so_far += sizeof(struct Lisp_Cons);
-
-        /* Advance to next element.  */
         prev = next;
         next = XCDR(next);
     }
 
-    /* Always preserve at least the most recent undo record
-       unless it is really horribly big.
-
-       Skip, skip, skip the undo, skip, skip, skip the undo,
+    /* Skip, skip, skip the undo, skip, skip, skip the undo,
        Skip, skip, skip the undo, skip to the undo bound'ry.  */
 
-    while (CONSP(next) && !NILP(XCAR(next))) {
-        Lisp_Object elt;
-        elt = XCAR(next);
-
-        /* Add in the space occupied by this element and its chain link.  */
-        size_so_far += sizeof(struct Lisp_Cons);
-        if (CONSP(elt)) {
-            size_so_far += sizeof(struct Lisp_Cons);
-            if (STRINGP(XCAR(elt)))
-                size_so_far +=
-                    (sizeof(struct Lisp_String) - 1 + SCHARS(XCAR(elt)));
+    if (!in_log) {
+        while (CONSP(next) && !NILP(XCAR(next))) {
+            size_so_far += undo_element_size(XCAR(next));
+            prev = next;
+            next = XCDR(next);
         }
-
-        /* Advance to next element.  */
-        prev = next;
-        next = XCDR(next);
     }
 
     /* If by the first boundary we have already passed undo_outer_limit,
@@ -319,6 +816,14 @@ void truncate_undo_list(struct buffer* b) {
         !NILP(Vundo_outer_limit_function)) {
         Lisp_Object tem;
 
+        /* The function can do anything to the undo log, so fold the log
+           into the list and measure the list instead; LOG and I must
+           not be used after the call.  */
+        if (log) {
+            flush_undo_log(b);
+            goto retry;
+        }
+
         /* Normally the function this calls is undo-outer-limit-truncate.  */
         tem = calln(Vundo_outer_limit_function, make_int(size_so_far));
         if (!NILP(tem)) {
@@ -329,46 +834,73 @@ void truncate_undo_list(struct buffer* b) {
         }
     }
 
-    if (CONSP(next))
-        last_boundary = prev;
-
-    /* Keep additional undo data, if it fits in the limits.  */
-    while (CONSP(next)) {
-        Lisp_Object elt;
-        elt = XCAR(next);
+    /* Keep additional undo data, if it fits in the limits.
 
-        /* When we get to a boundary, decide whether to truncate
+       When we get to a boundary, decide whether to truncate
        either before or after it.  The lower threshold, undo_limit,
        tells us to truncate after it.  If its size pushes past
        the higher threshold undo_strong_limit, we truncate before it.  */
-        if (NILP(elt)) {
-            if (size_so_far > undo_strong_limit)
+    bool stopped = false;
+    if (in_log) {
+        cut.where = CUT_LOG;
+        cut.boundary = i;
+        for (; i >= 0; i--) {
+            size_so_far = log->size - log->boundaries[i].size -
+                sizeof(struct Lisp_Cons);
+            if (size_so_far > undo_strong_limit) {
+                stopped = true;
                 break;
-            last_boundary = prev;
-            if (size_so_far > undo_limit)
+            }
+            cut.boundary = i;
+            if (size_so_far > undo_limit) {
+                stopped = true;
                 break;
+            }
         }
+        if (!stopped)
+            size_so_far = log->size - log->dropped;
+    }
+    else if (CONSP(next)) {
+        cut.where = CUT_LIST;
+        cut.prev = prev;
+    }
 
-        /* Add in the space occupied by this element and its chain link.  */
-        size_so_far += sizeof(struct Lisp_Cons);
-        if (CONSP(elt)) {
-            size_so_far += sizeof(struct Lisp_Cons);
-            if (STRINGP(XCAR(elt)))
-                size_so_far +=
-                    (sizeof(struct Lisp_String) - 1 + SCHARS(XCAR(elt)));
+    while (!stopped && CONSP(next)) {
+        Lisp_Object elt;
+        elt = XCAR(next);
+
+        if (NILP(elt)) {
+            if (size_so_far > undo_strong_limit) {
+                stopped = true;
+                break;
+            }
+            cut.where = CUT_LIST;
+            cut.prev = prev;
+            if (size_so_far > undo_limit) {
+                stopped = true;
+                break;
+            }
         }
 
+        size_so_far += undo_element_size(elt);
+
         /* Advance to next element.  */
         prev = next;
         next = XCDR(next);
     }
 
     /* If we scanned the whole list, it is short enough; don't change it.  */
-    if (NILP(next))
+    if (!stopped)
         ;
     /* Truncate at the boundary where we decided to truncate.  */
-    else if (!NILP(last_boundary))
-        XSETCDR(last_boundary, Qnil);
+    else if (cut.where == CUT_LOG) {
+        drop_undo_records(b, cut.boundary);
+        bset_undo_list_tail(b, Qnil);
+    }
+    else if (cut.where == CUT_LIST && CONSP(cut.prev))
+        XSETCDR(cut.prev, Qnil);
+    else if (cut.where == CUT_LIST)
+        bset_undo_list_tail(b, Qnil);
     /* There's nothing we decided to keep, so clear it out.  */
     else
         bset_undo_list(b, Qnil);
@@ -385,10 +917,9 @@ void syms_of_undo(void) {
     /* Marker for function call undo list elements.  */
     DEFSYM(Qapply, "apply");
 
-    pending_boundary = Qnil;
-    staticpro(&pending_boundary);
-
     defsubr(&Sundo_boundary);
+    defsubr(&Sundo__needs_boundary_p);
+    defsubr(&Sundo__pop_boundary);
 
     DEFVAR_INT ("undo-limit", undo_limit,
 	      doc: /* Keep no more undo information once it exceeds this size.
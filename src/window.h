@@ -222,6 +222,10 @@ struct window {
     struct glyph_matrix* current_matrix;
     struct glyph_matrix* desired_matrix;
 
+    /* Rows of text lines displayed in this window, kept for reuse by
+       redisplay.  See the line layout cache in xdisp.c.  */
+    struct layout_cache* layout_cache;
+
     /* Number saying how recently window was selected.  */
     EMACS_INT use_time;
 
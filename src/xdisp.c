@@ -466,6 +466,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
    `buffer_posn_from_coords' in dispnew.c for how this is handled.  */
 
 #include <config.h>
+#include <flexmember.h>
 #include <limits.h>
 #include <math.h>
 #include <stdlib.h>
@@ -1108,6 +1109,7 @@ static void push_it(struct it*, struct text_pos*);
 static void iterate_out_of_display_property(struct it*);
 static void pop_it(struct it*);
 static void redisplay_internal(void);
+static void record_frame(struct timespec);
 static void echo_area_display(bool);
 static void block_buffer_flips(void);
 static void unblock_buffer_flips(void);
@@ -1126,6 +1128,7 @@ static int try_window_id(struct window*);
 static void maybe_produce_line_number(struct it*);
 static bool should_produce_line_number(struct it*);
 static bool display_line(struct it*, int);
+static void maybe_set_cursor_in_row(struct it*, struct glyph_row*);
 static int display_mode_lines(struct window*);
 static int display_mode_line(struct window*, enum face_id, Lisp_Object);
 static int display_mode_element(struct it*, int, int, int, Lisp_Object,
@@ -3998,6 +4001,156 @@ static void handle_stop(struct it* it) {
 }
 
 
+/* Each buffer has a stop index, which records for a stretch of its
+   text the positions where the text properties in it_props change,
+   and where overlays begin or end.  compute_stop_pos consults it
+   instead of walking the interval tree and the overlay tree every
+   time the iterator reaches a stop position, which matters in text
+   with many small intervals, like fontified source code.  The index
+   is built lazily around the position where it is needed.  Changes
+   of text properties and overlays increment the buffer's MODIFF and
+   OVERLAY_MODIFF, respectively, which invalidates the index.  */
+
+/* Number of characters covered by a stop index.  This must be larger
+   than the largest distance compute_stop_pos looks ahead for text
+   property changes.  */
+enum
+{
+    STOP_INDEX_SPAN = 20 * TEXT_PROP_DISTANCE_LIMIT
+};
+
+struct stop_index {
+    /* The text covered is [BEGIN, END).  The index is valid while the
+       buffer's modification counts and ZV are as recorded.  */
+    ptrdiff_t begin, end, zv;
+    modiff_count modiff, overlay_modiff;
+
+    /* Sorted positions in (BEGIN, END) where the text properties in
+       it_props change, and where overlays begin or end.  */
+    ptrdiff_t *prop_stops, *overlay_stops;
+    ptrdiff_t nprop_stops, noverlay_stops;
+    ptrdiff_t prop_stops_size, overlay_stops_size;
+
+    /* The first position >= END where overlays begin or end, or ZV.  */
+    ptrdiff_t overlay_stop_after;
+};
+
+
+/* Free the stop index of buffer B, if any.  */
+
+void free_stop_index(struct buffer* b) {
+    struct stop_index* x = b->stop_index;
+
+    if (x) {
+        xfree(x->prop_stops);
+        xfree(x->overlay_stops);
+        xfree(x);
+        b->stop_index = NULL;
+    }
+}
+
+
+static void push_stop(ptrdiff_t** stops, ptrdiff_t* n, ptrdiff_t* size,
+                      ptrdiff_t pos) {
+    if (*n == *size)
+        *stops = xpalloc(*stops, size, 1, -1, sizeof **stops);
+    (*stops)[(*n)++] = pos;
+}
+
+
+static int compare_stops(const void* a, const void* b) {
+    ptrdiff_t p = *(const ptrdiff_t*)a, q = *(const ptrdiff_t*)b;
+    return (p > q) - (p < q);
+}
+
+
+/* Return the stop index of the current buffer, built so that it
+   covers the text from CHARPOS to LIMIT.  */
+
+static struct stop_index* stop_index_at(ptrdiff_t charpos, ptrdiff_t limit) {
+    struct buffer* b = current_buffer;
+    struct stop_index* x = b->stop_index;
+    INTERVAL iv, next_iv;
+    struct itree_node* node;
+    ptrdiff_t i, n;
+
+    if (x == NULL)
+        x = b->stop_index = xzalloc(sizeof *x);
+    else if (x->modiff == MODIFF && x->overlay_modiff == OVERLAY_MODIFF &&
+             x->zv == ZV && x->begin <= charpos && charpos < x->end &&
+             limit <= x->end)
+        return x;
+
+    /* Cover some text before CHARPOS as well, since bidi reordering
+       makes the iterator move backward, too.  */
+    x->begin = max(BEGV, charpos - STOP_INDEX_SPAN / 8);
+    x->end = max(charpos, limit) + STOP_INDEX_SPAN;
+    x->zv = ZV;
+    x->modiff = MODIFF;
+    x->overlay_modiff = OVERLAY_MODIFF;
+
+    /* Record where the values of the text properties we handle differ
+       from those of the preceding interval.  */
+    x->nprop_stops = 0;
+    iv = buffer_intervals(b) ? find_interval(buffer_intervals(b), x->begin)
+                             : NULL;
+    for (; iv && (next_iv = next_interval(iv)) && next_iv->position < x->end;
+         iv = next_iv) {
+        struct props* p;
+
+        for (p = it_props; p->handler; ++p) {
+            Lisp_Object sym = builtin_lisp_symbol(p->name);
+            if (!EQ(textget(iv->plist, sym), textget(next_iv->plist, sym)))
+                break;
+        }
+
+        if (p->handler && next_iv->position > x->begin)
+            push_stop(&x->prop_stops, &x->nprop_stops, &x->prop_stops_size,
+                      next_iv->position);
+    }
+
+    /* Record where overlays begin and end, in the same way as
+       next_overlay_change, i.e. ignoring the end of empty overlays.  */
+    x->noverlay_stops = 0;
+    ITREE_FOREACH(node, b->overlays, x->begin, x->end, ASCENDING) {
+        if (x->begin < node->begin && node->begin < x->end)
+            push_stop(&x->overlay_stops, &x->noverlay_stops,
+                      &x->overlay_stops_size, node->begin);
+        if (node->begin < node->end && x->begin < node->end &&
+            node->end < x->end)
+            push_stop(&x->overlay_stops, &x->noverlay_stops,
+                      &x->overlay_stops_size, node->end);
+    }
+    qsort(x->overlay_stops, x->noverlay_stops, sizeof *x->overlay_stops,
+          compare_stops);
+    for (i = n = 0; i < x->noverlay_stops; i++)
+        if (n == 0 || x->overlay_stops[n - 1] != x->overlay_stops[i])
+            x->overlay_stops[n++] = x->overlay_stops[i];
+    x->noverlay_stops = n;
+    x->overlay_stop_after = x->end <= ZV ? next_overlay_change(x->end - 1) : ZV;
+
+    return x;
+}
+
+
+/* Return the first of the N sorted positions in STOPS that is greater
+   than CHARPOS, or DFLT if there is none.  */
+
+static ptrdiff_t next_stop(ptrdiff_t* stops, ptrdiff_t n, ptrdiff_t charpos,
+                           ptrdiff_t dflt) {
+    ptrdiff_t lo = 0, hi = n;
+
+    while (lo < hi) {
+        ptrdiff_t mid = lo + (hi - lo) / 2;
+        if (stops[mid] <= charpos)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < n ? stops[lo] : dflt;
+}
+
+
 /* Compute IT->stop_charpos from text property and overlay change
    information for IT's current position.  */
 
@@ -4005,6 +4158,7 @@ static void compute_stop_pos(struct it* it) {
     register INTERVAL iv, next_iv;
     Lisp_Object object, limit, position;
     ptrdiff_t charpos, bytepos, cmp_limit_pos = -1;
+    struct stop_index* index = NULL;
 
     if (STRINGP(it->string)) {
         /* Strings are usually short, so don't limit the search for
@@ -4030,7 +4184,9 @@ static void compute_stop_pos(struct it* it) {
        follows.  */
         charpos = IT_CHARPOS(*it);
         bytepos = IT_BYTEPOS(*it);
-        pos = next_overlay_change(charpos);
+        index = stop_index_at(charpos, charpos + 10 * TEXT_PROP_DISTANCE_LIMIT);
+        pos = min(ZV, next_stop(index->overlay_stops, index->noverlay_stops,
+                                charpos, index->overlay_stop_after));
         if (pos < it->stop_charpos)
             it->stop_charpos = pos;
         /* If we are breaking compositions at point, stop at point.  */
@@ -4081,10 +4237,23 @@ static void compute_stop_pos(struct it* it) {
         limit = make_fixnum(pos);
     }
 
-    /* Get the interval containing IT's position.  Value is a null
-       interval if there isn't such an interval.  */
-    position = make_fixnum(charpos);
-    iv = validate_interval_range(object, &position, &position, false);
+    /* In a buffer, text properties change at the next position in
+       the stop index, but we don't look further than LIMIT.  */
+    if (index) {
+        if (buffer_intervals(current_buffer) && charpos < ZV)
+            it->stop_charpos =
+                min(it->stop_charpos,
+                    min(XFIXNAT(limit),
+                        next_stop(index->prop_stops, index->nprop_stops,
+                                  charpos, XFIXNAT(limit))));
+        iv = NULL;
+    }
+    else {
+        /* Get the interval containing IT's position.  Value is a null
+           interval if there isn't such an interval.  */
+        position = make_fixnum(charpos);
+        iv = validate_interval_range(object, &position, &position, false);
+    }
     if (iv) {
         Lisp_Object values_here[LAST_PROP_IDX];
         struct props* p;
@@ -15722,6 +15891,7 @@ static void redisplay_internal(void) {
 #endif
 
     redisplay_counter++;
+    struct timespec frame_start = monotonic_coarse_timespec();
 
     /* Record a function that clears redisplaying_p
        when we leave this function.  */
@@ -16477,6 +16647,8 @@ end_of_redisplay:
     if (max_redisplay_ticks > 0)
         update_redisplay_ticks(0, NULL);
 
+    record_frame(frame_start);
+
     unbind_to(count, Qnil);
     RESUME_POLLING;
 }
@@ -16520,6 +16692,143 @@ void redisplay_preserve_echo_area(int from_where) {
 }
 
 
+
+/***********************************************************************
+                   Redisplay caused by subprocess output
+ ***********************************************************************/
+
+/* A flood of subprocess output would otherwise redisplay once per
+   read.  Instead, such redisplays are coalesced into frames that are
+   at least 1 / redisplay_max_frame_rate seconds apart, and are put
+   off altogether while keyboard input is pending, since the command
+   loop will redisplay after handling that input anyway.  */
+
+/* Monotonic time when the last complete redisplay started.  */
+static struct timespec last_frame_start;
+
+/* True if a redisplay for subprocess output was put off by the frame
+   rate cap.  It is cleared as soon as that redisplay is attempted or
+   given up, whether or not redisplay_internal then completes a frame,
+   so that a redisplay that returns early cannot leave it set and make
+   wait_reading_process_output poll with a zero timeout.  */
+static bool output_redisplay_deferred;
+
+/* Counters reported by `redisplay-frame-statistics'.  */
+static struct {
+    /* Number of completed calls to redisplay_internal.  */
+    intmax_t frames;
+    /* Redisplays for output folded into a later frame by the rate cap.  */
+    intmax_t coalesced;
+    /* Redisplays for output put off because input was pending.  */
+    intmax_t deferred_for_input;
+    /* Total and largest time spent in redisplay_internal.  */
+    struct timespec total_time, max_time;
+} frame_stats;
+
+/* Return the minimum interval between frames, or an invalid timespec
+   if the frame rate is not capped.  */
+static struct timespec min_frame_interval(void) {
+    if (redisplay_max_frame_rate <= 0)
+        return invalid_timespec();
+    return make_timespec(0, TIMESPEC_HZ / min(redisplay_max_frame_rate,
+                                              TIMESPEC_HZ));
+}
+
+/* Record that a redisplay_internal call which started at monotonic
+   time START has completed.  */
+static void record_frame(struct timespec start) {
+    struct timespec elapsed = timespec_sub(monotonic_coarse_timespec(), start);
+
+    frame_stats.frames++;
+    frame_stats.total_time = timespec_add(frame_stats.total_time, elapsed);
+    if (timespec_cmp(frame_stats.max_time, elapsed) < 0)
+        frame_stats.max_time = elapsed;
+    last_frame_start = start;
+    output_redisplay_deferred = false;
+}
+
+/* Return how long to wait until a deferred redisplay for subprocess
+   output is due, zero if it is due now, or an invalid timespec if no
+   redisplay was deferred.  */
+struct timespec output_redisplay_delay(void) {
+    if (!output_redisplay_deferred)
+        return invalid_timespec();
+
+    struct timespec interval = min_frame_interval();
+    if (!timespec_valid_p(interval))
+        return make_timespec(0, 0);
+
+    struct timespec due = timespec_add(last_frame_start, interval);
+    struct timespec now = monotonic_coarse_timespec();
+    return (timespec_cmp(now, due) < 0 ? timespec_sub(due, now)
+                                       : make_timespec(0, 0));
+}
+
+/* Redisplay to show subprocess output, unless keyboard input is
+   pending or the last frame was too recent, in which case remember to
+   do it later.  FROM_WHERE is as for redisplay_preserve_echo_area.  */
+void redisplay_for_output(int from_where) {
+    /* The command loop redisplays after handling the input, so there
+       is nothing to remember.  */
+    if (detect_input_pending()) {
+        output_redisplay_deferred = false;
+        frame_stats.deferred_for_input++;
+        return;
+    }
+
+    output_redisplay_deferred = true;
+    struct timespec delay = output_redisplay_delay();
+    if (timespec_sign(delay) > 0) {
+        frame_stats.coalesced++;
+        return;
+    }
+
+    output_redisplay_deferred = false;
+    redisplay_preserve_echo_area(from_where);
+}
+
+/* Perform a redisplay for subprocess output that was deferred by
+   redisplay_for_output, if it is due.  */
+void redisplay_deferred_output(int from_where) {
+    struct timespec delay = output_redisplay_delay();
+    if (timespec_valid_p(delay) && timespec_sign(delay) == 0) {
+        output_redisplay_deferred = false;
+        if (!detect_input_pending())
+            redisplay_preserve_echo_area(from_where);
+    }
+}
+
+DEFUN ("redisplay-frame-statistics", Fredisplay_frame_statistics,
+       Sredisplay_frame_statistics, 0, 1, 0,
+       doc: /* Return statistics about redisplay frames as a property list.
+The properties are:
+
+ `:frames'              number of completed redisplays;
+ `:coalesced'           redisplays for subprocess output that were
+                        folded into a later frame because of
+                        `redisplay-max-frame-rate';
+ `:deferred-for-input'  redisplays for subprocess output that were put
+                        off because keyboard input was pending;
+ `:total-time'          seconds spent in redisplay, as a float;
+ `:max-time'            seconds spent in the slowest redisplay.
+
+If RESET is non-nil, reset the statistics to zero after returning
+them.  */)
+(Lisp_Object reset) {
+    Lisp_Object result =
+        list(QCframes, make_int(frame_stats.frames),
+              QCcoalesced, make_int(frame_stats.coalesced),
+              QCdeferred_for_input, make_int(frame_stats.deferred_for_input),
+              QCtotal_time, make_float(timespectod(frame_stats.total_time)),
+              QCmax_time, make_float(timespectod(frame_stats.max_time)));
+
+    if (!NILP(reset))
+        memset(&frame_stats, 0, sizeof frame_stats);
+
+    return result;
+}
+
+
 /* Function registered with record_unwind_protect in redisplay_internal.  */
 
 static void unwind_redisplay(void) {
@@ -19589,6 +19898,335 @@ finish_scroll_bars:
 }
 
 
+/***********************************************************************
+                          Line Layout Cache
+ ***********************************************************************/
+
+/* On terminal frames, each window remembers the glyph rows of text
+   lines it has displayed, keyed by the buffer position at which the
+   line starts, so that lines scrolled out of view and back into view
+   need not be laid out again by try_window.  A cached row is valid
+   as long as the text, overlays and accessible portion of the buffer,
+   the horizontal geometry of the window, the realized faces and the
+   settings recorded by layout_cache_settings stay the same; when any
+   of them changes, all entries of the window are discarded.  Changes
+   to the contents of the display table, `char-width-table' and
+   `glyphless-char-display' discard the entries of all windows, see
+   char_table_changed; `face-remapping-alist' is compared by contents,
+   since it may be changed in place too.
+
+   Only rows that start at the beginning of a line, end at the start
+   of the next one and show nothing but buffer text are cached.  Rows
+   whose appearance depends on point or on their vertical position,
+   like rows with line numbers or highlighted trailing whitespace, are
+   always produced by display_line.  */
+
+/* Number of values recorded by layout_cache_settings.  */
+enum
+{
+    LAYOUT_CACHE_SETTINGS = 16
+};
+
+struct layout_cache_entry {
+    /* The row as produced by display_line.  Its start position is zero
+       if the entry is unused.  The glyph pointers of ROW are not used;
+       the glyphs of its text area are in GLYPHS.  */
+    struct glyph_row row;
+    struct glyph* glyphs;
+    ptrdiff_t glyphs_size;
+};
+
+struct layout_cache {
+    /* What the cached rows were produced with.  FACE_REMAPPING and
+       INVISIBILITY_SPEC are copies of `face-remapping-alist' and
+       `buffer-invisibility-spec', which are often changed in place.  */
+    Lisp_Object settings[LAYOUT_CACHE_SETTINGS];
+    Lisp_Object face_remapping, invisibility_spec;
+    modiff_count modiff, overlay_modiff;
+    ptrdiff_t begv, zv;
+    int first_visible_x, last_visible_x;
+    int base_face_id;
+    enum line_wrap_method line_wrap;
+    unsigned epoch;
+
+    /* The table of entries has 1 << BITS elements.  */
+    int bits;
+    struct layout_cache_entry entries[FLEXIBLE_ARRAY_MEMBER];
+};
+
+/* Incremented to discard the cached rows of all windows.  */
+static unsigned layout_cache_epoch;
+
+
+/* Discard the rows cached by all windows.  Called when the faces they
+   use are freed.  */
+
+void invalidate_layout_caches(void) {
+    layout_cache_epoch++;
+}
+
+
+/* Free the layout cache of window W, if any.  */
+
+void free_layout_cache(struct window* w) {
+    struct layout_cache* c = w->layout_cache;
+
+    if (c) {
+        for (int i = 0; i < 1 << c->bits; i++)
+            xfree(c->entries[i].glyphs);
+        xfree(c);
+        w->layout_cache = NULL;
+    }
+}
+
+
+/* Mark the Lisp objects referenced by the layout cache of W.  The
+   glyphs of cached rows only reference the buffer, which is one of
+   the settings.  */
+
+void mark_layout_cache(struct window* w) {
+    if (w->layout_cache) {
+        mark_objects(w->layout_cache->settings, LAYOUT_CACHE_SETTINGS);
+        mark_object(w->layout_cache->face_remapping);
+        mark_object(w->layout_cache->invisibility_spec);
+    }
+}
+
+
+/* Store in SETTINGS the values of variables that affect the layout
+   of text in IT's window.  */
+
+static void layout_cache_settings(struct it* it, Lisp_Object* settings) {
+    struct Lisp_Char_Table* dp = window_display_table(it->w);
+    int i = 0;
+
+    settings[i++] = it->w->contents;
+    settings[i++] = BVAR(current_buffer, tab_width);
+    settings[i++] = BVAR(current_buffer, ctl_arrow);
+    settings[i++] = BVAR(current_buffer, bidi_display_reordering);
+    settings[i++] = BVAR(current_buffer, bidi_paragraph_direction);
+    settings[i++] = BVAR(current_buffer, enable_multibyte_characters);
+    settings[i++] = dp ? make_lisp_ptr(dp, Lisp_Vectorlike) : Qnil;
+    settings[i++] = Vchar_width_table;
+    settings[i++] = Vglyphless_char_display;
+    settings[i++] = Vnobreak_char_display;
+    settings[i++] = Vline_prefix;
+    settings[i++] = Vwrap_prefix;
+    settings[i++] = display_fill_column_indicator ? Qt : Qnil;
+    settings[i++] = Vdisplay_fill_column_indicator_column;
+    settings[i++] = Vdisplay_fill_column_indicator_character;
+    settings[i++] = BVAR(current_buffer, fill_column);
+    eassert(i == LAYOUT_CACHE_SETTINGS);
+}
+
+
+/* Return a copy of OBJ that shares no conses with it, so that changes
+   made to OBJ in place show when it is compared with the copy.  */
+
+static Lisp_Object layout_cache_copy_tree(Lisp_Object obj) {
+    if (!CONSP(obj))
+        return obj;
+
+    Lisp_Object head = Fcons(layout_cache_copy_tree(XCAR(obj)), Qnil);
+    Lisp_Object last = head, tail = XCDR(obj);
+    FOR_EACH_TAIL_SAFE(tail) {
+        Lisp_Object cell = Fcons(layout_cache_copy_tree(XCAR(tail)), Qnil);
+        XSETCDR(last, cell);
+        last = cell;
+    }
+    XSETCDR(last, tail);
+    return head;
+}
+
+
+/* Return the layout cache to use for the next row of IT, allocating
+   it or discarding its entries as necessary, or null if the row must
+   not be taken from or put into a cache.  */
+
+static struct layout_cache* layout_cache_for(struct it* it) {
+    struct window* w = it->w;
+    struct layout_cache* c = w->layout_cache;
+    Lisp_Object settings[LAYOUT_CACHE_SETTINGS];
+    int bits;
+
+    if (FRAME_WINDOW_P(it->f) || !BUFFERP(w->contents) ||
+        XBUFFER(w->contents) != current_buffer || it->glyph_row == NULL ||
+        !NILP(Vdisplay_line_numbers) ||
+        !NILP(Vshow_trailing_whitespace) ||
+        !NILP(BVAR(current_buffer, selective_display)) ||
+        hscrolling_current_line_p(w) || overlay_arrow_in_current_buffer_p())
+        return NULL;
+
+    /* Make room for a few windowfuls of lines.  */
+    for (bits = 4; 1 << bits < 4 * w->desired_matrix->nrows; bits++)
+        ;
+    if (c && c->bits != bits) {
+        free_layout_cache(w);
+        c = NULL;
+    }
+
+    layout_cache_settings(it, settings);
+    if (c && c->epoch == layout_cache_epoch &&
+        c->modiff == MODIFF && c->overlay_modiff == OVERLAY_MODIFF &&
+        c->begv == BEGV && c->zv == ZV &&
+        c->first_visible_x == it->first_visible_x &&
+        c->last_visible_x == it->last_visible_x &&
+        c->base_face_id == it->base_face_id && c->line_wrap == it->line_wrap &&
+        memcmp(c->settings, settings, sizeof settings) == 0 &&
+        !NILP(Fequal(c->face_remapping, Vface_remapping_alist)) &&
+        !NILP(Fequal(c->invisibility_spec,
+                     BVAR(current_buffer, invisibility_spec))))
+        return c;
+
+    if (c == NULL) {
+        c = xzalloc(FLEXSIZEOF(struct layout_cache, entries,
+                               sizeof *c->entries << bits));
+        c->bits = bits;
+        w->layout_cache = c;
+    }
+    else
+        for (int i = 0; i < 1 << bits; i++)
+            CHARPOS(c->entries[i].row.start.pos) = 0;
+
+    memcpy(c->settings, settings, sizeof settings);
+    c->face_remapping = layout_cache_copy_tree(Vface_remapping_alist);
+    c->invisibility_spec =
+        layout_cache_copy_tree(BVAR(current_buffer, invisibility_spec));
+    c->modiff = MODIFF;
+    c->overlay_modiff = OVERLAY_MODIFF;
+    c->begv = BEGV;
+    c->zv = ZV;
+    c->first_visible_x = it->first_visible_x;
+    c->last_visible_x = it->last_visible_x;
+    c->base_face_id = it->base_face_id;
+    c->line_wrap = it->line_wrap;
+    c->epoch = layout_cache_epoch;
+    return c;
+}
+
+
+/* Return the entry of cache C for a row starting at POS.  */
+
+static struct layout_cache_entry* layout_cache_entry(struct layout_cache* c,
+                                                     struct display_pos* pos) {
+    size_t hash = (size_t)CHARPOS(pos->pos) * 0x9e3779b97f4a7c15u;
+    return &c->entries[hash >> (sizeof hash * CHAR_BIT - c->bits)];
+}
+
+
+/* Value is true if POS is a position at which the iterator delivers
+   buffer text at the beginning of a line.  */
+
+static bool layout_cache_position_p(struct display_pos* pos) {
+    ptrdiff_t charpos = CHARPOS(pos->pos);
+
+    return (pos->overlay_string_index < 0 && CHARPOS(pos->string_pos) < 0 &&
+            pos->dpvec_index < 0 && charpos >= BEGV && charpos < ZV &&
+            (charpos == BEGV || FETCH_BYTE(BYTEPOS(pos->pos) - 1) == '\n'));
+}
+
+
+/* Remember ROW, just produced by display_line from the position
+   START of IT, in the layout cache of IT's window if possible.  */
+
+static void layout_cache_store(struct it* it, struct glyph_row* row,
+                               struct display_pos* start) {
+    struct layout_cache* c = layout_cache_for(it);
+    struct layout_cache_entry* e;
+    struct glyph* glyph = row->glyphs[TEXT_AREA];
+    struct glyph* end = glyph + row->used[TEXT_AREA];
+
+    if (c == NULL || !row->enabled_p || !row->displays_text_p ||
+        row->continued_p || row->ends_at_zv_p || row->ends_in_ellipsis_p ||
+        row->mode_line_p || row->used[LEFT_MARGIN_AREA] ||
+        row->used[RIGHT_MARGIN_AREA] || !layout_cache_position_p(&row->end) ||
+        CHARPOS(row->end.pos) <= CHARPOS(start->pos))
+        return;
+
+    for (; glyph < end; glyph++)
+        if ((glyph->type != CHAR_GLYPH && glyph->type != STRETCH_GLYPH) ||
+            !(BUFFERP(glyph->object) || NILP(glyph->object)))
+            return;
+
+    e = layout_cache_entry(c, start);
+    if (e->glyphs_size < row->used[TEXT_AREA])
+        e->glyphs = xpalloc(e->glyphs, &e->glyphs_size,
+                            row->used[TEXT_AREA] - e->glyphs_size, -1,
+                            sizeof *e->glyphs);
+    memcpy(e->glyphs, row->glyphs[TEXT_AREA],
+           row->used[TEXT_AREA] * sizeof *e->glyphs);
+    e->row = *row;
+}
+
+
+/* Produce the glyph row IT->glyph_row from the layout cache of IT's
+   window, if it has the row starting at IT->start.  Value is true if
+   successful.  In that case IT's row, vertical position and start
+   are advanced as display_line would, but the rest of IT's state is
+   left alone; call layout_cache_reseat before display_line is used
+   again.  */
+
+static bool display_line_from_layout_cache(struct it* it) {
+    struct glyph_row* row = it->glyph_row;
+    struct glyph_matrix* matrix = it->w->desired_matrix;
+    struct layout_cache* c;
+    struct layout_cache_entry* e;
+    struct glyph* glyphs[1 + LAST_AREA];
+    enum
+    {
+        off = offsetof(struct glyph_row, used)
+    };
+
+    if (MATRIX_ROW_VPOS(row, matrix) >= matrix->nrows ||
+        it->continuation_lines_width != 0 ||
+        !layout_cache_position_p(&it->start) ||
+        (c = layout_cache_for(it)) == NULL)
+        return false;
+
+    e = layout_cache_entry(c, &it->start);
+    if (CHARPOS(e->row.start.pos) != CHARPOS(it->start.pos) ||
+        BYTEPOS(e->row.start.pos) != BYTEPOS(it->start.pos) ||
+        e->row.used[TEXT_AREA] >
+            row->glyphs[TEXT_AREA + 1] - row->glyphs[TEXT_AREA])
+        return false;
+
+    /* Copy everything but the pointers to ROW's glyphs, like
+       clear_glyph_row, and then the glyphs.  */
+    prepare_desired_row(it->w, row, false);
+    memcpy(glyphs, row->glyphs, sizeof glyphs);
+    memcpy((char*)row + off, (char*)&e->row + off, sizeof *row - off);
+    memcpy(row->glyphs, glyphs, sizeof glyphs);
+    memcpy(row->glyphs[TEXT_AREA], e->glyphs,
+           row->used[TEXT_AREA] * sizeof *e->glyphs);
+    row->y = it->current_y;
+    row->line_hash_p = false;
+
+    maybe_set_cursor_in_row(it, row);
+
+    it->current_y += row->height;
+    ++it->vpos;
+    ++it->glyph_row;
+    if (it->glyph_row < MATRIX_BOTTOM_TEXT_ROW(matrix, it->w))
+        it->glyph_row->reversed_p = row->reversed_p;
+    it->start = row->end;
+    return true;
+}
+
+
+/* Set up IT to continue after ROW, the last of a series of rows taken
+   from the layout cache, keeping IT's row and vertical position.  */
+
+static void layout_cache_reseat(struct it* it, struct glyph_row* row) {
+    struct glyph_row* glyph_row = it->glyph_row;
+    int vpos = it->vpos, current_y = it->current_y;
+
+    init_to_row_end(it, it->w, row);
+    it->glyph_row = glyph_row;
+    it->vpos = vpos;
+    it->current_y = current_y;
+}
+
+
 /* Build the complete desired matrix of WINDOW with a window start
    buffer position POS.
 
@@ -19613,6 +20251,7 @@ int try_window(Lisp_Object window, struct text_pos pos, int flags) {
     struct glyph_row* last_text_row = NULL;
     struct frame* f = XFRAME(w->frame);
     int cursor_vpos = w->cursor.vpos;
+    bool reseat_p = false;
 
     /* Make POS the new window start.  */
     set_marker_both(w->start, Qnil, CHARPOS(pos), BYTEPOS(pos));
@@ -19625,12 +20264,31 @@ int try_window(Lisp_Object window, struct text_pos pos, int flags) {
     start_display(&it, w, pos);
     it.glyph_row->reversed_p = false;
 
-    /* Display all lines of W.  */
+    /* Display all lines of W, taking the rows of lines displayed
+       before from the window's layout cache where possible.  */
     while (it.current_y < it.last_visible_y) {
         int last_row_scale = it.w->nrows_scale_factor;
         int last_col_scale = it.w->ncols_scale_factor;
+        if (display_line_from_layout_cache(&it)) {
+            last_text_row = it.glyph_row - 1;
+            reseat_p = true;
+            continue;
+        }
+        if (reseat_p) {
+            layout_cache_reseat(&it, it.glyph_row - 1);
+            reseat_p = false;
+        }
+        struct glyph_row* row = it.glyph_row;
+        struct display_pos start = it.start;
+        bool cacheable_p = (it.method == GET_FROM_BUFFER && it.sp == 0);
+        modiff_count modiff = MODIFF;
         if (display_line(&it, cursor_vpos))
             last_text_row = it.glyph_row - 1;
+        /* Rows produced while fontification functions changed the
+           buffer can show some text with stale faces.  */
+        if (cacheable_p && modiff == MODIFF && !f->fonts_changed &&
+            it.glyph_row > row)
+            layout_cache_store(&it, row, &start);
         if (f->fonts_changed &&
             !((flags & TRY_WINDOW_IGNORE_FONTS_CHANGE)
               /* If the matrix dimensions are insufficient, we _must_
@@ -19639,6 +20297,8 @@ int try_window(Lisp_Object window, struct text_pos pos, int flags) {
               last_col_scale == it.w->ncols_scale_factor))
             return 0;
     }
+    if (reseat_p)
+        layout_cache_reseat(&it, it.glyph_row - 1);
 
     /* Save the character position of 'it' before we call
        'start_display' again.  */
@@ -23308,6 +23968,29 @@ static bool row_text_area_empty(struct glyph_row* row) {
     return true;
 }
 
+/* Set the cursor of IT's window from ROW, a row that was just
+   produced in its desired matrix, if point is displayed in ROW.  */
+
+static void maybe_set_cursor_in_row(struct it* it, struct glyph_row* row) {
+    int cvpos = it->w->cursor.vpos;
+
+    if ((cvpos < 0
+         /* In bidi-reordered rows, keep checking for proper cursor
+        position even if one has been found already, because buffer
+        positions in such rows change non-linearly with ROW->VPOS,
+        when a line is continued.  One exception: when we are at ZV,
+        display cursor on the first suitable glyph row, since all
+        the empty rows after that also have their position set to ZV.  */
+         /* FIXME: Revisit this when glyph ``spilling'' in continuation
+        lines' rows is implemented for bidi-reordered rows.  */
+         || (it->bidi_p &&
+             !MATRIX_ROW(it->w->desired_matrix, cvpos)->ends_at_zv_p)) &&
+        PT >= MATRIX_ROW_START_CHARPOS(row) &&
+        PT <= MATRIX_ROW_END_CHARPOS(row) && cursor_row_p(row))
+        set_cursor_from_row(it->w, row, it->w->desired_matrix, 0, 0, 0, 0);
+}
+
+
 /* Construct the glyph row IT->glyph_row in the desired matrix of
    IT->w from text at the current position of IT.  See dispextern.h
    for an overview of struct it.  Value is true if
@@ -23328,7 +24011,6 @@ static bool display_line(struct it* it, int cursor_vpos) {
     int wrap_row_extra_line_spacing UNINIT;
     ptrdiff_t wrap_row_min_pos UNINIT, wrap_row_min_bpos UNINIT;
     ptrdiff_t wrap_row_max_pos UNINIT, wrap_row_max_bpos UNINIT;
-    int cvpos;
     ptrdiff_t min_pos = ZV + 1, max_pos = 0;
     ptrdiff_t min_bpos UNINIT, max_bpos UNINIT;
     bool pending_handle_line_prefix = false;
@@ -24214,21 +24896,7 @@ static bool display_line(struct it* it, int cursor_vpos) {
         row->redraw_fringe_bitmaps_p = true;
 
     /* Maybe set the cursor.  */
-    cvpos = it->w->cursor.vpos;
-    if ((cvpos < 0
-         /* In bidi-reordered rows, keep checking for proper cursor
-        position even if one has been found already, because buffer
-        positions in such rows change non-linearly with ROW->VPOS,
-        when a line is continued.  One exception: when we are at ZV,
-        display cursor on the first suitable glyph row, since all
-        the empty rows after that also have their position set to ZV.  */
-         /* FIXME: Revisit this when glyph ``spilling'' in continuation
-        lines' rows is implemented for bidi-reordered rows.  */
-         || (it->bidi_p &&
-             !MATRIX_ROW(it->w->desired_matrix, cvpos)->ends_at_zv_p)) &&
-        PT >= MATRIX_ROW_START_CHARPOS(row) &&
-        PT <= MATRIX_ROW_END_CHARPOS(row) && cursor_row_p(row))
-        set_cursor_from_row(it->w, row, it->w->desired_matrix, 0, 0, 0, 0);
+    maybe_set_cursor_in_row(it, row);
 
     /* Prepare for the next line.  This line starts horizontally at (X
        HPOS) = (0 0).  Vertical positions are incremented.  As a
@@ -34525,6 +35193,7 @@ be let-bound around code that needs to disable messages temporarily. */);
     staticpro(&message_dolog_marker3);
 
     defsubr(&Sset_buffer_redisplay);
+    defsubr(&Sredisplay_frame_statistics);
 #ifdef GLYPH_DEBUG
     defsubr(&Sdump_frame_glyph_matrix);
     defsubr(&Sdump_glyph_matrix);
@@ -35599,6 +36268,24 @@ The recommended non-zero value is between 100000 and 1000000,
 depending on your patience and the speed of your system.  */);
     max_redisplay_ticks = 0;
 
+    DEFVAR_INT ("redisplay-max-frame-rate", redisplay_max_frame_rate,
+    doc: /* Maximum number of redisplays per second caused by subprocess output.
+When output from subprocesses arrives faster than this, the redisplays
+it would cause are coalesced, so that the display is updated at most
+this many times per second.  Redisplay caused by keyboard input is not
+limited, and takes precedence: while input is pending, redisplay for
+subprocess output is put off entirely.
+
+A value of zero or less means no limit.
+See also `redisplay-frame-statistics'.  */);
+    redisplay_max_frame_rate = 60;
+
+    DEFSYM(QCframes, ":frames");
+    DEFSYM(QCcoalesced, ":coalesced");
+    DEFSYM(QCdeferred_for_input, ":deferred-for-input");
+    DEFSYM(QCtotal_time, ":total-time");
+    DEFSYM(QCmax_time, ":max-time");
+
     /* Called by decode_mode_spec.  */
     DEFSYM(Qfile_remote_p, "file-remote-p");
 
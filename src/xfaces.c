@@ -2920,8 +2920,10 @@ static void free_realized_faces(struct face_cache* c) {
             c->faces_by_id[i] = NULL;
         }
 
-        /* Forget the escape-glyph and glyphless-char faces.  */
+        /* Forget the escape-glyph and glyphless-char faces, and the
+           rows cached by redisplay that use any of the faces.  */
         forget_escape_and_glyphless_faces();
+        invalidate_layout_caches();
         c->used = 0;
         size = FACE_CACHE_BUCKETS_SIZE * sizeof *c->buckets;
         memset(c->buckets, 0, size);